@@ -15,7 +15,10 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cstdio>
+
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/test/floating_point_comparison.hpp>
@@ -392,6 +395,140 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test concurrent generation and caching of coefficients, which should reproduce the serially generated coefficients.
+BOOST_AUTO_TEST_CASE( testConcurrentAndCachedCoefficientGeneration )
+{
+    // Create test capsule.
+    boost::shared_ptr< geometric_shapes::Capsule > capsule
+            = boost::make_shared< geometric_shapes::Capsule >(
+                4.694, 1.956, 2.662, -1.0 * 33.0 * PI / 180.0, 0.196 );
+
+    std::vector< int > numberOfLines( 4, 21 );
+    std::vector< int > numberOfPoints( 4, 21 );
+    std::vector< bool > invertOrders( 4, 0 );
+    Eigen::Vector3d momentReference( -0.6624, 0.0, -0.1369 );
+
+    std::vector< std::vector< double > > independentVariableDataPoints( 3 );
+    independentVariableDataPoints[ 0 ] = getDefaultHypersonicLocalInclinationMachPoints( "Full" );
+    for ( int i = 0; i < 13; i++ )
+    {
+        independentVariableDataPoints[ 1 ].push_back( static_cast< double >( i - 6 ) * 2.5 * PI / 180.0 );
+    }
+    independentVariableDataPoints[ 2 ] = getDefaultHypersonicLocalInclinationAngleOfSideslipPoints( );
+
+    std::vector< std::vector< int > > selectedMethods( 2, std::vector< int >( 4 ) );
+    selectedMethods[ 0 ][ 0 ] = 1;
+    selectedMethods[ 0 ][ 1 ] = 5;
+    selectedMethods[ 0 ][ 2 ] = 5;
+    selectedMethods[ 0 ][ 3 ] = 1;
+    selectedMethods[ 1 ][ 0 ] = 6;
+    selectedMethods[ 1 ][ 1 ] = 3;
+    selectedMethods[ 1 ][ 2 ] = 4;
+    selectedMethods[ 1 ][ 3 ] = 0;
+
+    const double referenceArea = PI * pow( capsule->getMiddleRadius( ), 2.0 );
+    const std::string cacheFile = ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                                        "hypersonicLocalInclinationCoefficients-%%%%-%%%%.dat" ) ).string( );
+
+    // Generate coefficients serially, concurrently, and concurrently with caching (twice, reading them from the cache
+    // file the second time), and with caching for a different reference area.
+    std::vector< boost::shared_ptr< HypersonicLocalInclinationAnalysis > > coefficientInterfaces;
+    coefficientInterfaces.push_back(
+                boost::make_shared< HypersonicLocalInclinationAnalysis >(
+                    independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                    invertOrders, selectedMethods, referenceArea, 3.9116, momentReference ) );
+    coefficientInterfaces.push_back(
+                boost::make_shared< HypersonicLocalInclinationAnalysis >(
+                    independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                    invertOrders, selectedMethods, referenceArea, 3.9116, momentReference, 4 ) );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        coefficientInterfaces.push_back(
+                    boost::make_shared< HypersonicLocalInclinationAnalysis >(
+                        independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                        invertOrders, selectedMethods, referenceArea, 3.9116, momentReference, 3, cacheFile ) );
+    }
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > scaledCoefficientInterface =
+            boost::make_shared< HypersonicLocalInclinationAnalysis >(
+                independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                invertOrders, selectedMethods, 2.0 * referenceArea, 3.9116, momentReference, 1, cacheFile );
+
+    // Check that only the second analysis with caching read its coefficients from the cache file.
+    for( unsigned int i = 0; i < coefficientInterfaces.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( coefficientInterfaces.at( i )->areCoefficientsReadFromCacheFile( ), ( i == 3 ) );
+    }
+    BOOST_CHECK( !scaledCoefficientInterface->areCoefficientsReadFromCacheFile( ) );
+
+    BOOST_CHECK_EQUAL( coefficientInterfaces.at( 0 )->computeCoefficientsCacheKey( ),
+                       coefficientInterfaces.at( 3 )->computeCoefficientsCacheKey( ) );
+    BOOST_CHECK( coefficientInterfaces.at( 0 )->computeCoefficientsCacheKey( ) !=
+                 scaledCoefficientInterface->computeCoefficientsCacheKey( ) );
+
+    // Compare coefficients of all interfaces.
+    boost::array< int, 3 > independentVariables;
+    for( unsigned int i = 0; i < independentVariableDataPoints[ 0 ].size( ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( unsigned int j = 0; j < independentVariableDataPoints[ 1 ].size( ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( unsigned int k = 0; k < independentVariableDataPoints[ 2 ].size( ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+                Vector6d expectedCoefficients =
+                        coefficientInterfaces.at( 0 )->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( unsigned int l = 1; l < coefficientInterfaces.size( ); l++ )
+                {
+                    Vector6d currentCoefficients =
+                            coefficientInterfaces.at( l )->getAerodynamicCoefficientsDataPoint( independentVariables );
+                    for( unsigned int m = 0; m < 6; m++ )
+                    {
+                        BOOST_CHECK_EQUAL( currentCoefficients( m ), expectedCoefficients( m ) );
+                    }
+                }
+
+                Vector6d scaledCoefficients =
+                        scaledCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( unsigned int m = 0; m < 6; m++ )
+                {
+                    BOOST_CHECK_SMALL( scaledCoefficients( m ) - expectedCoefficients( m ) / 2.0,
+                                       1.0E-15 * std::max( std::fabs( expectedCoefficients( m ) ), 1.0 ) );
+                }
+            }
+        }
+    }
+
+    // Check panel inclinations at given attitude against direct computation from surface normals.
+    const double angleOfAttack = 10.0 * PI / 180.0;
+    const double angleOfSideslip = 2.0 * PI / 180.0;
+    const Eigen::Vector3d freestreamVelocityDirection(
+                std::cos( angleOfAttack ) * std::cos( angleOfSideslip ), std::sin( angleOfSideslip ),
+                std::sin( angleOfAttack ) * std::cos( angleOfSideslip ) );
+    coefficientInterfaces.at( 0 )->determineInclinations( angleOfAttack, angleOfSideslip );
+    const std::vector< std::vector< std::vector< double > > >& panelInclinations =
+            coefficientInterfaces.at( 0 )->getPanelInclinations( );
+    BOOST_CHECK_EQUAL( panelInclinations.size( ), 4 );
+    for( unsigned int k = 0; k < panelInclinations.size( ); k++ )
+    {
+        boost::shared_ptr< geometric_shapes::LawgsPartGeometry > vehiclePart =
+                coefficientInterfaces.at( 0 )->getVehiclePart( k );
+        BOOST_CHECK_EQUAL( panelInclinations.at( k ).size( ), vehiclePart->getNumberOfLines( ) - 1 );
+        for( int i = 0; i < vehiclePart->getNumberOfLines( ) - 1; i++ )
+        {
+            BOOST_CHECK_EQUAL( panelInclinations.at( k ).at( i ).size( ), vehiclePart->getNumberOfPoints( ) - 1 );
+            for( int j = 0; j < vehiclePart->getNumberOfPoints( ) - 1; j++ )
+            {
+                BOOST_CHECK_SMALL( panelInclinations.at( k ).at( i ).at( j ) - (
+                                       PI / 2.0 - std::acos( vehiclePart->getPanelSurfaceNormal( i, j ).dot(
+                                                                 freestreamVelocityDirection ) ) ), 1.0E-15 );
+            }
+        }
+    }
+
+    std::remove( cacheFile.c_str( ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,220 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/fusedTabulatedAtmosphere.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace aerodynamics;
+
+BOOST_AUTO_TEST_SUITE( test_fused_tabulated_atmosphere )
+
+//! Check if fused tabulated atmosphere reproduces results of tabulated atmosphere with separate interpolators.
+BOOST_AUTO_TEST_CASE( testFusedTabulatedAtmosphereAgainstTabulatedAtmosphere )
+{
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        // Define atmosphere file and dependent variables for current test case.
+        std::string atmosphereFile = input_output::getAtmosphereTablesPath( ) +
+                "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat";
+        std::vector< TabulatedAtmosphere::AtmosphereDependentVariables > dependentVariables =
+        { TabulatedAtmosphere::density_dependent_atmosphere, TabulatedAtmosphere::pressure_dependent_atmosphere,
+          TabulatedAtmosphere::temperature_dependent_atmosphere };
+        if( testCase == 1 )
+        {
+            dependentVariables = { TabulatedAtmosphere::pressure_dependent_atmosphere,
+                                   TabulatedAtmosphere::density_dependent_atmosphere,
+                                   TabulatedAtmosphere::temperature_dependent_atmosphere };
+        }
+        else if( testCase == 2 )
+        {
+            atmosphereFile = input_output::getAtmosphereTablesPath( ) +
+                    "USSA1976Until100kmPer100mUntil1000kmPer1000m_wHR_GC.dat";
+            dependentVariables.push_back( TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere );
+            dependentVariables.push_back( TabulatedAtmosphere::gas_constant_dependent_atmosphere );
+        }
+
+        TabulatedAtmosphere tabulatedAtmosphere( atmosphereFile, dependentVariables );
+        FusedTabulatedAtmosphere fusedAtmosphere( atmosphereFile, dependentVariables );
+        BOOST_CHECK_EQUAL( fusedAtmosphere.getNumberOfTabulatedProperties( ),
+                           static_cast< int >( dependentVariables.size( ) ) );
+
+        // Compare properties at altitudes throughout table (in non-monotonic order).
+        for( int i = 0; i < 1000; i++ )
+        {
+            const double altitude = 500.0E3 + 495.0E3 * std::sin( 0.37 * static_cast< double >( i ) );
+            const double time = static_cast< double >( i );
+
+            const FusedAtmosphericProperties& properties =
+                    fusedAtmosphere.getAtmosphericProperties( altitude, 0.0, 0.0, time );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        properties( TabulatedAtmosphere::density_dependent_atmosphere ),
+                        tabulatedAtmosphere.getDensity( altitude ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        properties( TabulatedAtmosphere::pressure_dependent_atmosphere ),
+                        tabulatedAtmosphere.getPressure( altitude ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        properties( TabulatedAtmosphere::temperature_dependent_atmosphere ),
+                        tabulatedAtmosphere.getTemperature( altitude ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        properties( TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere ),
+                        tabulatedAtmosphere.getRatioOfSpecificHeats( altitude ), 1.0E-12 );
+
+            // Check if single-property functions give same result.
+            BOOST_CHECK_EQUAL( fusedAtmosphere.getDensity( altitude, 0.0, 0.0, time ),
+                               properties( TabulatedAtmosphere::density_dependent_atmosphere ) );
+            BOOST_CHECK_EQUAL( fusedAtmosphere.getPressure( altitude, 0.0, 0.0, time ),
+                               properties( TabulatedAtmosphere::pressure_dependent_atmosphere ) );
+            BOOST_CHECK_EQUAL( fusedAtmosphere.getTemperature( altitude, 0.0, 0.0, time ),
+                               properties( TabulatedAtmosphere::temperature_dependent_atmosphere ) );
+        }
+
+        // Check specific gas constant and speed of sound.
+        if( testCase == 2 )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( fusedAtmosphere.getSpecificGasConstant( 1.0E3 ), 8.0,
+                                        std::numeric_limits< double >::epsilon( ) );
+            BOOST_CHECK_CLOSE_FRACTION( fusedAtmosphere.getSpeedOfSound( 1.0E3 ),
+                                        std::sqrt( 1.7 * 8.0 * fusedAtmosphere.getTemperature( 1.0E3 ) ),
+                                        1.0E-14 );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( fusedAtmosphere.getSpecificGasConstant( 1.0E3 ),
+                               physical_constants::SPECIFIC_GAS_CONSTANT_AIR );
+            BOOST_CHECK_CLOSE_FRACTION( fusedAtmosphere.getSpeedOfSound( 1.0E3 ),
+                                        tabulatedAtmosphere.getSpeedOfSound( 1.0E3 ), 1.0E-12 );
+        }
+    }
+
+    // Check if incomplete list of dependent variables is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        FusedTabulatedAtmosphere fusedAtmosphere(
+                    input_output::getAtmosphereTablesPath( ) + "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat",
+                    { TabulatedAtmosphere::density_dependent_atmosphere,
+                      TabulatedAtmosphere::pressure_dependent_atmosphere } );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Function with which multi-dimensional test tables are filled (multi-linear in independent variables).
+double getTestTableValue( const int propertyIndex, const double altitude, const double longitude,
+                          const double latitude, const double time )
+{
+    return static_cast< double >( propertyIndex + 1 ) * ( 1.0 + 1.0E-5 * altitude ) * ( 2.0 - 0.1 * longitude ) *
+            ( 3.0 + 0.5 * latitude ) * ( 1.0 + 1.0E-3 * time );
+}
+
+//! Check if multi-dimensional fused tabulated atmosphere correctly interpolates all properties
+BOOST_AUTO_TEST_CASE( testMultiDimensionalFusedTabulatedAtmosphere )
+{
+    // Define grid of independent variables (order different from function argument order).
+    std::vector< AtmosphereIndependentVariables > independentVariables =
+    { time_dependent_atmosphere, altitude_dependent_atmosphere, latitude_dependent_atmosphere,
+      longitude_dependent_atmosphere };
+    std::vector< std::vector< double > > independentVariableValues =
+    { { 0.0, 100.0, 250.0 }, { 0.0, 1.0E4, 3.0E4, 5.0E4, 1.0E5 }, { -1.5, 0.0, 1.5 }, { -3.0, -1.0, 1.0, 3.0 } };
+
+    // Fill tables with function that is multi-linear in independent variables (reproduced exactly by interpolation).
+    std::vector< TabulatedAtmosphere::AtmosphereDependentVariables > dependentVariables =
+    { TabulatedAtmosphere::temperature_dependent_atmosphere, TabulatedAtmosphere::density_dependent_atmosphere,
+      TabulatedAtmosphere::gas_constant_dependent_atmosphere, TabulatedAtmosphere::pressure_dependent_atmosphere };
+    std::vector< boost::multi_array< double, 4 > > dependentVariableValues;
+    for( unsigned int j = 0; j < dependentVariables.size( ); j++ )
+    {
+        boost::multi_array< double, 4 > currentTable( boost::extents[ 3 ][ 5 ][ 3 ][ 4 ] );
+        for( int i0 = 0; i0 < 3; i0++ )
+        {
+            for( int i1 = 0; i1 < 5; i1++ )
+            {
+                for( int i2 = 0; i2 < 3; i2++ )
+                {
+                    for( int i3 = 0; i3 < 4; i3++ )
+                    {
+                        currentTable[ i0 ][ i1 ][ i2 ][ i3 ] = getTestTableValue(
+                                    dependentVariables.at( j ), independentVariableValues[ 1 ][ i1 ],
+                                independentVariableValues[ 3 ][ i3 ], independentVariableValues[ 2 ][ i2 ],
+                                independentVariableValues[ 0 ][ i0 ] );
+                    }
+                }
+            }
+        }
+        dependentVariableValues.push_back( currentTable );
+    }
+
+    MultiDimensionalFusedTabulatedAtmosphere< 4 > fusedAtmosphere(
+                independentVariableValues, dependentVariableValues, independentVariables, dependentVariables,
+                287.0, 1.3 );
+
+    // Compare interpolated properties with exact values, changing only a single independent variable at a time.
+    for( int i = 0; i < 200; i++ )
+    {
+        const double altitude = 5.0E4 + 4.9E4 * std::sin( 0.21 * static_cast< double >( i ) );
+        const double longitude = ( i % 4 == 1 ) ? -2.0 : 2.5;
+        const double latitude = ( i % 4 == 2 ) ? 1.2 : -0.3;
+        const double time = ( i % 4 == 3 ) ? 30.0 : 200.0;
+
+        const FusedAtmosphericProperties& properties =
+                fusedAtmosphere.getAtmosphericProperties( altitude, longitude, latitude, time );
+        for( unsigned int j = 0; j < dependentVariables.size( ); j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION(
+                        properties( dependentVariables.at( j ) ),
+                        getTestTableValue( dependentVariables.at( j ), altitude, longitude, latitude, time ),
+                        1.0E-14 );
+        }
+        BOOST_CHECK_EQUAL( properties( TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere ), 1.3 );
+
+        BOOST_CHECK_EQUAL( fusedAtmosphere.getDensity( altitude, longitude, latitude, time ),
+                           properties( TabulatedAtmosphere::density_dependent_atmosphere ) );
+        BOOST_CHECK_CLOSE_FRACTION( fusedAtmosphere.getSpeedOfSound( altitude, longitude, latitude, time ),
+                                    std::sqrt( 1.3 * properties( TabulatedAtmosphere::gas_constant_dependent_atmosphere ) *
+                                               properties( TabulatedAtmosphere::temperature_dependent_atmosphere ) ),
+                                    1.0E-15 );
+    }
+
+    // Check if inconsistent table size is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        independentVariableValues[ 1 ].pop_back( );
+        MultiDimensionalFusedTabulatedAtmosphere< 4 > inconsistentAtmosphere(
+                    independentVariableValues, dependentVariableValues, independentVariables, dependentVariables );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,143 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00SurrogateAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace aerodynamics;
+
+using mathematical_constants::PI;
+
+BOOST_AUTO_TEST_SUITE( test_nrlmsise00_surrogate_atmosphere )
+
+//! Check conversion between longitude and local solar time.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00SurrogateLocalSolarTime )
+{
+    // 21-06-2030, 08:03:20 UT
+    const double time = basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 8, 3, 20.0 ),
+                basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    BOOST_CHECK_CLOSE_FRACTION( NRLMSISE00SurrogateAtmosphere::computeLocalSolarTime( 0.0, time ),
+                                8.0 + 3.0 / 60.0 + 20.0 / 3600.0, 1.0E-8 );
+    BOOST_CHECK_CLOSE_FRACTION( NRLMSISE00SurrogateAtmosphere::computeLocalSolarTime( PI / 2.0, time ),
+                                14.0 + 3.0 / 60.0 + 20.0 / 3600.0, 1.0E-8 );
+    BOOST_CHECK_CLOSE_FRACTION( NRLMSISE00SurrogateAtmosphere::computeLocalSolarTime( -PI / 2.0, time ),
+                                2.0 + 3.0 / 60.0 + 20.0 / 3600.0, 1.0E-8 );
+
+    for( int i = 0; i < 100; i++ )
+    {
+        const double longitude = -PI + 2.0 * PI * ( static_cast< double >( i ) + 0.5 ) / 100.0;
+        BOOST_CHECK_SMALL( NRLMSISE00SurrogateAtmosphere::computeLongitudeFromLocalSolarTime(
+                               NRLMSISE00SurrogateAtmosphere::computeLocalSolarTime( longitude, time ), time ) -
+                           longitude, 1.0E-12 );
+    }
+}
+
+//! Check surrogate model against full NRLMSISE-00 model.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00SurrogateAgainstFullModel )
+{
+    // Load space weather data (21-06-2030 and 22-06-2030 are used).
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            input_output::solar_activity::readSolarActivityData( folder + "swAtmosTestNoAdjust.txt" );
+
+    const double startTime = basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 2, 0, 0.0 ),
+                basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    const double endTime = startTime + 1.5 * physical_constants::JULIAN_DAY;
+
+    // Create surrogate model on coarse grid.
+    const double maximumRelativeDensityError = 0.05;
+    NRLMSISE00SurrogateSettings surrogateSettings(
+                startTime, endTime, 100.0E3, 600.0E3, 10.0E3, 15.0 * PI / 180.0, 2.0, 6.0 * 3600.0,
+                maximumRelativeDensityError, 3, 500 );
+    boost::shared_ptr< NRLMSISE00SurrogateAtmosphere > surrogateModel =
+            createNRLMSISE00SurrogateAtmosphere( solarActivityData, surrogateSettings );
+
+    // Check if validation during creation met required accuracy.
+    NRLMSISE00SurrogateValidationResults validationResults = surrogateModel->getValidationResults( );
+    BOOST_CHECK_EQUAL( validationResults.numberOfSamples_, 500 );
+    BOOST_CHECK( validationResults.maximumRelativeDensityError_ <= maximumRelativeDensityError );
+    BOOST_CHECK( validationResults.rmsRelativeDensityError_ <= validationResults.maximumRelativeDensityError_ );
+
+    // Check time grid, which should cover both days.
+    std::vector< double > timeGrid = surrogateModel->getGridValues( 3 );
+    BOOST_CHECK( timeGrid.front( ) <= startTime );
+    BOOST_CHECK( timeGrid.back( ) >= endTime );
+
+    // Create full model, and validate surrogate with independent samples.
+    boost::function< NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            boost::bind( &nrlmsiseInputFunction, _1, _2, _3, _4, solarActivityData, false, TUDAT_NAN );
+    NRLMSISE00Atmosphere fullModel( inputFunction );
+
+    NRLMSISE00SurrogateValidationResults independentValidationResults =
+            validateNRLMSISE00SurrogateAtmosphere( *surrogateModel, fullModel, 500, 42 );
+    BOOST_CHECK( independentValidationResults.maximumRelativeDensityError_ <= 2.0 * maximumRelativeDensityError );
+
+    // Compare properties at a number of conditions, and check consistency of surrogate properties.
+    for( int i = 0; i < 20; i++ )
+    {
+        const double altitude = 350.0E3 + 240.0E3 * std::sin( 0.7 * static_cast< double >( i ) );
+        const double longitude = PI * std::sin( 1.3 * static_cast< double >( i ) );
+        const double latitude = 1.5 * std::cos( 0.4 * static_cast< double >( i ) );
+        const double time = startTime + 0.07 * physical_constants::JULIAN_DAY * static_cast< double >( i );
+
+        const double density = surrogateModel->getDensity( altitude, longitude, latitude, time );
+        const double temperature = surrogateModel->getTemperature( altitude, longitude, latitude, time );
+        const double meanMolarMass = surrogateModel->getMeanMolarMass( altitude, longitude, latitude, time );
+
+        BOOST_CHECK_CLOSE_FRACTION( density, fullModel.getDensity( altitude, longitude, latitude, time ),
+                                    2.0 * maximumRelativeDensityError );
+        BOOST_CHECK_CLOSE_FRACTION( temperature, fullModel.getTemperature( altitude, longitude, latitude, time ),
+                                    2.0 * maximumRelativeDensityError );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    surrogateModel->getPressure( altitude, longitude, latitude, time ),
+                    density * physical_constants::MOLAR_GAS_CONSTANT * temperature / meanMolarMass, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    surrogateModel->getSpeedOfSound( altitude, longitude, latitude, time ),
+                    std::sqrt( fullModel.getSpecificHeatRatio( ) * physical_constants::MOLAR_GAS_CONSTANT *
+                               temperature / meanMolarMass ), 1.0E-14 );
+    }
+
+    // Check if time outside of tabulated interval is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        surrogateModel->getDensity( 400.0E3, 0.0, 0.0, timeGrid.back( ) + physical_constants::JULIAN_DAY );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,205 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "Tudat/InputOutput/matrixTextFileReader.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+
+#include "Tudat/Astrodynamics/Aerodynamics/fusedTabulatedAtmosphere.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Constructor
+FusedTabulatedAtmosphereModel::FusedTabulatedAtmosphereModel(
+        const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+        const double specificGasConstant, const double ratioOfSpecificHeats ):
+    dependentVariables_( dependentVariables ),
+    numberOfTabulatedProperties_( dependentVariables.size( ) ),
+    currentAltitude_( TUDAT_NAN ), currentLongitude_( TUDAT_NAN ),
+    currentLatitude_( TUDAT_NAN ), currentTime_( TUDAT_NAN )
+{
+    // Set constant properties; tabulated properties are overwritten upon first evaluation.
+    currentProperties_.setConstant( TUDAT_NAN );
+    currentProperties_( TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere ) = ratioOfSpecificHeats;
+    currentProperties_( TabulatedAtmosphere::gas_constant_dependent_atmosphere ) = specificGasConstant;
+
+    // Set index of each tabulated property, and check if each property is provided at most once.
+    std::vector< bool > isPropertyTabulated( numberOfFusedAtmosphericProperties, false );
+    for( unsigned int i = 0; i < dependentVariables_.size( ); i++ )
+    {
+        const int currentPropertyIndex = static_cast< int >( dependentVariables_.at( i ) );
+        if( currentPropertyIndex < 0 || currentPropertyIndex >= numberOfFusedAtmosphericProperties )
+        {
+            throw std::runtime_error( "Error, dependent variable " + std::to_string( currentPropertyIndex ) +
+                                      " not found in fused tabulated atmosphere" );
+        }
+        else if( isPropertyTabulated.at( currentPropertyIndex ) )
+        {
+            throw std::runtime_error( "Error, dependent variable " + std::to_string( currentPropertyIndex ) +
+                                      " provided multiple times to fused tabulated atmosphere" );
+        }
+        isPropertyTabulated[ currentPropertyIndex ] = true;
+        propertyIndices_.push_back( currentPropertyIndex );
+    }
+
+    if( !isPropertyTabulated.at( TabulatedAtmosphere::density_dependent_atmosphere ) ||
+            !isPropertyTabulated.at( TabulatedAtmosphere::pressure_dependent_atmosphere ) ||
+            !isPropertyTabulated.at( TabulatedAtmosphere::temperature_dependent_atmosphere ) )
+    {
+        throw std::runtime_error(
+                    "Error, fused tabulated atmosphere must be initialized with at least temperature, pressure and density" );
+    }
+}
+
+//! Constructor from atmosphere table file.
+FusedTabulatedAtmosphere::FusedTabulatedAtmosphere(
+        const std::string& atmosphereTableFile,
+        const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+        const double specificGasConstant,
+        const double ratioOfSpecificHeats,
+        const interpolators::AvailableLookupScheme selectedLookupScheme ):
+    FusedTabulatedAtmosphereModel( dependentVariables, specificGasConstant, ratioOfSpecificHeats )
+{
+    Eigen::MatrixXd atmosphereTableFileData = input_output::readMatrixFromFile( atmosphereTableFile, " \t", "%" );
+
+    // Check whether data is present in the file.
+    if( atmosphereTableFileData.rows( ) < 1 || atmosphereTableFileData.cols( ) < 1 )
+    {
+        throw std::runtime_error( "The atmosphere table file " + atmosphereTableFile + " is empty" );
+    }
+    else if( atmosphereTableFileData.cols( ) < numberOfTabulatedProperties_ + 1 )
+    {
+        throw std::runtime_error( "The atmosphere table file " + atmosphereTableFile +
+                                  " contains fewer columns than dependent variables" );
+    }
+
+    altitudes_.resize( atmosphereTableFileData.rows( ) );
+    for( int i = 0; i < atmosphereTableFileData.rows( ); i++ )
+    {
+        altitudes_[ i ] = atmosphereTableFileData( i, 0 );
+    }
+
+    initialize( atmosphereTableFileData.block( 0, 1, atmosphereTableFileData.rows( ), numberOfTabulatedProperties_ ),
+                selectedLookupScheme );
+}
+
+//! Constructor from tabulated data.
+FusedTabulatedAtmosphere::FusedTabulatedAtmosphere(
+        const std::vector< double >& altitudes,
+        const Eigen::MatrixXd& dependentVariableValues,
+        const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+        const double specificGasConstant,
+        const double ratioOfSpecificHeats,
+        const interpolators::AvailableLookupScheme selectedLookupScheme ):
+    FusedTabulatedAtmosphereModel( dependentVariables, specificGasConstant, ratioOfSpecificHeats ),
+    altitudes_( altitudes )
+{
+    if( dependentVariableValues.rows( ) != static_cast< int >( altitudes_.size( ) ) ||
+            dependentVariableValues.cols( ) != numberOfTabulatedProperties_ )
+    {
+        throw std::runtime_error( "Error when creating fused tabulated atmosphere, size of data is inconsistent" );
+    }
+
+    initialize( dependentVariableValues, selectedLookupScheme );
+}
+
+//! Function to set the interleaved data and second derivatives from tabulated data.
+void FusedTabulatedAtmosphere::initialize(
+        const Eigen::MatrixXd& dependentVariableValues,
+        const interpolators::AvailableLookupScheme selectedLookupScheme )
+{
+    const int numberOfNodes = altitudes_.size( );
+    if( numberOfNodes < 3 )
+    {
+        throw std::runtime_error( "Error when creating fused tabulated atmosphere, at least 3 altitudes are required" );
+    }
+    else if( !std::is_sorted( altitudes_.begin( ), altitudes_.end( ) ) )
+    {
+        throw std::runtime_error(
+                    "Error when creating fused tabulated atmosphere, altitudes should be in ascending order" );
+    }
+
+    // Store data with all properties at single altitude in a single column.
+    interleavedPropertyValues_ = dependentVariableValues.transpose( );
+
+    // Set tridiagonal system for second derivatives of natural cubic spline (Press W.H., et al., 2002), with all
+    // properties solved for simultaneously.
+    std::vector< double > subDiagonal( numberOfNodes - 2, 0.0 );
+    std::vector< double > diagonal( numberOfNodes - 2 );
+    std::vector< double > superDiagonal( numberOfNodes - 2, 0.0 );
+    std::vector< Eigen::VectorXd > rightHandSide( numberOfNodes - 2 );
+    for( int i = 0; i < numberOfNodes - 2; i++ )
+    {
+        const double lowerStep = altitudes_[ i + 1 ] - altitudes_[ i ];
+        const double upperStep = altitudes_[ i + 2 ] - altitudes_[ i + 1 ];
+        if( i < numberOfNodes - 3 )
+        {
+            subDiagonal[ i ] = upperStep;
+            superDiagonal[ i ] = upperStep;
+        }
+        diagonal[ i ] = 2.0 * ( lowerStep + upperStep );
+        rightHandSide[ i ] = 6.0 * (
+                    ( interleavedPropertyValues_.col( i + 2 ) - interleavedPropertyValues_.col( i + 1 ) ) / upperStep -
+                    ( interleavedPropertyValues_.col( i + 1 ) - interleavedPropertyValues_.col( i ) ) / lowerStep );
+    }
+
+    std::vector< Eigen::VectorXd > middleSecondDerivatives =
+            interpolators::solveTridiagonalMatrixEquation< double, Eigen::VectorXd >(
+                subDiagonal, diagonal, superDiagonal, rightHandSide );
+
+    // Set second derivatives, with zero values at end points (natural spline condition).
+    interleavedSecondDerivatives_.setZero( numberOfTabulatedProperties_, numberOfNodes );
+    for( int i = 1; i < numberOfNodes - 1; i++ )
+    {
+        interleavedSecondDerivatives_.col( i ) = middleSecondDerivatives.at( i - 1 );
+    }
+
+    lookUpScheme_ = interpolators::createLookupScheme< double >( altitudes_, selectedLookupScheme );
+}
+
+//! Function to compute all atmospheric properties at given altitude, and set them in currentProperties_.
+void FusedTabulatedAtmosphere::computeAtmosphericProperties(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    TUDAT_UNUSED_PARAMETER( longitude );
+    TUDAT_UNUSED_PARAMETER( latitude );
+    TUDAT_UNUSED_PARAMETER( time );
+
+    // Determine altitude interval (single look-up for all properties).
+    const int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( altitude );
+    const double lowerAltitude = altitudes_[ lowerEntry ];
+    const double upperAltitude = altitudes_[ lowerEntry + 1 ];
+
+    // Calculate cubic spline coefficients A, B, C, D (see Press W.H., et al., 2002).
+    const double squareDifference = ( upperAltitude - lowerAltitude ) * ( upperAltitude - lowerAltitude );
+    const double coefficientA = ( upperAltitude - altitude ) / ( upperAltitude - lowerAltitude );
+    const double coefficientB = 1.0 - coefficientA;
+    const double coefficientC = ( coefficientA * coefficientA * coefficientA - coefficientA ) / 6.0 * squareDifference;
+    const double coefficientD = ( coefficientB * coefficientB * coefficientB - coefficientB ) / 6.0 * squareDifference;
+
+    // Evaluate all properties from consecutive entries in data.
+    const double* lowerValues = interleavedPropertyValues_.col( lowerEntry ).data( );
+    const double* upperValues = interleavedPropertyValues_.col( lowerEntry + 1 ).data( );
+    const double* lowerSecondDerivatives = interleavedSecondDerivatives_.col( lowerEntry ).data( );
+    const double* upperSecondDerivatives = interleavedSecondDerivatives_.col( lowerEntry + 1 ).data( );
+    for( int j = 0; j < numberOfTabulatedProperties_; j++ )
+    {
+        currentProperties_( propertyIndices_[ j ] ) =
+                coefficientA * lowerValues[ j ] + coefficientB * upperValues[ j ] +
+                coefficientC * lowerSecondDerivatives[ j ] + coefficientD * upperSecondDerivatives[ j ];
+    }
+}
+
+} // namespace aerodynamics
+} // namespace tudat
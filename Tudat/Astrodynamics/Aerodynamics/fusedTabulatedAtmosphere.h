@@ -0,0 +1,556 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press W.H., et al. Numerical Recipes in C++: The Art of Scientific Computing. Cambridge
+ *          University Press, February 2002.
+ *
+ */
+
+#ifndef TUDAT_FUSED_TABULATED_ATMOSPHERE_H
+#define TUDAT_FUSED_TABULATED_ATMOSPHERE_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Number of atmospheric properties that can be provided by a fused tabulated atmosphere
+/*!
+ *  Number of atmospheric properties that can be provided by a fused tabulated atmosphere, equal to the number of
+ *  entries in the TabulatedAtmosphere::AtmosphereDependentVariables enum.
+ */
+static const int numberOfFusedAtmosphericProperties = 5;
+
+//! Typedef for vector containing all properties of a fused tabulated atmosphere.
+/*!
+ *  Typedef for vector containing all properties of a fused tabulated atmosphere, where the entry at index i corresponds
+ *  to TabulatedAtmosphere::AtmosphereDependentVariables entry i (density, pressure, temperature, ratio of specific
+ *  heats and specific gas constant).
+ */
+typedef Eigen::Matrix< double, numberOfFusedAtmosphericProperties, 1 > FusedAtmosphericProperties;
+
+//! List of independent variables of which a multi-dimensional tabulated atmosphere can be a function.
+enum AtmosphereIndependentVariables
+{
+    altitude_dependent_atmosphere = 0,
+    longitude_dependent_atmosphere = 1,
+    latitude_dependent_atmosphere = 2,
+    time_dependent_atmosphere = 3
+};
+
+//! Base class for tabulated atmospheres in which all properties are retrieved from a single table look-up.
+/*!
+ *  Base class for tabulated atmospheres in which all properties are retrieved from a single table look-up. The data
+ *  of all properties is stored interleaved per table node, so that the interval in which the independent variables
+ *  lie needs to be determined only once, after which all properties are computed together. The properties at the most
+ *  recent independent variables are stored, so that subsequent requests for different properties at the same
+ *  conditions (as done by the AtmosphericFlightConditions class) do not require a new interpolation.
+ */
+class FusedTabulatedAtmosphereModel : public AtmosphereModel
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param dependentVariables The dependent variables, in order, contained in the table.
+     *  \param specificGasConstant The constant specific gas constant of the air (used if not tabulated)
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air (used if not tabulated)
+     */
+    FusedTabulatedAtmosphereModel(
+            const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+            const double specificGasConstant, const double ratioOfSpecificHeats );
+
+    //! Destructor
+    virtual ~FusedTabulatedAtmosphereModel( ){ }
+
+    //! Function to retrieve all atmospheric properties at given conditions.
+    /*!
+     *  Function to retrieve all atmospheric properties at given conditions, from a single table look-up.
+     *  \param altitude Altitude at which properties are to be computed.
+     *  \param longitude Longitude at which properties are to be computed.
+     *  \param latitude Latitude at which properties are to be computed.
+     *  \param time Time at which properties are to be computed.
+     *  \return Vector of atmospheric properties, with entries ordered as TabulatedAtmosphere::AtmosphereDependentVariables
+     *  (reference to internal variable, which is modified by next call to this object).
+     */
+    const FusedAtmosphericProperties& getAtmosphericProperties(
+            const double altitude, const double longitude = 0.0,
+            const double latitude = 0.0, const double time = 0.0 )
+    {
+        if( !( altitude == currentAltitude_ && longitude == currentLongitude_ &&
+               latitude == currentLatitude_ && time == currentTime_ ) )
+        {
+            computeAtmosphericProperties( altitude, longitude, latitude, time );
+
+            currentAltitude_ = altitude;
+            currentLongitude_ = longitude;
+            currentLatitude_ = latitude;
+            currentTime_ = time;
+        }
+        return currentProperties_;
+    }
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere in kg per meter^3.
+     *  \param altitude Altitude at which density is to be computed.
+     *  \param longitude Longitude at which density is to be computed.
+     *  \param latitude Latitude at which density is to be computed.
+     *  \param time Time at which density is to be computed.
+     *  \return Atmospheric density at specified conditions.
+     */
+    double getDensity( const double altitude, const double longitude = 0.0,
+                       const double latitude = 0.0, const double time = 0.0 )
+    {
+        return getAtmosphericProperties( altitude, longitude, latitude, time )(
+                    TabulatedAtmosphere::density_dependent_atmosphere );
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere in Newton per meter^2.
+     *  \param altitude Altitude at which pressure is to be computed.
+     *  \param longitude Longitude at which pressure is to be computed.
+     *  \param latitude Latitude at which pressure is to be computed.
+     *  \param time Time at which pressure is to be computed.
+     *  \return Atmospheric pressure at specified conditions.
+     */
+    double getPressure( const double altitude, const double longitude = 0.0,
+                        const double latitude = 0.0, const double time = 0.0 )
+    {
+        return getAtmosphericProperties( altitude, longitude, latitude, time )(
+                    TabulatedAtmosphere::pressure_dependent_atmosphere );
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere in Kelvin.
+     *  \param altitude Altitude at which temperature is to be computed.
+     *  \param longitude Longitude at which temperature is to be computed.
+     *  \param latitude Latitude at which temperature is to be computed.
+     *  \param time Time at which temperature is to be computed.
+     *  \return Atmospheric temperature at specified conditions.
+     */
+    double getTemperature( const double altitude, const double longitude = 0.0,
+                           const double latitude = 0.0, const double time = 0.0 )
+    {
+        return getAtmosphericProperties( altitude, longitude, latitude, time )(
+                    TabulatedAtmosphere::temperature_dependent_atmosphere );
+    }
+
+    //! Get local ratio of specific heats.
+    /*!
+     *  Returns the local ratio of specific heats of the atmosphere.
+     *  \param altitude Altitude at which ratio of specific heats is to be computed.
+     *  \param longitude Longitude at which ratio of specific heats is to be computed.
+     *  \param latitude Latitude at which ratio of specific heats is to be computed.
+     *  \param time Time at which ratio of specific heats is to be computed.
+     *  \return Ratio of specific heats at specified conditions.
+     */
+    double getRatioOfSpecificHeats( const double altitude, const double longitude = 0.0,
+                                    const double latitude = 0.0, const double time = 0.0 )
+    {
+        return getAtmosphericProperties( altitude, longitude, latitude, time )(
+                    TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere );
+    }
+
+    //! Get local specific gas constant.
+    /*!
+     *  Returns the local specific gas constant of the atmosphere in J/(kg K).
+     *  \param altitude Altitude at which specific gas constant is to be computed.
+     *  \param longitude Longitude at which specific gas constant is to be computed.
+     *  \param latitude Latitude at which specific gas constant is to be computed.
+     *  \param time Time at which specific gas constant is to be computed.
+     *  \return Specific gas constant at specified conditions.
+     */
+    double getSpecificGasConstant( const double altitude, const double longitude = 0.0,
+                                   const double latitude = 0.0, const double time = 0.0 )
+    {
+        return getAtmosphericProperties( altitude, longitude, latitude, time )(
+                    TabulatedAtmosphere::gas_constant_dependent_atmosphere );
+    }
+
+    //! Get local speed of sound in the atmosphere.
+    /*!
+     *  Returns the speed of sound in the atmosphere in m/s, computed from the local temperature, ratio of specific
+     *  heats and specific gas constant.
+     *  \param altitude Altitude at which speed of sound is to be computed.
+     *  \param longitude Longitude at which speed of sound is to be computed.
+     *  \param latitude Latitude at which speed of sound is to be computed.
+     *  \param time Time at which speed of sound is to be computed.
+     *  \return Atmospheric speed of sound at specified conditions.
+     */
+    double getSpeedOfSound( const double altitude, const double longitude = 0.0,
+                            const double latitude = 0.0, const double time = 0.0 )
+    {
+        const FusedAtmosphericProperties& properties =
+                getAtmosphericProperties( altitude, longitude, latitude, time );
+        return computeSpeedOfSound(
+                    properties( TabulatedAtmosphere::temperature_dependent_atmosphere ),
+                    properties( TabulatedAtmosphere::specific_heat_ratio_dependent_atmosphere ),
+                    properties( TabulatedAtmosphere::gas_constant_dependent_atmosphere ) );
+    }
+
+    //! Function to retrieve the number of tabulated properties
+    /*!
+     *  Function to retrieve the number of tabulated properties (i.e. number of entries per table node)
+     *  \return Number of tabulated properties
+     */
+    int getNumberOfTabulatedProperties( )
+    {
+        return numberOfTabulatedProperties_;
+    }
+
+protected:
+
+    //! Function to compute all atmospheric properties at given conditions, and set them in currentProperties_.
+    /*!
+     *  Function to compute all atmospheric properties at given conditions, and set them in currentProperties_. Only
+     *  the entries of tabulated properties are to be modified, other entries contain the constant values.
+     *  \param altitude Altitude at which properties are to be computed.
+     *  \param longitude Longitude at which properties are to be computed.
+     *  \param latitude Latitude at which properties are to be computed.
+     *  \param time Time at which properties are to be computed.
+     */
+    virtual void computeAtmosphericProperties(
+            const double altitude, const double longitude, const double latitude, const double time ) = 0;
+
+    //! List of dependent variables, in the order in which they are stored per table node.
+    std::vector< TabulatedAtmosphere::AtmosphereDependentVariables > dependentVariables_;
+
+    //! Number of tabulated properties (i.e. number of entries per table node)
+    int numberOfTabulatedProperties_;
+
+    //! Index in FusedAtmosphericProperties vector of each tabulated property.
+    std::vector< int > propertyIndices_;
+
+    //! Atmospheric properties at current independent variables.
+    FusedAtmosphericProperties currentProperties_;
+
+private:
+
+    //! Altitude at which currentProperties_ were computed.
+    double currentAltitude_;
+
+    //! Longitude at which currentProperties_ were computed.
+    double currentLongitude_;
+
+    //! Latitude at which currentProperties_ were computed.
+    double currentLatitude_;
+
+    //! Time at which currentProperties_ were computed.
+    double currentTime_;
+};
+
+//! Tabulated atmosphere, as a function of altitude, with all properties retrieved from a single look-up.
+/*!
+ *  Tabulated atmosphere, as a function of altitude, with all properties retrieved from a single look-up. The
+ *  properties are interpolated by natural cubic splines (Press W.H., et al., 2002), and are identical to those
+ *  obtained from the TabulatedAtmosphere class, which uses a separate interpolator (and look-up) per property.
+ */
+class FusedTabulatedAtmosphere : public FusedTabulatedAtmosphereModel
+{
+public:
+
+    //! Constructor from atmosphere table file.
+    /*!
+     *  Constructor from atmosphere table file.
+     *  \param atmosphereTableFile File containing atmospheric properties, with the altitude in the first column,
+     *  and the dependent variables in the subsequent columns (see TabulatedAtmosphere).
+     *  \param dependentVariables The dependent variables, in order, contained in the file.
+     *  \param specificGasConstant The constant specific gas constant of the air (used if not tabulated)
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air (used if not tabulated)
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding altitude interval
+     */
+    FusedTabulatedAtmosphere(
+            const std::string& atmosphereTableFile,
+            const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables =
+    { TabulatedAtmosphere::density_dependent_atmosphere, TabulatedAtmosphere::pressure_dependent_atmosphere,
+      TabulatedAtmosphere::temperature_dependent_atmosphere },
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4,
+            const interpolators::AvailableLookupScheme selectedLookupScheme = interpolators::huntingAlgorithm );
+
+    //! Constructor from tabulated data.
+    /*!
+     *  Constructor from tabulated data.
+     *  \param altitudes Altitudes at which the atmospheric properties are tabulated, in ascending order.
+     *  \param dependentVariableValues Matrix with tabulated properties, each row containing the properties at the
+     *  altitude with the same index, and each column containing the property from dependentVariables with the same
+     *  index.
+     *  \param dependentVariables The dependent variables, in order, contained in the columns of
+     *  dependentVariableValues
+     *  \param specificGasConstant The constant specific gas constant of the air (used if not tabulated)
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air (used if not tabulated)
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding altitude interval
+     */
+    FusedTabulatedAtmosphere(
+            const std::vector< double >& altitudes,
+            const Eigen::MatrixXd& dependentVariableValues,
+            const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4,
+            const interpolators::AvailableLookupScheme selectedLookupScheme = interpolators::huntingAlgorithm );
+
+    //! Destructor
+    ~FusedTabulatedAtmosphere( ){ }
+
+protected:
+
+    //! Function to compute all atmospheric properties at given altitude, and set them in currentProperties_.
+    /*!
+     *  Function to compute all atmospheric properties at given altitude, and set them in currentProperties_.
+     *  \param altitude Altitude at which properties are to be computed.
+     *  \param longitude Longitude at which properties are to be computed (unused).
+     *  \param latitude Latitude at which properties are to be computed (unused).
+     *  \param time Time at which properties are to be computed (unused).
+     */
+    void computeAtmosphericProperties(
+            const double altitude, const double longitude, const double latitude, const double time );
+
+private:
+
+    //! Function to set the interleaved data and second derivatives from tabulated data.
+    /*!
+     *  Function to set the interleaved data and second derivatives (for natural cubic spline) from tabulated data.
+     *  \param dependentVariableValues Matrix with tabulated properties (see constructor).
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding altitude interval
+     */
+    void initialize( const Eigen::MatrixXd& dependentVariableValues,
+                     const interpolators::AvailableLookupScheme selectedLookupScheme );
+
+    //! Altitudes at which the atmospheric properties are tabulated.
+    std::vector< double > altitudes_;
+
+    //! Tabulated properties, with all properties at a single altitude stored consecutively (one column per altitude).
+    Eigen::MatrixXd interleavedPropertyValues_;
+
+    //! Second derivatives of cubic spline of tabulated properties, ordered as interleavedPropertyValues_.
+    Eigen::MatrixXd interleavedSecondDerivatives_;
+
+    //! Look-up scheme used to find altitude interval.
+    boost::shared_ptr< interpolators::LookUpScheme< double > > lookUpScheme_;
+};
+
+//! Typedef for shared-pointer to FusedTabulatedAtmosphere object.
+typedef boost::shared_ptr< FusedTabulatedAtmosphere > FusedTabulatedAtmospherePointer;
+
+//! Tabulated atmosphere, as a function of multiple independent variables, with all properties retrieved from a single
+//! look-up.
+/*!
+ *  Tabulated atmosphere, as a function of multiple independent variables (any combination of altitude, longitude,
+ *  latitude and time), with all properties retrieved from a single look-up. The properties are interpolated by
+ *  multi-linear interpolation, with the same weights used for each of the properties.
+ *  \tparam NumberOfDimensions Number of independent variables of table.
+ */
+template< unsigned int NumberOfDimensions >
+class MultiDimensionalFusedTabulatedAtmosphere : public FusedTabulatedAtmosphereModel
+{
+public:
+
+    //! Constructor from tabulated data.
+    /*!
+     *  Constructor from tabulated data.
+     *  \param independentVariableValues Values of independent variables at which atmospheric properties are tabulated
+     *  (one vector per independent variable, each in ascending order).
+     *  \param dependentVariableValues Tabulated atmospheric properties (one multi-array per dependent variable), with
+     *  the index of each dimension referring to the entry in independentVariableValues.
+     *  \param independentVariables The independent variables of the table, in the order in which they are given in
+     *  independentVariableValues.
+     *  \param dependentVariables The dependent variables, in the order in which they are given in
+     *  dependentVariableValues.
+     *  \param specificGasConstant The constant specific gas constant of the air (used if not tabulated)
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air (used if not tabulated)
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding intervals of independent variables
+     */
+    MultiDimensionalFusedTabulatedAtmosphere(
+            const std::vector< std::vector< double > >& independentVariableValues,
+            const std::vector< boost::multi_array< double, NumberOfDimensions > >& dependentVariableValues,
+            const std::vector< AtmosphereIndependentVariables >& independentVariables,
+            const std::vector< TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables,
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4,
+            const interpolators::AvailableLookupScheme selectedLookupScheme = interpolators::huntingAlgorithm ):
+        FusedTabulatedAtmosphereModel( dependentVariables, specificGasConstant, ratioOfSpecificHeats ),
+        independentVariableValues_( independentVariableValues ), independentVariables_( independentVariables )
+    {
+        // Check input consistency
+        if( independentVariableValues_.size( ) != NumberOfDimensions ||
+                independentVariables_.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error when creating multi-dimensional fused tabulated atmosphere, number of independent variables is inconsistent" );
+        }
+
+        if( static_cast< int >( dependentVariableValues.size( ) ) != numberOfTabulatedProperties_ )
+        {
+            throw std::runtime_error(
+                        "Error when creating multi-dimensional fused tabulated atmosphere, number of dependent variables is inconsistent" );
+        }
+
+        // Set strides of independent variables in interleaved data, and check size of data
+        int numberOfNodes = 1;
+        for( int i = NumberOfDimensions - 1; i >= 0; i-- )
+        {
+            if( independentVariableValues_.at( i ).size( ) < 2 )
+            {
+                throw std::runtime_error(
+                            "Error when creating multi-dimensional fused tabulated atmosphere, at least 2 values required per independent variable" );
+            }
+
+            if( !std::is_sorted( independentVariableValues_.at( i ).begin( ), independentVariableValues_.at( i ).end( ) ) )
+            {
+                throw std::runtime_error(
+                            "Error when creating multi-dimensional fused tabulated atmosphere, independent variables must be in ascending order" );
+            }
+
+            for( int j = 0; j < numberOfTabulatedProperties_; j++ )
+            {
+                if( dependentVariableValues.at( j ).shape( )[ i ] != independentVariableValues_.at( i ).size( ) )
+                {
+                    throw std::runtime_error(
+                                "Error when creating multi-dimensional fused tabulated atmosphere, size of dependent and independent variables is inconsistent" );
+                }
+            }
+
+            nodeStrides_[ i ] = numberOfNodes;
+            numberOfNodes *= independentVariableValues_.at( i ).size( );
+        }
+
+        // Set interleaved data.
+        interleavedPropertyValues_.resize( numberOfTabulatedProperties_, numberOfNodes );
+        for( int j = 0; j < numberOfTabulatedProperties_; j++ )
+        {
+            const double* currentPropertyValues = dependentVariableValues.at( j ).data( );
+            for( int k = 0; k < numberOfNodes; k++ )
+            {
+                interleavedPropertyValues_( j, k ) = currentPropertyValues[ k ];
+            }
+        }
+
+        // Set offsets in interleaved data of corners of hyper-rectangle in which interpolation is performed.
+        for( unsigned int k = 0; k < numberOfCorners_; k++ )
+        {
+            cornerOffsets_[ k ] = 0;
+            for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+            {
+                if( ( k >> i ) & 1 )
+                {
+                    cornerOffsets_[ k ] += nodeStrides_[ i ];
+                }
+            }
+        }
+
+        // Create look-up schemes.
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            lookUpSchemes_[ i ] = interpolators::createLookupScheme< double >(
+                        independentVariableValues_.at( i ), selectedLookupScheme );
+        }
+    }
+
+    //! Destructor
+    ~MultiDimensionalFusedTabulatedAtmosphere( ){ }
+
+protected:
+
+    //! Function to compute all atmospheric properties at given conditions, and set them in currentProperties_.
+    /*!
+     *  Function to compute all atmospheric properties at given conditions, and set them in currentProperties_, using
+     *  a single look-up per independent variable, and a single set of interpolation weights for all properties.
+     *  \param altitude Altitude at which properties are to be computed.
+     *  \param longitude Longitude at which properties are to be computed.
+     *  \param latitude Latitude at which properties are to be computed.
+     *  \param time Time at which properties are to be computed.
+     */
+    void computeAtmosphericProperties(
+            const double altitude, const double longitude, const double latitude, const double time )
+    {
+        const double conditions[ 4 ] = { altitude, longitude, latitude, time };
+
+        // Determine interval, and fraction in interval, of each independent variable.
+        int lowerNodeIndex = 0;
+        boost::array< double, NumberOfDimensions > upperFractions;
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            const double currentValue = conditions[ independentVariables_[ i ] ];
+            const int lowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour( currentValue );
+            const double lowerValue = independentVariableValues_[ i ][ lowerIndex ];
+            upperFractions[ i ] = ( currentValue - lowerValue ) /
+                    ( independentVariableValues_[ i ][ lowerIndex + 1 ] - lowerValue );
+            lowerNodeIndex += lowerIndex * nodeStrides_[ i ];
+        }
+
+        // Add contributions of all corners of hyper-rectangle.
+        for( int j = 0; j < numberOfTabulatedProperties_; j++ )
+        {
+            currentProperties_( propertyIndices_[ j ] ) = 0.0;
+        }
+        for( unsigned int k = 0; k < numberOfCorners_; k++ )
+        {
+            double cornerWeight = 1.0;
+            for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+            {
+                cornerWeight *= ( ( k >> i ) & 1 ) ? upperFractions[ i ] : ( 1.0 - upperFractions[ i ] );
+            }
+
+            const double* cornerValues = interleavedPropertyValues_.col( lowerNodeIndex + cornerOffsets_[ k ] ).data( );
+            for( int j = 0; j < numberOfTabulatedProperties_; j++ )
+            {
+                currentProperties_( propertyIndices_[ j ] ) += cornerWeight * cornerValues[ j ];
+            }
+        }
+    }
+
+private:
+
+    //! Number of corners of hyper-rectangle in which interpolation is performed.
+    static const unsigned int numberOfCorners_ = 1 << NumberOfDimensions;
+
+    //! Values of independent variables at which atmospheric properties are tabulated.
+    std::vector< std::vector< double > > independentVariableValues_;
+
+    //! The independent variables of the table
+    std::vector< AtmosphereIndependentVariables > independentVariables_;
+
+    //! Tabulated properties, with all properties at a single node stored consecutively (one column per node).
+    Eigen::MatrixXd interleavedPropertyValues_;
+
+    //! Difference in node index (column of interleavedPropertyValues_) for increment in each independent variable.
+    boost::array< int, NumberOfDimensions > nodeStrides_;
+
+    //! Difference in node index w.r.t. lower node of each corner of hyper-rectangle in which interpolation is performed.
+    boost::array< int, ( 1 << NumberOfDimensions ) > cornerOffsets_;
+
+    //! Look-up schemes used to find interval of each independent variable.
+    boost::array< boost::shared_ptr< interpolators::LookUpScheme< double > >, NumberOfDimensions > lookUpSchemes_;
+};
+
+} // namespace aerodynamics
+} // namespace tudat
+
+#endif // TUDAT_FUSED_TABULATED_ATMOSPHERE_H
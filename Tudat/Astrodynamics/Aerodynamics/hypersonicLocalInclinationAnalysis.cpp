@@ -13,11 +13,15 @@
  *
  */
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <string>
+#include <thread>
 
 #include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/function.hpp>
-#include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
@@ -42,6 +46,43 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+namespace
+{
+
+//! Identifier written at the start of a coefficients cache file.
+const char coefficientsCacheFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'L', 'I' };
+
+//! Function returning a pressure coefficient that is independent of panel inclination.
+double getConstantPressureCoefficient( const double, const double pressureCoefficient )
+{
+    return pressureCoefficient;
+}
+
+//! Function to add a block of data to a FNV-1a hash.
+void addToFnvHash( boost::uint64_t& hash, const void* data, const std::size_t numberOfBytes )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < numberOfBytes; i++ )
+    {
+        hash ^= static_cast< boost::uint64_t >( bytes[ i ] );
+        hash *= 1099511628211ULL;
+    }
+}
+
+//! Function to add a double to a FNV-1a hash.
+void addToFnvHash( boost::uint64_t& hash, const double value )
+{
+    addToFnvHash( hash, &value, sizeof( double ) );
+}
+
+//! Function to add an integer to a FNV-1a hash.
+void addToFnvHash( boost::uint64_t& hash, const int value )
+{
+    addToFnvHash( hash, &value, sizeof( int ) );
+}
+
+} // namespace
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -126,15 +167,19 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< int > >& selectedMethods,
         const double referenceArea,
         const double referenceLength,
-        const Eigen::Vector3d& momentReferencePoint )
+        const Eigen::Vector3d& momentReferencePoint,
+        const unsigned int numberOfThreads,
+        const std::string& coefficientsCacheFile )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint,
           boost::assign::list_of( mach_number_dependent )( angle_of_attack_dependent )
           ( angle_of_sideslip_dependent ), 1, 0 ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
-      selectedMethods_( selectedMethods )
+      selectedMethods_( selectedMethods ),
+      numberOfThreads_( numberOfThreads ),
+      coefficientsCacheFile_( coefficientsCacheFile ),
+      areCoefficientsReadFromCacheFile_( false )
 {
     // Set geometry if it is a single surface.
     if ( boost::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
@@ -204,32 +249,6 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
-    {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
-        {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-        }
-    }
-
-    boost::array< int, 3 > numberOfPointsPerIndependentVariables;
-    for( int i = 0; i < 3; i++ )
-    {
-        numberOfPointsPerIndependentVariables[ i ] =
-                dataPointsOfIndependentVariables_[ i ].size( );
-    }
-
-    isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
-
-    std::fill( isCoefficientGenerated_.origin( ),
-               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
-
     generateCoefficients( );
     createInterpolator( );
 }
@@ -238,223 +257,324 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
 Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint(
         const boost::array< int, 3 > independentVariables )
 {
-    if( isCoefficientGenerated_( independentVariables ) == 0 )
-    {
-        determineVehicleCoefficients( independentVariables );
-    }
-
-    // Return requested coefficients.
+    // Return requested coefficients (all coefficients are generated upon construction).
     return aerodynamicCoefficients_( independentVariables );
-
 }
 
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    // Read coefficients from cache file, if available.
+    areCoefficientsReadFromCacheFile_ = false;
+    if( coefficientsCacheFile_ != "" )
+    {
+        areCoefficientsReadFromCacheFile_ = readCoefficientsFromCacheFile( );
+    }
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    if( !areCoefficientsReadFromCacheFile_ )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        // Iterate over all attitudes (combinations of angle of attack and sideslip), on a single or multiple threads.
+        const unsigned int numberOfAttitudes =
+                dataPointsOfIndependentVariables_[ 1 ].size( ) * dataPointsOfIndependentVariables_[ 2 ].size( );
+        unsigned int numberOfThreads = ( numberOfThreads_ == 0 ) ?
+                    std::max( std::thread::hardware_concurrency( ), 1u ) : numberOfThreads_;
+        numberOfThreads = std::max( std::min( numberOfThreads, numberOfAttitudes ), 1u );
+
+        std::atomic< unsigned int > nextAttitudeIndex( 0 );
+        std::vector< std::exception_ptr > generationErrors( numberOfThreads );
+        if( numberOfThreads == 1 )
+        {
+            generateCoefficientsForAttitudes( nextAttitudeIndex, generationErrors.at( 0 ) );
+        }
+        else
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            std::vector< std::thread > generationThreads;
+            for( unsigned int i = 0; i < numberOfThreads; i++ )
+            {
+                generationThreads.push_back(
+                            std::thread( &HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitudes, this,
+                                         std::ref( nextAttitudeIndex ), std::ref( generationErrors.at( i ) ) ) );
+            }
+            for( unsigned int i = 0; i < numberOfThreads; i++ )
             {
-                independentVariableIndices[ 2 ] = k;
+                generationThreads.at( i ).join( );
+            }
+        }
 
-                determineVehicleCoefficients( independentVariableIndices );
+        // Re-throw first error that occured during generation (if any).
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            if( generationErrors.at( i ) )
+            {
+                std::rethrow_exception( generationErrors.at( i ) );
             }
         }
+
+        if( coefficientsCacheFile_ != "" )
+        {
+            writeCoefficientsToCacheFile( );
+        }
     }
 }
 
-//! Generate aerodynamic coefficients at a single set of independent variables.
-void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
-        const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic coefficients at all Mach numbers for a list of attitudes.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitudes(
+        std::atomic< unsigned int >& nextAttitudeIndex, std::exception_ptr& generationError )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
+    try
+    {
+        const unsigned int numberOfAngleOfSideslipPoints = dataPointsOfIndependentVariables_[ 2 ].size( );
+        const unsigned int numberOfAttitudes =
+                dataPointsOfIndependentVariables_[ 1 ].size( ) * numberOfAngleOfSideslipPoints;
 
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+        unsigned int currentAttitudeIndex = nextAttitudeIndex++;
+        while( currentAttitudeIndex < numberOfAttitudes )
+        {
+            generateCoefficientsForAttitude( currentAttitudeIndex / numberOfAngleOfSideslipPoints,
+                                             currentAttitudeIndex % numberOfAngleOfSideslipPoints );
+            currentAttitudeIndex = nextAttitudeIndex++;
+        }
+    }
+    catch( ... )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
+        generationError = std::current_exception( );
     }
-
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic coefficients at all Mach numbers for a single attitude.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitude(
+        const int angleOfAttackIndex, const int angleOfSideslipIndex )
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
+    const double angleOfAttack = dataPointsOfIndependentVariables_[ 1 ][ angleOfAttackIndex ];
+    const double angleOfSideslip = dataPointsOfIndependentVariables_[ 2 ][ angleOfSideslipIndex ];
+    const std::vector< double >& machNumbers = dataPointsOfIndependentVariables_[ 0 ];
+    const unsigned int numberOfMachPoints = machNumbers.size( );
+
+    // Determine panel inclinations for attitude.
+    std::vector< std::vector< std::vector< double > > > panelInclinations;
+    computePanelInclinations( angleOfAttack, angleOfSideslip, panelInclinations );
+
+    std::vector< Vector6d > coefficients( numberOfMachPoints, Vector6d::Zero( ) );
+    std::vector< boost::function< double( double ) > > compressionPressureFunctions( numberOfMachPoints );
+    std::vector< boost::function< double( double ) > > expansionPressureFunctions( numberOfMachPoints );
+    std::vector< Eigen::Vector3d > partForceCoefficients( numberOfMachPoints );
+    std::vector< Eigen::Vector3d > partMomentCoefficients( numberOfMachPoints );
+
+    for ( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
+        // Retrieve pressure coefficient functions of part for each Mach number.
+        for( unsigned int m = 0; m < numberOfMachPoints; m++ )
+        {
+            compressionPressureFunctions[ m ] = getCompressionPressureFunction(
+                        machNumbers[ m ], k, computeStagnationPressure( machNumbers[ m ], ratioOfSpecificHeats ) );
+            expansionPressureFunctions[ m ] = getExpansionPressureFunction( machNumbers[ m ], k );
+            partForceCoefficients[ m ].setZero( );
+            partMomentCoefficients[ m ].setZero( );
+        }
 
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
+        // Add contributions of all panels of part, evaluating the panel geometry once for all Mach numbers.
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            {
+                const Eigen::Vector3d panelSurfaceNormal = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                const double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+                const Eigen::Vector3d panelMomentArm =
+                        ( vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_ ).cross(
+                            panelSurfaceNormal );
+                const double inclination = panelInclinations[ k ][ i ][ j ];
+
+                double pressureCoefficient;
+                for( unsigned int m = 0; m < numberOfMachPoints; m++ )
+                {
+                    pressureCoefficient = ( inclination > 0 ) ? compressionPressureFunctions[ m ]( inclination ) :
+                                                                expansionPressureFunctions[ m ]( inclination );
+                    partForceCoefficients[ m ] -= pressureCoefficient * panelArea * panelSurfaceNormal;
+                    partMomentCoefficients[ m ] -= pressureCoefficient * panelArea * panelMomentArm;
+                }
+            }
+        }
+
+        // Normalize part coefficients, and add to vehicle coefficients.
+        for( unsigned int m = 0; m < numberOfMachPoints; m++ )
+        {
+            partForceCoefficients[ m ] /= referenceArea_;
+            partMomentCoefficients[ m ] /= ( referenceLength_ * referenceArea_ );
+            coefficients[ m ].segment( 0, 3 ) += partForceCoefficients[ m ];
+            coefficients[ m ].segment( 3, 3 ) += partMomentCoefficients[ m ];
+        }
     }
 
-    else
+    for( unsigned int m = 0; m < numberOfMachPoints; m++ )
     {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
+        aerodynamicCoefficients_[ m ][ angleOfAttackIndex ][ angleOfSideslipIndex ] = coefficients[ m ];
     }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Determines the inclination angle of panels on all parts.
+void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
+                                                                const double angleOfSideslip )
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
+    computePanelInclinations( angleOfAttack, angleOfSideslip, inclination_ );
+}
 
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
+//! Compute inclination angles of panels on all parts.
+void HypersonicLocalInclinationAnalysis::computePanelInclinations(
+        const double angleOfAttack, const double angleOfSideslip,
+        std::vector< std::vector< std::vector< double > > >& panelInclinations ) const
+{
+    // Set freestream velocity vector in body frame.
+    Eigen::Vector3d freestreamVelocityDirection;
+    freestreamVelocityDirection( 0 ) = cos( angleOfAttack )* cos( angleOfSideslip );
+    freestreamVelocityDirection( 1 ) = sin( angleOfSideslip );
+    freestreamVelocityDirection( 2 ) = sin( angleOfAttack ) * cos( angleOfSideslip );
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    // Loop over all panels of all vehicle parts and set inclination angles, from inner product between surface normal
+    // and free-stream direction.
+    panelInclinations.resize( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        panelInclinations[ k ].resize( vehicleParts_[ k ]->getNumberOfLines( ) - 1 );
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        {
+            panelInclinations[ k ][ i ].resize( vehicleParts_[ k ]->getNumberOfPoints( ) - 1 );
+            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            {
+                panelInclinations[ k ][ i ][ j ] = PI / 2.0 - acos(
+                            vehicleParts_[ k ]->getPanelSurfaceNormal( i, j ).dot( freestreamVelocityDirection ) );
+            }
+        }
+    }
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Function to compute the key with which the coefficients are identified in the coefficients cache file.
+boost::uint64_t HypersonicLocalInclinationAnalysis::computeCoefficientsCacheKey( )
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
+    boost::uint64_t hash = 14695981039346656037ULL;
 
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Add vehicle geometry.
+    addToFnvHash( hash, static_cast< int >( vehicleParts_.size( ) ) );
+    for ( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
+        addToFnvHash( hash, vehicleParts_[ k ]->getNumberOfLines( ) );
+        addToFnvHash( hash, vehicleParts_[ k ]->getNumberOfPoints( ) );
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
         {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
+            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            {
+                addToFnvHash( hash, vehicleParts_[ k ]->getPanelArea( i, j ) );
+                for( unsigned int l = 0; l < 3; l++ )
+                {
+                    addToFnvHash( hash, vehicleParts_[ k ]->getPanelSurfaceNormal( i, j )( l ) );
+                    addToFnvHash( hash, vehicleParts_[ k ]->getPanelCentroid( i, j )( l ) );
+                }
+            }
         }
     }
 
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
+    // Add independent variables, reference quantities and selected methods.
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
+    {
+        addToFnvHash( hash, static_cast< int >( dataPointsOfIndependentVariables_[ i ].size( ) ) );
+        for( unsigned int j = 0; j < dataPointsOfIndependentVariables_[ i ].size( ); j++ )
+        {
+            addToFnvHash( hash, dataPointsOfIndependentVariables_[ i ][ j ] );
+        }
+    }
+    addToFnvHash( hash, referenceArea_ );
+    addToFnvHash( hash, referenceLength_ );
+    for( unsigned int l = 0; l < 3; l++ )
+    {
+        addToFnvHash( hash, momentReferencePoint_( l ) );
+    }
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < selectedMethods_[ i ].size( ); j++ )
+        {
+            addToFnvHash( hash, selectedMethods_[ i ][ j ] );
+        }
+    }
+    addToFnvHash( hash, ratioOfSpecificHeats );
 
-    return forceCoefficients;
+    return hash;
 }
 
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+//! Function to read the aerodynamic coefficients from the coefficients cache file.
+bool HypersonicLocalInclinationAnalysis::readCoefficientsFromCacheFile( )
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
+    std::ifstream cacheFile( coefficientsCacheFile_.c_str( ), std::ios::binary );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
 
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance ;
+    // Check whether cached coefficients match current analysis.
+    char fileIdentifier[ 8 ];
+    boost::uint64_t cacheKey;
+    boost::uint64_t numberOfCoefficients;
+    cacheFile.read( fileIdentifier, 8 );
+    cacheFile.read( reinterpret_cast< char* >( &cacheKey ), sizeof( boost::uint64_t ) );
+    cacheFile.read( reinterpret_cast< char* >( &numberOfCoefficients ), sizeof( boost::uint64_t ) );
+    if( !cacheFile.good( ) || !std::equal( fileIdentifier, fileIdentifier + 8, coefficientsCacheFileIdentifier ) ||
+            cacheKey != computeCoefficientsCacheKey( ) ||
+            numberOfCoefficients != 6 * aerodynamicCoefficients_.num_elements( ) )
+    {
+        return false;
+    }
 
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Read coefficients into temporary array, so that an incomplete file leaves the coefficients untouched.
+    std::vector< double > cachedCoefficients( numberOfCoefficients );
+    cacheFile.read( reinterpret_cast< char* >( cachedCoefficients.data( ) ), numberOfCoefficients * sizeof( double ) );
+    if( !cacheFile.good( ) )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->
-                                  getPanelCentroid( i, j ) -  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        return false;
     }
 
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
+    Vector6d* coefficients = aerodynamicCoefficients_.origin( );
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        coefficients[ i ] = Eigen::Map< Vector6d >( cachedCoefficients.data( ) + 6 * i );
+    }
 
-    return momentCoefficients;
+    return true;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Function to write the aerodynamic coefficients to the coefficients cache file.
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToCacheFile( )
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
-    // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack )* cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
+    const boost::uint64_t cacheKey = computeCoefficientsCacheKey( );
+    const boost::uint64_t numberOfCoefficients = 6 * aerodynamicCoefficients_.num_elements( );
 
-    // Loop over all panels of given vehicle part and set inclination angles.
-    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    // Write to temporary file, and move it to its final name when complete, so that other processes never read a
+    // partially written file.
+    const std::string temporaryFile =
+            coefficientsCacheFile_ + boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" ).string( );
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
+        std::ofstream cacheFile( temporaryFile.c_str( ), std::ios::binary );
+        cacheFile.write( coefficientsCacheFileIdentifier, 8 );
+        cacheFile.write( reinterpret_cast< const char* >( &cacheKey ), sizeof( boost::uint64_t ) );
+        cacheFile.write( reinterpret_cast< const char* >( &numberOfCoefficients ), sizeof( boost::uint64_t ) );
 
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
+        const Vector6d* coefficients = aerodynamicCoefficients_.origin( );
+        for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+        {
+            cacheFile.write( reinterpret_cast< const char* >( coefficients[ i ].data( ) ), 6 * sizeof( double ) );
+        }
 
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
+        if( !cacheFile.good( ) )
+        {
+            cacheFile.close( );
+            std::remove( temporaryFile.c_str( ) );
+            throw std::runtime_error( "Error when writing hypersonic local inclination coefficients cache file " +
+                                      coefficientsCacheFile_ );
         }
     }
+    boost::filesystem::rename( temporaryFile, coefficientsCacheFile_ );
 }
 
-//! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+//! Function to retrieve the compression pressure coefficient function of a given part.
+boost::function< double( double ) > HypersonicLocalInclinationAnalysis::getCompressionPressureFunction(
+        const double machNumber, const int partNumber, const double currentStagnationPressureCoefficient )
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
@@ -471,7 +591,7 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
     case 1:
         pressureFunction =
                 boost::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, _1,
-                             stagnationPressureCoefficient );
+                             currentStagnationPressureCoefficient );
         break;
 
     case 2:
@@ -522,119 +642,66 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
-        }
-    }
+    return pressureFunction;
 }
 
-//! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+//! Function to retrieve the expansion pressure coefficient function of a given part.
+boost::function< double( double ) > HypersonicLocalInclinationAnalysis::getExpansionPressureFunction(
+        const double machNumber, const int partNumber )
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
-    if ( method == 0 || method == 1 || method == 4 )
-    {
-        boost::function< double( ) > pressureFunction;
-        switch( method )
-        {
-        case 0:
-            pressureFunction = boost::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                            machNumber, ratioOfSpecificHeats );
-            break;
-
-        case 1:
-            pressureFunction = boost::lambda::constant( 0.0 );
-            break;
-
-        case 4:
-            pressureFunction = boost::bind( &aerodynamics::computeHighMachBasePressure,
-                                            machNumber );
-            break;
+    boost::function< double( double ) > pressureFunction;
 
-        }
+    // Switch to analyze part using correct method.
+    switch( method )
+    {
+    case 0:
+        pressureFunction = boost::bind( &getConstantPressureCoefficient, _1,
+                                        aerodynamics::computeVacuumPressureCoefficient(
+                                            machNumber, ratioOfSpecificHeats ) );
+        break;
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
-            }
-        }
-    }
+    case 1:
+        pressureFunction = boost::bind( &getConstantPressureCoefficient, _1, 0.0 );
+        break;
 
-    else if( method == 3 || method == 5 || method == 6 )
+    case 3:
     {
+        // Calculate freestream Prandtl-Meyer function.
+        double freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction(
+                    machNumber, ratioOfSpecificHeats );
+        pressureFunction =
+                boost::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
+                             _1, machNumber, ratioOfSpecificHeats,
+                             freestreamPrandtlMeyerFunction );
+        break;
+    }
 
-        boost::function< double( double ) > pressureFunction;
-
-        // Declare local variable.
-        double freestreamPrandtlMeyerFunction;
+    case 4:
+        pressureFunction = boost::bind( &getConstantPressureCoefficient, _1,
+                                        aerodynamics::computeHighMachBasePressure( machNumber ) );
+        break;
 
-        // Switch to analyze part using correct method.
-        switch( method )
-        {
-        case 3:
-            // Calculate freestream Prandtl-Meyer function.
-            freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction(
-                        machNumber, ratioOfSpecificHeats );
-            pressureFunction =
-                    boost::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                 _1, machNumber, ratioOfSpecificHeats,
-                                 freestreamPrandtlMeyerFunction );
-            break;
-
-        case 5:
-            pressureFunction =
-                    boost::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                 _1, machNumber, ratioOfSpecificHeats, -1 );
-            break;
-
-        case 6:
-            pressureFunction = boost::bind( &aerodynamics::computeAcmEmpiricalPressureCoefficient,
-                                            _1, machNumber );
-            break;
-        }
+    case 5:
+        pressureFunction =
+                boost::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
+                             _1, machNumber, ratioOfSpecificHeats, -1 );
+        break;
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
-            }
-        }
-    }
+    case 6:
+        pressureFunction = boost::bind( &aerodynamics::computeAcmEmpiricalPressureCoefficient,
+                                        _1, machNumber );
+        break;
 
-    else
-    {
+    default:
         std::string errorMessage = "Error, expansion local inclination method number "
                 + std::to_string( method ) + " not recognized";
         throw std::runtime_error( errorMessage );
     }
+
+    return pressureFunction;
 }
 
 } // namespace aerodynamics
@@ -18,11 +18,14 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
-#include <map>
+#include <atomic>
+#include <exception>
 #include <string>
 #include <vector>
 
 #include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/function.hpp>
 #include <boost/multi_array.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -99,6 +102,13 @@ public:
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param numberOfThreads Number of threads over which the attitudes (combinations of angle of attack and
+     *  angle of sideslip) of the coefficient database are distributed during the generation of the coefficients
+     *  (default 1, i.e. no concurrent generation). If 0, the number of hardware threads is used.
+     *  \param coefficientsCacheFile Name of binary file in which the generated coefficients are cached (default empty,
+     *  i.e. no caching). If the file exists and was generated for the same vehicle geometry, independent variable
+     *  data points, reference quantities and selected methods, the coefficients are read from the file. Otherwise,
+     *  the coefficients are generated and written to the file.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -109,7 +119,9 @@ public:
             const std::vector< std::vector< int > >& selectedMethods,
             const double referenceArea,
             const double referenceLength,
-            const Eigen::Vector3d& momentReferencePoint );
+            const Eigen::Vector3d& momentReferencePoint,
+            const unsigned int numberOfThreads = 1,
+            const std::string& coefficientsCacheFile = "" );
 
     //! Default destructor.
     /*!
@@ -131,14 +143,25 @@ public:
 
     //! Determine inclination angles of panels on a given part.
     /*!
-     * Determines panel inclinations for all panels on all parts for given attitude.
-     * Outward pointing surface-normals are assumed!
+     * Determines panel inclinations for all panels on all parts for given attitude, which can subsequently be
+     * retrieved with getPanelInclinations. Outward pointing surface-normals are assumed!
      * \param angleOfAttack Angle of attack at which to determine inclination angles.
      * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
      */
     void determineInclinations( const double angleOfAttack,
                                 const double angleOfSideslip );
 
+    //! Get panel inclination angles.
+    /*!
+     * Returns panel inclination angles, as set by the last call to determineInclinations. Indices indicate
+     * part-line-point.
+     * \return Panel inclination angles.
+     */
+    const std::vector< std::vector< std::vector< double > > >& getPanelInclinations( ) const
+    {
+        return inclination_;
+    }
+
     //! Get the number of vehicle parts.
     /*!
      *  Returns the number of vehicle parts.
@@ -161,6 +184,26 @@ public:
          return vehicleParts_[ vehicleIndex ];
      }
 
+    //! Function to compute the key with which the coefficients are identified in the coefficients cache file.
+    /*!
+     * Function to compute the key with which the coefficients are identified in the coefficients cache file, as a
+     * (FNV-1a) hash of all the quantities that determine the coefficients: the panels of the vehicle parts, the data
+     * points of the independent variables, the reference quantities, the selected methods and the ratio of specific
+     * heats.
+     * \return Key with which the coefficients are identified in the coefficients cache file.
+     */
+    boost::uint64_t computeCoefficientsCacheKey( );
+
+    //! Function to retrieve whether the coefficients were read from the coefficients cache file.
+    /*!
+     * Function to retrieve whether the coefficients were read from the coefficients cache file (rather than generated).
+     * \return True if the coefficients were read from the coefficients cache file.
+     */
+    bool areCoefficientsReadFromCacheFile( ) const
+    {
+        return areCoefficientsReadFromCacheFile_;
+    }
+
     //! Overload ostream to print class information.
     /*!
      * Overloads ostream to print class information, prints the number of lawgs geometry parts and
@@ -183,72 +226,74 @@ private:
      */
     void generateCoefficients( );
 
-    //! Generate aerodynamic coefficients at a single set of independent variables.
+    //! Generate aerodynamic coefficients at all Mach numbers for a list of attitudes.
     /*!
-     * Generates aerodynamic coefficients at a single set of independent variables.
-     * Determines values and sets corresponding entry in vehicleCoefficients_ array.
-     * \param independentVariableIndices Array of indices from lists of Mach number,
-     *          angle of attack and angle of sideslip points at which to perform analysis.
+     * Generates aerodynamic coefficients at all Mach numbers for a list of attitudes, and sets the corresponding
+     * entries of the aerodynamicCoefficients_ array. Attitudes are retrieved from the list one at a time, using a
+     * counter that is shared by all threads generating coefficients (if any).
+     * \param nextAttitudeIndex Counter of next attitude (combined index of angle of attack and sideslip) that is to be
+     * processed, incremented by this function.
+     * \param generationError Error that was caught during generation on this thread (returned by reference)
      */
-    void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
+    void generateCoefficientsForAttitudes( std::atomic< unsigned int >& nextAttitudeIndex,
+                                           std::exception_ptr& generationError );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
+    //! Generate aerodynamic coefficients at all Mach numbers for a single attitude.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
+     * Generates aerodynamic coefficients at all Mach numbers for a single attitude, and sets the corresponding entries of
+     * the aerodynamicCoefficients_ array. The panel inclinations, areas and moment arms are evaluated once for the
+     * attitude, after which the pressure coefficients of each panel are evaluated for all Mach numbers. This function
+     * does not modify any other member variables, so that it can be called concurrently for different attitudes.
+     * \param angleOfAttackIndex Index of angle of attack in list of independent variables.
+     * \param angleOfSideslipIndex Index of angle of sideslip in list of independent variables.
      */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+    void generateCoefficientsForAttitude( const int angleOfAttackIndex, const int angleOfSideslipIndex );
 
-    //! Determine pressure coefficients on a given part.
+    //! Compute inclination angles of panels on all parts.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * Computes panel inclinations for all panels on all parts for given attitude, without modifying any member
+     * variables. Outward pointing surface-normals are assumed!
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param panelInclinations Panel inclination angles, indices indicate part-line-point (returned by reference).
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void computePanelInclinations( const double angleOfAttack, const double angleOfSideslip,
+                                   std::vector< std::vector< std::vector< double > > >& panelInclinations ) const;
 
-    //! Determine force coefficients of a part.
+    //! Function to read the aerodynamic coefficients from the coefficients cache file.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
+     * Function to read the aerodynamic coefficients from the coefficients cache file into the aerodynamicCoefficients_
+     * array. The coefficients are only read if the key and size of the cached coefficients match those of the current
+     * analysis.
+     * \return True if the coefficients were read from the file, false if the file does not exist or does not match.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    bool readCoefficientsFromCacheFile( );
 
-    //! Determine moment coefficients of a part.
-    /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
-     */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    //! Function to write the aerodynamic coefficients to the coefficients cache file.
+    void writeCoefficientsToCacheFile( );
 
-    //! Determine the compression pressure coefficients of a given part.
+    //! Function to retrieve the compression pressure coefficient function of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
-     * inclination > 0.
+     * Function to retrieve the compression pressure coefficient function (as a function of panel inclination) of a
+     * given part and Mach number, as selected in selectedMethods_.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param currentStagnationPressureCoefficient Stagnation pressure coefficient at given Mach number.
+     * \return Compression pressure coefficient as a function of panel inclination.
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    boost::function< double( double ) > getCompressionPressureFunction(
+            const double machNumber, const int partNumber, const double currentStagnationPressureCoefficient );
 
-    //! Determine the expansion pressure coefficients of a given part.
+    //! Function to retrieve the expansion pressure coefficient function of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
-     * which inclination <= 0.
+     * Function to retrieve the expansion pressure coefficient function (as a function of panel inclination) of a
+     * given part and Mach number, as selected in selectedMethods_.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \return Expansion pressure coefficient as a function of panel inclination.
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    boost::function< double( double ) > getExpansionPressureFunction(
+            const double machNumber, const int partNumber );
 
     //! Array of vehicle parts.
     /*!
@@ -256,41 +301,13 @@ private:
      */
     std::vector< boost::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
 
-    //! Multi-array as which indicates which coefficients have been calculated already.
-    /*!
-     * Multi-array as which indicates which coefficients have been calculated already. Indices of
-     * entries coincide with indices of aerodynamicCoefficients_.
-     */
-    boost::multi_array< bool, 3 > isCoefficientGenerated_;
-
     //! Three-dimensional array of panel inclination angles.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Three-dimensional array of panel inclination angles, as set by the last call to determineInclinations.
+     * Indices indicate part-line-point.
      */
     std::vector< std::vector< std::vector< double > > > inclination_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
-    /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
-     */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-            previouslyComputedInclinations_;
-
-    //! Three-dimensional array of panel pressure coefficients.
-    /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
-     */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
-
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
-
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
@@ -303,6 +320,15 @@ private:
      * second index represents vehicle part.
      */
     std::vector< std::vector< int > > selectedMethods_;
+
+    //! Number of threads over which the attitudes are distributed during the generation of the coefficients.
+    unsigned int numberOfThreads_;
+
+    //! Name of binary file in which the generated coefficients are cached (empty if no caching is used).
+    std::string coefficientsCacheFile_;
+
+    //! Boolean denoting whether the coefficients were read from the coefficients cache file.
+    bool areCoefficientsReadFromCacheFile_;
 };
 
 //! Typedef for shared-pointer to HypersonicLocalInclinationAnalysis object.
@@ -242,6 +242,36 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         gasComponentProperties_ = gasComponentProperties;
     }
 
+    //! Get gas component properties.
+    /*!
+     * Returns the gas component properties used for the calculation of the speed of sound and the mean free path.
+     * \return Properties of the gas components
+     */
+    GasComponentProperties getGasComponentProperties( )
+    {
+        return gasComponentProperties_;
+    }
+
+    //! Get function providing the NRLMSISE00 model input.
+    /*!
+     * Returns the function which provides the NRLMSISE00 model input as a function of (altitude, longitude, latitude, time ).
+     * \return Function providing the NRLMSISE00 model input
+     */
+    NRLMSISE00InputFunction getNRLMSISE00InputFunction( )
+    {
+        return nrlmsise00InputFunction_;
+    }
+
+    //! Get variable denoting whether the ideal gas law is used for computation of pressure.
+    /*!
+     * Returns variable denoting whether the ideal gas law is used for computation of pressure.
+     * \return True if the ideal gas law is used for computation of pressure.
+     */
+    bool getUseIdealGasLaw( )
+    {
+        return useIdealGasLaw_;
+    }
+
     //! Get local density.
     /*!
      * Returns the local density of the atmosphere in kg per meter^3.
@@ -330,6 +360,16 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         return meanFreePath_;
     }
 
+    //! Get ratio of specific heats.
+    /*!
+    * Returns the (constant) ratio of specific heats used by the model.
+    * \return Ratio of specific heats.
+    */
+    double getSpecificHeatRatio( )
+    {
+        return specificHeatRatio_;
+    }
+
     //! Get local mean molar mass.
     /*!
     * Returns the local mean molar mass in kg/mol.
@@ -0,0 +1,420 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00SurrogateAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Time before the start of the next day at which the last table node of each day is placed (s).
+static const double dayBoundaryTimeOffset = 1.0E-3;
+
+//! Maximum number of times the interval error criterion is halved when no interval exceeds it in a grid refinement.
+static const int maximumNumberOfIntervalErrorReductions = 20;
+
+//! Function to create equidistant grid values between (and including) given bounds, with at most given step.
+static std::vector< double > createEquidistantGridValues(
+        const double lowerBound, const double upperBound, const double maximumStep )
+{
+    const int numberOfIntervals = std::max(
+                1, static_cast< int >( std::ceil( ( upperBound - lowerBound ) / maximumStep - 1.0E-9 ) ) );
+    std::vector< double > gridValues( numberOfIntervals + 1 );
+    for( int i = 0; i <= numberOfIntervals; i++ )
+    {
+        gridValues[ i ] = lowerBound + static_cast< double >( i ) / static_cast< double >( numberOfIntervals ) *
+                ( upperBound - lowerBound );
+    }
+    gridValues[ numberOfIntervals ] = upperBound;
+    return gridValues;
+}
+
+//! Function to compute the time (seconds since J2000) at the start of the (UT) day in which the given time lies.
+static double computeStartOfDay( const double time )
+{
+    return std::floor( ( time - physical_constants::JULIAN_DAY / 2.0 ) / physical_constants::JULIAN_DAY ) *
+            physical_constants::JULIAN_DAY + physical_constants::JULIAN_DAY / 2.0;
+}
+
+//! Constructor
+NRLMSISE00SurrogateAtmosphere::NRLMSISE00SurrogateAtmosphere(
+        const boost::shared_ptr< NRLMSISE00Atmosphere > fullModel,
+        const NRLMSISE00SurrogateSettings& surrogateSettings ):
+    fullModel_( fullModel ), surrogateSettings_( surrogateSettings ),
+    specificHeatRatio_( fullModel->getSpecificHeatRatio( ) ),
+    molarGasConstant_( physical_constants::MOLAR_GAS_CONSTANT ),
+    currentConditions_( Eigen::Vector4d::Constant( TUDAT_NAN ) )
+{
+    if( !( surrogateSettings_.endTime_ > surrogateSettings_.startTime_ ) ||
+            !( surrogateSettings_.maximumAltitude_ > surrogateSettings_.minimumAltitude_ ) )
+    {
+        throw std::runtime_error( "Error when creating NRLMSISE00 surrogate, time or altitude range is empty" );
+    }
+
+    if( !( surrogateSettings_.altitudeStep_ > 0.0 ) || !( surrogateSettings_.latitudeStep_ > 0.0 ) ||
+            !( surrogateSettings_.localSolarTimeStep_ > 0.0 ) || !( surrogateSettings_.timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating NRLMSISE00 surrogate, grid steps must be positive" );
+    }
+
+    createInitialGrid( );
+
+    // Tabulate full model, and refine grid until required accuracy is met.
+    const double maximumDensityError = surrogateSettings_.maximumRelativeDensityError_;
+    double maximumIntervalError = maximumDensityError / 4.0;
+    int numberOfRefinements = 0;
+    while( true )
+    {
+        tabulateFullModel( );
+        validationResults_ = validateNRLMSISE00SurrogateAtmosphere(
+                    *this, *fullModel_, surrogateSettings_.numberOfValidationSamples_,
+                    surrogateSettings_.randomSeed_ );
+
+        if( !( maximumDensityError > 0.0 ) ||
+                validationResults_.maximumRelativeDensityError_ <= maximumDensityError )
+        {
+            break;
+        }
+        else if( numberOfRefinements >= surrogateSettings_.maximumNumberOfRefinements_ )
+        {
+            throw std::runtime_error(
+                        "Error when creating NRLMSISE00 surrogate, maximum relative density error " +
+                        std::to_string( validationResults_.maximumRelativeDensityError_ ) + " exceeds required " +
+                        std::to_string( maximumDensityError ) + " after " +
+                        std::to_string( numberOfRefinements ) + " grid refinements" );
+        }
+
+        // Bisect intervals with too large error; if none are found, tighten criterion.
+        int numberOfIntervalErrorReductions = 0;
+        while( !refineGrid( maximumIntervalError, surrogateSettings_.randomSeed_ + numberOfRefinements + 1 ) )
+        {
+            if( numberOfIntervalErrorReductions >= maximumNumberOfIntervalErrorReductions )
+            {
+                throw std::runtime_error(
+                            "Error when creating NRLMSISE00 surrogate, maximum relative density error " +
+                            std::to_string( validationResults_.maximumRelativeDensityError_ ) + " exceeds required " +
+                            std::to_string( maximumDensityError ) + ", but no grid interval with an error above " +
+                            std::to_string( maximumIntervalError ) + " was found" );
+            }
+            maximumIntervalError /= 2.0;
+            numberOfIntervalErrorReductions++;
+        }
+        numberOfRefinements++;
+    }
+}
+
+//! Function to compute the local solar time from longitude and time
+double NRLMSISE00SurrogateAtmosphere::computeLocalSolarTime( const double longitude, const double time )
+{
+    const double secondOfDay = time - computeStartOfDay( time );
+    double localSolarTime = std::fmod( secondOfDay / 3600.0 + longitude / ( mathematical_constants::PI / 12.0 ), 24.0 );
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+    return localSolarTime;
+}
+
+//! Function to compute the longitude at which a given local solar time occurs at a given time
+double NRLMSISE00SurrogateAtmosphere::computeLongitudeFromLocalSolarTime(
+        const double localSolarTime, const double time )
+{
+    const double secondOfDay = time - computeStartOfDay( time );
+    double longitude = std::fmod( ( localSolarTime - secondOfDay / 3600.0 ) * mathematical_constants::PI / 12.0 +
+                                  mathematical_constants::PI, 2.0 * mathematical_constants::PI );
+    if( longitude < 0.0 )
+    {
+        longitude += 2.0 * mathematical_constants::PI;
+    }
+    return longitude - mathematical_constants::PI;
+}
+
+//! Function to create the initial grid from the surrogate settings.
+void NRLMSISE00SurrogateAtmosphere::createInitialGrid( )
+{
+    independentVariableValues_[ 0 ] = createEquidistantGridValues(
+                surrogateSettings_.minimumAltitude_, surrogateSettings_.maximumAltitude_,
+                surrogateSettings_.altitudeStep_ );
+    independentVariableValues_[ 1 ] = createEquidistantGridValues(
+                -mathematical_constants::PI / 2.0, mathematical_constants::PI / 2.0,
+                surrogateSettings_.latitudeStep_ );
+    independentVariableValues_[ 2 ] = createEquidistantGridValues(
+                0.0, 24.0, surrogateSettings_.localSolarTimeStep_ );
+
+    // Create time grid for each day separately, with nodes at start and (just before) end of each day.
+    independentVariableValues_[ 3 ].clear( );
+    for( double startOfDay = computeStartOfDay( surrogateSettings_.startTime_ );
+         startOfDay <= surrogateSettings_.endTime_; startOfDay += physical_constants::JULIAN_DAY )
+    {
+        std::vector< double > dailyTimes = createEquidistantGridValues(
+                    startOfDay, startOfDay + physical_constants::JULIAN_DAY - dayBoundaryTimeOffset,
+                    surrogateSettings_.timeStep_ );
+        independentVariableValues_[ 3 ].insert(
+                    independentVariableValues_[ 3 ].end( ), dailyTimes.begin( ), dailyTimes.end( ) );
+    }
+}
+
+//! Function to evaluate the full model at the given grid coordinates.
+Eigen::Vector3d NRLMSISE00SurrogateAtmosphere::evaluateFullModel( const boost::array< double, 4 >& gridCoordinates )
+{
+    const double altitude = gridCoordinates[ 0 ];
+    const double latitude = gridCoordinates[ 1 ];
+    const double time = gridCoordinates[ 3 ];
+    const double longitude = computeLongitudeFromLocalSolarTime( gridCoordinates[ 2 ], time );
+
+    return ( Eigen::Vector3d( ) << std::log( fullModel_->getDensity( altitude, longitude, latitude, time ) ),
+             fullModel_->getTemperature( altitude, longitude, latitude, time ),
+             fullModel_->getMeanMolarMass( altitude, longitude, latitude, time ) ).finished( );
+}
+
+//! Function to (re)compute the table from the full model, using the current grid.
+void NRLMSISE00SurrogateAtmosphere::tabulateFullModel( )
+{
+    // Set strides of independent variables in table, and offsets of corners of interpolation hyper-rectangle.
+    int numberOfNodes = 1;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        nodeStrides_[ i ] = numberOfNodes;
+        numberOfNodes *= independentVariableValues_[ i ].size( );
+    }
+
+    for( unsigned int k = 0; k < 16; k++ )
+    {
+        cornerOffsets_[ k ] = 0;
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            if( ( k >> i ) & 1 )
+            {
+                cornerOffsets_[ k ] += nodeStrides_[ i ];
+            }
+        }
+    }
+
+    // Evaluate full model at all nodes.
+    tabulatedProperties_.resize( 3, numberOfNodes );
+    boost::array< double, 4 > gridCoordinates;
+    for( int j = 0; j < numberOfNodes; j++ )
+    {
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            gridCoordinates[ i ] = independentVariableValues_[ i ][
+                    ( j / nodeStrides_[ i ] ) % independentVariableValues_[ i ].size( ) ];
+        }
+        tabulatedProperties_.col( j ) = evaluateFullModel( gridCoordinates );
+    }
+
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        lookUpSchemes_[ i ] = interpolators::createLookupScheme< double >(
+                    independentVariableValues_[ i ], interpolators::huntingAlgorithm );
+    }
+
+    currentConditions_.setConstant( TUDAT_NAN );
+}
+
+//! Function to refine the grid, by bisecting each interval in which the midpoint density error is too large.
+bool NRLMSISE00SurrogateAtmosphere::refineGrid( const double maximumIntervalError, const int randomSeed )
+{
+    const int numberOfSamplesPerInterval = 3;
+    boost::random::mt19937 randomNumberGenerator( randomSeed );
+
+    bool isGridRefined = false;
+    boost::array< std::vector< double >, 4 > refinedIndependentVariableValues;
+    boost::array< double, 4 > gridCoordinates;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        refinedIndependentVariableValues[ i ].push_back( independentVariableValues_[ i ][ 0 ] );
+        for( unsigned int j = 0; j < independentVariableValues_[ i ].size( ) - 1; j++ )
+        {
+            const double lowerValue = independentVariableValues_[ i ][ j ];
+            const double upperValue = independentVariableValues_[ i ][ j + 1 ];
+
+            // Evaluate error at interval midpoint, with other independent variables at random nodes (intervals across
+            // day boundaries are not refined, since input is discontinuous there).
+            double maximumMidpointError = 0.0;
+            if( !( i == 3 && ( upperValue - lowerValue ) <= 2.0 * dayBoundaryTimeOffset ) )
+            {
+                for( int k = 0; k < numberOfSamplesPerInterval; k++ )
+                {
+                    for( unsigned int l = 0; l < 4; l++ )
+                    {
+                        boost::random::uniform_int_distribution< int > nodeDistribution(
+                                    0, independentVariableValues_[ l ].size( ) - 1 );
+                        gridCoordinates[ l ] = independentVariableValues_[ l ][ nodeDistribution( randomNumberGenerator ) ];
+                    }
+                    gridCoordinates[ i ] = 0.5 * ( lowerValue + upperValue );
+
+                    const double fullModelDensity = std::exp( evaluateFullModel( gridCoordinates )( 0 ) );
+                    const double surrogateDensity = std::exp( interpolateProperties( gridCoordinates )( 0 ) );
+                    maximumMidpointError = std::max(
+                                maximumMidpointError, std::fabs( surrogateDensity - fullModelDensity ) / fullModelDensity );
+                }
+            }
+
+            if( maximumMidpointError > maximumIntervalError )
+            {
+                refinedIndependentVariableValues[ i ].push_back( 0.5 * ( lowerValue + upperValue ) );
+                isGridRefined = true;
+            }
+            refinedIndependentVariableValues[ i ].push_back( upperValue );
+        }
+    }
+
+    if( isGridRefined )
+    {
+        independentVariableValues_ = refinedIndependentVariableValues;
+    }
+    return isGridRefined;
+}
+
+//! Function to interpolate the tabulated properties at the given grid coordinates.
+Eigen::Vector3d NRLMSISE00SurrogateAtmosphere::interpolateProperties( const boost::array< double, 4 >& gridCoordinates )
+{
+    // Determine interval, and fraction in interval, of each independent variable.
+    int lowerNodeIndex = 0;
+    boost::array< double, 4 > upperFractions;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        const int lowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour( gridCoordinates[ i ] );
+        const double lowerValue = independentVariableValues_[ i ][ lowerIndex ];
+        upperFractions[ i ] = ( gridCoordinates[ i ] - lowerValue ) /
+                ( independentVariableValues_[ i ][ lowerIndex + 1 ] - lowerValue );
+        lowerNodeIndex += lowerIndex * nodeStrides_[ i ];
+    }
+
+    // Add contributions of all corners of hyper-rectangle.
+    Eigen::Vector3d interpolatedProperties = Eigen::Vector3d::Zero( );
+    for( unsigned int k = 0; k < 16; k++ )
+    {
+        double cornerWeight = 1.0;
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            cornerWeight *= ( ( k >> i ) & 1 ) ? upperFractions[ i ] : ( 1.0 - upperFractions[ i ] );
+        }
+        interpolatedProperties += cornerWeight * tabulatedProperties_.col( lowerNodeIndex + cornerOffsets_[ k ] );
+    }
+    return interpolatedProperties;
+}
+
+//! Function to compute the atmospheric properties at the given conditions, if they have changed.
+void NRLMSISE00SurrogateAtmosphere::computeProperties(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    if( altitude == currentConditions_( 0 ) && longitude == currentConditions_( 1 ) &&
+            latitude == currentConditions_( 2 ) && time == currentConditions_( 3 ) )
+    {
+        return;
+    }
+
+    if( time < independentVariableValues_[ 3 ].front( ) ||
+            time > independentVariableValues_[ 3 ].back( ) + dayBoundaryTimeOffset )
+    {
+        throw std::runtime_error( "Error in NRLMSISE00 surrogate, time " + std::to_string( time ) +
+                                  " is outside of tabulated time interval" );
+    }
+
+    boost::array< double, 4 > gridCoordinates;
+    gridCoordinates[ 0 ] = altitude;
+    gridCoordinates[ 1 ] = latitude;
+    gridCoordinates[ 2 ] = computeLocalSolarTime( longitude, time );
+    gridCoordinates[ 3 ] = time;
+
+    const Eigen::Vector3d interpolatedProperties = interpolateProperties( gridCoordinates );
+    density_ = std::exp( interpolatedProperties( 0 ) );
+    temperature_ = interpolatedProperties( 1 );
+    meanMolarMass_ = interpolatedProperties( 2 );
+
+    currentConditions_ << altitude, longitude, latitude, time;
+}
+
+//! Function to validate a NRLMSISE-00 surrogate model against the full model.
+NRLMSISE00SurrogateValidationResults validateNRLMSISE00SurrogateAtmosphere(
+        NRLMSISE00SurrogateAtmosphere& surrogateModel,
+        NRLMSISE00Atmosphere& fullModel,
+        const int numberOfSamples, const int randomSeed )
+{
+    // Create distributions of conditions covering domain of surrogate model.
+    std::vector< double > altitudes = surrogateModel.getGridValues( 0 );
+    std::vector< double > times = surrogateModel.getGridValues( 3 );
+    boost::random::mt19937 randomNumberGenerator( randomSeed );
+    boost::random::uniform_real_distribution< double > altitudeDistribution( altitudes.front( ), altitudes.back( ) );
+    boost::random::uniform_real_distribution< double > longitudeDistribution(
+                -mathematical_constants::PI, mathematical_constants::PI );
+    boost::random::uniform_real_distribution< double > latitudeDistribution(
+                -mathematical_constants::PI / 2.0, mathematical_constants::PI / 2.0 );
+    boost::random::uniform_real_distribution< double > timeDistribution( times.front( ), times.back( ) );
+
+    // Compare surrogate and full model at each sample.
+    NRLMSISE00SurrogateValidationResults validationResults;
+    double sumOfSquaredDensityErrors = 0.0;
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        const double altitude = altitudeDistribution( randomNumberGenerator );
+        const double longitude = longitudeDistribution( randomNumberGenerator );
+        const double latitude = latitudeDistribution( randomNumberGenerator );
+        const double time = timeDistribution( randomNumberGenerator );
+
+        const double fullModelDensity = fullModel.getDensity( altitude, longitude, latitude, time );
+        const double fullModelTemperature = fullModel.getTemperature( altitude, longitude, latitude, time );
+
+        const double relativeDensityError = std::fabs(
+                    surrogateModel.getDensity( altitude, longitude, latitude, time ) - fullModelDensity ) /
+                fullModelDensity;
+        const double relativeTemperatureError = std::fabs(
+                    surrogateModel.getTemperature( altitude, longitude, latitude, time ) - fullModelTemperature ) /
+                fullModelTemperature;
+
+        if( relativeDensityError > validationResults.maximumRelativeDensityError_ )
+        {
+            validationResults.maximumRelativeDensityError_ = relativeDensityError;
+            validationResults.conditionsAtMaximumDensityError_ << altitude, longitude, latitude, time;
+        }
+        validationResults.maximumRelativeTemperatureError_ = std::max(
+                    validationResults.maximumRelativeTemperatureError_, relativeTemperatureError );
+        sumOfSquaredDensityErrors += relativeDensityError * relativeDensityError;
+    }
+
+    validationResults.numberOfSamples_ = numberOfSamples;
+    if( numberOfSamples > 0 )
+    {
+        validationResults.rmsRelativeDensityError_ =
+                std::sqrt( sumOfSquaredDensityErrors / static_cast< double >( numberOfSamples ) );
+    }
+    return validationResults;
+}
+
+//! Function to create a NRLMSISE-00 surrogate model from solar activity data.
+boost::shared_ptr< NRLMSISE00SurrogateAtmosphere > createNRLMSISE00SurrogateAtmosphere(
+        const input_output::solar_activity::SolarActivityDataMap& solarActivityData,
+        const NRLMSISE00SurrogateSettings& surrogateSettings )
+{
+    boost::function< NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            boost::bind( &nrlmsiseInputFunction, _1, _2, _3, _4, solarActivityData, false, TUDAT_NAN );
+    return boost::make_shared< NRLMSISE00SurrogateAtmosphere >(
+                boost::make_shared< NRLMSISE00Atmosphere >( inputFunction ), surrogateSettings );
+}
+
+}  // namespace aerodynamics
+
+}  // namespace tudat
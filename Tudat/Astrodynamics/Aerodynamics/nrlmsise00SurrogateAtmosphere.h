@@ -0,0 +1,423 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_NRLMSISE00_SURROGATE_ATMOSPHERE_H
+#define TUDAT_NRLMSISE00_SURROGATE_ATMOSPHERE_H
+
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Settings for the creation of a tabulated surrogate of the NRLMSISE-00 atmosphere model
+/*!
+ *  Settings for the creation of a tabulated surrogate of the NRLMSISE-00 atmosphere model. The model is tabulated on an
+ *  (altitude, latitude, local solar time, time) grid. The grid spacing provided here is the initial spacing, which is
+ *  refined (by bisection of intervals) where needed to meet the required maximum relative density error.
+ */
+struct NRLMSISE00SurrogateSettings
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param startTime Start of time interval in which surrogate model is to be valid (seconds since J2000).
+     *  \param endTime End of time interval in which surrogate model is to be valid (seconds since J2000).
+     *  \param minimumAltitude Minimum altitude of table [m].
+     *  \param maximumAltitude Maximum altitude of table [m].
+     *  \param altitudeStep Initial altitude step of table [m].
+     *  \param latitudeStep Initial latitude step of table (from -90 to 90 degrees) [rad].
+     *  \param localSolarTimeStep Initial local solar time step of table (from 0 to 24 hours) [hours].
+     *  \param timeStep Initial time step of table within each day [s]. Since the solar activity input changes
+     *  discontinuously at the start of each day, nodes are placed at the start and just before the end of each day.
+     *  \param maximumRelativeDensityError Maximum relative error of surrogate density w.r.t. full model, evaluated at
+     *  the validation samples (no refinement or check is performed if this value is not positive).
+     *  \param maximumNumberOfRefinements Maximum number of grid refinement iterations to meet
+     *  maximumRelativeDensityError. If this error is not met after these refinements, an exception is thrown.
+     *  \param numberOfValidationSamples Number of randomly sampled conditions at which surrogate model is validated
+     *  against full model after creation.
+     *  \param randomSeed Seed of random number generator used to generate conditions for refinement and validation.
+     */
+    NRLMSISE00SurrogateSettings(
+            const double startTime, const double endTime,
+            const double minimumAltitude = 100.0E3, const double maximumAltitude = 1000.0E3,
+            const double altitudeStep = 10.0E3,
+            const double latitudeStep = 10.0 * mathematical_constants::PI / 180.0,
+            const double localSolarTimeStep = 1.0,
+            const double timeStep = 3.0 * 3600.0,
+            const double maximumRelativeDensityError = 0.01,
+            const int maximumNumberOfRefinements = 3,
+            const int numberOfValidationSamples = 1000,
+            const int randomSeed = 0 ):
+        startTime_( startTime ), endTime_( endTime ),
+        minimumAltitude_( minimumAltitude ), maximumAltitude_( maximumAltitude ), altitudeStep_( altitudeStep ),
+        latitudeStep_( latitudeStep ), localSolarTimeStep_( localSolarTimeStep ), timeStep_( timeStep ),
+        maximumRelativeDensityError_( maximumRelativeDensityError ),
+        maximumNumberOfRefinements_( maximumNumberOfRefinements ),
+        numberOfValidationSamples_( numberOfValidationSamples ), randomSeed_( randomSeed ){ }
+
+    //! Start of time interval in which surrogate model is to be valid (seconds since J2000).
+    double startTime_;
+
+    //! End of time interval in which surrogate model is to be valid (seconds since J2000).
+    double endTime_;
+
+    //! Minimum altitude of table [m].
+    double minimumAltitude_;
+
+    //! Maximum altitude of table [m].
+    double maximumAltitude_;
+
+    //! Initial altitude step of table [m].
+    double altitudeStep_;
+
+    //! Initial latitude step of table [rad].
+    double latitudeStep_;
+
+    //! Initial local solar time step of table [hours].
+    double localSolarTimeStep_;
+
+    //! Initial time step of table within each day [s].
+    double timeStep_;
+
+    //! Maximum relative error of surrogate density w.r.t. full model.
+    double maximumRelativeDensityError_;
+
+    //! Maximum number of grid refinement iterations to meet maximumRelativeDensityError_.
+    int maximumNumberOfRefinements_;
+
+    //! Number of randomly sampled conditions at which surrogate model is validated against full model.
+    int numberOfValidationSamples_;
+
+    //! Seed of random number generator used to generate conditions for refinement and validation.
+    int randomSeed_;
+};
+
+//! Results of validation of NRLMSISE-00 surrogate model against full model.
+struct NRLMSISE00SurrogateValidationResults
+{
+    //! Constructor, initializing all errors to zero.
+    NRLMSISE00SurrogateValidationResults( ):
+        numberOfSamples_( 0 ), maximumRelativeDensityError_( 0.0 ), rmsRelativeDensityError_( 0.0 ),
+        maximumRelativeTemperatureError_( 0.0 ),
+        conditionsAtMaximumDensityError_( Eigen::Vector4d::Constant( TUDAT_NAN ) ){ }
+
+    //! Number of samples at which surrogate model was compared to full model.
+    int numberOfSamples_;
+
+    //! Maximum absolute value of relative density error.
+    double maximumRelativeDensityError_;
+
+    //! Root mean square value of relative density error.
+    double rmsRelativeDensityError_;
+
+    //! Maximum absolute value of relative temperature error.
+    double maximumRelativeTemperatureError_;
+
+    //! Altitude, longitude, latitude and time at which maximum relative density error occurs.
+    Eigen::Vector4d conditionsAtMaximumDensityError_;
+};
+
+//! Tabulated surrogate of the NRLMSISE-00 atmosphere model.
+/*!
+ *  Tabulated surrogate of the NRLMSISE-00 atmosphere model, in which the model is evaluated on an (altitude, latitude,
+ *  local solar time, time) grid upon creation, and multi-linearly interpolated during use. The logarithm of the
+ *  density, the temperature and the mean molar mass are tabulated (interleaved per grid node, so that a single look-up
+ *  is needed for all properties), from which pressure and speed of sound are computed as done in the full model. Upon
+ *  creation, the grid is refined until the maximum relative density error (w.r.t. the full model) is below the value
+ *  provided in the NRLMSISE00SurrogateSettings.
+ *
+ *  The local solar time is computed from the longitude and the time of day (UT), as done by the nrlmsiseInputFunction
+ *  function with adjustSolarTime set to false. The full model must use this same definition (i.e. the local solar time
+ *  must not be overridden) for the surrogate to be consistent.
+ */
+class NRLMSISE00SurrogateAtmosphere : public AtmosphereModel
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, tabulates the full model, refines the grid where needed and validates the result.
+     *  \param fullModel Full NRLMSISE-00 model that is to be tabulated
+     *  \param surrogateSettings Settings for the creation of the surrogate model
+     */
+    NRLMSISE00SurrogateAtmosphere( const boost::shared_ptr< NRLMSISE00Atmosphere > fullModel,
+                                   const NRLMSISE00SurrogateSettings& surrogateSettings );
+
+    //! Destructor
+    ~NRLMSISE00SurrogateAtmosphere( ){ }
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere in kg per meter^3.
+     *  \param altitude Altitude at which density is to be computed [m].
+     *  \param longitude Longitude at which density is to be computed [rad].
+     *  \param latitude Latitude at which density is to be computed [rad].
+     *  \param time Time at which density is to be computed (seconds since J2000).
+     *  \return Atmospheric density [kg/m^3].
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return density_;
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere in Newton per meter^2, computed from the ideal gas law.
+     *  \param altitude Altitude at which pressure is to be computed [m].
+     *  \param longitude Longitude at which pressure is to be computed [rad].
+     *  \param latitude Latitude at which pressure is to be computed [rad].
+     *  \param time Time at which pressure is to be computed (seconds since J2000).
+     *  \return Atmospheric pressure.
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return density_ * molarGasConstant_ * temperature_ / meanMolarMass_;
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere in Kelvin.
+     *  \param altitude Altitude at which temperature is to be computed [m].
+     *  \param longitude Longitude at which temperature is to be computed [rad].
+     *  \param latitude Latitude at which temperature is to be computed [rad].
+     *  \param time Time at which temperature is to be computed (seconds since J2000).
+     *  \return Atmospheric temperature.
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return temperature_;
+    }
+
+    //! Get local speed of sound.
+    /*!
+     *  Returns the local speed of sound in m/s.
+     *  \param altitude Altitude at which speed of sound is to be computed [m].
+     *  \param longitude Longitude at which speed of sound is to be computed [rad].
+     *  \param latitude Latitude at which speed of sound is to be computed [rad].
+     *  \param time Time at which speed of sound is to be computed (seconds since J2000).
+     *  \return Speed of sound.
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return computeSpeedOfSound( temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+    }
+
+    //! Get local mean molar mass.
+    /*!
+     *  Returns the local mean molar mass in kg/mol.
+     *  \param altitude Altitude at which mean molar mass is to be computed [m].
+     *  \param longitude Longitude at which mean molar mass is to be computed [rad].
+     *  \param latitude Latitude at which mean molar mass is to be computed [rad].
+     *  \param time Time at which mean molar mass is to be computed (seconds since J2000).
+     *  \return Mean molar mass.
+     */
+    double getMeanMolarMass( const double altitude, const double longitude,
+                             const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return meanMolarMass_;
+    }
+
+    //! Function to retrieve the results of the validation against the full model, performed upon creation.
+    /*!
+     *  Function to retrieve the results of the validation against the full model, performed upon creation.
+     *  \return Results of the validation against the full model
+     */
+    NRLMSISE00SurrogateValidationResults getValidationResults( )
+    {
+        return validationResults_;
+    }
+
+    //! Function to retrieve the grid values of a given independent variable.
+    /*!
+     *  Function to retrieve the grid values of a given independent variable (after refinement).
+     *  \param independentVariableIndex Index of independent variable (0: altitude, 1: latitude, 2: local solar time,
+     *  3: time).
+     *  \return Grid values of requested independent variable.
+     */
+    std::vector< double > getGridValues( const int independentVariableIndex )
+    {
+        return independentVariableValues_.at( independentVariableIndex );
+    }
+
+    //! Function to retrieve the total number of nodes in the table.
+    /*!
+     *  Function to retrieve the total number of nodes in the table.
+     *  \return Total number of nodes in the table.
+     */
+    int getNumberOfGridNodes( )
+    {
+        return tabulatedProperties_.cols( );
+    }
+
+    //! Function to compute the local solar time from longitude and time
+    /*!
+     *  Function to compute the local solar time from longitude and time, in range [0,24) hours.
+     *  \param longitude Longitude [rad].
+     *  \param time Time (seconds since J2000).
+     *  \return Local solar time [hours].
+     */
+    static double computeLocalSolarTime( const double longitude, const double time );
+
+    //! Function to compute the longitude at which a given local solar time occurs at a given time
+    /*!
+     *  Function to compute the longitude at which a given local solar time occurs at a given time, in range [-pi,pi).
+     *  \param localSolarTime Local solar time [hours].
+     *  \param time Time (seconds since J2000).
+     *  \return Longitude [rad].
+     */
+    static double computeLongitudeFromLocalSolarTime( const double localSolarTime, const double time );
+
+private:
+
+    //! Function to create the initial grid from the surrogate settings.
+    void createInitialGrid( );
+
+    //! Function to compute the atmospheric properties at the given conditions, if they have changed.
+    /*!
+     *  Function to compute the atmospheric properties at the given conditions, if they have changed, from a single
+     *  look-up per independent variable.
+     *  \param altitude Altitude at which properties are to be computed [m].
+     *  \param longitude Longitude at which properties are to be computed [rad].
+     *  \param latitude Latitude at which properties are to be computed [rad].
+     *  \param time Time at which properties are to be computed (seconds since J2000).
+     */
+    void computeProperties( const double altitude, const double longitude, const double latitude, const double time );
+
+    //! Function to interpolate the tabulated properties at the given grid coordinates.
+    /*!
+     *  Function to interpolate the tabulated properties at the given grid coordinates, using a single look-up per
+     *  independent variable.
+     *  \param gridCoordinates Altitude, latitude, local solar time and time at which properties are to be interpolated
+     *  \return Logarithm of density, temperature and mean molar mass, interpolated from table.
+     */
+    Eigen::Vector3d interpolateProperties( const boost::array< double, 4 >& gridCoordinates );
+
+    //! Function to evaluate the full model at the given grid coordinates.
+    /*!
+     *  Function to evaluate the full model at the given grid coordinates.
+     *  \param gridCoordinates Altitude, latitude, local solar time and time at which model is to be evaluated
+     *  \return Logarithm of density, temperature and mean molar mass, from full model.
+     */
+    Eigen::Vector3d evaluateFullModel( const boost::array< double, 4 >& gridCoordinates );
+
+    //! Function to (re)compute the table from the full model, using the current grid.
+    void tabulateFullModel( );
+
+    //! Function to refine the grid, by bisecting each interval in which the midpoint density error is too large.
+    /*!
+     *  Function to refine the grid, by bisecting each interval in which the density error at the midpoint of the
+     *  interval is too large. For each independent variable, the error is evaluated at the midpoint of each interval,
+     *  with the other independent variables at randomly chosen grid nodes, so that the interpolation error in each
+     *  independent variable is assessed separately.
+     *  \param maximumIntervalError Maximum relative density error at interval midpoint, above which the interval is
+     *  bisected.
+     *  \param randomSeed Seed of random number generator used to select grid nodes.
+     *  \return True if any interval is bisected, false otherwise.
+     */
+    bool refineGrid( const double maximumIntervalError, const int randomSeed );
+
+    //! Full NRLMSISE-00 model that is tabulated
+    boost::shared_ptr< NRLMSISE00Atmosphere > fullModel_;
+
+    //! Settings for the creation of the surrogate model
+    NRLMSISE00SurrogateSettings surrogateSettings_;
+
+    //! Values of (altitude, latitude, local solar time, time) at grid nodes.
+    boost::array< std::vector< double >, 4 > independentVariableValues_;
+
+    //! Difference in node index (column of tabulatedProperties_) for increment in each independent variable.
+    boost::array< int, 4 > nodeStrides_;
+
+    //! Difference in node index w.r.t. lower node of each corner of hyper-rectangle in which interpolation is performed.
+    boost::array< int, 16 > cornerOffsets_;
+
+    //! Tabulated logarithm of density, temperature and mean molar mass, with each column containing a single node.
+    Eigen::Matrix< double, 3, Eigen::Dynamic > tabulatedProperties_;
+
+    //! Look-up schemes used to find interval of each independent variable.
+    boost::array< boost::shared_ptr< interpolators::LookUpScheme< double > >, 4 > lookUpSchemes_;
+
+    //! Results of the validation against the full model, performed upon creation.
+    NRLMSISE00SurrogateValidationResults validationResults_;
+
+    //! Specific heat ratio, as used by full model
+    double specificHeatRatio_;
+
+    //! Molar gas constant (J/mol K)
+    double molarGasConstant_;
+
+    //! Current altitude, longitude, latitude and time at which properties are computed.
+    Eigen::Vector4d currentConditions_;
+
+    //! Current local density (kg/m3)
+    double density_;
+
+    //! Current local temperature (K)
+    double temperature_;
+
+    //! Current mean molar mass (kg/mole)
+    double meanMolarMass_;
+};
+
+//! Function to validate a NRLMSISE-00 surrogate model against the full model.
+/*!
+ *  Function to validate a NRLMSISE-00 surrogate model against the full model, by comparing the density and temperature
+ *  at randomly sampled conditions, uniformly distributed in the domain of the surrogate model.
+ *  \param surrogateModel Surrogate model that is to be validated
+ *  \param fullModel Full model against which surrogate model is to be validated
+ *  \param numberOfSamples Number of randomly sampled conditions at which models are compared
+ *  \param randomSeed Seed of random number generator used to generate conditions
+ *  \return Results of the validation (maximum and rms relative errors)
+ */
+NRLMSISE00SurrogateValidationResults validateNRLMSISE00SurrogateAtmosphere(
+        NRLMSISE00SurrogateAtmosphere& surrogateModel,
+        NRLMSISE00Atmosphere& fullModel,
+        const int numberOfSamples, const int randomSeed = 0 );
+
+//! Function to create a NRLMSISE-00 surrogate model from solar activity data.
+/*!
+ *  Function to create a NRLMSISE-00 surrogate model from solar activity data, using the nrlmsiseInputFunction to
+ *  compute the full model input (without overriding the local solar time).
+ *  \param solarActivityData Solar activity data, must contain data for all days in the time window of the
+ *  surrogateSettings.
+ *  \param surrogateSettings Settings for the creation of the surrogate model
+ *  \return NRLMSISE-00 surrogate model
+ */
+boost::shared_ptr< NRLMSISE00SurrogateAtmosphere > createNRLMSISE00SurrogateAtmosphere(
+        const input_output::solar_activity::SolarActivityDataMap& solarActivityData,
+        const NRLMSISE00SurrogateSettings& surrogateSettings );
+
+}  // namespace aerodynamics
+
+}  // namespace tudat
+
+#endif // TUDAT_NRLMSISE00_SURROGATE_ATMOSPHERE_H
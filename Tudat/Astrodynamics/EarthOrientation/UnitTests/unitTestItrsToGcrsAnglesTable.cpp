@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsAnglesTable.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::earth_orientation;
+
+BOOST_AUTO_TEST_SUITE( test_itrs_to_gcrs_angles_table )
+
+//! Test whether the interpolated angles meet the error tolerances, and are independent of the number of threads.
+BOOST_AUTO_TEST_CASE( testItrsToGcrsAnglesTableInterpolation )
+{
+    boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+
+    // Tolerances for X, Y, s, x_p, y_p (1 microarcsecond) and UT1 (1 microsecond)
+    Eigen::Vector6d errorTolerances;
+    errorTolerances << 4.8E-12, 4.8E-12, 4.8E-12, 4.8E-12, 4.8E-12, 1.0E-6;
+
+    const double intervalStart = 1.5E8;
+    const double intervalEnd = intervalStart + 5.0 * 86400.0;
+    ItrsToGcrsAnglesTable anglesTable(
+                intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale, earthOrientationCalculator,
+                6, 60.0, 86400.0, 4 );
+    ItrsToGcrsAnglesTable serialAnglesTable(
+                intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale, earthOrientationCalculator,
+                6, 60.0, 86400.0, 1 );
+
+    // Check selected time steps: multiples of minimum time step, with fewer nodes for slowly varying quantities.
+    Eigen::Vector6d timeSteps = anglesTable.getTimeSteps( );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        const double timeStepRatio = timeSteps( i ) / 60.0;
+        BOOST_CHECK_EQUAL( timeStepRatio, std::pow( 2.0, std::round( std::log2( timeStepRatio ) ) ) );
+        BOOST_CHECK( timeSteps( i ) <= 86400.0 );
+        BOOST_CHECK_EQUAL( anglesTable.getNumberOfNodes( ).at( i ),
+                           static_cast< unsigned int >( std::floor( 5.0 * 86400.0 / timeSteps( i ) ) ) + 6 );
+    }
+    BOOST_CHECK( timeSteps( 2 ) > timeSteps( 3 ) );
+    BOOST_CHECK( timeSteps == serialAnglesTable.getTimeSteps( ) );
+
+    // Compare interpolated angles with directly computed angles
+    for( unsigned int i = 0; i <= 1000; i++ )
+    {
+        const double testTime = intervalStart + ( intervalEnd - intervalStart ) * static_cast< double >( i ) / 1000.0;
+        std::pair< Eigen::Vector5d, Time > expectedRotationValues =
+                earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< Time >(
+                    testTime, basic_astrodynamics::tdb_scale );
+        std::pair< Eigen::Vector5d, Time > rotationValues =
+                anglesTable.getRotationAnglesFromItrsToGcrs< Time >( testTime );
+        std::pair< Eigen::Vector5d, double > serialRotationValues =
+                serialAnglesTable.getRotationAnglesFromItrsToGcrs< double >( testTime );
+
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_SMALL( rotationValues.first( j ) - expectedRotationValues.first( j ), errorTolerances( j ) );
+            BOOST_CHECK_EQUAL( rotationValues.first( j ), serialRotationValues.first( j ) );
+        }
+        BOOST_CHECK_SMALL( ( rotationValues.second - expectedRotationValues.second ).getSeconds< double >( ),
+                           errorTolerances( 5 ) );
+        BOOST_CHECK_EQUAL( anglesTable.getInterpolatedQuantity( 5, testTime ),
+                           serialAnglesTable.getInterpolatedQuantity( 5, testTime ) );
+        BOOST_CHECK_CLOSE_FRACTION( rotationValues.second.getSeconds< double >( ), serialRotationValues.second,
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that table cannot be used outside of its interval
+    BOOST_CHECK_THROW( anglesTable.getRotationAnglesFromItrsToGcrs< double >( intervalEnd + 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( anglesTable.getInterpolatedQuantity( 0, intervalStart - 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( anglesTable.getInterpolatedQuantity( 6, intervalStart ), std::runtime_error );
+}
+
+//! Test whether a table is correctly written to and read from file, and whether outdated or invalid files are replaced.
+BOOST_AUTO_TEST_CASE( testItrsToGcrsAnglesTableFile )
+{
+    // Write all files to a unique temporary directory, which is removed at the end of the test.
+    const boost::filesystem::path testDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    boost::filesystem::create_directories( testDirectory );
+    const std::string tableFile = ( testDirectory / "itrsToGcrsAnglesTableTest.dat" ).string( );
+
+    boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+    Eigen::Vector6d errorTolerances;
+    errorTolerances << 4.8E-11, 4.8E-11, 4.8E-11, 4.8E-11, 4.8E-11, 1.0E-5;
+
+    const double intervalStart = 1.5E8;
+    const double intervalEnd = intervalStart + 2.0 * 86400.0;
+    boost::shared_ptr< ItrsToGcrsAnglesTable > anglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+
+    // Read table from file, and compare with original.
+    ItrsToGcrsAnglesTable readAnglesTable( tableFile );
+    BOOST_CHECK_EQUAL( readAnglesTable.getIntervalStart( ), intervalStart );
+    BOOST_CHECK_EQUAL( readAnglesTable.getIntervalEnd( ), intervalEnd );
+    BOOST_CHECK( readAnglesTable.getTimeSteps( ) == anglesTable->getTimeSteps( ) );
+    BOOST_CHECK( readAnglesTable.getNumberOfNodes( ) == anglesTable->getNumberOfNodes( ) );
+    BOOST_CHECK_EQUAL( readAnglesTable.getTimeScale( ), basic_astrodynamics::tdb_scale );
+    for( unsigned int i = 0; i <= 100; i++ )
+    {
+        const double testTime = intervalStart + ( intervalEnd - intervalStart ) * static_cast< double >( i ) / 100.0;
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( readAnglesTable.getInterpolatedQuantity( j, testTime ),
+                               anglesTable->getInterpolatedQuantity( j, testTime ) );
+        }
+    }
+
+    // Check that file is reused for a sub-interval, and that it is replaced for different settings.
+    boost::shared_ptr< ItrsToGcrsAnglesTable > reusedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart + 86400.0, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+    BOOST_CHECK_EQUAL( reusedAnglesTable->getIntervalStart( ), intervalStart );
+
+    boost::shared_ptr< ItrsToGcrsAnglesTable > replacedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart + 86400.0, intervalEnd, 2.0 * errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+    BOOST_CHECK_EQUAL( replacedAnglesTable->getIntervalStart( ), intervalStart + 86400.0 );
+    BOOST_CHECK_EQUAL( ItrsToGcrsAnglesTable( tableFile ).getIntervalStart( ), intervalStart + 86400.0 );
+
+    // Check that file is replaced if the Earth orientation data file has changed (dummy data file used to check this).
+    const std::string dataFile = ( testDirectory / "itrsToGcrsAnglesTableTestData.txt" ).string( );
+    {
+        std::ofstream fileStream( dataFile.c_str( ) );
+        fileStream << "EOP data" << std::endl;
+    }
+    createItrsToGcrsAnglesTable(
+                tableFile, intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator, 6, 60.0, 86400.0, 0, dataFile );
+    BOOST_CHECK( ItrsToGcrsAnglesTable( tableFile ).isCreatedFromFile( dataFile ) );
+    BOOST_CHECK( !ItrsToGcrsAnglesTable( tableFile ).isCreatedFromFile( tableFile ) );
+    reusedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart + 86400.0, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator, 6, 60.0, 86400.0, 0, dataFile );
+    BOOST_CHECK_EQUAL( reusedAnglesTable->getIntervalStart( ), intervalStart );
+    {
+        std::ofstream fileStream( dataFile.c_str( ), std::ios::app );
+        fileStream << "Updated EOP data" << std::endl;
+    }
+    replacedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart + 86400.0, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator, 6, 60.0, 86400.0, 0, dataFile );
+    BOOST_CHECK_EQUAL( replacedAnglesTable->getIntervalStart( ), intervalStart + 86400.0 );
+    BOOST_CHECK( ItrsToGcrsAnglesTable( tableFile ).isCreatedFromFile( dataFile ) );
+    std::remove( dataFile.c_str( ) );
+    BOOST_CHECK( !ItrsToGcrsAnglesTable( tableFile ).isCreatedFromFile( dataFile ) );
+
+    // Check that invalid and truncated files are rejected when read directly, and replaced when creating a table.
+    {
+        std::ofstream fileStream( tableFile.c_str( ) );
+        fileStream << "Not an ITRS to GCRS angles table file" << std::endl;
+    }
+    BOOST_CHECK_THROW( ItrsToGcrsAnglesTable( tableFile ).getIntervalStart( ), std::runtime_error );
+    replacedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+    BOOST_CHECK_EQUAL( ItrsToGcrsAnglesTable( tableFile ).getIntervalStart( ), intervalStart );
+
+    boost::filesystem::resize_file( tableFile, boost::filesystem::file_size( tableFile ) - sizeof( double ) );
+    BOOST_CHECK_THROW( ItrsToGcrsAnglesTable( tableFile ).getIntervalStart( ), std::runtime_error );
+    replacedAnglesTable = createItrsToGcrsAnglesTable(
+                tableFile, intervalStart, intervalEnd, errorTolerances, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+    BOOST_CHECK_EQUAL( replacedAnglesTable->getInterpolatedQuantity( 0, intervalEnd ),
+                       anglesTable->getInterpolatedQuantity( 0, intervalEnd ) );
+    BOOST_CHECK_EQUAL( ItrsToGcrsAnglesTable( tableFile ).getInterpolatedQuantity( 0, intervalEnd ),
+                       anglesTable->getInterpolatedQuantity( 0, intervalEnd ) );
+
+    std::remove( tableFile.c_str( ) );
+    BOOST_CHECK_THROW( ItrsToGcrsAnglesTable( tableFile ).getIntervalStart( ), std::runtime_error );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -11,6 +11,10 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Basics/testMacros.h"
@@ -234,6 +238,143 @@ BOOST_AUTO_TEST_CASE( testShortPeriodUt1CombinedCorrections )
     BOOST_CHECK_SMALL( std::fabs( ut1CorrectionTotal - ( ut1CorrectionLibration + ut1CorrectionOceanTides ) ), 1.0E-20 );
 }
 
+//! Test whether the combined (deduplicated) correction terms reproduce the term-by-term sum over all files, and whether
+//! the slow-argument cache reproduces the direct computation.
+BOOST_AUTO_TEST_CASE( testShortPeriodCorrectionTermEvaluation )
+{
+    const std::vector< std::string > amplitudeFiles =
+    { getEarthOrientationDataFilesPath( ) + "polarMotionOceanTidesAmplitudes.txt",
+      getEarthOrientationDataFilesPath( ) + "polarMotionLibrationAmplitudesQuasiDiurnalOnly.txt" };
+    const std::vector< std::string > multiplierFiles =
+    { getEarthOrientationDataFilesPath( ) + "polarMotionOceanTidesFundamentalArgumentMultipliers.txt",
+      getEarthOrientationDataFilesPath( ) + "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt" };
+    const double conversionFactor = convertArcSecondsToRadians< double >( 1.0E-6 );
+
+    ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > polarMotionCalculator(
+                conversionFactor, 0.0, amplitudeFiles, multiplierFiles );
+    ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > cachedPolarMotionCalculator(
+                conversionFactor, 0.0, amplitudeFiles, multiplierFiles );
+    cachedPolarMotionCalculator.setSlowArgumentCacheSettings( true );
+
+    ShortPeriodEarthOrientationCorrectionCalculator< double > ut1Calculator(
+                1.0E-6, 0.0,
+    { getEarthOrientationDataFilesPath( ) + "utcLibrationAmplitudes.txt",
+      getEarthOrientationDataFilesPath( ) + "utcOceanTidesAmplitudes.txt" },
+    { getEarthOrientationDataFilesPath( ) + "utcLibrationFundamentalArgumentMultipliers.txt",
+      getEarthOrientationDataFilesPath( ) + "utcOceanTidesFundamentalArgumentMultipliers.txt" } );
+    ShortPeriodEarthOrientationCorrectionCalculator< double > cachedUt1Calculator(
+                1.0E-6, 0.0,
+    { getEarthOrientationDataFilesPath( ) + "utcLibrationAmplitudes.txt",
+      getEarthOrientationDataFilesPath( ) + "utcOceanTidesAmplitudes.txt" },
+    { getEarthOrientationDataFilesPath( ) + "utcLibrationFundamentalArgumentMultipliers.txt",
+      getEarthOrientationDataFilesPath( ) + "utcOceanTidesFundamentalArgumentMultipliers.txt" } );
+    cachedUt1Calculator.setSlowArgumentCacheSettings( true );
+
+    // Read terms of all files, and check that terms shared between files are combined.
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > polarMotionTerms;
+    int numberOfPolarMotionTerms = 0;
+    for( unsigned int i = 0; i < amplitudeFiles.size( ); i++ )
+    {
+        polarMotionTerms.push_back( readAmplitudesAndFundamentalArgumentMultipliers(
+                                        amplitudeFiles.at( i ), multiplierFiles.at( i ) ) );
+        numberOfPolarMotionTerms += polarMotionTerms.at( i ).first.rows( );
+    }
+    BOOST_CHECK( polarMotionCalculator.getNumberOfUniqueCorrectionTerms( ) < numberOfPolarMotionTerms );
+
+    // Evaluate corrections every 5 minutes over two days.
+    double startEphemerisTime = convertUTCtoTT(
+                convertJulianDayToSecondsSinceEpoch( 54335.0 + JULIAN_DAY_AT_0_MJD, JULIAN_DAY_ON_J2000 ) );
+    for( int i = 0; i < 576; i++ )
+    {
+        double currentEphemerisTime = startEphemerisTime + 300.0 * i;
+        Eigen::Vector6d fundamentalArguments = calculateDelaunayFundamentalArgumentsWithGmst( currentEphemerisTime );
+
+        // Compute corrections term-by-term
+        Eigen::Vector2d expectedPolarMotionCorrection = Eigen::Vector2d::Zero( );
+        for( unsigned int j = 0; j < polarMotionTerms.size( ); j++ )
+        {
+            for( int k = 0; k < polarMotionTerms.at( j ).first.rows( ); k++ )
+            {
+                double tideAngle = polarMotionTerms.at( j ).second.row( k ).dot( fundamentalArguments.transpose( ) );
+                expectedPolarMotionCorrection.x( ) += conversionFactor * (
+                            polarMotionTerms.at( j ).first( k, 0 ) * std::sin( tideAngle ) +
+                            polarMotionTerms.at( j ).first( k, 1 ) * std::cos( tideAngle ) );
+                expectedPolarMotionCorrection.y( ) += conversionFactor * (
+                            polarMotionTerms.at( j ).first( k, 2 ) * std::sin( tideAngle ) +
+                            polarMotionTerms.at( j ).first( k, 3 ) * std::cos( tideAngle ) );
+            }
+        }
+
+        Eigen::Vector2d polarMotionCorrection = polarMotionCalculator.getCorrections( fundamentalArguments );
+        Eigen::Vector2d cachedPolarMotionCorrection = cachedPolarMotionCalculator.getCorrections( currentEphemerisTime );
+        double ut1Correction = ut1Calculator.getCorrections( currentEphemerisTime );
+        double cachedUt1Correction = cachedUt1Calculator.getCorrections( currentEphemerisTime );
+
+        // Check combined terms (to within rounding errors) and cached values (to within 0.001 microarcseconds/10 ps).
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            BOOST_CHECK_SMALL( polarMotionCorrection( j ) - expectedPolarMotionCorrection( j ), 1.0E-22 );
+            BOOST_CHECK_SMALL( cachedPolarMotionCorrection( j ) - polarMotionCorrection( j ), 5.0E-15 );
+        }
+        BOOST_CHECK_SMALL( cachedUt1Correction - ut1Correction, 1.0E-11 );
+    }
+}
+
+//! Test whether copies of a calculator (as used when copying Earth orientation calculators for parallel use) give
+//! results identical to the original, independently of the evaluations of the original (the evaluation buffers and
+//! slow-argument cache are copied, not shared).
+BOOST_AUTO_TEST_CASE( testShortPeriodCorrectionCalculatorCopy )
+{
+    const std::vector< std::string > amplitudeFiles =
+    { getEarthOrientationDataFilesPath( ) + "polarMotionOceanTidesAmplitudes.txt",
+      getEarthOrientationDataFilesPath( ) + "polarMotionLibrationAmplitudesQuasiDiurnalOnly.txt" };
+    const std::vector< std::string > multiplierFiles =
+    { getEarthOrientationDataFilesPath( ) + "polarMotionOceanTidesFundamentalArgumentMultipliers.txt",
+      getEarthOrientationDataFilesPath( ) + "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt" };
+    const double conversionFactor = convertArcSecondsToRadians< double >( 1.0E-6 );
+
+    ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > uncachedCalculator(
+                conversionFactor, 0.0, amplitudeFiles, multiplierFiles );
+
+    for( unsigned int useCache = 0; useCache < 2; useCache++ )
+    {
+        ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > originalCalculator(
+                    conversionFactor, 0.0, amplitudeFiles, multiplierFiles );
+        ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > referenceCalculator(
+                    conversionFactor, 0.0, amplitudeFiles, multiplierFiles );
+        originalCalculator.setSlowArgumentCacheSettings( useCache == 1 );
+        referenceCalculator.setSlowArgumentCacheSettings( useCache == 1 );
+
+        // Evaluate original before copying, so that the buffers (and cache) of the copy are filled.
+        double startEphemerisTime = convertUTCtoTT(
+                    convertJulianDayToSecondsSinceEpoch( 54335.0 + JULIAN_DAY_AT_0_MJD, JULIAN_DAY_ON_J2000 ) );
+        originalCalculator.getCorrections( startEphemerisTime );
+        referenceCalculator.getCorrections( startEphemerisTime );
+
+        ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > copiedCalculator( originalCalculator );
+        BOOST_CHECK_EQUAL( copiedCalculator.getNumberOfUniqueCorrectionTerms( ),
+                           originalCalculator.getNumberOfUniqueCorrectionTerms( ) );
+
+        // Evaluate copy and original interleaved at different times (half a day apart), and compare with results of
+        // calculators that are evaluated only at the times of the original and copy, respectively.
+        for( int i = 0; i < 288; i++ )
+        {
+            double currentEphemerisTime = startEphemerisTime + 300.0 * i;
+            Eigen::Vector2d copiedCorrection = copiedCalculator.getCorrections( currentEphemerisTime + 43200.0 );
+            Eigen::Vector2d originalCorrection = originalCalculator.getCorrections( currentEphemerisTime );
+            Eigen::Vector2d referenceCorrection = referenceCalculator.getCorrections( currentEphemerisTime );
+            Eigen::Vector2d expectedCopiedCorrection =
+                    uncachedCalculator.getCorrections( currentEphemerisTime + 43200.0 );
+
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_EQUAL( originalCorrection( j ), referenceCorrection( j ) );
+                BOOST_CHECK_SMALL( copiedCorrection( j ) - expectedCopiedCorrection( j ), 5.0E-15 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
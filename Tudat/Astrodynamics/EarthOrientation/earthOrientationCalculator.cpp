@@ -93,6 +93,44 @@ boost::shared_ptr< EarthOrientationAnglesCalculator > createStandardEarthOrienta
                 polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
 }
 
+//! Function to create a copy of an EarthOrientationAnglesCalculator, which can be used independently of the original
+boost::shared_ptr< EarthOrientationAnglesCalculator > copyEarthOrientationAnglesCalculator(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator )
+{
+    // Create polar motion calculator with its own short-period corrections (which keep evaluation buffers), sharing the
+    // interpolator of daily IERS values with the original.
+    boost::shared_ptr< PolarMotionCalculator > originalPolarMotionCalculator =
+            earthOrientationCalculator->getPolarMotionCalculator( );
+    boost::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > > shortPeriodPolarMotionCalculator;
+    if( originalPolarMotionCalculator->getShortPeriodPolarMotionCalculator( ) != NULL )
+    {
+        shortPeriodPolarMotionCalculator =
+                boost::make_shared< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >(
+                    *originalPolarMotionCalculator->getShortPeriodPolarMotionCalculator( ) );
+    }
+    boost::shared_ptr< PolarMotionCalculator > polarMotionCalculator = boost::make_shared< PolarMotionCalculator >(
+                originalPolarMotionCalculator->getDailyIersValueInterpolator( ), shortPeriodPolarMotionCalculator );
+
+    // Create time scale converter, which has its own current times and short-period corrections, sharing the interpolator
+    // of daily UT1 - UTC values with the original.
+    boost::shared_ptr< TerrestrialTimeScaleConverter > originalTimeScaleConverter =
+            earthOrientationCalculator->getTerrestrialTimeScaleConverter( );
+    boost::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > shortPeriodUt1CorrectionCalculator;
+    if( originalTimeScaleConverter->getShortPeriodUt1CorrectionCalculator( ) != NULL )
+    {
+        shortPeriodUt1CorrectionCalculator = boost::make_shared< ShortPeriodEarthOrientationCorrectionCalculator< double > >(
+                    *originalTimeScaleConverter->getShortPeriodUt1CorrectionCalculator( ) );
+    }
+    boost::shared_ptr< TerrestrialTimeScaleConverter > terrestrialTimeScaleConverter =
+            boost::make_shared< TerrestrialTimeScaleConverter >(
+                originalTimeScaleConverter->getDailyUtcUt1CorrectionInterpolator( ), shortPeriodUt1CorrectionCalculator );
+
+    // Precession-nutation calculator is not modified upon evaluation, and is shared with the original.
+    return boost::make_shared< EarthOrientationAnglesCalculator >(
+                polarMotionCalculator, earthOrientationCalculator->getPrecessionNutationCalculator( ),
+                terrestrialTimeScaleConverter );
+}
+
 ////! Function to create an interpolator for the Earth orientation angles
 //boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, 6,1 > > >
 //createInterpolatorForItrsToGcrsAngles(
@@ -298,6 +298,18 @@ private:
 boost::shared_ptr< EarthOrientationAnglesCalculator > createStandardEarthOrientationCalculator(
         const boost::shared_ptr< EOPReader > eopReader = boost::make_shared< EOPReader >( ) );
 
+//! Function to create a copy of an EarthOrientationAnglesCalculator, which can be used independently of the original
+/*!
+ * Function to create a copy of an EarthOrientationAnglesCalculator, which can be used independently of (and concurrently
+ * with) the original. The copy has its own time scale converter (with its own current times) and its own short-period
+ * correction calculators (which keep evaluation buffers). The interpolators of the daily IERS corrections and the
+ * precession-nutation calculator are shared with the original.
+ * \param earthOrientationCalculator Object that is to be copied
+ * \return Copy of earthOrientationCalculator
+ */
+boost::shared_ptr< EarthOrientationAnglesCalculator > copyEarthOrientationAnglesCalculator(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator );
+
 //! Function to create an interpolator for the Earth orientation angles and UT1
 /*!
  * Function to create an interpolator for the Earth orientation angles and UT1, to reduce computation time of Earth rotation
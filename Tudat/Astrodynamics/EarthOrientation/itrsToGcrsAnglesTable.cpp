@@ -0,0 +1,591 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/EarthOrientation/itrsToGcrsAnglesTable.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Identifier at the start of an ITRS<->GCRS angles table file.
+const char anglesTableFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'E', 'O', 'T' };
+
+//! Version of the ITRS<->GCRS angles table file format.
+const boost::uint64_t anglesTableFileFormatVersion = 1;
+
+//! Number of sample windows in which the interpolation errors are evaluated to select the time steps.
+static const unsigned int NUMBER_OF_SAMPLE_WINDOWS = 4;
+
+//! Factor by which the interpolation errors in the sample windows must be below the error tolerances.
+static const double SAMPLE_ERROR_SAFETY_FACTOR = 0.5;
+
+//! Number of times at which the Earth orientation is evaluated by a thread before a new batch is requested.
+static const unsigned int TIMES_PER_BATCH = 64;
+
+//! Function to interpolate values at equidistant nodes with the (second) barycentric form of Lagrange interpolation.
+/*!
+ *  Function to interpolate values at equidistant nodes with the (second) barycentric form of Lagrange interpolation.
+ *  \param nodeValues Values at the nodes (with stride valueStride).
+ *  \param valueStride Distance in memory between the values at consecutive nodes.
+ *  \param localTime Time at which to interpolate, in units of the time step, relative to the first node.
+ *  \param barycentricWeights Barycentric weights of the nodes.
+ *  \return Interpolated value.
+ */
+static double interpolateAtEquidistantNodes( const double* nodeValues, const unsigned int valueStride,
+                                             const double localTime, const std::vector< double >& barycentricWeights )
+{
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for( unsigned int i = 0; i < barycentricWeights.size( ); i++ )
+    {
+        const double timeDifference = localTime - static_cast< double >( i );
+        if( timeDifference == 0.0 )
+        {
+            return nodeValues[ i * valueStride ];
+        }
+        const double nodeTerm = barycentricWeights[ i ] / timeDifference;
+        numerator += nodeTerm * nodeValues[ i * valueStride ];
+        denominator += nodeTerm;
+    }
+    return numerator / denominator;
+}
+
+//! Function to evaluate batches of times with an Earth orientation calculator, until all times have been evaluated.
+/*!
+ *  Function to evaluate batches of times with an Earth orientation calculator, until all times have been evaluated.
+ *  \param earthOrientationCalculator Object from which Earth orientation data is retrieved (not shared with other threads).
+ *  \param timeScale Time scale of the input times.
+ *  \param evaluationTimes Times at which the Earth orientation is to be evaluated.
+ *  \param quantityValues Values of X, Y, s, x_p, y_p and UT1 minus input time at each time (6 entries per time).
+ *  \param nextTimeIndex Index of the next time that is to be evaluated (shared by all threads).
+ *  \param evaluationError Exception thrown during the evaluation on this thread (if any).
+ */
+static void evaluateItrsToGcrsAnglesOnThread(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const basic_astrodynamics::TimeScales timeScale,
+        const std::vector< double >& evaluationTimes,
+        std::vector< double >& quantityValues,
+        std::atomic< unsigned int >& nextTimeIndex,
+        std::exception_ptr& evaluationError )
+{
+    try
+    {
+        unsigned int currentTimeIndex = nextTimeIndex.fetch_add( TIMES_PER_BATCH );
+        while( currentTimeIndex < evaluationTimes.size( ) )
+        {
+            const unsigned int batchEnd = std::min(
+                        currentTimeIndex + TIMES_PER_BATCH, static_cast< unsigned int >( evaluationTimes.size( ) ) );
+            for( unsigned int i = currentTimeIndex; i < batchEnd; i++ )
+            {
+                // UT1 is computed at Time precision, so that UT1 minus input time retains full (double) precision.
+                std::pair< Eigen::Vector5d, Time > currentRotationValues =
+                        earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< Time >(
+                            evaluationTimes[ i ], timeScale );
+                for( unsigned int j = 0; j < 5; j++ )
+                {
+                    quantityValues[ 6 * i + j ] = currentRotationValues.first( j );
+                }
+                quantityValues[ 6 * i + 5 ] =
+                        ( currentRotationValues.second - Time( evaluationTimes[ i ] ) ).getSeconds< double >( );
+            }
+            currentTimeIndex = nextTimeIndex.fetch_add( TIMES_PER_BATCH );
+        }
+    }
+    catch( ... )
+    {
+        evaluationError = std::current_exception( );
+    }
+}
+
+//! Function to evaluate the ITRS<->GCRS angles and UT1 at a list of times, on one or more threads.
+/*!
+ *  Function to evaluate the ITRS<->GCRS angles and UT1 at a list of times, on one or more threads. Each additional thread
+ *  uses its own copy of the Earth orientation calculator.
+ *  \param earthOrientationCalculator Object from which Earth orientation data is retrieved.
+ *  \param timeScale Time scale of the input times.
+ *  \param evaluationTimes Times at which the Earth orientation is to be evaluated.
+ *  \param numberOfRequestedThreads Number of threads on which the times are evaluated (hardware concurrency if 0).
+ *  \return Values of X, Y, s, x_p, y_p and UT1 minus input time at each time (6 entries per time).
+ */
+static std::vector< double > evaluateItrsToGcrsAngles(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const basic_astrodynamics::TimeScales timeScale,
+        const std::vector< double >& evaluationTimes,
+        const unsigned int numberOfRequestedThreads )
+{
+    std::vector< double > quantityValues( 6 * evaluationTimes.size( ) );
+
+    const unsigned int numberOfBatches = ( evaluationTimes.size( ) + TIMES_PER_BATCH - 1 ) / TIMES_PER_BATCH;
+    unsigned int numberOfThreads = ( numberOfRequestedThreads == 0 ) ?
+                std::max( std::thread::hardware_concurrency( ), 1u ) : numberOfRequestedThreads;
+    numberOfThreads = std::max( std::min( numberOfThreads, numberOfBatches ), 1u );
+
+    std::atomic< unsigned int > nextTimeIndex( 0 );
+    std::vector< std::exception_ptr > evaluationErrors( numberOfThreads );
+    if( numberOfThreads == 1 )
+    {
+        evaluateItrsToGcrsAnglesOnThread( earthOrientationCalculator, timeScale, evaluationTimes, quantityValues,
+                                          nextTimeIndex, evaluationErrors.at( 0 ) );
+    }
+    else
+    {
+        // Earth orientation calculators keep data of their last evaluation, so a copy is created for each thread.
+        std::vector< boost::shared_ptr< EarthOrientationAnglesCalculator > > threadCalculators;
+        threadCalculators.push_back( earthOrientationCalculator );
+        for( unsigned int i = 1; i < numberOfThreads; i++ )
+        {
+            threadCalculators.push_back( copyEarthOrientationAnglesCalculator( earthOrientationCalculator ) );
+        }
+
+        std::vector< std::thread > evaluationThreads;
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            evaluationThreads.push_back(
+                        std::thread( &evaluateItrsToGcrsAnglesOnThread, threadCalculators.at( i ), timeScale,
+                                     std::cref( evaluationTimes ), std::ref( quantityValues ),
+                                     std::ref( nextTimeIndex ), std::ref( evaluationErrors.at( i ) ) ) );
+        }
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            evaluationThreads.at( i ).join( );
+        }
+    }
+
+    // Re-throw first error that occured during evaluation (if any).
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        if( evaluationErrors.at( i ) )
+        {
+            std::rethrow_exception( evaluationErrors.at( i ) );
+        }
+    }
+
+    return quantityValues;
+}
+
+//! Constructor, computes the table from an Earth orientation calculator.
+ItrsToGcrsAnglesTable::ItrsToGcrsAnglesTable(
+        const double intervalStart, const double intervalEnd,
+        const Eigen::Vector6d& errorTolerances,
+        const basic_astrodynamics::TimeScales timeScale,
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const unsigned int numberOfInterpolationPoints,
+        const double minimumTimeStep,
+        const double maximumTimeStep,
+        const unsigned int numberOfThreads ):
+    intervalStart_( intervalStart ), intervalEnd_( intervalEnd ), errorTolerances_( errorTolerances ),
+    timeScale_( timeScale ), numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+    minimumTimeStep_( minimumTimeStep ), maximumTimeStep_( maximumTimeStep ),
+    sourceFileSize_( 0 ), sourceFileModificationTime_( 0 )
+{
+    if( !( intervalEnd_ > intervalStart_ ) )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS angles table, interval end must be after start" );
+    }
+    if( numberOfInterpolationPoints_ < 2 || numberOfInterpolationPoints_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS angles table, number of interpolation points ( " +
+                                  boost::lexical_cast< std::string >( numberOfInterpolationPoints_ ) +
+                                  " ) must be even" );
+    }
+    if( !( minimumTimeStep_ > 0.0 ) || maximumTimeStep_ < minimumTimeStep_ )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS angles table, inconsistent time step bounds" );
+    }
+    if( !( errorTolerances_.minCoeff( ) > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating ITRS to GCRS angles table, error tolerances must be positive" );
+    }
+
+    computeBarycentricWeights( );
+    selectTimeSteps( earthOrientationCalculator, numberOfThreads );
+    computeNodeValues( earthOrientationCalculator, numberOfThreads );
+}
+
+//! Constructor, reads the table from a file.
+ItrsToGcrsAnglesTable::ItrsToGcrsAnglesTable( const std::string& tableFile )
+{
+    std::ifstream inputFile( tableFile.c_str( ), std::ios::binary );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error, could not open ITRS to GCRS angles table file " + tableFile );
+    }
+
+    // Read settings and node layout of table.
+    char fileIdentifier[ 8 ];
+    boost::uint64_t timeScale;
+    boost::uint64_t numberOfInterpolationPoints;
+    boost::uint64_t formatVersion;
+    boost::uint64_t numberOfNodes[ 6 ];
+    inputFile.read( fileIdentifier, 8 );
+    inputFile.read( reinterpret_cast< char* >( &formatVersion ), sizeof( boost::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( &intervalStart_ ), sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( &intervalEnd_ ), sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( &minimumTimeStep_ ), sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( &maximumTimeStep_ ), sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( errorTolerances_.data( ) ), 6 * sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( timeSteps_.data( ) ), 6 * sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( firstNodeTimes_.data( ) ), 6 * sizeof( double ) );
+    inputFile.read( reinterpret_cast< char* >( &timeScale ), sizeof( boost::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfInterpolationPoints ), sizeof( boost::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( numberOfNodes ), 6 * sizeof( boost::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( &sourceFileSize_ ), sizeof( boost::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( &sourceFileModificationTime_ ), sizeof( boost::int64_t ) );
+    if( !inputFile.good( ) || !std::equal( fileIdentifier, fileIdentifier + 8, anglesTableFileIdentifier ) ||
+            formatVersion != anglesTableFileFormatVersion ||
+            numberOfInterpolationPoints < 2 || numberOfInterpolationPoints % 2 != 0 )
+    {
+        throw std::runtime_error( "Error, file " + tableFile + " is not a valid ITRS to GCRS angles table file" );
+    }
+    timeScale_ = static_cast< basic_astrodynamics::TimeScales >( timeScale );
+    numberOfInterpolationPoints_ = static_cast< unsigned int >( numberOfInterpolationPoints );
+
+    // Check number of nodes against size of remainder of file (before allocating memory for the node values).
+    const std::streampos headerEnd = inputFile.tellg( );
+    inputFile.seekg( 0, std::ios::end );
+    const boost::uint64_t numberOfValuesInFile =
+            static_cast< boost::uint64_t >( inputFile.tellg( ) - headerEnd ) / sizeof( double );
+    inputFile.seekg( headerEnd );
+
+    boost::uint64_t numberOfValues = 0;
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        if( numberOfNodes[ i ] < numberOfInterpolationPoints_ || numberOfNodes[ i ] > numberOfValuesInFile )
+        {
+            throw std::runtime_error( "Error, file " + tableFile + " is not a valid ITRS to GCRS angles table file" );
+        }
+        numberOfNodes_.push_back( static_cast< unsigned int >( numberOfNodes[ i ] ) );
+        firstNodeValueIndices_.push_back( static_cast< unsigned int >( numberOfValues ) );
+        numberOfValues += numberOfNodes[ i ];
+    }
+    if( numberOfValues != numberOfValuesInFile )
+    {
+        throw std::runtime_error( "Error, size of ITRS to GCRS angles table file " + tableFile +
+                                  " is inconsistent with its header" );
+    }
+
+    // Read node values.
+    nodeValues_.resize( numberOfValues );
+    inputFile.read( reinterpret_cast< char* >( nodeValues_.data( ) ), numberOfValues * sizeof( double ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error, ITRS to GCRS angles table file " + tableFile + " is incomplete" );
+    }
+
+    computeBarycentricWeights( );
+}
+
+//! Function to write the table to a (binary) file.
+void ItrsToGcrsAnglesTable::writeToFile( const std::string& tableFile, const std::string& sourceFile ) const
+{
+    const boost::uint64_t formatVersion = anglesTableFileFormatVersion;
+    const boost::uint64_t timeScale = static_cast< boost::uint64_t >( timeScale_ );
+    const boost::uint64_t numberOfInterpolationPoints = numberOfInterpolationPoints_;
+    boost::uint64_t numberOfNodes[ 6 ];
+    std::copy( numberOfNodes_.begin( ), numberOfNodes_.end( ), numberOfNodes );
+    boost::uint64_t sourceFileSize = 0;
+    boost::int64_t sourceFileModificationTime = 0;
+    if( sourceFile != "" )
+    {
+        sourceFileSize = boost::filesystem::file_size( sourceFile );
+        sourceFileModificationTime = boost::filesystem::last_write_time( sourceFile );
+    }
+
+    // Write to temporary file, and move it to its final name when complete.
+    const std::string temporaryFile =
+            tableFile + boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" ).string( );
+    {
+        std::ofstream outputFile( temporaryFile.c_str( ), std::ios::binary );
+        outputFile.write( anglesTableFileIdentifier, 8 );
+        outputFile.write( reinterpret_cast< const char* >( &formatVersion ), sizeof( boost::uint64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( &intervalStart_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &intervalEnd_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &minimumTimeStep_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &maximumTimeStep_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( errorTolerances_.data( ) ), 6 * sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( timeSteps_.data( ) ), 6 * sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( firstNodeTimes_.data( ) ), 6 * sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &timeScale ), sizeof( boost::uint64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( &numberOfInterpolationPoints ), sizeof( boost::uint64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( numberOfNodes ), 6 * sizeof( boost::uint64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( &sourceFileSize ), sizeof( boost::uint64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( &sourceFileModificationTime ), sizeof( boost::int64_t ) );
+        outputFile.write( reinterpret_cast< const char* >( nodeValues_.data( ) ), nodeValues_.size( ) * sizeof( double ) );
+        if( !outputFile.good( ) )
+        {
+            outputFile.close( );
+            std::remove( temporaryFile.c_str( ) );
+            throw std::runtime_error( "Error when writing ITRS to GCRS angles table file " + tableFile );
+        }
+    }
+    boost::filesystem::rename( temporaryFile, tableFile );
+}
+
+//! Function to check whether the table was created from the current version of an Earth orientation data file.
+bool ItrsToGcrsAnglesTable::isCreatedFromFile( const std::string& sourceFile ) const
+{
+    boost::system::error_code errorCode;
+    const boost::uintmax_t sourceFileSize = boost::filesystem::file_size( sourceFile, errorCode );
+    if( errorCode )
+    {
+        return false;
+    }
+    const std::time_t sourceFileModificationTime = boost::filesystem::last_write_time( sourceFile, errorCode );
+    if( errorCode )
+    {
+        return false;
+    }
+    return ( sourceFileSize_ == sourceFileSize ) &&
+            ( sourceFileModificationTime_ == static_cast< boost::int64_t >( sourceFileModificationTime ) );
+}
+
+//! Function to interpolate a single quantity of the table.
+double ItrsToGcrsAnglesTable::getInterpolatedQuantity( const unsigned int quantityIndex, const double timeValue ) const
+{
+    if( quantityIndex > 5 )
+    {
+        throw std::runtime_error( "Error when interpolating ITRS to GCRS angles table, quantity index " +
+                                  boost::lexical_cast< std::string >( quantityIndex ) + " does not exist" );
+    }
+    checkTimeInInterval( timeValue );
+
+    return interpolateQuantity( quantityIndex, timeValue );
+}
+
+//! Function to select the time step of each quantity, from the interpolation errors in a number of sample windows.
+void ItrsToGcrsAnglesTable::selectTimeSteps(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const unsigned int numberOfThreads )
+{
+    const unsigned int numberOfPoints = numberOfInterpolationPoints_;
+    const double intervalLength = intervalEnd_ - intervalStart_;
+
+    // Determine largest time step (as multiple of minimum time step) that is considered.
+    unsigned int maximumStride = 1;
+    while( 2.0 * maximumStride * minimumTimeStep_ <= maximumTimeStep_ &&
+           2.0 * maximumStride * minimumTimeStep_ * numberOfPoints <= intervalLength )
+    {
+        maximumStride *= 2;
+    }
+
+    // Sample Earth orientation at minimum time step in windows spread over the interval, each of which can be used to
+    // test interpolation at the maximum time step.
+    const unsigned int windowLength = ( numberOfPoints + 1 ) * maximumStride;
+    const double numberOfIntervalSteps = std::floor( intervalLength / minimumTimeStep_ );
+    const unsigned int numberOfWindows = ( numberOfIntervalSteps > windowLength ) ? NUMBER_OF_SAMPLE_WINDOWS : 1;
+
+    std::vector< double > sampleTimes;
+    for( unsigned int i = 0; i < numberOfWindows; i++ )
+    {
+        const double windowOffset = ( numberOfWindows == 1 ) ? 0.0 : std::floor(
+                    ( numberOfIntervalSteps - windowLength ) * static_cast< double >( i ) / ( numberOfWindows - 1 ) );
+        for( unsigned int j = 0; j <= windowLength; j++ )
+        {
+            sampleTimes.push_back( intervalStart_ + ( windowOffset + j ) * minimumTimeStep_ );
+        }
+    }
+    std::vector< double > sampleValues = evaluateItrsToGcrsAngles(
+                earthOrientationCalculator, timeScale_, sampleTimes, numberOfThreads );
+
+    // Select largest time step for which interpolation halfway between (central) nodes meets the tolerance.
+    const double localTestTime = 0.5 * static_cast< double >( numberOfPoints - 1 );
+    for( unsigned int quantityIndex = 0; quantityIndex < 6; quantityIndex++ )
+    {
+        unsigned int selectedStride = 1;
+        for( unsigned int stride = 2; stride <= maximumStride; stride *= 2 )
+        {
+            double maximumError = 0.0;
+            for( unsigned int i = 0; i < numberOfWindows; i++ )
+            {
+                const double* windowValues = sampleValues.data( ) + 6 * i * ( windowLength + 1 ) + quantityIndex;
+                for( unsigned int firstNode = 0; firstNode + ( numberOfPoints - 1 ) * stride <= windowLength;
+                     firstNode += stride )
+                {
+                    const unsigned int testIndex = firstNode + ( numberOfPoints / 2 - 1 ) * stride + stride / 2;
+                    const double interpolationError = std::fabs(
+                                interpolateAtEquidistantNodes( windowValues + 6 * firstNode, 6 * stride,
+                                                               localTestTime, barycentricWeights_ ) -
+                                windowValues[ 6 * testIndex ] );
+                    maximumError = std::max( maximumError, interpolationError );
+                }
+            }
+
+            if( maximumError > SAMPLE_ERROR_SAFETY_FACTOR * errorTolerances_( quantityIndex ) )
+            {
+                break;
+            }
+            selectedStride = stride;
+        }
+        timeSteps_( quantityIndex ) = selectedStride * minimumTimeStep_;
+    }
+}
+
+//! Function to compute the values at the nodes of all quantities.
+void ItrsToGcrsAnglesTable::computeNodeValues(
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const unsigned int numberOfThreads )
+{
+    // Nodes of each quantity start numberOfInterpolationPoints_ / 2 - 1 time steps before the interval, and end at least
+    // numberOfInterpolationPoints_ / 2 time steps after it. Time steps are multiples of the minimum time step, so all nodes
+    // are on a grid at the minimum time step from the interval start.
+    const int numberOfNodesBeforeInterval = static_cast< int >( numberOfInterpolationPoints_ / 2 ) - 1;
+    std::vector< std::vector< int > > quantityGridIndices( 6 );
+    std::vector< int > gridIndices;
+    numberOfNodes_.clear( );
+    firstNodeValueIndices_.clear( );
+    unsigned int numberOfValues = 0;
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        const int stride = static_cast< int >( std::round( timeSteps_( i ) / minimumTimeStep_ ) );
+        numberOfNodes_.push_back( static_cast< unsigned int >(
+                                      std::floor( ( intervalEnd_ - intervalStart_ ) / timeSteps_( i ) ) ) +
+                                  numberOfInterpolationPoints_ );
+        firstNodeValueIndices_.push_back( numberOfValues );
+        numberOfValues += numberOfNodes_.at( i );
+        firstNodeTimes_( i ) = intervalStart_ - numberOfNodesBeforeInterval * timeSteps_( i );
+
+        for( unsigned int j = 0; j < numberOfNodes_.at( i ); j++ )
+        {
+            quantityGridIndices[ i ].push_back( ( static_cast< int >( j ) - numberOfNodesBeforeInterval ) * stride );
+        }
+        gridIndices.insert( gridIndices.end( ), quantityGridIndices[ i ].begin( ), quantityGridIndices[ i ].end( ) );
+    }
+
+    // Evaluate Earth orientation once at each grid point that is a node of any quantity.
+    std::sort( gridIndices.begin( ), gridIndices.end( ) );
+    gridIndices.erase( std::unique( gridIndices.begin( ), gridIndices.end( ) ), gridIndices.end( ) );
+    std::vector< double > evaluationTimes( gridIndices.size( ) );
+    for( unsigned int i = 0; i < gridIndices.size( ); i++ )
+    {
+        evaluationTimes[ i ] = intervalStart_ + gridIndices[ i ] * minimumTimeStep_;
+    }
+    std::vector< double > evaluatedValues = evaluateItrsToGcrsAngles(
+                earthOrientationCalculator, timeScale_, evaluationTimes, numberOfThreads );
+
+    // Store values at nodes of each quantity contiguously.
+    nodeValues_.resize( numberOfValues );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        std::vector< int >::const_iterator gridIterator = gridIndices.begin( );
+        for( unsigned int j = 0; j < numberOfNodes_.at( i ); j++ )
+        {
+            gridIterator = std::lower_bound( gridIterator, gridIndices.cend( ), quantityGridIndices[ i ][ j ] );
+            nodeValues_[ firstNodeValueIndices_.at( i ) + j ] =
+                    evaluatedValues[ 6 * ( gridIterator - gridIndices.cbegin( ) ) + i ];
+        }
+    }
+}
+
+//! Function to compute the barycentric weights of the equidistant Lagrange interpolation.
+void ItrsToGcrsAnglesTable::computeBarycentricWeights( )
+{
+    // For nodes 0, 1, ..., n-1, weights are (-1)^i (n-1 choose i).
+    barycentricWeights_.resize( numberOfInterpolationPoints_ );
+    double binomialCoefficient = 1.0;
+    for( unsigned int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        barycentricWeights_[ i ] = ( i % 2 == 0 ) ? binomialCoefficient : -binomialCoefficient;
+        binomialCoefficient *= static_cast< double >( numberOfInterpolationPoints_ - 1 - i ) / static_cast< double >( i + 1 );
+    }
+}
+
+//! Function to check whether a time is in the interval of the table, throws an exception if not.
+void ItrsToGcrsAnglesTable::checkTimeInInterval( const double timeValue ) const
+{
+    if( !( timeValue >= intervalStart_ && timeValue <= intervalEnd_ ) )
+    {
+        throw std::runtime_error( "Error when interpolating ITRS to GCRS angles table, time " +
+                                  boost::lexical_cast< std::string >( timeValue ) + " is outside of table interval [ " +
+                                  boost::lexical_cast< std::string >( intervalStart_ ) + ", " +
+                                  boost::lexical_cast< std::string >( intervalEnd_ ) + " ]" );
+    }
+}
+
+//! Function to interpolate a single quantity of the table, without checking the input.
+double ItrsToGcrsAnglesTable::interpolateQuantity( const unsigned int quantityIndex, const double timeValue ) const
+{
+    // Compute index of first node, such that the time is in the central interval of the nodes (if possible).
+    const double scaledTime = ( timeValue - firstNodeTimes_( quantityIndex ) ) / timeSteps_( quantityIndex );
+    int firstNodeIndex = static_cast< int >( std::floor( scaledTime ) ) -
+            static_cast< int >( numberOfInterpolationPoints_ / 2 ) + 1;
+    firstNodeIndex = std::max( std::min(
+                                   firstNodeIndex, static_cast< int >( numberOfNodes_[ quantityIndex ] -
+                                                                       numberOfInterpolationPoints_ ) ), 0 );
+
+    return interpolateAtEquidistantNodes(
+                nodeValues_.data( ) + firstNodeValueIndices_[ quantityIndex ] + firstNodeIndex, 1,
+                scaledTime - static_cast< double >( firstNodeIndex ), barycentricWeights_ );
+}
+
+//! Function to read an ITRS<->GCRS angles table from file, or to compute it (and write it to file) if no suitable table exists.
+boost::shared_ptr< ItrsToGcrsAnglesTable > createItrsToGcrsAnglesTable(
+        const std::string& tableFile,
+        const double intervalStart, const double intervalEnd,
+        const Eigen::Vector6d& errorTolerances,
+        const basic_astrodynamics::TimeScales timeScale,
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const unsigned int numberOfInterpolationPoints,
+        const double minimumTimeStep,
+        const double maximumTimeStep,
+        const unsigned int numberOfThreads,
+        const std::string& earthOrientationDataFile )
+{
+    // Use existing table if it has been created with the same settings and Earth orientation data, for an interval
+    // containing the current one. An unreadable or corrupt file is replaced.
+    if( std::ifstream( tableFile.c_str( ) ).good( ) )
+    {
+        try
+        {
+            boost::shared_ptr< ItrsToGcrsAnglesTable > anglesTable =
+                    boost::make_shared< ItrsToGcrsAnglesTable >( tableFile );
+            if( anglesTable->getIntervalStart( ) <= intervalStart && anglesTable->getIntervalEnd( ) >= intervalEnd &&
+                    anglesTable->getErrorTolerances( ) == errorTolerances && anglesTable->getTimeScale( ) == timeScale &&
+                    anglesTable->getNumberOfInterpolationPoints( ) == numberOfInterpolationPoints &&
+                    anglesTable->getMinimumTimeStep( ) == minimumTimeStep &&
+                    anglesTable->getMaximumTimeStep( ) == maximumTimeStep &&
+                    ( earthOrientationDataFile == "" || anglesTable->isCreatedFromFile( earthOrientationDataFile ) ) )
+            {
+                return anglesTable;
+            }
+        }
+        catch( const std::runtime_error& )
+        {
+            // Table file is corrupt or unreadable, it is recomputed and overwritten below.
+        }
+    }
+
+    boost::shared_ptr< ItrsToGcrsAnglesTable > anglesTable = boost::make_shared< ItrsToGcrsAnglesTable >(
+                intervalStart, intervalEnd, errorTolerances, timeScale, earthOrientationCalculator,
+                numberOfInterpolationPoints, minimumTimeStep, maximumTimeStep, numberOfThreads );
+    anglesTable->writeToFile( tableFile, earthOrientationDataFile );
+    return anglesTable;
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
@@ -0,0 +1,292 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_ITRSTOGCRSANGLESTABLE_H
+#define TUDAT_ITRSTOGCRSANGLESTABLE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class for tabulated ITRS<->GCRS rotation angles, with the node spacing of each angle set by an error tolerance.
+/*!
+ *  Class for tabulated ITRS<->GCRS rotation angles, to be used instead of the createInterpolatorsForItrsToGcrsAngles
+ *  function when the time step should not be chosen by hand. The table stores X, Y, s, x_p, y_p (IERS Conventions 2010
+ *  notation) and UT1 minus the input time. Each quantity has its own equidistant nodes, interpolated with a Lagrange
+ *  polynomial. Its time step is the largest minimumTimeStep * 2^k (up to maximumTimeStep) for which the interpolation
+ *  error stays below the tolerance. This error is estimated halfway between nodes, in a number of sample windows
+ *  spread over the interval, from a single evaluation of the Earth orientation at the minimum time step.
+ *  The node values are stored in one contiguous array, so each interpolation finds its nodes by direct index
+ *  computation. The nodes are computed on multiple threads (each with its own copy of the Earth orientation calculator).
+ *  A table can be written to a (binary) file and read again, so that it can be reused for multiple runs. The size and
+ *  modification time of the Earth orientation data file from which the table was created can be stored in the file, so
+ *  that an outdated table can be detected.
+ *  NOTE: UT1 minus UTC is discontinuous at leap seconds, so a UTC input time scale should not be used for intervals
+ *  that contain a leap second.
+ */
+class ItrsToGcrsAnglesTable
+{
+public:
+
+    //! Constructor, computes the table from an Earth orientation calculator.
+    /*!
+     *  Constructor, computes the table from an Earth orientation calculator.
+     *  \param intervalStart Start of time interval in which the table is to be used.
+     *  \param intervalEnd End of time interval in which the table is to be used.
+     *  \param errorTolerances Maximum interpolation error of X, Y, s, x_p, y_p (in radians) and UT1 (in seconds).
+     *  If the tolerance of a quantity cannot be met by interpolating at minimumTimeStep, the minimum time step is used.
+     *  \param timeScale Time scale of the input times of the table.
+     *  \param earthOrientationCalculator Object from which Earth orientation data is to be retrieved.
+     *  \param numberOfInterpolationPoints Number of nodes used for each interpolation (must be even).
+     *  \param minimumTimeStep Minimum time step between nodes.
+     *  \param maximumTimeStep Maximum time step between nodes.
+     *  \param numberOfThreads Number of threads on which the nodes are computed (hardware concurrency if 0).
+     */
+    ItrsToGcrsAnglesTable(
+            const double intervalStart, const double intervalEnd,
+            const Eigen::Vector6d& errorTolerances,
+            const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+            const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( ),
+            const unsigned int numberOfInterpolationPoints = 6,
+            const double minimumTimeStep = 60.0,
+            const double maximumTimeStep = 86400.0,
+            const unsigned int numberOfThreads = 0 );
+
+    //! Constructor, reads the table from a file.
+    /*!
+     *  Constructor, reads the table from a file written by writeToFile. An exception is thrown if the file cannot be read.
+     *  \param tableFile Name of the file from which the table is read.
+     */
+    ItrsToGcrsAnglesTable( const std::string& tableFile );
+
+    //! Function to write the table to a (binary) file.
+    /*!
+     *  Function to write the table to a (binary) file, which can be read with the constructor from a file. The file is
+     *  first written under a temporary name and then renamed, so that other processes never read a partially written file.
+     *  \param tableFile Name of the file to which the table is written.
+     *  \param sourceFile Name of the Earth orientation data (EOP) file from which the table was created, used to detect
+     *  when the table file is outdated (no check is performed if empty).
+     */
+    void writeToFile( const std::string& tableFile, const std::string& sourceFile = "" ) const;
+
+    //! Function to check whether the table was created from the current version of an Earth orientation data file.
+    /*!
+     *  Function to check whether the table was created from the current version of an Earth orientation data (EOP) file,
+     *  by comparing the size and modification time of the source file with those stored in the table file.
+     *  \param sourceFile Name of the Earth orientation data file.
+     *  \return True if the size and modification time of sourceFile match those stored in the table file.
+     */
+    bool isCreatedFromFile( const std::string& sourceFile ) const;
+
+    //! Function to interpolate the rotation angles from ITRS to GCRS at given time value.
+    /*!
+     *  Function to interpolate the rotation angles from ITRS to GCRS at given time value, equivalent to
+     *  EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs (with time scale fixed to that of the table).
+     *  \param timeValue Number of seconds since J2000 at which orientation is to be evaluated.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAnglesFromItrsToGcrs( const double timeValue ) const
+    {
+        checkTimeInInterval( timeValue );
+
+        Eigen::Vector5d rotationAngles;
+        for( unsigned int i = 0; i < 5; i++ )
+        {
+            rotationAngles( i ) = interpolateQuantity( i, timeValue );
+        }
+        return std::make_pair( rotationAngles, static_cast< TimeType >( timeValue ) + interpolateQuantity( 5, timeValue ) );
+    }
+
+    //! Function to interpolate a single quantity of the table.
+    /*!
+     *  Function to interpolate a single quantity of the table.
+     *  \param quantityIndex Index of quantity: X, Y, s, x_p, y_p, UT1 minus input time (0-5).
+     *  \param timeValue Number of seconds since J2000 at which the quantity is to be evaluated.
+     *  \return Interpolated quantity.
+     */
+    double getInterpolatedQuantity( const unsigned int quantityIndex, const double timeValue ) const;
+
+    //! Function to retrieve the start of time interval of the table.
+    double getIntervalStart( ) const
+    {
+        return intervalStart_;
+    }
+
+    //! Function to retrieve the end of time interval of the table.
+    double getIntervalEnd( ) const
+    {
+        return intervalEnd_;
+    }
+
+    //! Function to retrieve the error tolerances of the quantities with which the table was created.
+    Eigen::Vector6d getErrorTolerances( ) const
+    {
+        return errorTolerances_;
+    }
+
+    //! Function to retrieve the time scale of the input times of the table.
+    basic_astrodynamics::TimeScales getTimeScale( ) const
+    {
+        return timeScale_;
+    }
+
+    //! Function to retrieve the number of nodes used for each interpolation.
+    unsigned int getNumberOfInterpolationPoints( ) const
+    {
+        return numberOfInterpolationPoints_;
+    }
+
+    //! Function to retrieve the minimum time step between nodes with which the table was created.
+    double getMinimumTimeStep( ) const
+    {
+        return minimumTimeStep_;
+    }
+
+    //! Function to retrieve the maximum time step between nodes with which the table was created.
+    double getMaximumTimeStep( ) const
+    {
+        return maximumTimeStep_;
+    }
+
+    //! Function to retrieve the time steps between the nodes of each quantity.
+    Eigen::Vector6d getTimeSteps( ) const
+    {
+        return timeSteps_;
+    }
+
+    //! Function to retrieve the number of nodes of each quantity.
+    std::vector< unsigned int > getNumberOfNodes( ) const
+    {
+        return numberOfNodes_;
+    }
+
+private:
+
+    //! Function to select the time step of each quantity, from the interpolation errors in a number of sample windows.
+    void selectTimeSteps( const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+                          const unsigned int numberOfThreads );
+
+    //! Function to compute the values at the nodes of all quantities.
+    void computeNodeValues( const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+                            const unsigned int numberOfThreads );
+
+    //! Function to compute the barycentric weights of the equidistant Lagrange interpolation.
+    void computeBarycentricWeights( );
+
+    //! Function to check whether a time is in the interval of the table, throws an exception if not.
+    void checkTimeInInterval( const double timeValue ) const;
+
+    //! Function to interpolate a single quantity of the table, without checking the input.
+    double interpolateQuantity( const unsigned int quantityIndex, const double timeValue ) const;
+
+    //! Start of time interval of the table.
+    double intervalStart_;
+
+    //! End of time interval of the table.
+    double intervalEnd_;
+
+    //! Error tolerances of the quantities with which the table was created.
+    Eigen::Vector6d errorTolerances_;
+
+    //! Time scale of the input times of the table.
+    basic_astrodynamics::TimeScales timeScale_;
+
+    //! Number of nodes used for each interpolation.
+    unsigned int numberOfInterpolationPoints_;
+
+    //! Minimum time step between nodes with which the table was created.
+    double minimumTimeStep_;
+
+    //! Maximum time step between nodes with which the table was created.
+    double maximumTimeStep_;
+
+    //! Time steps between the nodes of each quantity.
+    Eigen::Vector6d timeSteps_;
+
+    //! Times of the first node of each quantity.
+    Eigen::Vector6d firstNodeTimes_;
+
+    //! Number of nodes of each quantity.
+    std::vector< unsigned int > numberOfNodes_;
+
+    //! Index in nodeValues_ of the first node of each quantity.
+    std::vector< unsigned int > firstNodeValueIndices_;
+
+    //! Values at the nodes of all quantities, stored contiguously per quantity.
+    std::vector< double > nodeValues_;
+
+    //! Barycentric weights of the Lagrange interpolation over numberOfInterpolationPoints_ equidistant nodes.
+    std::vector< double > barycentricWeights_;
+
+    //! Size (in bytes) of the Earth orientation data file from which the table was created (0 if not stored).
+    boost::uint64_t sourceFileSize_;
+
+    //! Modification time of the Earth orientation data file from which the table was created (0 if not stored).
+    boost::int64_t sourceFileModificationTime_;
+};
+
+//! Function to read an ITRS<->GCRS angles table from file, or to compute it (and write it to file) if no suitable table exists.
+/*!
+ *  Function to read an ITRS<->GCRS angles table from file, or to compute it and write it to the file if the file does not
+ *  exist, cannot be read, was created with different settings (or for an interval that does not contain the requested
+ *  interval), or was created from a different version of the Earth orientation data file. Note that only the size and
+ *  modification time of the Earth orientation data file are compared, so earthOrientationDataFile must be the file from
+ *  which the data of earthOrientationCalculator was read.
+ *  \param tableFile Name of the file from which the table is read, or to which it is written.
+ *  \param intervalStart Start of time interval in which the table is to be used.
+ *  \param intervalEnd End of time interval in which the table is to be used.
+ *  \param errorTolerances Maximum interpolation error of X, Y, s, x_p, y_p (in radians) and UT1 (in seconds).
+ *  \param timeScale Time scale of the input times of the table.
+ *  \param earthOrientationCalculator Object from which Earth orientation data is to be retrieved.
+ *  \param numberOfInterpolationPoints Number of nodes used for each interpolation (must be even).
+ *  \param minimumTimeStep Minimum time step between nodes.
+ *  \param maximumTimeStep Maximum time step between nodes.
+ *  \param numberOfThreads Number of threads on which the nodes are computed (hardware concurrency if 0).
+ *  \param earthOrientationDataFile Earth orientation data (EOP) file from which earthOrientationCalculator was created
+ *  (not checked if empty).
+ *  \return Table read from or written to tableFile.
+ */
+boost::shared_ptr< ItrsToGcrsAnglesTable > createItrsToGcrsAnglesTable(
+        const std::string& tableFile,
+        const double intervalStart, const double intervalEnd,
+        const Eigen::Vector6d& errorTolerances,
+        const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+        const boost::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+        createStandardEarthOrientationCalculator( ),
+        const unsigned int numberOfInterpolationPoints = 6,
+        const double minimumTimeStep = 60.0,
+        const double maximumTimeStep = 86400.0,
+        const unsigned int numberOfThreads = 0,
+        const std::string& earthOrientationDataFile =
+        input_output::getEarthOrientationDataFilesPath( ) + "eopc04_08_IAU2000.62-now.txt" );
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_ITRSTOGCRSANGLESTABLE_H
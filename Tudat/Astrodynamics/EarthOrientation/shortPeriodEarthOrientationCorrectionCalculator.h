@@ -13,7 +13,12 @@
 #define TUDAT_SHORTPERIODEARTHORIENTATIONCORRECTIONCALCULATOR_H
 
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
@@ -74,14 +79,18 @@ public:
         }
 
         // Read data from files
+        std::vector< Eigen::MatrixXd > argumentAmplitudes;
+        std::vector< Eigen::MatrixXd > argumentMultipliers;
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile;
         for( unsigned int i = 0; i < amplitudesFiles.size( ); i++ )
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
-            argumentMultipliers_.push_back( dataFromFile.second );
+            argumentAmplitudes.push_back( conversionFactor * dataFromFile.first );
+            argumentMultipliers.push_back( dataFromFile.second );
         }
+
+        compileCorrectionTerms( argumentAmplitudes, argumentMultipliers );
     }
 
     //! Function to obtain short period corrections.
@@ -106,8 +115,279 @@ public:
         return sumCorrectionTerms( fundamentalArguments );
     }
 
+    //! Function to set whether the slow-argument cache is used when computing corrections.
+    /*!
+     *  Function to set whether the slow-argument cache is used when computing corrections. When using the cache, the
+     *  sines and cosines of the contributions of the slowly-varying fundamental arguments (all but the fast argument,
+     *  by default GMST + pi) to the tidal phase angles are stored. For subsequent calls at which these contributions
+     *  have changed by no more than maximumSlowArgumentChange for any of the terms, the stored values are updated by
+     *  a second-order Taylor expansion, instead of being recomputed. The error per term is then bounded by
+     *  maximumSlowArgumentChange^3 / 6 times its amplitude. The contribution of the fast argument is always computed
+     *  exactly, which requires its multipliers to be integers.
+     *  \param useCache Boolean denoting whether the slow-argument cache is to be used.
+     *  \param maximumSlowArgumentChange Maximum change (in radians) of the slow contribution to any of the phase
+     *  angles since the stored values were computed, above which the stored values are recomputed.
+     *  \param fastArgumentIndex Index of the fast-varying argument in the fundamental arguments.
+     */
+    void setSlowArgumentCacheSettings( const bool useCache,
+                                       const double maximumSlowArgumentChange = 1.0E-2,
+                                       const unsigned int fastArgumentIndex = 0 )
+    {
+        if( fastArgumentIndex > 5 )
+        {
+            throw std::runtime_error( "Error when setting slow-argument cache of short period Earth orientation "
+                                      "corrections, fast argument index must be smaller than 6." );
+        }
+
+        useSlowArgumentCache_ = useCache;
+        maximumSlowArgumentChange_ = maximumSlowArgumentChange;
+        isSlowArgumentCacheValid_ = false;
+
+        if( useSlowArgumentCache_ )
+        {
+            sortCorrectionTermsByFastArgumentMultiplier( fastArgumentIndex );
+        }
+    }
+
+    //! Function to retrieve the number of unique fundamental argument multiplier combinations that are evaluated.
+    int getNumberOfUniqueCorrectionTerms( ) const
+    {
+        return uniqueArgumentMultipliers_.rows( );
+    }
+
 private:
 
+    //! Function to combine the correction terms of all files into a single set of terms with unique arguments.
+    /*!
+     *  Function to combine the correction terms of all files into a single set of terms, in which the amplitudes of
+     *  terms with identical fundamental argument multipliers are summed, and in which the sine and cosine amplitudes
+     *  are stored as separate (contiguous) matrices. This allows all phase angles to be computed by a single
+     *  matrix-vector product, and all terms to be summed by matrix-vector products. The terms per file are not retained.
+     *  \param argumentAmplitudes Amplitudes of the variations, per file (one term per row)
+     *  \param argumentMultipliers Fundamental argument multipliers of the variations, per file (one term per row)
+     */
+    void compileCorrectionTerms( const std::vector< Eigen::MatrixXd >& argumentAmplitudes,
+                                 const std::vector< Eigen::MatrixXd >& argumentMultipliers )
+    {
+        std::map< std::vector< double >, int > uniqueTermIndices;
+        std::vector< std::vector< double > > uniqueMultipliers;
+        std::vector< Eigen::VectorXd > uniqueAmplitudes;
+
+        for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+        {
+            if( ( i > 0 ) && ( argumentAmplitudes.at( i ).cols( ) != argumentAmplitudes.at( 0 ).cols( ) ) )
+            {
+                throw std::runtime_error( "Error when calling ShortPeriodEarthOrientationCorrectionCalculator, "
+                                          "number of amplitudes is inconsistent" );
+            }
+
+            for( int j = 0; j < argumentMultipliers.at( i ).rows( ); j++ )
+            {
+                std::vector< double > currentMultipliers( 6 );
+                for( int k = 0; k < 6; k++ )
+                {
+                    currentMultipliers[ k ] = argumentMultipliers.at( i )( j, k );
+                }
+
+                if( uniqueTermIndices.count( currentMultipliers ) == 0 )
+                {
+                    uniqueTermIndices[ currentMultipliers ] = uniqueMultipliers.size( );
+                    uniqueMultipliers.push_back( currentMultipliers );
+                    uniqueAmplitudes.push_back( argumentAmplitudes.at( i ).row( j ).transpose( ) );
+                }
+                else
+                {
+                    uniqueAmplitudes[ uniqueTermIndices.at( currentMultipliers ) ] +=
+                            argumentAmplitudes.at( i ).row( j ).transpose( );
+                }
+            }
+        }
+
+        const int numberOfTerms = uniqueMultipliers.size( );
+        const int numberOfComponents = ( argumentAmplitudes.size( ) > 0 ) ? argumentAmplitudes.at( 0 ).cols( ) / 2 : 0;
+        uniqueArgumentMultipliers_.resize( numberOfTerms, 6 );
+        sineAmplitudes_.resize( numberOfTerms, numberOfComponents );
+        cosineAmplitudes_.resize( numberOfTerms, numberOfComponents );
+        for( int i = 0; i < numberOfTerms; i++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                uniqueArgumentMultipliers_( i, k ) = uniqueMultipliers.at( i ).at( k );
+            }
+            for( int k = 0; k < numberOfComponents; k++ )
+            {
+                sineAmplitudes_( i, k ) = uniqueAmplitudes.at( i )( 2 * k );
+                cosineAmplitudes_( i, k ) = uniqueAmplitudes.at( i )( 2 * k + 1 );
+            }
+        }
+
+        currentPhaseAngles_.resize( numberOfTerms );
+        currentSines_.resize( numberOfTerms );
+        currentCosines_.resize( numberOfTerms );
+        currentCorrection_.resize( numberOfComponents );
+    }
+
+    //! Function to sort the unique correction terms by their multiplier of the fast argument.
+    /*!
+     *  Function to sort the unique correction terms by their multiplier of the fast argument, so that all terms with
+     *  the same multiplier are stored contiguously. Also resets the slow-argument cache.
+     *  \param fastArgumentIndex Index of the fast-varying argument in the fundamental arguments.
+     */
+    void sortCorrectionTermsByFastArgumentMultiplier( const unsigned int fastArgumentIndex )
+    {
+        const int numberOfTerms = uniqueArgumentMultipliers_.rows( );
+
+        std::vector< int > sortedIndices( numberOfTerms );
+        for( int i = 0; i < numberOfTerms; i++ )
+        {
+            if( uniqueArgumentMultipliers_( i, fastArgumentIndex ) !=
+                    std::round( uniqueArgumentMultipliers_( i, fastArgumentIndex ) ) )
+            {
+                throw std::runtime_error( "Error when setting slow-argument cache of short period Earth orientation "
+                                          "corrections, multipliers of fast argument must be integers." );
+            }
+            sortedIndices[ i ] = i;
+        }
+        std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ),
+                          [ & ]( const int firstIndex, const int secondIndex )
+        {
+            return uniqueArgumentMultipliers_( firstIndex, fastArgumentIndex ) <
+                    uniqueArgumentMultipliers_( secondIndex, fastArgumentIndex );
+        } );
+
+        Eigen::Matrix< double, Eigen::Dynamic, 6 > unsortedMultipliers = uniqueArgumentMultipliers_;
+        Eigen::MatrixXd unsortedSineAmplitudes = sineAmplitudes_;
+        Eigen::MatrixXd unsortedCosineAmplitudes = cosineAmplitudes_;
+        for( int i = 0; i < numberOfTerms; i++ )
+        {
+            uniqueArgumentMultipliers_.row( i ) = unsortedMultipliers.row( sortedIndices.at( i ) );
+            sineAmplitudes_.row( i ) = unsortedSineAmplitudes.row( sortedIndices.at( i ) );
+            cosineAmplitudes_.row( i ) = unsortedCosineAmplitudes.row( sortedIndices.at( i ) );
+        }
+
+        // Split multipliers into slow and fast contributions, and determine blocks with equal fast multiplier.
+        slowArgumentMultipliers_ = uniqueArgumentMultipliers_;
+        slowArgumentMultipliers_.col( fastArgumentIndex ).setZero( );
+        fastArgumentIndex_ = fastArgumentIndex;
+
+        fastArgumentMultiplierBlocks_.clear( );
+        for( int i = 0; i < numberOfTerms; i++ )
+        {
+            if( i == 0 || uniqueArgumentMultipliers_( i, fastArgumentIndex ) !=
+                    uniqueArgumentMultipliers_( i - 1, fastArgumentIndex ) )
+            {
+                fastArgumentMultiplierBlocks_.push_back(
+                            std::make_pair( uniqueArgumentMultipliers_( i, fastArgumentIndex ), i ) );
+            }
+        }
+
+        maximumSlowMultiplierSum_ = ( numberOfTerms > 0 ) ?
+                    slowArgumentMultipliers_.cwiseAbs( ).rowwise( ).sum( ).maxCoeff( ) : 0.0;
+
+        cachedSlowSines_.resize( numberOfTerms );
+        cachedSlowCosines_.resize( numberOfTerms );
+        slowAngleChanges_.resize( numberOfTerms );
+        slowSines_.resize( numberOfTerms );
+        isSlowArgumentCacheValid_ = false;
+    }
+
+    //! Function to compute the sines and cosines of a list of angles.
+    /*!
+     *  Function to compute the sines and cosines of a list of angles, in a single pass over the angles (so that the
+     *  compiler can combine the sine and cosine of each angle into a single sincos call).
+     *  \param angles Angles for which the sines and cosines are to be computed
+     *  \param sines Sines of the angles (returned by reference, must have the same size as angles)
+     *  \param cosines Cosines of the angles (returned by reference, must have the same size as angles)
+     */
+    static void computeSinesAndCosines( const Eigen::VectorXd& angles, Eigen::ArrayXd& sines, Eigen::ArrayXd& cosines )
+    {
+        for( int i = 0; i < angles.rows( ); i++ )
+        {
+            const double angle = angles( i );
+            sines( i ) = std::sin( angle );
+            cosines( i ) = std::cos( angle );
+        }
+    }
+
+    //! Function to compute the sines and cosines of all phase angles, using the slow-argument cache.
+    /*!
+     *  Function to compute the sines and cosines of all phase angles, using the slow-argument cache (see
+     *  setSlowArgumentCacheSettings), and store them in currentSines_ and currentCosines_
+     *  \param arguments Values of fundamental arguments
+     */
+    void computeSinesAndCosinesFromSlowArgumentCache( const Eigen::Vector6d& arguments )
+    {
+        Eigen::Vector6d argumentChanges = arguments - cachedArguments_;
+        argumentChanges( fastArgumentIndex_ ) = 0.0;
+
+        if( !isSlowArgumentCacheValid_ ||
+                !( maximumSlowMultiplierSum_ * argumentChanges.cwiseAbs( ).maxCoeff( ) <= maximumSlowArgumentChange_ ) )
+        {
+            // Recompute slow contribution to phase angles.
+            currentPhaseAngles_.noalias( ) = slowArgumentMultipliers_ * arguments;
+            computeSinesAndCosines( currentPhaseAngles_, cachedSlowSines_, cachedSlowCosines_ );
+            cachedArguments_ = arguments;
+            isSlowArgumentCacheValid_ = true;
+
+            currentSines_ = cachedSlowSines_;
+            currentCosines_ = cachedSlowCosines_;
+        }
+        else
+        {
+            // Update sines and cosines of slow contribution to second order in angle change.
+            slowAngleChanges_.matrix( ).noalias( ) = slowArgumentMultipliers_ * argumentChanges;
+            currentSines_ = cachedSlowSines_ * ( 1.0 - 0.5 * slowAngleChanges_.square( ) ) +
+                    cachedSlowCosines_ * slowAngleChanges_;
+            currentCosines_ = cachedSlowCosines_ * ( 1.0 - 0.5 * slowAngleChanges_.square( ) ) -
+                    cachedSlowSines_ * slowAngleChanges_;
+        }
+
+        // Add the fast contribution to the phase angles, per block of terms with equal fast argument multiplier.
+        const int numberOfTerms = currentSines_.rows( );
+        for( unsigned int i = 0; i < fastArgumentMultiplierBlocks_.size( ); i++ )
+        {
+            const int blockStart = fastArgumentMultiplierBlocks_.at( i ).second;
+            const int blockSize = ( ( i + 1 < fastArgumentMultiplierBlocks_.size( ) ) ?
+                                        fastArgumentMultiplierBlocks_.at( i + 1 ).second : numberOfTerms ) - blockStart;
+            if( fastArgumentMultiplierBlocks_.at( i ).first != 0.0 )
+            {
+                const double fastAngle = fastArgumentMultiplierBlocks_.at( i ).first * arguments( fastArgumentIndex_ );
+                const double fastSine = std::sin( fastAngle );
+                const double fastCosine = std::cos( fastAngle );
+
+                slowSines_.segment( blockStart, blockSize ) = currentSines_.segment( blockStart, blockSize );
+                currentSines_.segment( blockStart, blockSize ) =
+                        slowSines_.segment( blockStart, blockSize ) * fastCosine +
+                        currentCosines_.segment( blockStart, blockSize ) * fastSine;
+                currentCosines_.segment( blockStart, blockSize ) =
+                        currentCosines_.segment( blockStart, blockSize ) * fastCosine -
+                        slowSines_.segment( blockStart, blockSize ) * fastSine;
+            }
+        }
+    }
+
+    //! Function to compute the sum of all correction terms, as a vector.
+    /*!
+     *  Function to compute the sum of all correction terms, as a vector (with the size of the number of correction
+     *  components), and store it in currentCorrection_.
+     * \param arguments Values of fundamental arguments
+     */
+    void computeCorrectionVector( const Eigen::Vector6d& arguments )
+    {
+        if( useSlowArgumentCache_ )
+        {
+            computeSinesAndCosinesFromSlowArgumentCache( arguments );
+        }
+        else
+        {
+            currentPhaseAngles_.noalias( ) = uniqueArgumentMultipliers_ * arguments;
+            computeSinesAndCosines( currentPhaseAngles_, currentSines_, currentCosines_ );
+        }
+
+        currentCorrection_.noalias( ) = sineAmplitudes_.transpose( ) * currentSines_.matrix( );
+        currentCorrection_.noalias( ) += cosineAmplitudes_.transpose( ) * currentCosines_.matrix( );
+    }
+
     //! Function to sum all the corrcetion terms.
     /*!
      *  Function to sum all the corrcetion terms.
@@ -116,15 +396,66 @@ private:
      */
     OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
-
-    //! Fundamental argument multipliers of libration-induced variations.
-    std::vector< Eigen::MatrixXd > argumentMultipliers_;
-
     //! Fundamental argument functions associated with multipliers.
     boost::function< Eigen::Vector6d( const double ) > argumentFunction_;
 
+    //! Unique combinations of fundamental argument multipliers of all files (one combination per row).
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > uniqueArgumentMultipliers_;
+
+    //! Sine amplitudes of the terms in uniqueArgumentMultipliers_ (one column per correction component).
+    Eigen::MatrixXd sineAmplitudes_;
+
+    //! Cosine amplitudes of the terms in uniqueArgumentMultipliers_ (one column per correction component).
+    Eigen::MatrixXd cosineAmplitudes_;
+
+    //! Phase angles of all terms at the current fundamental arguments (pre-allocated).
+    Eigen::VectorXd currentPhaseAngles_;
+
+    //! Sines of the phase angles of all terms at the current fundamental arguments (pre-allocated).
+    Eigen::ArrayXd currentSines_;
+
+    //! Cosines of the phase angles of all terms at the current fundamental arguments (pre-allocated).
+    Eigen::ArrayXd currentCosines_;
+
+    //! Summed corrections at the current fundamental arguments (pre-allocated).
+    Eigen::VectorXd currentCorrection_;
+
+    //! Boolean denoting whether the slow-argument cache is used.
+    bool useSlowArgumentCache_ = false;
+
+    //! Maximum change of the slow contribution to any phase angle, above which the cache is recomputed.
+    double maximumSlowArgumentChange_ = 1.0E-2;
+
+    //! Index of the fast-varying argument in the fundamental arguments.
+    unsigned int fastArgumentIndex_ = 0;
+
+    //! Fundamental argument multipliers, with the multipliers of the fast argument set to zero.
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > slowArgumentMultipliers_;
+
+    //! Maximum (over all terms) sum of the absolute values of the slow argument multipliers.
+    double maximumSlowMultiplierSum_ = 0.0;
+
+    //! List of fast argument multipliers, with the index of the first term with this multiplier.
+    std::vector< std::pair< double, int > > fastArgumentMultiplierBlocks_;
+
+    //! Boolean denoting whether the slow-argument cache contains valid values.
+    bool isSlowArgumentCacheValid_ = false;
+
+    //! Fundamental arguments at which the slow-argument cache was computed.
+    Eigen::Vector6d cachedArguments_;
+
+    //! Sines of the slow contributions to the phase angles, at cachedArguments_.
+    Eigen::ArrayXd cachedSlowSines_;
+
+    //! Cosines of the slow contributions to the phase angles, at cachedArguments_.
+    Eigen::ArrayXd cachedSlowCosines_;
+
+    //! Change of the slow contributions to the phase angles since cachedArguments_ (pre-allocated).
+    Eigen::ArrayXd slowAngleChanges_;
+
+    //! Sines of the slow contributions to the phase angles at the current fundamental arguments (pre-allocated).
+    Eigen::ArrayXd slowSines_;
+
 
 };
 
@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Function to create Kepler ephemeris of eccentric low Earth orbit, used as reference for Chebyshev ephemerides.
+boost::shared_ptr< Ephemeris > getReferenceKeplerEphemeris( )
+{
+    Eigen::Vector6d keplerElements;
+    keplerElements << 7.0E6, 0.05, 1.2, 0.3, 2.5, 0.1;
+    return boost::make_shared< KeplerEphemeris >( keplerElements, 0.0, 398600.4415E9, "Earth", "J2000" );
+}
+
+//! Check Chebyshev ephemeris fit directly to analytical state function.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFromStateFunction )
+{
+    boost::shared_ptr< Ephemeris > keplerEphemeris = getReferenceKeplerEphemeris( );
+
+    // Fit ephemeris on two-day interval, starting from segments that are too long to meet tolerance.
+    const double startTime = 1.0E4;
+    const double endTime = startTime + 2.0 * 86400.0;
+    const double positionTolerance = 1.0E-3;
+    const double velocityTolerance = 1.0E-6;
+    boost::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianState, keplerEphemeris, _1 ), startTime, endTime, 4.0 * 3600.0,
+                12, positionTolerance, velocityTolerance, 8, "Earth", "J2000" );
+
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getPolynomialDegree( ), 12 );
+    BOOST_CHECK( chebyshevEphemeris->getNumberOfSegments( ) > 12 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getSegmentLength( ) *
+                                static_cast< double >( chebyshevEphemeris->getNumberOfSegments( ) ),
+                                endTime - startTime, 1.0E-14 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getValidityInterval( ).first, startTime );
+
+    // Compare against reference throughout interval (including edges).
+    for( int i = 0; i <= 1000; i++ )
+    {
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) / 1000.0;
+        Eigen::Vector6d stateDifference =
+                chebyshevEphemeris->getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 2.0 * velocityTolerance );
+    }
+
+    // Check consistency of velocity with position (within segment and across segment boundary).
+    const double timeStep = 0.1;
+    for( int i = 0; i < 2; i++ )
+    {
+        const double testTime = ( i == 0 ) ? startTime + 0.3 * chebyshevEphemeris->getSegmentLength( ) :
+                                             startTime + chebyshevEphemeris->getSegmentLength( );
+        Eigen::Vector3d numericalVelocity =
+                ( chebyshevEphemeris->getCartesianState( testTime + timeStep ).segment( 0, 3 ) -
+                  chebyshevEphemeris->getCartesianState( testTime - timeStep ).segment( 0, 3 ) ) / ( 2.0 * timeStep );
+        BOOST_CHECK_SMALL( ( numericalVelocity - chebyshevEphemeris->getCartesianState( testTime ).segment( 3, 3 ) ).norm( ),
+                           1.0E-3 );
+    }
+
+    // Check if times outside of interval are rejected.
+    for( int i = 0; i < 2; i++ )
+    {
+        bool isExceptionCaught = false;
+        try
+        {
+            chebyshevEphemeris->getCartesianState( ( i == 0 ) ? startTime - 1.0 : endTime + 1.0 );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+    }
+
+    // Check if unattainable tolerance is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        fitChebyshevEphemeris(
+                    boost::bind( &Ephemeris::getCartesianState, keplerEphemeris, _1 ), startTime, endTime,
+                    4.0 * 3600.0, 12, positionTolerance, TUDAT_NAN, 1 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Check Chebyshev ephemeris fit to tabulated (numerical) state history.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFromStateHistory )
+{
+    boost::shared_ptr< Ephemeris > keplerEphemeris = getReferenceKeplerEphemeris( );
+
+    // Create state history at typical output step of numerical integration.
+    const double timeStep = 10.0;
+    std::map< double, Eigen::Vector6d > stateHistory;
+    for( int i = 0; i <= 2 * 8640; i++ )
+    {
+        stateHistory[ static_cast< double >( i ) * timeStep ] =
+                keplerEphemeris->getCartesianState( static_cast< double >( i ) * timeStep );
+    }
+
+    // Fit ephemeris to state history.
+    const double positionTolerance = 1.0E-3;
+    boost::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemerisToStateHistory(
+                stateHistory, 3600.0, 14, positionTolerance, TUDAT_NAN, 8, 8, "Earth", "J2000" );
+
+    // Check interval (Lagrange interpolator edges excluded).
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getValidityInterval( ).first, 5.0 * timeStep );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getValidityInterval( ).second,
+                                stateHistory.rbegin( )->first - 5.0 * timeStep, 1.0E-15 );
+
+    // Check memory reduction w.r.t. state history.
+    const int numberOfChebyshevCoefficients = chebyshevEphemeris->getChebyshevCoefficients( ).size( );
+    BOOST_CHECK( 10 * numberOfChebyshevCoefficients < 6 * static_cast< int >( stateHistory.size( ) ) );
+
+    // Compare against reference (tolerance includes Lagrange interpolation error of history).
+    for( int i = 0; i <= 1000; i++ )
+    {
+        const double testTime = chebyshevEphemeris->getValidityInterval( ).first +
+                ( chebyshevEphemeris->getValidityInterval( ).second - chebyshevEphemeris->getValidityInterval( ).first ) *
+                static_cast< double >( i ) / 1000.0;
+        Eigen::Vector6d stateDifference =
+                chebyshevEphemeris->getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-5 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,284 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, sets Chebyshev coefficients, segment definition and frame data.
+ChebyshevEphemeris::ChebyshevEphemeris(
+        const Eigen::MatrixXd& chebyshevCoefficients,
+        const double startTime,
+        const double segmentLength,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    chebyshevCoefficients_( chebyshevCoefficients ), startTime_( startTime ), segmentLength_( segmentLength )
+{
+    if( chebyshevCoefficients_.cols( ) == 0 || chebyshevCoefficients_.rows( ) == 0 ||
+            chebyshevCoefficients_.rows( ) % 3 != 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, coefficient matrix has size " +
+                                  std::to_string( chebyshevCoefficients_.rows( ) ) + "x" +
+                                  std::to_string( chebyshevCoefficients_.cols( ) ) );
+    }
+
+    if( !( segmentLength_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, segment length must be positive." );
+    }
+
+    numberOfCoefficientsPerComponent_ = chebyshevCoefficients_.rows( ) / 3;
+    endTime_ = startTime_ + segmentLength_ * static_cast< double >( chebyshevCoefficients_.cols( ) );
+}
+
+//! Get cartesian state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Determine segment directly from time (allowing for rounding errors at the interval edges).
+    const int numberOfSegments = chebyshevCoefficients_.cols( );
+    const double normalizedTime = ( secondsSinceEpoch - startTime_ ) / segmentLength_;
+    if( !( normalizedTime >= -1.0E-12 && normalizedTime <= static_cast< double >( numberOfSegments ) + 1.0E-12 ) )
+    {
+        throw std::runtime_error( "Error in Chebyshev ephemeris, requested time " + std::to_string( secondsSinceEpoch ) +
+                                  " is outside of interval [" + std::to_string( startTime_ ) + ", " +
+                                  std::to_string( endTime_ ) + "]" );
+    }
+
+    int segmentIndex = static_cast< int >( std::floor( normalizedTime ) );
+    if( segmentIndex < 0 )
+    {
+        segmentIndex = 0;
+    }
+    else if( segmentIndex >= numberOfSegments )
+    {
+        segmentIndex = numberOfSegments - 1;
+    }
+
+    // Compute time scaled to [-1,1] on segment.
+    const double scaledTime = 2.0 * ( normalizedTime - static_cast< double >( segmentIndex ) ) - 1.0;
+    const double twiceScaledTime = 2.0 * scaledTime;
+    const double timeDerivativeOfScaledTime = 2.0 / segmentLength_;
+
+    // Evaluate Chebyshev series and its derivative for each position component, using Clenshaw's recurrence.
+    Eigen::Vector6d currentState;
+    const double* segmentCoefficients = chebyshevCoefficients_.data( ) +
+            segmentIndex * chebyshevCoefficients_.rows( );
+    for( int i = 0; i < 3; i++ )
+    {
+        const double* componentCoefficients = segmentCoefficients + i * numberOfCoefficientsPerComponent_;
+
+        double b1 = 0.0, b2 = 0.0, d1 = 0.0, d2 = 0.0;
+        double b0, d0;
+        for( int k = numberOfCoefficientsPerComponent_ - 1; k > 0; k-- )
+        {
+            b0 = componentCoefficients[ k ] + twiceScaledTime * b1 - b2;
+            d0 = 2.0 * b1 + twiceScaledTime * d1 - d2;
+            b2 = b1;
+            b1 = b0;
+            d2 = d1;
+            d1 = d0;
+        }
+
+        currentState( i ) = componentCoefficients[ 0 ] + scaledTime * b1 - b2;
+        currentState( i + 3 ) = ( b1 + scaledTime * d1 - d2 ) * timeDerivativeOfScaledTime;
+    }
+
+    return currentState;
+}
+
+//! Function to compute the Chebyshev coefficients of position on segments of equal length.
+/*!
+ *  Function to compute the Chebyshev coefficients of position on segments of equal length, by interpolating the
+ *  position returned by the state function at the Chebyshev-Gauss nodes of each segment.
+ *  \param stateFunction Function returning the state as a function of time.
+ *  \param startTime Start time of first segment.
+ *  \param segmentLength Length of each segment.
+ *  \param numberOfSegments Number of segments.
+ *  \param polynomialDegree Degree of the Chebyshev series on each segment.
+ *  \return Chebyshev coefficients of position (in format required by ChebyshevEphemeris).
+ */
+Eigen::MatrixXd computeChebyshevPositionCoefficients(
+        const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double startTime,
+        const double segmentLength,
+        const int numberOfSegments,
+        const int polynomialDegree )
+{
+    const int numberOfNodes = polynomialDegree + 1;
+
+    // Precompute Chebyshev polynomials at nodes: T_{k}(x_{j}) = cos( k * pi * ( j + 1/2 ) / N )
+    Eigen::MatrixXd chebyshevPolynomialsAtNodes( numberOfNodes, numberOfNodes );
+    Eigen::VectorXd scaledNodeTimes( numberOfNodes );
+    for( int j = 0; j < numberOfNodes; j++ )
+    {
+        const double nodeAngle = mathematical_constants::PI * ( static_cast< double >( j ) + 0.5 ) /
+                static_cast< double >( numberOfNodes );
+        scaledNodeTimes( j ) = std::cos( nodeAngle );
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            chebyshevPolynomialsAtNodes( k, j ) = std::cos( static_cast< double >( k ) * nodeAngle );
+        }
+    }
+
+    // Compute coefficients for each segment from positions at nodes.
+    Eigen::MatrixXd chebyshevCoefficients = Eigen::MatrixXd::Zero( 3 * numberOfNodes, numberOfSegments );
+    Eigen::MatrixXd positionsAtNodes( numberOfNodes, 3 );
+    for( int segment = 0; segment < numberOfSegments; segment++ )
+    {
+        const double segmentMidTime = startTime + ( static_cast< double >( segment ) + 0.5 ) * segmentLength;
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            positionsAtNodes.row( j ) = stateFunction(
+                        segmentMidTime + 0.5 * segmentLength * scaledNodeTimes( j ) ).segment( 0, 3 ).transpose( );
+        }
+
+        for( int i = 0; i < 3; i++ )
+        {
+            Eigen::VectorXd componentCoefficients =
+                    2.0 / static_cast< double >( numberOfNodes ) * chebyshevPolynomialsAtNodes * positionsAtNodes.col( i );
+            componentCoefficients( 0 ) *= 0.5;
+            chebyshevCoefficients.block( i * numberOfNodes, segment, numberOfNodes, 1 ) = componentCoefficients;
+        }
+    }
+
+    return chebyshevCoefficients;
+}
+
+//! Function to fit a Chebyshev ephemeris to a state function.
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double startTime,
+        const double endTime,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int maximumNumberOfRefinements,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( !( endTime > startTime ) || !( initialSegmentLength > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, time interval or segment length is invalid." );
+    }
+
+    if( polynomialDegree < 1 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, polynomial degree must be at least 1." );
+    }
+
+    const bool checkVelocity = ( velocityTolerance == velocityTolerance );
+    const int numberOfNodes = polynomialDegree + 1;
+
+    int numberOfSegments = static_cast< int >( std::ceil( ( endTime - startTime ) / initialSegmentLength ) );
+    double maximumPositionError = TUDAT_NAN, maximumVelocityError = TUDAT_NAN;
+    for( int refinement = 0; refinement <= maximumNumberOfRefinements; refinement++ )
+    {
+        // Fit segments of current length.
+        const double segmentLength = ( endTime - startTime ) / static_cast< double >( numberOfSegments );
+        boost::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = boost::make_shared< ChebyshevEphemeris >(
+                    computeChebyshevPositionCoefficients(
+                        stateFunction, startTime, segmentLength, numberOfSegments, polynomialDegree ),
+                    startTime, segmentLength, referenceFrameOrigin, referenceFrameOrientation );
+
+        // Check errors at extrema of highest-degree polynomial, which lie in between the fitting nodes.
+        maximumPositionError = 0.0;
+        maximumVelocityError = 0.0;
+        Eigen::Vector6d stateDifference;
+        for( int segment = 0; segment < numberOfSegments; segment++ )
+        {
+            const double segmentMidTime = startTime + ( static_cast< double >( segment ) + 0.5 ) * segmentLength;
+            for( int j = 0; j <= numberOfNodes; j++ )
+            {
+                const double testTime = segmentMidTime + 0.5 * segmentLength * std::cos(
+                            mathematical_constants::PI * static_cast< double >( j ) /
+                            static_cast< double >( numberOfNodes ) );
+                stateDifference = chebyshevEphemeris->getCartesianState( testTime ) - stateFunction( testTime );
+                maximumPositionError = std::max( maximumPositionError, stateDifference.segment( 0, 3 ).norm( ) );
+                maximumVelocityError = std::max( maximumVelocityError, stateDifference.segment( 3, 3 ).norm( ) );
+            }
+        }
+
+        if( maximumPositionError <= positionTolerance && ( !checkVelocity || maximumVelocityError <= velocityTolerance ) )
+        {
+            return chebyshevEphemeris;
+        }
+
+        numberOfSegments *= 2;
+    }
+
+    throw std::runtime_error( "Error when fitting Chebyshev ephemeris, tolerance not met after " +
+                              std::to_string( maximumNumberOfRefinements ) + " refinements; maximum position error: " +
+                              std::to_string( maximumPositionError ) + ", maximum velocity error: " +
+                              std::to_string( maximumVelocityError ) );
+}
+
+//! Function to fit a Chebyshev ephemeris to a (numerically propagated) state history.
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int numberOfLagrangeInterpolationStages,
+        const int maximumNumberOfRefinements,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( static_cast< int >( stateHistory.size( ) ) < numberOfLagrangeInterpolationStages + 4 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris to state history, history contains " +
+                                  std::to_string( stateHistory.size( ) ) + " states, which is insufficient for " +
+                                  std::to_string( numberOfLagrangeInterpolationStages ) + "-stage interpolation." );
+    }
+
+    return fitChebyshevEphemerisToTabulatedEphemeris(
+                boost::make_shared< TabulatedCartesianEphemeris< double, double > >(
+                    boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                        stateHistory, numberOfLagrangeInterpolationStages ),
+                    referenceFrameOrigin, referenceFrameOrientation ),
+                initialSegmentLength, polynomialDegree, positionTolerance, velocityTolerance,
+                maximumNumberOfRefinements );
+}
+
+//! Function to fit a Chebyshev ephemeris to a tabulated ephemeris.
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToTabulatedEphemeris(
+        const boost::shared_ptr< Ephemeris > tabulatedEphemeris,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int maximumNumberOfRefinements )
+{
+    std::pair< double, double > fitInterval = getTabulatedEphemerisSafeInterval( tabulatedEphemeris );
+
+    return fitChebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianState, tabulatedEphemeris, _1 ),
+                fitInterval.first, fitInterval.second, initialSegmentLength, polynomialDegree,
+                positionTolerance, velocityTolerance, maximumNumberOfRefinements,
+                tabulatedEphemeris->getReferenceFrameOrigin( ), tabulatedEphemeris->getReferenceFrameOrientation( ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,237 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <map>
+#include <string>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from piecewise Chebyshev polynomials.
+/*!
+ *  Class that determines an ephemeris from piecewise Chebyshev polynomials (in the manner of SPICE type 2 SPK segments).
+ *  The time interval of the ephemeris is divided into segments of equal length, and on each segment the position
+ *  is given by a Chebyshev series of fixed degree in each of its components. The velocity is the analytical time
+ *  derivative of this series, so that the position and velocity are fully consistent. The segment at a given time is
+ *  found directly from the time (no search required), and the series are evaluated using Clenshaw's recurrence.
+ *  Compared to a TabulatedCartesianEphemeris of a propagated body, this ephemeris requires much less memory for a
+ *  given accuracy. Objects of this class are typically created by the fitChebyshevEphemeris function.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, sets Chebyshev coefficients, segment definition and frame data.
+    /*!
+     *  Constructor, sets Chebyshev coefficients, segment definition and frame data.
+     *  \param chebyshevCoefficients Chebyshev coefficients of position. Each column contains the coefficients of a single
+     *  segment: the first ( polynomialDegree + 1 ) entries are the x-position coefficients (in order of increasing
+     *  degree), followed by those of the y- and z-position.
+     *  \param startTime Start time of the first segment.
+     *  \param segmentLength Length of each segment (in seconds).
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevEphemeris(
+            const Eigen::MatrixXd& chebyshevCoefficients,
+            const double startTime,
+            const double segmentLength,
+            const std::string& referenceFrameOrigin = "SSB",
+            const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ){ }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     *  Returns cartesian state from ephemeris, by evaluating the Chebyshev series of the segment containing the given
+     *  time (and its derivative). An exception is thrown if the time is outside of the interval covered by the segments.
+     *  \param secondsSinceEpoch Seconds since epoch.
+     *  \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to return the Chebyshev coefficients of position
+    /*!
+     *  Function to return the Chebyshev coefficients of position (see constructor for format).
+     *  \return Chebyshev coefficients of position
+     */
+    Eigen::MatrixXd getChebyshevCoefficients( )
+    {
+        return chebyshevCoefficients_;
+    }
+
+    //! Function to return the degree of the Chebyshev series
+    /*!
+     *  Function to return the degree of the Chebyshev series
+     *  \return Degree of the Chebyshev series
+     */
+    int getPolynomialDegree( )
+    {
+        return numberOfCoefficientsPerComponent_ - 1;
+    }
+
+    //! Function to return the number of segments
+    /*!
+     *  Function to return the number of segments
+     *  \return Number of segments
+     */
+    int getNumberOfSegments( )
+    {
+        return chebyshevCoefficients_.cols( );
+    }
+
+    //! Function to return the length of each segment
+    /*!
+     *  Function to return the length of each segment
+     *  \return Length of each segment (in seconds).
+     */
+    double getSegmentLength( )
+    {
+        return segmentLength_;
+    }
+
+    //! Function to return the time interval on which the ephemeris is defined
+    /*!
+     *  Function to return the time interval on which the ephemeris is defined
+     *  \return Pair with start and end time of interval on which the ephemeris is defined
+     */
+    std::pair< double, double > getValidityInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+private:
+
+    //! Chebyshev coefficients of position, with one column per segment (see constructor).
+    Eigen::MatrixXd chebyshevCoefficients_;
+
+    //! Start time of the first segment.
+    double startTime_;
+
+    //! End time of the last segment.
+    double endTime_;
+
+    //! Length of each segment (in seconds).
+    double segmentLength_;
+
+    //! Number of Chebyshev coefficients of each position component (i.e. degree + 1).
+    int numberOfCoefficientsPerComponent_;
+};
+
+//! Function to fit a Chebyshev ephemeris to a state function.
+/*!
+ *  Function to fit a Chebyshev ephemeris to a state function. The interval between the start and end time is divided
+ *  into segments of equal length, which are no longer than the given initial segment length. On each segment, the
+ *  position components are interpolated by a Chebyshev series at the Chebyshev-Gauss nodes of the segment. The position
+ *  and velocity of the resulting ephemeris are then compared to those of the state function at points in between
+ *  the nodes. If the difference exceeds the tolerance on any of the segments, the number of segments is doubled and the
+ *  fit is repeated. An exception is thrown if the tolerance is not met after the maximum number of refinements.
+ *  \param stateFunction Function returning the state as a function of time, to which the ephemeris is to be fit (e.g.
+ *  the interpolated numerical solution of a propagated body).
+ *  \param startTime Start time of interval on which ephemeris is to be fit.
+ *  \param endTime End time of interval on which ephemeris is to be fit.
+ *  \param initialSegmentLength Maximum length of each segment for the first fit (in seconds).
+ *  \param polynomialDegree Degree of the Chebyshev series on each segment.
+ *  \param positionTolerance Maximum allowed difference (norm) in position w.r.t. state function.
+ *  \param velocityTolerance Maximum allowed difference (norm) in velocity w.r.t. state function (default NaN, in which
+ *  case velocity is not checked).
+ *  \param maximumNumberOfRefinements Maximum number of times the number of segments is doubled.
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \return Chebyshev ephemeris that is fit to the state function.
+ */
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double startTime,
+        const double endTime,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance = TUDAT_NAN,
+        const int maximumNumberOfRefinements = 8,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to fit a Chebyshev ephemeris to a (numerically propagated) state history.
+/*!
+ *  Function to fit a Chebyshev ephemeris to a (numerically propagated) state history. The state history is first
+ *  interpolated using a Lagrange interpolator, to which the Chebyshev segments are fit by the fitChebyshevEphemeris
+ *  function. The ephemeris is fit on the interval of the state history where the Lagrange interpolator has its full
+ *  accuracy, i.e. excluding the first and last ( numberOfLagrangeInterpolationStages / 2 + 1 ) states.
+ *  \param stateHistory Map of states as a function of time, to which the ephemeris is to be fit.
+ *  \param initialSegmentLength Maximum length of each segment for the first fit (in seconds).
+ *  \param polynomialDegree Degree of the Chebyshev series on each segment.
+ *  \param positionTolerance Maximum allowed difference (norm) in position w.r.t. interpolated state history.
+ *  \param velocityTolerance Maximum allowed difference (norm) in velocity w.r.t. interpolated state history (default NaN,
+ *  in which case velocity is not checked).
+ *  \param numberOfLagrangeInterpolationStages Number of stages of Lagrange interpolator used for state history.
+ *  \param maximumNumberOfRefinements Maximum number of times the number of segments is doubled.
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \return Chebyshev ephemeris that is fit to the state history.
+ */
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance = TUDAT_NAN,
+        const int numberOfLagrangeInterpolationStages = 8,
+        const int maximumNumberOfRefinements = 8,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to fit a Chebyshev ephemeris to a tabulated ephemeris.
+/*!
+ *  Function to fit a Chebyshev ephemeris to a tabulated ephemeris (e.g. the ephemeris of a propagated body that is set
+ *  from the numerical solution), on the interval where it can be safely interrogated
+ *  (see getTabulatedEphemerisSafeInterval). The reference frame of the tabulated ephemeris is retained.
+ *  \param tabulatedEphemeris Tabulated ephemeris to which the Chebyshev ephemeris is to be fit. An exception is thrown if
+ *  this is not a tabulated ephemeris.
+ *  \param initialSegmentLength Maximum length of each segment for the first fit (in seconds).
+ *  \param polynomialDegree Degree of the Chebyshev series on each segment.
+ *  \param positionTolerance Maximum allowed difference (norm) in position w.r.t. tabulated ephemeris.
+ *  \param velocityTolerance Maximum allowed difference (norm) in velocity w.r.t. tabulated ephemeris (default NaN,
+ *  in which case velocity is not checked).
+ *  \param maximumNumberOfRefinements Maximum number of times the number of segments is doubled.
+ *  \return Chebyshev ephemeris that is fit to the tabulated ephemeris.
+ */
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToTabulatedEphemeris(
+        const boost::shared_ptr< Ephemeris > tabulatedEphemeris,
+        const double initialSegmentLength,
+        const int polynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance = TUDAT_NAN,
+        const int maximumNumberOfRefinements = 8 );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
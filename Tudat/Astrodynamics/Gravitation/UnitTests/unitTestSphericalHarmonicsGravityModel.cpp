@@ -298,6 +298,201 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperCla
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-15 );
 }
 
+// Check the order-major vectorized summation against the term-by-term summation for a high-degree field.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationOrderMajorSummation )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define synthetic geodesy-normalized coefficients up to degree and order 200, with a Kaula-like decay.
+    const int maximumDegree = 200;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::cos( 1.3 * degree + 0.7 * order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) *
+                        std::sin( 0.4 * degree + 1.9 * order );
+            }
+        }
+    }
+
+    // Define test positions, including positions close to the poles.
+    std::vector< Eigen::Vector3d > positions;
+    positions.push_back( Eigen::Vector3d( 7.0e6, 8.0e6, 9.0e6 ) );
+    positions.push_back( Eigen::Vector3d( -6.8e6, 1.2e5, -2.0e5 ) );
+    positions.push_back( Eigen::Vector3d( 1.0e2, -3.0e1, 6.9e6 ) );
+    positions.push_back( Eigen::Vector3d( 4.0e3, 2.0e3, -7.1e6 ) );
+
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > termByTermCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > orderMajorCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+    std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+
+    // Compare accelerations from both summation methods.
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        const Eigen::Vector3d termByTermAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.at( i ), gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    termByTermCache, dummyMap );
+        const Eigen::Vector3d orderMajorAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+                    positions.at( i ), gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    orderMajorCache );
+
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( termByTermAcceleration( j ) - orderMajorAcceleration( j ) ),
+                               1.0E-13 * termByTermAcceleration.norm( ) );
+        }
+    }
+
+    // Compare results from acceleration model, with both summation methods.
+    SphericalHarmonicsGravitationalAccelerationModelPointer termByTermGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::constant( positions.at( 0 ) ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsGravitationalAccelerationModelPointer orderMajorGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::constant( positions.at( 0 ) ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    orderMajorGravity->setEvaluationMethod( order_major_vectorized_evaluation );
+    orderMajorGravity->updateMembers( );
+    BOOST_CHECK_EQUAL( orderMajorGravity->getEvaluationMethod( ), order_major_vectorized_evaluation );
+
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( termByTermGravity->getAcceleration( )( j ) -
+                                      orderMajorGravity->getAcceleration( )( j ) ),
+                           1.0E-13 * termByTermGravity->getAcceleration( ).norm( ) );
+    }
+
+    // Compare both summation methods for a sequence of slightly perturbed positions, which forces cache updates.
+    const int numberOfEvaluations = 200;
+    Eigen::Vector3d accumulatedAcceleration = Eigen::Vector3d::Zero( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        accumulatedAcceleration += computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.at( 0 ) + Eigen::Vector3d::Constant( static_cast< double >( i ) ),
+                    gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    termByTermCache, dummyMap );
+        accumulatedAcceleration -= computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+                    positions.at( 0 ) + Eigen::Vector3d::Constant( static_cast< double >( i ) ),
+                    gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    orderMajorCache );
+    }
+    BOOST_CHECK_SMALL( accumulatedAcceleration.norm( ), 1.0E-11 * numberOfEvaluations );
+}
+
+// Check the Cunningham recursion against the term-by-term summation for a high-degree field, including at the poles.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationCunninghamRecursion )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define synthetic geodesy-normalized coefficients up to degree 200 and order 150, with a Kaula-like decay.
+    const int maximumDegree = 200;
+    const int maximumOrder = 150;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; ( order <= degree ) && ( order <= maximumOrder ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::cos( 1.3 * degree + 0.7 * order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) *
+                        std::sin( 0.4 * degree + 1.9 * order );
+            }
+        }
+    }
+
+    std::vector< Eigen::Vector3d > positions;
+    positions.push_back( Eigen::Vector3d( 7.0e6, 8.0e6, 9.0e6 ) );
+    positions.push_back( Eigen::Vector3d( -6.8e6, 1.2e5, -2.0e5 ) );
+    positions.push_back( Eigen::Vector3d( 1.0e2, -3.0e1, 6.9e6 ) );
+    positions.push_back( Eigen::Vector3d( 4.0e3, 2.0e3, -7.1e6 ) );
+
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumOrder + 1 );
+    boost::shared_ptr< CunninghamRecursionCache > recursionCache = boost::make_shared< CunninghamRecursionCache >( );
+    std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+
+    // Compare accelerations from term-by-term summation and recursion, for full field and for low degree/order.
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        for( unsigned int test = 0; test < 2; test++ )
+        {
+            const int numberOfRows = ( test == 0 ) ? maximumDegree + 1 : 6;
+            const int numberOfColumns = ( test == 0 ) ? maximumOrder + 1 : 4;
+            const Eigen::Vector3d termByTermAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions.at( i ), gravitationalParameter, planetaryRadius,
+                        cosineCoefficients.block( 0, 0, numberOfRows, numberOfColumns ),
+                        sineCoefficients.block( 0, 0, numberOfRows, numberOfColumns ),
+                        sphericalHarmonicsCache, dummyMap );
+            const Eigen::Vector3d recursiveAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+                        positions.at( i ), gravitationalParameter, planetaryRadius,
+                        cosineCoefficients.block( 0, 0, numberOfRows, numberOfColumns ),
+                        sineCoefficients.block( 0, 0, numberOfRows, numberOfColumns ),
+                        recursionCache );
+
+            // Term-by-term summation loses precision close to the pole (position 3 is 100 m from the polar axis).
+            const double tolerance = ( i == 2 ) ? 1.0E-11 : 1.0E-13;
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( termByTermAcceleration( j ) - recursiveAcceleration( j ) ),
+                                   tolerance * termByTermAcceleration.norm( ) );
+            }
+        }
+    }
+
+    // Check that recursion is well-defined exactly at the pole (where the term-by-term summation is singular), and
+    // continuous with a point close to the pole.
+    const Eigen::Vector3d poleAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+                Eigen::Vector3d( 0.0, 0.0, 6.9e6 ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients, recursionCache );
+    const Eigen::Vector3d nearPoleAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+                Eigen::Vector3d( 1.0E-3, 1.0E-3, 6.9e6 ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients, recursionCache );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_EQUAL( std::isnan( poleAcceleration( j ) ), false );
+        BOOST_CHECK_SMALL( std::fabs( poleAcceleration( j ) - nearPoleAcceleration( j ) ),
+                           1.0E-9 * poleAcceleration.norm( ) );
+    }
+
+    // Compare results from acceleration model, with recursive evaluation selected.
+    SphericalHarmonicsGravitationalAccelerationModelPointer termByTermGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::constant( positions.at( 0 ) ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsGravitationalAccelerationModelPointer recursiveGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::constant( positions.at( 0 ) ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    recursiveGravity->setEvaluationMethod( cunningham_recursive_evaluation );
+    recursiveGravity->updateMembers( );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( termByTermGravity->getAcceleration( )( j ) -
+                                      recursiveGravity->getAcceleration( )( j ) ),
+                           1.0E-13 * termByTermGravity->getAcceleration( ).norm( ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
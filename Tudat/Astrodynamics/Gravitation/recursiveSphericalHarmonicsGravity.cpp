@@ -0,0 +1,210 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Tudat/Astrodynamics/Gravitation/recursiveSphericalHarmonicsGravity.h"
+
+namespace tudat
+{
+namespace gravitation
+{
+
+//! Update maximum degree and order of cache
+void CunninghamRecursionCache::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = std::min( maximumOrder, maximumDegree );
+
+    // Pre-compute square roots required for normalization factors (up to 2 * ( maximumDegree_ + 1 ) + 3 ).
+    const int numberOfSquareRoots = 2 * maximumDegree_ + 6;
+    squareRoots_.resize( numberOfSquareRoots );
+    inverseSquareRoots_.resize( numberOfSquareRoots );
+    squareRoots_[ 0 ] = 0.0;
+    inverseSquareRoots_[ 0 ] = 0.0;
+    for( int i = 1; i < numberOfSquareRoots; i++ )
+    {
+        squareRoots_[ i ] = std::sqrt( static_cast< double >( i ) );
+        inverseSquareRoots_[ i ] = 1.0 / squareRoots_[ i ];
+    }
+
+    // Solid harmonics are required up to degree maximumDegree_ + 1.
+    cosineSolidHarmonics_.setZero( maximumDegree_ + 2, 3 );
+    sineSolidHarmonics_.setZero( maximumDegree_ + 2, 3 );
+}
+
+//! Function to compute the normalized solid harmonics at a single order, for all degrees
+void CunninghamRecursionCache::computeSolidHarmonicsAtOrder(
+        const int order, const int highestDegree, const double scaledZComponent, const double squaredRadiusRatio )
+{
+    const int column = order % 3;
+    double* cosineTerms = cosineSolidHarmonics_.col( column ).data( );
+    double* sineTerms = sineSolidHarmonics_.col( column ).data( );
+
+    // Compute first non-sectoral term.
+    if( order <= highestDegree )
+    {
+        const double recursionFactor = squareRoots_[ 2 * order + 3 ] * scaledZComponent;
+        cosineTerms[ order + 1 ] = recursionFactor * cosineTerms[ order ];
+        sineTerms[ order + 1 ] = recursionFactor * sineTerms[ order ];
+    }
+
+    // Compute remaining terms from recursion in degree.
+    for( int degree = order + 2; degree <= highestDegree + 1; degree++ )
+    {
+        const double inverseNormalization =
+                inverseSquareRoots_[ degree - order ] * inverseSquareRoots_[ degree + order ];
+        const double firstFactor = squareRoots_[ 2 * degree + 1 ] * squareRoots_[ 2 * degree - 1 ] *
+                inverseNormalization * scaledZComponent;
+        const double secondFactor = squareRoots_[ 2 * degree + 1 ] * squareRoots_[ degree + order - 1 ] *
+                squareRoots_[ degree - order - 1 ] * inverseSquareRoots_[ 2 * degree - 3 ] *
+                inverseNormalization * squaredRadiusRatio;
+
+        cosineTerms[ degree ] = firstFactor * cosineTerms[ degree - 1 ] - secondFactor * cosineTerms[ degree - 2 ];
+        sineTerms[ degree ] = firstFactor * sineTerms[ degree - 1 ] - secondFactor * sineTerms[ degree - 2 ];
+    }
+}
+
+//! Function to compute the gravitational acceleration due to a spherical harmonic gravity field.
+Eigen::Vector3d CunninghamRecursionCache::computeAcceleration(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    // Set highest degree and order of coefficients.
+    const int highestDegree = cosineHarmonicCoefficients.rows( ) - 1;
+    const int highestOrder = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ) - 1, highestDegree );
+
+    // Resize cache if needed.
+    if( highestDegree > maximumDegree_ )
+    {
+        resetMaximumDegreeAndOrder( highestDegree, highestDegree );
+    }
+
+    // Compute scaled position components.
+    const double squaredDistance = positionOfBodySubjectToAcceleration.squaredNorm( );
+    const double scalingFactor = referenceRadius / squaredDistance;
+    const double scaledXComponent = positionOfBodySubjectToAcceleration.x( ) * scalingFactor;
+    const double scaledYComponent = positionOfBodySubjectToAcceleration.y( ) * scalingFactor;
+    const double scaledZComponent = positionOfBodySubjectToAcceleration.z( ) * scalingFactor;
+    const double squaredRadiusRatio = referenceRadius * scalingFactor;
+
+    // Compute solid harmonics at order 0 and 1.
+    cosineSolidHarmonics_( 0, 0 ) = referenceRadius / std::sqrt( squaredDistance );
+    sineSolidHarmonics_( 0, 0 ) = 0.0;
+    computeSolidHarmonicsAtOrder( 0, highestDegree, scaledZComponent, squaredRadiusRatio );
+
+    cosineSolidHarmonics_( 1, 1 ) = squareRoots_[ 3 ] * scaledXComponent * cosineSolidHarmonics_( 0, 0 );
+    sineSolidHarmonics_( 1, 1 ) = squareRoots_[ 3 ] * scaledYComponent * cosineSolidHarmonics_( 0, 0 );
+    computeSolidHarmonicsAtOrder( 1, highestDegree, scaledZComponent, squaredRadiusRatio );
+
+    double xAcceleration = 0.0, yAcceleration = 0.0, zAcceleration = 0.0;
+    for( int order = 0; order <= highestOrder; order++ )
+    {
+        const int currentColumn = order % 3;
+        const int nextColumn = ( order + 1 ) % 3;
+        const int previousColumn = ( order + 2 ) % 3;
+
+        // Compute solid harmonics at next order (overwriting those at order - 2), starting from sectoral term.
+        if( order > 0 )
+        {
+            const int nextOrder = order + 1;
+            const double sectoralFactor = squareRoots_[ 2 * nextOrder + 1 ] * inverseSquareRoots_[ 2 * nextOrder ];
+            cosineSolidHarmonics_( nextOrder, nextColumn ) = sectoralFactor * (
+                        scaledXComponent * cosineSolidHarmonics_( order, currentColumn ) -
+                        scaledYComponent * sineSolidHarmonics_( order, currentColumn ) );
+            sineSolidHarmonics_( nextOrder, nextColumn ) = sectoralFactor * (
+                        scaledXComponent * sineSolidHarmonics_( order, currentColumn ) +
+                        scaledYComponent * cosineSolidHarmonics_( order, currentColumn ) );
+            computeSolidHarmonicsAtOrder( nextOrder, highestDegree, scaledZComponent, squaredRadiusRatio );
+        }
+
+        const double* currentCosineTerms = cosineSolidHarmonics_.col( currentColumn ).data( );
+        const double* currentSineTerms = sineSolidHarmonics_.col( currentColumn ).data( );
+        const double* nextCosineTerms = cosineSolidHarmonics_.col( nextColumn ).data( );
+        const double* nextSineTerms = sineSolidHarmonics_.col( nextColumn ).data( );
+        const double* previousCosineTerms = cosineSolidHarmonics_.col( previousColumn ).data( );
+        const double* previousSineTerms = sineSolidHarmonics_.col( previousColumn ).data( );
+
+        // Add contributions of all degrees at current order.
+        for( int degree = order; degree <= highestDegree; degree++ )
+        {
+            const double cosineCoefficient = cosineHarmonicCoefficients( degree, order );
+            const double sineCoefficient = sineHarmonicCoefficients( degree, order );
+
+            const double commonNormalization = squareRoots_[ 2 * degree + 1 ] * inverseSquareRoots_[ 2 * degree + 3 ];
+
+            // Normalization factor for terms at degree + 1 and order + 1.
+            const double nextOrderNormalization = commonNormalization *
+                    squareRoots_[ degree + order + 1 ] * squareRoots_[ degree + order + 2 ];
+
+            if( order == 0 )
+            {
+                const double zonalNormalization = 0.5 * squareRoots_[ 2 ] * nextOrderNormalization;
+                xAcceleration -= zonalNormalization * cosineCoefficient * nextCosineTerms[ degree + 1 ];
+                yAcceleration -= zonalNormalization * cosineCoefficient * nextSineTerms[ degree + 1 ];
+            }
+            else
+            {
+                // Normalization factor for terms at degree + 1 and order - 1.
+                double previousOrderNormalization = commonNormalization *
+                        squareRoots_[ degree - order + 1 ] * squareRoots_[ degree - order + 2 ];
+                if( order == 1 )
+                {
+                    previousOrderNormalization *= squareRoots_[ 2 ];
+                }
+
+                xAcceleration += 0.5 * (
+                            nextOrderNormalization * ( -cosineCoefficient * nextCosineTerms[ degree + 1 ]
+                                                       - sineCoefficient * nextSineTerms[ degree + 1 ] ) +
+                            previousOrderNormalization * ( cosineCoefficient * previousCosineTerms[ degree + 1 ]
+                                                           + sineCoefficient * previousSineTerms[ degree + 1 ] ) );
+                yAcceleration += 0.5 * (
+                            nextOrderNormalization * ( -cosineCoefficient * nextSineTerms[ degree + 1 ]
+                                                       + sineCoefficient * nextCosineTerms[ degree + 1 ] ) +
+                            previousOrderNormalization * ( -cosineCoefficient * previousSineTerms[ degree + 1 ]
+                                                           + sineCoefficient * previousCosineTerms[ degree + 1 ] ) );
+            }
+
+            // Normalization factor for terms at degree + 1 and order.
+            const double currentOrderNormalization = commonNormalization *
+                    squareRoots_[ degree + order + 1 ] * squareRoots_[ degree - order + 1 ];
+            zAcceleration -= currentOrderNormalization * ( cosineCoefficient * currentCosineTerms[ degree + 1 ]
+                                                           + sineCoefficient * currentSineTerms[ degree + 1 ] );
+        }
+    }
+
+    return gravitationalParameter / ( referenceRadius * referenceRadius ) *
+            Eigen::Vector3d( xAcceleration, yAcceleration, zAcceleration );
+}
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, using the Cunningham recursion.
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const boost::shared_ptr< CunninghamRecursionCache > recursionCache,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    return accelerationRotation * recursionCache->computeAcceleration(
+                positionOfBodySubjectToAcceleration, gravitationalParameter, equatorialRadius,
+                cosineHarmonicCoefficients, sineHarmonicCoefficients );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
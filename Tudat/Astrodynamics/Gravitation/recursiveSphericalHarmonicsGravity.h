@@ -0,0 +1,175 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Cunningham, L.E. On the computation of the spherical harmonic terms needed during the
+ *        numerical integration of the orbital motion of an artificial satellite. Celestial
+ *        Mechanics, 2(2):207-216, 1970.
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications. Springer, 2000.
+ *
+ */
+
+#ifndef TUDAT_RECURSIVE_SPHERICAL_HARMONICS_GRAVITY_H
+#define TUDAT_RECURSIVE_SPHERICAL_HARMONICS_GRAVITY_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace gravitation
+{
+
+//! Class to compute spherical harmonic gravitational accelerations using the Cunningham recursion.
+/*!
+ *  Class to compute spherical harmonic gravitational accelerations using the recursion of Cunningham (1970), as described
+ *  by Montenbruck & Gill (2000), modified for use with geodesy-normalized coefficients. The acceleration is computed
+ *  directly in Cartesian coordinates from the normalized solid harmonics V_nm, W_nm (which are the Legendre polynomials
+ *  multiplied by ( R / r )^( n + 1 ) and the cosine/sine of m times the longitude), without computing latitude and
+ *  longitude, and without converting a spherical gradient to Cartesian coordinates. The computation is therefore free of
+ *  singularities at the poles. The V_nm and W_nm are computed order by order, so that only the values at orders m - 1,
+ *  m and m + 1 are stored at any given time: the working memory of this object is O(n), with n the maximum degree.
+ */
+class CunninghamRecursionCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree of gravity field for which cache is to be used
+     * \param maximumOrder Maximum order of gravity field for which cache is to be used
+     */
+    CunninghamRecursionCache( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of cache
+    /*!
+     * Update maximum degree and order of cache
+     * \param maximumDegree Maximum degree of gravity field for which cache is to be used
+     * \param maximumOrder Maximum order of gravity field for which cache is to be used
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Function to compute the gravitational acceleration due to a spherical harmonic gravity field.
+    /*!
+     * Function to compute the gravitational acceleration due to a spherical harmonic gravity field, using the
+     * Cunningham recursion. If the size of the coefficient matrices exceeds the maximum degree/order of this object,
+     * it is resized automatically.
+     * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the reference frame that is
+     * associated with the harmonic coefficients.
+     * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+     * \param referenceRadius Reference radius of the spherical harmonics [m].
+     * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients. The row index
+     * indicates the degree and the column index indicates the order of coefficients.
+     * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients. The row index
+     * indicates the degree and the column index indicates the order of coefficients.
+     * \return Cartesian acceleration vector, in the frame in which the coefficients are defined.
+     */
+    Eigen::Vector3d computeAcceleration(
+            const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const Eigen::MatrixXd& cosineHarmonicCoefficients,
+            const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+    //! Function to get the maximum degree of cache.
+    /*!
+     * Function to get the maximum degree of cache
+     * \return Maximum degree of cache.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of cache.
+    /*!
+     * Function to get the maximum order of cache.
+     * \return Maximum order of cache.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+private:
+
+    //! Function to compute the normalized solid harmonics at a single order, for all degrees
+    /*!
+     * Function to compute the normalized solid harmonics at a single order, for all degrees up to highestDegree + 1,
+     * from the sectoral solid harmonic at that order (which must be set before calling this function), using the
+     * recursion in degree.
+     * \param order Order for which solid harmonics are to be computed.
+     * \param highestDegree Highest degree of the gravity field coefficients.
+     * \param scaledZComponent z-component of position, multiplied by reference radius and divided by squared distance.
+     * \param squaredRadiusRatio Squared ratio of reference radius and distance.
+     */
+    void computeSolidHarmonicsAtOrder( const int order, const int highestDegree, const double scaledZComponent,
+                                       const double squaredRadiusRatio );
+
+    //! Maximum degree of cache.
+    int maximumDegree_;
+
+    //! Maximum order of cache.
+    int maximumOrder_;
+
+    //! List of square roots of integers, with entry i the square root of i.
+    std::vector< double > squareRoots_;
+
+    //! List of inverse square roots of integers, with entry i the inverse square root of i (entry 0 is not used).
+    std::vector< double > inverseSquareRoots_;
+
+    //! Normalized cosine solid harmonics V_nm at three consecutive orders
+    /*!
+     * Normalized cosine solid harmonics V_nm at three consecutive orders; entry (n, m % 3) denotes V_nm.
+     */
+    Eigen::MatrixXd cosineSolidHarmonics_;
+
+    //! Normalized sine solid harmonics W_nm at three consecutive orders
+    /*!
+     * Normalized sine solid harmonics W_nm at three consecutive orders; entry (n, m % 3) denotes W_nm.
+     */
+    Eigen::MatrixXd sineSolidHarmonics_;
+};
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, using the Cunningham recursion.
+/*!
+ * Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization,
+ * using the Cunningham recursion (see CunninghamRecursionCache).
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the reference frame that is
+ * associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param recursionCache Cache object containing working memory of recursion.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const boost::shared_ptr< CunninghamRecursionCache > recursionCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_RECURSIVE_SPHERICAL_HARMONICS_GRAVITY_H
@@ -17,6 +17,8 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_GRAVITY_FIELD_H
 #define TUDAT_SPHERICAL_HARMONICS_GRAVITY_FIELD_H
 
+#include <mutex>
+
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
@@ -86,7 +88,7 @@ public:
                                     const std::string& fixedReferenceFrame = "" )
         : GravityFieldModel( gravitationalParameter ), referenceRadius_( referenceRadius ),
           cosineCoefficients_( cosineCoefficients ), sineCoefficients_( sineCoefficients ),
-          fixedReferenceFrame_( fixedReferenceFrame )
+          fixedReferenceFrame_( fixedReferenceFrame ), evaluationMethod_( term_by_term_evaluation )
     {
         sphericalHarmonicsCache_ = boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder( cosineCoefficients_.rows( ) + 1,
@@ -232,6 +234,7 @@ public:
                                       const double minimumDegree = 0,
                                       const double minimumOrder = 0 )
     {
+        std::lock_guard< std::mutex > cacheLock( sphericalHarmonicsCacheMutex_ );
         return calculateSphericalHarmonicGravitationalPotential(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
                     cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
@@ -268,6 +271,7 @@ public:
     {
         std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
 
+        std::lock_guard< std::mutex > cacheLock( sphericalHarmonicsCacheMutex_ );
         return computeGeodesyNormalizedGravitationalAccelerationSum(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
                     cosineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ),
@@ -284,6 +288,29 @@ public:
         return fixedReferenceFrame_;
     }
 
+    //! Function to retrieve the algorithm used to evaluate accelerations due to this field
+    /*!
+     *  Function to retrieve the algorithm that spherical harmonic acceleration models created for this field use to
+     *  evaluate the sum of the spherical harmonic terms.
+     *  \return Algorithm used to evaluate accelerations due to this field.
+     */
+    SphericalHarmonicsEvaluationMethod getEvaluationMethod( )
+    {
+        return evaluationMethod_;
+    }
+
+    //! Function to reset the algorithm used to evaluate accelerations due to this field
+    /*!
+     *  Function to reset the algorithm that spherical harmonic acceleration models created for this field use to
+     *  evaluate the sum of the spherical harmonic terms. Acceleration models that have already been created are not
+     *  modified.
+     *  \param evaluationMethod Algorithm used to evaluate accelerations due to this field.
+     */
+    void setEvaluationMethod( const SphericalHarmonicsEvaluationMethod evaluationMethod )
+    {
+        evaluationMethod_ = evaluationMethod;
+    }
+
 protected:
 
     //! Reference radius of spherical harmonic field expansion
@@ -312,6 +339,12 @@ protected:
 
     //! Cache object for potential calculations.
     boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
+
+    //! Mutex for access to sphericalHarmonicsCache_, so that the field can be evaluated from several threads.
+    std::mutex sphericalHarmonicsCacheMutex_;
+
+    //! Algorithm that acceleration models created for this field use to evaluate the sum of the spherical harmonic terms.
+    SphericalHarmonicsEvaluationMethod evaluationMethod_;
 };
 
 } // namespace gravitation
@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -127,6 +128,112 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     return accelerationRotation * ( transformationToCartesianCoordinates * sphericalGradient );
 }
 
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, using a vectorized summation over the degrees at each order.
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    // Set highest degree and order.
+    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestOrder = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ), highestDegree );
+
+    // Declare spherical position vector.
+    Eigen::Vector3d sphericalpositionOfBodySubjectToAcceleration = coordinate_conversions::
+            convertCartesianToSpherical( positionOfBodySubjectToAcceleration );
+    sphericalpositionOfBodySubjectToAcceleration( 1 ) = mathematical_constants::PI / 2.0 -
+            sphericalpositionOfBodySubjectToAcceleration( 1 );
+
+    double sineOfAngle = std::sin( sphericalpositionOfBodySubjectToAcceleration( 1 ) );
+    sphericalHarmonicsCache->update( sphericalpositionOfBodySubjectToAcceleration( 0 ),
+                                     sineOfAngle,
+                                     sphericalpositionOfBodySubjectToAcceleration( 2 ),
+                                     equatorialRadius );
+
+    // Retrieve Legendre polynomials, with all degrees of a single order contiguous in memory.
+    sphericalHarmonicsCache->updateOrderMajorLegendrePolynomials( );
+    const Eigen::MatrixXd& legendrePolynomials = sphericalHarmonicsCache->getOrderMajorLegendrePolynomials( );
+    const Eigen::MatrixXd& legendrePolynomialDerivatives =
+            sphericalHarmonicsCache->getOrderMajorLegendrePolynomialDerivatives( );
+
+    // Retrieve ( R / r )^( n + 1 ), with entry n of the map corresponding to degree n.
+    const Eigen::Map< const Eigen::ArrayXd > radiusPowerTerms(
+                sphericalHarmonicsCache->getReferenceRadiusRatioPowersList( ).data( ) + 1, highestDegree );
+
+    // Compute gradient premultiplier.
+    const double preMultiplier = gravitationalParameter / equatorialRadius;
+    const double cosineOfLatitude =
+            sphericalHarmonicsCache->getLegendreCache( )->getCurrentPolynomialParameterComplement( );
+
+    // Initialize gradient vector.
+    Eigen::Vector3d sphericalGradient = Eigen::Vector3d::Zero( );
+
+    // Loop through all orders, and sum contributions of all degrees of each order.
+    for( int order = 0; order < highestOrder; order++ )
+    {
+        const int numberOfDegrees = highestDegree - order;
+
+        // Compute inner products over degree for the radial, latitude and longitude gradient components.
+        const double radialCosineSum =
+                ( Eigen::ArrayXd::LinSpaced( numberOfDegrees, order + 1.0, highestDegree ) *
+                  radiusPowerTerms.segment( order, numberOfDegrees ) *
+                  legendrePolynomials.col( order ).segment( order, numberOfDegrees ).array( ) *
+                  cosineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+        const double radialSineSum =
+                ( Eigen::ArrayXd::LinSpaced( numberOfDegrees, order + 1.0, highestDegree ) *
+                  radiusPowerTerms.segment( order, numberOfDegrees ) *
+                  legendrePolynomials.col( order ).segment( order, numberOfDegrees ).array( ) *
+                  sineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+        const double latitudeCosineSum =
+                ( radiusPowerTerms.segment( order, numberOfDegrees ) *
+                  legendrePolynomialDerivatives.col( order ).segment( order, numberOfDegrees ).array( ) *
+                  cosineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+        const double latitudeSineSum =
+                ( radiusPowerTerms.segment( order, numberOfDegrees ) *
+                  legendrePolynomialDerivatives.col( order ).segment( order, numberOfDegrees ).array( ) *
+                  sineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+
+        const double cosineOfOrderLongitude = sphericalHarmonicsCache->getCosineOfMultipleLongitude( order );
+        const double sineOfOrderLongitude = sphericalHarmonicsCache->getSineOfMultipleLongitude( order );
+
+        sphericalGradient( basic_mathematics::radiusIndex ) -=
+                cosineOfOrderLongitude * radialCosineSum + sineOfOrderLongitude * radialSineSum;
+        sphericalGradient( basic_mathematics::latitudeIndex ) +=
+                cosineOfOrderLongitude * latitudeCosineSum + sineOfOrderLongitude * latitudeSineSum;
+
+        // Longitude gradient vanishes for zonal terms.
+        if( order > 0 )
+        {
+            const double longitudeCosineSum =
+                    ( radiusPowerTerms.segment( order, numberOfDegrees ) *
+                      legendrePolynomials.col( order ).segment( order, numberOfDegrees ).array( ) *
+                      cosineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+            const double longitudeSineSum =
+                    ( radiusPowerTerms.segment( order, numberOfDegrees ) *
+                      legendrePolynomials.col( order ).segment( order, numberOfDegrees ).array( ) *
+                      sineHarmonicCoefficients.col( order ).segment( order, numberOfDegrees ).array( ) ).sum( );
+            sphericalGradient( basic_mathematics::longitudeIndex ) += static_cast< double >( order ) * (
+                        cosineOfOrderLongitude * longitudeSineSum - sineOfOrderLongitude * longitudeCosineSum );
+        }
+    }
+
+    // Apply common factors of gradient components.
+    sphericalGradient( basic_mathematics::radiusIndex ) *=
+            preMultiplier / sphericalpositionOfBodySubjectToAcceleration( basic_mathematics::radiusIndex );
+    sphericalGradient( basic_mathematics::latitudeIndex ) *= preMultiplier * cosineOfLatitude;
+    sphericalGradient( basic_mathematics::longitudeIndex ) *= preMultiplier;
+
+    // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector) and
+    // return the resulting acceleration vector.
+    return accelerationRotation * ( coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                                        positionOfBodySubjectToAcceleration ) * sphericalGradient );
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
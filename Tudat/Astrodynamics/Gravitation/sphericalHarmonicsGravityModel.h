@@ -25,6 +25,7 @@
 #include <Eigen/Geometry>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Astrodynamics/Gravitation/recursiveSphericalHarmonicsGravity.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModelBase.h"
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
 
@@ -93,6 +94,58 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const bool saveSeparateTerms = 0,
         const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
 
+//! Enum listing the available algorithms for evaluating the sum of spherical harmonic gravitational accelerations.
+/*!
+ *  Enum listing the available algorithms for evaluating the sum of spherical harmonic gravitational accelerations:
+ *  term-by-term (computeGeodesyNormalizedGravitationalAccelerationSum), vectorized per order
+ *  (computeGeodesyNormalizedGravitationalAccelerationSumPerOrder) and using the Cartesian Cunningham recursion
+ *  (computeGeodesyNormalizedGravitationalAccelerationSumRecursively), which does not store the Legendre polynomials and is
+ *  free of singularities at the poles.
+ */
+enum SphericalHarmonicsEvaluationMethod
+{
+    term_by_term_evaluation,
+    order_major_vectorized_evaluation,
+    cunningham_recursive_evaluation
+};
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization, using a vectorized summation over the degrees at each order.
+/*!
+ * This function computes the same acceleration as computeGeodesyNormalizedGravitationalAccelerationSum, but
+ * reorganizes the summation to be efficient for high-degree gravity fields. For each order m, the terms of all degrees
+ * n are reduced to six inner products (per gradient component, one for the cosine and one for the sine coefficients)
+ * over arrays that are contiguous in memory: the coefficient matrices (which are stored column-major), the order-major
+ * copies of the Legendre polynomials and their derivatives stored in the sphericalHarmonicsCache, and the powers of
+ * the reference radius ratio. These reductions are evaluated by Eigen, which uses the SIMD instruction set (SSE2,
+ * AVX2 or AVX-512) that the code is compiled for. The trigonometric functions of m times the longitude are applied
+ * once per order, instead of once per term. Separate contributions per degree/order cannot be saved by this function;
+ * computeGeodesyNormalizedGravitationalAccelerationSum should be used if these are required.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics
+ *          [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic
+ *          coefficients. The row index indicates the degree and the column index indicates the order
+ *          of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ *          The row index indicates the degree and the column index indicates the order of
+ *          coefficients. The matrix must be equal in size to cosineHarmonicCoefficients.
+ * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
+ *          gradient calculation.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
  * This function computes the acceleration caused by a single gravitational spherical harmonics
@@ -221,7 +274,8 @@ public:
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          evaluationMethod_( term_by_term_evaluation )
     {
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
                     std::max< int >( static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) ),
@@ -282,7 +336,8 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          evaluationMethod_( term_by_term_evaluation )
     {
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
                     std::max< int >( static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) ),
@@ -336,16 +391,41 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+            if( evaluationMethod_ == cunningham_recursive_evaluation && !saveSphericalHarmonicTermsSeparately_ )
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, recursionCache_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
+            else if( evaluationMethod_ == order_major_vectorized_evaluation && !saveSphericalHarmonicTermsSeparately_ )
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
+            else
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            accelerationPerTerm_,
+                            saveSphericalHarmonicTermsSeparately_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
             currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
         }
     }
@@ -445,6 +525,33 @@ public:
         saveSphericalHarmonicTermsSeparately_ = saveSphericalHarmonicTermsSeparately;
     }
 
+    //! Function to set the algorithm that is used to evaluate the sum of the spherical harmonic terms
+    /*!
+     * Function to set the algorithm that is used to evaluate the sum of the spherical harmonic terms. If the separate
+     * spherical harmonic terms are to be saved, the term_by_term_evaluation is always used, as only this method computes
+     * the separate terms.
+     * \param evaluationMethod Algorithm that is to be used to evaluate the sum of the spherical harmonic terms.
+     */
+    void setEvaluationMethod( const SphericalHarmonicsEvaluationMethod evaluationMethod )
+    {
+        evaluationMethod_ = evaluationMethod;
+        if( evaluationMethod_ == cunningham_recursive_evaluation && recursionCache_ == NULL )
+        {
+            recursionCache_ = boost::make_shared< CunninghamRecursionCache >(
+                        sphericalHarmonicsCache_->getMaximumDegree( ), sphericalHarmonicsCache_->getMaximumOrder( ) );
+        }
+    }
+
+    //! Function to retrieve the algorithm that is used to evaluate the sum of the spherical harmonic terms
+    /*!
+     * Function to retrieve the algorithm that is used to evaluate the sum of the spherical harmonic terms
+     * \return Algorithm that is used to evaluate the sum of the spherical harmonic terms.
+     */
+    SphericalHarmonicsEvaluationMethod getEvaluationMethod( )
+    {
+        return evaluationMethod_;
+    }
+
     //! Function to retrieve the contributions of separate degrees/ordesr to the acceleration, concatenated in a single vector
     /*!
      * Function to retrieve the contributions of specific separate degree/order to the acceleration, concatenated in a single
@@ -532,6 +639,12 @@ private:
     //! Boolean that denotes whether each of the separate spherical harmonic terms should be saved (in accelerationPerTerm_)
     bool saveSphericalHarmonicTermsSeparately_;
 
+    //! Algorithm that is used to evaluate the sum of the spherical harmonic terms.
+    SphericalHarmonicsEvaluationMethod evaluationMethod_;
+
+    //! Working memory for Cunningham recursion (only created if cunningham_recursive_evaluation is used).
+    boost::shared_ptr< CunninghamRecursionCache > recursionCache_;
+
 };
 
 
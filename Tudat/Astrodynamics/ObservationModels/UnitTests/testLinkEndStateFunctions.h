@@ -0,0 +1,46 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TEST_LINK_END_STATE_FUNCTIONS_H
+#define TUDAT_TEST_LINK_END_STATE_FUNCTIONS_H
+
+#include <cmath>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to compute state on circular orbit about origin, in xy-plane (used as analytical link end state function).
+/*!
+ *  Function to compute state on circular orbit about origin, in xy-plane, used as analytical link end state function
+ *  in observation model unit tests.
+ *  \param time Time at which state is to be computed.
+ *  \param radius Radius of circular orbit.
+ *  \param angularVelocity Angular velocity of body on circular orbit.
+ *  \param initialPhase Phase (angle w.r.t. x-axis) of body at time zero.
+ *  \return Cartesian state of body on circular orbit at given time.
+ */
+inline Eigen::Vector6d getCircularOrbitState( const double time, const double radius, const double angularVelocity,
+                                              const double initialPhase )
+{
+    const double phase = initialPhase + angularVelocity * time;
+    Eigen::Vector6d state;
+    state << radius * std::cos( phase ), radius * std::sin( phase ), 0.0,
+            -radius * angularVelocity * std::sin( phase ), radius * angularVelocity * std::cos( phase ), 0.0;
+    return state;
+}
+
+} // namespace unit_tests
+} // namespace tudat
+
+#endif // TUDAT_TEST_LINK_END_STATE_FUNCTIONS_H
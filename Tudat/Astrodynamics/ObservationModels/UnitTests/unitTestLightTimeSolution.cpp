@@ -16,6 +16,7 @@
 
 #include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
 #include "Tudat/Astrodynamics/ObservationModels/UnitTests/testLightTimeCorrections.h"
+#include "Tudat/Astrodynamics/ObservationModels/UnitTests/testLinkEndStateFunctions.h"
 
 #include <limits>
 #include <string>
@@ -230,6 +231,69 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Test Newton iterations and warm start of light-time calculator.
+BOOST_AUTO_TEST_CASE( testLightTimeNewtonIterationAndWarmStart )
+{
+    // Define analytical state functions of Earth-like transmitter and Mars-like receiver.
+    boost::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            boost::bind( &getCircularOrbitState, _1, 1.496E11, 1.99E-7, 0.0 );
+    boost::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            boost::bind( &getCircularOrbitState, _1, 2.28E11, 1.06E-7, 2.0 );
+
+    // Create light-time calculators with default settings and with Newton iterations and warm start.
+    boost::shared_ptr< LightTimeCalculator< > > fixedPointLightTimeCalculator =
+            boost::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    boost::shared_ptr< LightTimeCalculator< > > newtonLightTimeCalculator =
+            boost::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    newtonLightTimeCalculator->setLightTimeIterationSettings( newton_light_time_iteration, true );
+
+    BOOST_CHECK_EQUAL( fixedPointLightTimeCalculator->getLightTimeIterationType( ), fixed_point_light_time_iteration );
+    BOOST_CHECK_EQUAL( fixedPointLightTimeCalculator->getUseWarmStart( ), false );
+    BOOST_CHECK_EQUAL( newtonLightTimeCalculator->getLightTimeIterationType( ), newton_light_time_iteration );
+    BOOST_CHECK_EQUAL( newtonLightTimeCalculator->getUseWarmStart( ), true );
+
+    // Compute light times for 1 Hz observation set, with fixed reception and transmission times.
+    const int numberOfObservations = 600;
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        const bool isTimeAtReception = ( testCase == 0 );
+        fixedPointLightTimeCalculator->resetLightTimeSolutionStatistics( );
+        newtonLightTimeCalculator->resetLightTimeSolutionStatistics( );
+
+        Eigen::Vector6d fixedPointReceiverState, fixedPointTransmitterState;
+        Eigen::Vector6d newtonReceiverState, newtonTransmitterState;
+        for( int i = 0; i < numberOfObservations; i++ )
+        {
+            const double observationTime = 1.0E7 + static_cast< double >( i );
+            const double fixedPointLightTime = fixedPointLightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                        fixedPointReceiverState, fixedPointTransmitterState, observationTime, isTimeAtReception );
+            const double newtonLightTime = newtonLightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                        newtonReceiverState, newtonTransmitterState, observationTime, isTimeAtReception );
+
+            // Check if both methods produce the same, converged, solution.
+            BOOST_CHECK_SMALL( newtonLightTime - fixedPointLightTime, 1.0E-11 );
+            BOOST_CHECK_SMALL( newtonLightTime - ( newtonReceiverState - newtonTransmitterState ).segment( 0, 3 ).norm( ) /
+                               physical_constants::SPEED_OF_LIGHT, 1.0E-11 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        fixedPointReceiverState, newtonReceiverState, 1.0E-14 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        fixedPointTransmitterState, newtonTransmitterState, 1.0E-14 );
+        }
+
+        // Check statistics: Newton iteration with warm start should require at most two iterations per observation.
+        LightTimeSolutionStatistics fixedPointStatistics =
+                fixedPointLightTimeCalculator->getLightTimeSolutionStatistics( );
+        LightTimeSolutionStatistics newtonStatistics = newtonLightTimeCalculator->getLightTimeSolutionStatistics( );
+        BOOST_CHECK_EQUAL( fixedPointStatistics.numberOfLightTimeSolutions_, numberOfObservations );
+        BOOST_CHECK_EQUAL( newtonStatistics.numberOfLightTimeSolutions_, numberOfObservations );
+        BOOST_CHECK_EQUAL( newtonStatistics.numberOfStateFunctionEvaluations_,
+                           newtonStatistics.numberOfIterations_ + 2 * numberOfObservations );
+        BOOST_CHECK( newtonStatistics.maximumNumberOfIterations_ <= 2 );
+        BOOST_CHECK( newtonStatistics.numberOfStateFunctionEvaluations_ <
+                     fixedPointStatistics.numberOfStateFunctionEvaluations_ );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -22,6 +22,8 @@
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/ObservationModels/oneWayRangeObservationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
+#include "Tudat/Astrodynamics/ObservationModels/UnitTests/testLinkEndStateFunctions.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createObservationModel.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/defaultBodies.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
@@ -251,6 +253,104 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
 
 }
 
+//! Test computation of one-way range observations at list of times in a single call.
+BOOST_AUTO_TEST_CASE( testOneWayRangeModelBatchComputation )
+{
+    // Define analytical state functions of Earth-like transmitter and Mars-like receiver.
+    boost::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            boost::bind( &getCircularOrbitState, _1, 1.496E11, 1.99E-7, 0.0 );
+    boost::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            boost::bind( &getCircularOrbitState, _1, 2.28E11, 1.06E-7, 2.0 );
+
+    // Create observation models (with bias) for single and batch computations.
+    boost::shared_ptr< LightTimeCalculator< > > singleLightTimeCalculator =
+            boost::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    boost::shared_ptr< LightTimeCalculator< > > batchLightTimeCalculator =
+            boost::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    boost::shared_ptr< ObservationBias< 1 > > observationBias = boost::make_shared< ConstantObservationBias< 1 > >(
+                ( Eigen::Matrix< double, 1, 1 >( ) << 2.56294 ).finished( ) );
+    boost::shared_ptr< ObservationModel< 1, double, double > > singleObservationModel =
+            boost::make_shared< OneWayRangeObservationModel< > >( singleLightTimeCalculator, observationBias );
+    boost::shared_ptr< ObservationModel< 1, double, double > > batchObservationModel =
+            boost::make_shared< OneWayRangeObservationModel< > >( batchLightTimeCalculator, observationBias );
+    BOOST_CHECK_EQUAL( batchObservationModel->getUseBatchComputation( ), false );
+    batchObservationModel->setUseBatchComputation( true );
+
+    // Define 1 Hz observation times
+    const int numberOfObservations = 600;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observationTimes.push_back( 1.0E7 + static_cast< double >( i ) );
+    }
+
+    Eigen::Matrix< double, 1, Eigen::Dynamic > observations;
+    Eigen::MatrixXd linkEndTimes;
+    Eigen::MatrixXd linkEndStates;
+    std::vector< double > singleLinkEndTimes, batchLinkEndTimes;
+    std::vector< Eigen::Vector6d > singleLinkEndStates, batchLinkEndStates;
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        const LinkEndType referenceLinkEnd = ( testCase == 0 ) ? receiver : transmitter;
+        singleLightTimeCalculator->resetLightTimeSolutionStatistics( );
+        batchLightTimeCalculator->resetLightTimeSolutionStatistics( );
+
+        // Compute observations in a single call (output matrices are preallocated for second test case).
+        const double* observationData = observations.data( );
+        batchObservationModel->computeObservationsWithLinkEndDataAtTimes(
+                    observationTimes, referenceLinkEnd, observations, linkEndTimes, linkEndStates );
+        BOOST_CHECK_EQUAL( observations.cols( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( linkEndTimes.rows( ), 2 );
+        BOOST_CHECK_EQUAL( linkEndTimes.cols( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( linkEndStates.rows( ), 12 );
+        BOOST_CHECK_EQUAL( linkEndStates.cols( ), numberOfObservations );
+        if( testCase > 0 )
+        {
+            BOOST_CHECK_EQUAL( observations.data( ), observationData );
+        }
+
+        // Compare against observations computed one at a time.
+        for( int i = 0; i < numberOfObservations; i++ )
+        {
+            const double singleObservation = singleObservationModel->computeObservationsWithLinkEndData(
+                        observationTimes.at( i ), referenceLinkEnd, singleLinkEndTimes, singleLinkEndStates )( 0 );
+            getSingleObservationLinkEndData( linkEndTimes, linkEndStates, i, batchLinkEndTimes, batchLinkEndStates );
+
+            BOOST_CHECK_CLOSE_FRACTION( observations( 0, i ), singleObservation,
+                                        std::numeric_limits< double >::epsilon( ) );
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_SMALL( batchLinkEndTimes.at( j ) - singleLinkEndTimes.at( j ), 1.0E-11 );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( batchLinkEndStates.at( j ), singleLinkEndStates.at( j ), 1.0E-14 );
+            }
+        }
+
+        // Check if computation started from previous light-time solution.
+        BOOST_CHECK( batchLightTimeCalculator->getLightTimeSolutionStatistics( ).numberOfStateFunctionEvaluations_ <
+                     singleLightTimeCalculator->getLightTimeSolutionStatistics( ).numberOfStateFunctionEvaluations_ );
+
+        // Check if simulated observations (with and without batch computation) retain ordering of times.
+        std::vector< double > reversedObservationTimes( observationTimes.rbegin( ), observationTimes.rend( ) );
+        std::pair< Eigen::VectorXd, std::vector< double > > simulatedObservations =
+                simulateObservationsWithCheck< 1, double, double >(
+                    reversedObservationTimes, batchObservationModel, referenceLinkEnd );
+        std::pair< Eigen::VectorXd, std::vector< double > > singleSimulatedObservations =
+                simulateObservationsWithCheck< 1, double, double >(
+                    reversedObservationTimes, singleObservationModel, referenceLinkEnd );
+        BOOST_CHECK_EQUAL( simulatedObservations.second.size( ), observationTimes.size( ) );
+        BOOST_CHECK_EQUAL( singleSimulatedObservations.second.size( ), observationTimes.size( ) );
+        for( int i = 0; i < numberOfObservations; i++ )
+        {
+            BOOST_CHECK_EQUAL( simulatedObservations.second.at( i ), observationTimes.at( i ) );
+            BOOST_CHECK_EQUAL( singleSimulatedObservations.second.at( i ), observationTimes.at( i ) );
+            BOOST_CHECK_CLOSE_FRACTION( simulatedObservations.first( i ), observations( 0, i ),
+                                        2.0 * std::numeric_limits< double >::epsilon( ) );
+            BOOST_CHECK_CLOSE_FRACTION( singleSimulatedObservations.first( i ), observations( 0, i ),
+                                        2.0 * std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
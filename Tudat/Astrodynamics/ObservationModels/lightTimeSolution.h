@@ -143,6 +143,38 @@ private:
     bool isWarningProvided_;
 };
 
+//! Enum defining the method by which the light-time equation is iterated.
+enum LightTimeIterationType
+{
+    fixed_point_light_time_iteration,
+    newton_light_time_iteration
+};
+
+//! Statistics on the light-time solutions computed by a LightTimeCalculator
+/*!
+ *  Statistics on the light-time solutions computed by a LightTimeCalculator, used to assess the computational cost
+ *  (number of link-end state function evaluations) of the light-time computations.
+ */
+struct LightTimeSolutionStatistics
+{
+    //! Constructor, setting all counters to zero.
+    LightTimeSolutionStatistics( ):
+        numberOfLightTimeSolutions_( 0 ), numberOfIterations_( 0 ), numberOfStateFunctionEvaluations_( 0 ),
+        maximumNumberOfIterations_( 0 ){ }
+
+    //! Number of light-time equations that have been solved.
+    int numberOfLightTimeSolutions_;
+
+    //! Total number of iterations over all light-time solutions.
+    int numberOfIterations_;
+
+    //! Total number of calls to the link end state functions over all light-time solutions.
+    int numberOfStateFunctionEvaluations_;
+
+    //! Maximum number of iterations required for a single light-time solution.
+    int maximumNumberOfIterations_;
+};
+
 //! Class to calculate the light time between two points.
 /*!
  *  This class calculates the light time between two points, of which the state functions
@@ -180,7 +212,11 @@ public:
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         correctionFunctions_( correctionFunctions ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 ){ }
+        currentCorrection_( 0.0 ),
+        lightTimeIterationType_( fixed_point_light_time_iteration ),
+        useWarmStart_( false ),
+        isBatchComputationActive_( false ),
+        isPreviousLightTimeSet_( false ){ }
 
     //! Class constructor.
     /*!
@@ -199,7 +235,11 @@ public:
         stateFunctionOfTransmittingBody_( positionFunctionOfTransmittingBody ),
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 )
+        currentCorrection_( 0.0 ),
+        lightTimeIterationType_( fixed_point_light_time_iteration ),
+        useWarmStart_( false ),
+        isBatchComputationActive_( false ),
+        isPreviousLightTimeSet_( false )
     {
         for( unsigned int i = 0; i < correctionFunctions.size( ); i++ )
         {
@@ -284,9 +324,16 @@ public:
         using physical_constants::SPEED_OF_LIGHT;
         using std::fabs;
 
-        // Initialize reception and transmission times and states to initial guess (zero light time)
-        TimeType receptionTime = time;
-        TimeType transmissionTime = time;
+        // Initialize reception and transmission times and states to initial guess (zero light time, or light time of
+        // previous solution if warm start is used or batch computation is active)
+        ObservationScalarType initialLightTimeGuess = mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+        if( ( useWarmStart_ || isBatchComputationActive_ ) && isPreviousLightTimeSet_ )
+        {
+            initialLightTimeGuess = previousLightTime_;
+        }
+
+        TimeType receptionTime = isTimeAtReception ? time : time + initialLightTimeGuess;
+        TimeType transmissionTime = isTimeAtReception ? time - initialLightTimeGuess : time;
         StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
         StateType transmitterState =
                 stateFunctionOfTransmittingBody_( transmissionTime );
@@ -295,9 +342,10 @@ public:
         setTotalLightTimeCorrection(
                     transmitterState, receiverState, transmissionTime, receptionTime );
 
-        // Calculate light-time solution assuming infinte speed of signal as initial estimate.
+        // Calculate light-time solution from initial guess (for zero initial guess and fixed-point iteration, this
+        // corresponds to assuming infinite speed of signal).
         ObservationScalarType previousLightTimeCalculation =
-                calculateNewLightTimeEstime( receiverState, transmitterState );
+                updateLightTimeEstimate( receiverState, transmitterState, initialLightTimeGuess, isTimeAtReception );
 
         // Set variables for iteration
         ObservationScalarType newLightTimeCalculation = 0.0;
@@ -307,8 +355,11 @@ public:
         int counter = 0;
 
         // Set variable determining whether to update the light time each iteration.
+        // For Newton iterations without light-time corrections, no additional iteration to check the corrections is
+        // performed upon convergence.
         bool updateLightTimeCorrections = false;
-        if( iterateCorrections_ )
+        if( iterateCorrections_ ||
+                ( lightTimeIterationType_ == newton_light_time_iteration && correctionFunctions_.size( ) == 0 ) )
         {
             updateLightTimeCorrections = true;
         }
@@ -336,7 +387,8 @@ public:
                 transmissionTime = time;
                 receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
             }
-            newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
+            newLightTimeCalculation = updateLightTimeEstimate(
+                        receiverState, transmitterState, previousLightTimeCalculation, isTimeAtReception );
 
             // Check for convergence.
             if( fabs( newLightTimeCalculation - previousLightTimeCalculation ) < tolerance )
@@ -376,6 +428,17 @@ public:
             counter++;
         }
 
+        // Update statistics and store solution for warm start of next solution.
+        lightTimeSolutionStatistics_.numberOfLightTimeSolutions_++;
+        lightTimeSolutionStatistics_.numberOfIterations_ += counter;
+        lightTimeSolutionStatistics_.numberOfStateFunctionEvaluations_ += counter + 2;
+        if( counter > lightTimeSolutionStatistics_.maximumNumberOfIterations_ )
+        {
+            lightTimeSolutionStatistics_.maximumNumberOfIterations_ = counter;
+        }
+        previousLightTime_ = newLightTimeCalculation;
+        isPreviousLightTimeSet_ = true;
+
         // Set output variables and return the light time.
         receiverStateOutput = receiverState;
         transmitterStateOutput = transmitterState;
@@ -420,6 +483,77 @@ public:
         return correctionFunctions_;
     }
 
+    //! Function to set the method by which the light-time equation is iterated.
+    /*!
+     *  Function to set the method by which the light-time equation is iterated. Newton iterations use the velocity of
+     *  the link end that is evaluated at the iterated time to compute the derivative of the light-time equation
+     *  (derivatives of light-time corrections are neglected), which typically reduces the number of link end state
+     *  evaluations. When using a warm start, the iteration is started from the light time of the previous solution,
+     *  instead of from the infinite signal speed solution, which is efficient for dense (e.g. 1 Hz) observation sets.
+     *  \param lightTimeIterationType Method by which the light-time equation is iterated.
+     *  \param useWarmStart Boolean denoting whether to start iterations from the previous light-time solution.
+     */
+    void setLightTimeIterationSettings( const LightTimeIterationType lightTimeIterationType,
+                                        const bool useWarmStart )
+    {
+        lightTimeIterationType_ = lightTimeIterationType;
+        useWarmStart_ = useWarmStart;
+        isPreviousLightTimeSet_ = false;
+    }
+
+    //! Function to retrieve the method by which the light-time equation is iterated.
+    /*!
+     *  Function to retrieve the method by which the light-time equation is iterated.
+     *  \return Method by which the light-time equation is iterated.
+     */
+    LightTimeIterationType getLightTimeIterationType( )
+    {
+        return lightTimeIterationType_;
+    }
+
+    //! Function to retrieve whether light-time iterations are started from the previous light-time solution.
+    /*!
+     *  Function to retrieve whether light-time iterations are started from the previous light-time solution.
+     *  \return True if light-time iterations are started from the previous light-time solution.
+     */
+    bool getUseWarmStart( )
+    {
+        return useWarmStart_;
+    }
+
+    //! Function to set whether a batch of light-time solutions at (sorted) times is being computed.
+    /*!
+     *  Function to set whether a batch of light-time solutions at (sorted) times is being computed. While a batch
+     *  computation is active, iterations are started from the previous light-time solution, regardless of the warm
+     *  start setting. Upon activation, the previous light-time solution is discarded, so that the results of a batch
+     *  do not depend on earlier calls to this object.
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    void setBatchComputationMode( const bool isBatchComputationActive )
+    {
+        if( isBatchComputationActive && !isBatchComputationActive_ )
+        {
+            isPreviousLightTimeSet_ = false;
+        }
+        isBatchComputationActive_ = isBatchComputationActive;
+    }
+
+    //! Function to retrieve the statistics on the light-time solutions computed since creation or last reset.
+    /*!
+     *  Function to retrieve the statistics on the light-time solutions computed since creation or last reset.
+     *  \return Statistics on the light-time solutions.
+     */
+    LightTimeSolutionStatistics getLightTimeSolutionStatistics( )
+    {
+        return lightTimeSolutionStatistics_;
+    }
+
+    //! Function to reset the statistics on the light-time solutions.
+    void resetLightTimeSolutionStatistics( )
+    {
+        lightTimeSolutionStatistics_ = LightTimeSolutionStatistics( );
+    }
+
 protected:
 
     //! Transmitter state function.
@@ -456,6 +590,24 @@ protected:
     //! Current light-time correction.
     double currentCorrection_;
 
+    //! Method by which the light-time equation is iterated.
+    LightTimeIterationType lightTimeIterationType_;
+
+    //! Boolean denoting whether iterations are started from the light time of the previous solution.
+    bool useWarmStart_;
+
+    //! Boolean denoting whether a batch of light-time solutions is being computed (iterations are warm-started if true).
+    bool isBatchComputationActive_;
+
+    //! Boolean denoting whether previousLightTime_ has been set.
+    bool isPreviousLightTimeSet_;
+
+    //! Light time computed in previous call to calculateLightTimeWithLinkEndsStates.
+    ObservationScalarType previousLightTime_;
+
+    //! Statistics on the light-time solutions computed since creation or last reset.
+    LightTimeSolutionStatistics lightTimeSolutionStatistics_;
+
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
@@ -474,6 +626,43 @@ protected:
                 physical_constants::getSpeedOfLight< ObservationScalarType >( ) + currentCorrection_;
     }
 
+    //! Function to calculate an updated light-time estimate from the link-ends states at the current estimate.
+    /*!
+     *  Function to calculate an updated light-time estimate from the states of the two ends of the link, evaluated
+     *  using the current light-time estimate. For fixed-point iterations, the new estimate is computed directly from
+     *  the link-end states. For Newton iterations, the derivative of the light-time equation w.r.t. the light time is
+     *  computed from the velocity of the link end that is evaluated at the iterated time.
+     *  \param receiverState Assumed state of receiver.
+     *  \param transmitterState Assumed state of transmitter.
+     *  \param currentLightTime Light-time estimate at which link end states were evaluated.
+     *  \param isTimeAtReception True if reception time is fixed, false if transmission time is fixed.
+     *  \return New value of the light-time estimate.
+     */
+    ObservationScalarType updateLightTimeEstimate(
+            const StateType& receiverState,
+            const StateType& transmitterState,
+            const ObservationScalarType currentLightTime,
+            const bool isTimeAtReception ) const
+    {
+        ObservationScalarType newLightTime = calculateNewLightTimeEstime( receiverState, transmitterState );
+        if( lightTimeIterationType_ == newton_light_time_iteration )
+        {
+            // Compute derivative of Euclidean light time w.r.t. light time from velocity of iterated link end.
+            PositionType relativePositionDirection =
+                    ( ( receiverState - transmitterState ).segment( 0, 3 ).template cast< ObservationScalarType >( ) ).
+                    normalized( );
+            PositionType iteratedLinkEndVelocity = ( isTimeAtReception ? transmitterState : receiverState ).
+                    segment( 3, 3 ).template cast< ObservationScalarType >( );
+            ObservationScalarType lightTimeEquationDerivative =
+                    mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) -
+                    relativePositionDirection.dot( iteratedLinkEndVelocity ) /
+                    physical_constants::getSpeedOfLight< ObservationScalarType >( );
+
+            newLightTime = currentLightTime + ( newLightTime - currentLightTime ) / lightTimeEquationDerivative;
+        }
+        return newLightTime;
+    }
+
     //! Function to reset the currentCorrection_ variable during current iteration.
     /*!
      *  Function to reset the currentCorrection_ variable during current iteration, representing
@@ -213,6 +213,20 @@ public:
         return lightTimeCalculators_;
     }
 
+    //! Function to set whether observations at a list of (sorted) times are being computed.
+    /*!
+     *  Function to set whether observations at a list of (sorted) times are being computed, by which the light-time calculators
+     *  start iterations from the solution at the previous time.
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    void setLightTimeBatchComputationMode( const bool isBatchComputationActive )
+    {
+        for( unsigned int i = 0; i < lightTimeCalculators_.size( ); i++ )
+        {
+            lightTimeCalculators_.at( i )->setBatchComputationMode( isBatchComputationActive );
+        }
+    }
+
 private:
 
     //! List of objects to compute the light-times for each leg of the n-way range.
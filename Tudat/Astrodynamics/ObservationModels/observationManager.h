@@ -217,7 +217,9 @@ public:
     //! Function to simulate observations between specified link ends and associated partials at set of observation times.
     /*!
      *  Function to simulate observations between specified link ends  and associated partials at set of observation times,
-     *  used the sensitivity and state transition matrix interpolators set in the base class.
+     *  used the sensitivity and state transition matrix interpolators set in the base class. If batch computation is set
+     *  for the observation model (see ObservationModel::setUseBatchComputation), all observations are computed in a
+     *  single call, otherwise they are computed one at a time.
      *  \param times Vector of times at which observations are performed
      *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
      *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
@@ -237,6 +239,17 @@ public:
         boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
                 observationSimulator_->getObservationModel( linkEnds );
 
+        // Compute all observations, with link end data, in a single call (if requested).
+        const bool useBatchComputation = selectedObservationModel->getUseBatchComputation( );
+        Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic > batchObservations;
+        Eigen::MatrixXd batchLinkEndTimes;
+        Eigen::MatrixXd batchLinkEndStates;
+        if( useBatchComputation )
+        {
+            selectedObservationModel->computeObservationsWithLinkEndDataAtTimes(
+                        times, linkEndAssociatedWithTime, batchObservations, batchLinkEndTimes, batchLinkEndStates );
+        }
+
         // Initialize vectors of states and times of link ends to be used in calculations.
         std::vector< Eigen::Vector6d > vectorOfStates;
         std::vector< double > vectorOfTimes;
@@ -247,12 +260,22 @@ public:
         int currentObservationSize;
         for( unsigned int i = 0; i < times.size( ); i++ )
         {
-            vectorOfTimes.clear( );
-            vectorOfStates.clear( );
+            // Retrieve or compute observation and link end data
+            if( useBatchComputation )
+            {
+                getSingleObservationLinkEndData(
+                            batchLinkEndTimes, batchLinkEndStates, i, vectorOfTimes, vectorOfStates );
+                currentObservation = batchObservations.col( i );
+            }
+            else
+            {
+                vectorOfTimes.clear( );
+                vectorOfStates.clear( );
 
-            // Compute observation
-            currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
-                        times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates );
+                // Compute observation
+                currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
+                            times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates );
+            }
             observations[ times[ i ] ] = currentObservation;
 
             // Compute observation partial
@@ -347,11 +370,18 @@ protected:
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        // Retrieve observation partials associated with given link ends (no member variables are modified, so that
+        // partials for different link ends may be computed concurrently).
+        if( observationPartials_.count( linkEnds ) == 0 )
+        {
+            return partialMatrix;
+        }
+        const std::map< std::pair< int, int >, boost::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >&
+                currentLinkEndPartials = observationPartials_.at( linkEnds );
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, boost::shared_ptr<
-             observation_partials::ObservationPartial< ObservationSize > > >::iterator
+             observation_partials::ObservationPartial< ObservationSize > > >::const_iterator
              partialIterator = currentLinkEndPartials.begin( );
              partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
         {
@@ -409,10 +439,6 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, boost::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, boost::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
-
 };
 
 }
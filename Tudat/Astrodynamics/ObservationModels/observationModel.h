@@ -57,22 +57,9 @@ public:
     ObservationModel(
             const ObservableType observableType ,
             const boost::shared_ptr< ObservationBias< ObservationSize > > observationBiasCalculator = NULL ):
-        observableType_( observableType ),
-        observationBiasCalculator_( observationBiasCalculator )
+        observableType_( observableType ), useBatchComputation_( false )
     {
-        // Check if bias is empty
-        if( observationBiasCalculator_ != NULL )
-        {
-            isBiasNull_ = 0;
-            if( observationBiasCalculator_->getObservationSize( ) != ObservationSize )
-            {
-                throw std::runtime_error( "Error when making observation model, bias size is inconsistent" );
-            }
-        }
-        else
-        {
-            isBiasNull_ = 1;
-        }
+        setObservationBiasCalculator( observationBiasCalculator );
     }
 
     //! Virtual destructor
@@ -148,6 +135,116 @@ public:
         }
     }
 
+    //! Function to compute ideal observations at a list of times, with link end times and states.
+    /*!
+     *  Function to compute ideal observations (see computeIdealObservationsWithLinkEndData) at a list of times, filling
+     *  matrices that are provided by reference (which are only resized if their size is not yet consistent with the
+     *  output, so that they may be preallocated by the user). The times should be sorted: during the computation, the
+     *  light-time solutions of the derived class are started from the solution at the previous time.
+     *  \param times Times at which observables are to be evaluated (sorted in ascending order).
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Matrix of observations, with column i the observation at times[ i ] (returned by reference).
+     *  \param linkEndTimes Matrix of times at each link end, with column i the link end times of observation i, in the
+     *  order of computeIdealObservationsWithLinkEndData (returned by reference).
+     *  \param linkEndStates Matrix of states at each link end, with column i the concatenated link end states of
+     *  observation i, in the order of computeIdealObservationsWithLinkEndData (returned by reference).
+     */
+    void computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates )
+    {
+        computeObservationsWithLinkEndDataAtTimes(
+                    times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, false );
+    }
+
+    //! Function to compute full observations at a list of times, with link end times and states.
+    /*!
+     *  Function to compute observations at a list of times (include any defined non-ideal corrections), filling
+     *  matrices that are provided by reference (which are only resized if their size is not yet consistent with the
+     *  output, so that they may be preallocated by the user). The times should be sorted: during the computation, the
+     *  light-time solutions of the derived class are started from the solution at the previous time.
+     *  \param times Times at which observations are to be simulated (sorted in ascending order).
+     *  \param linkEndAssociatedWithTime Link end at which current time is measured, i.e. reference
+     *  link end for observable.
+     *  \param observations Matrix of observations, with column i the observation at times[ i ] (returned by reference).
+     *  \param linkEndTimes Matrix of times at each link end, with column i the link end times of observation i, in the
+     *  order of computeIdealObservationsWithLinkEndData (returned by reference).
+     *  \param linkEndStates Matrix of states at each link end, with column i the concatenated link end states of
+     *  observation i, in the order of computeIdealObservationsWithLinkEndData (returned by reference).
+     *  \param addObservationBias Boolean denoting whether to add the observation bias (if any) to the observations.
+     */
+    void computeObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const bool addObservationBias = true )
+    {
+        const int numberOfTimes = times.size( );
+        if( numberOfTimes == 0 )
+        {
+            observations.resize( observations.rows( ), 0 );
+            linkEndTimes.resize( 0, 0 );
+            linkEndStates.resize( 0, 0 );
+        }
+
+        // Light-time calculators are reset to single computation mode when guard goes out of scope (also on exception).
+        LightTimeBatchComputationModeGuard batchComputationModeGuard( this );
+        for( int i = 0; i < numberOfTimes; i++ )
+        {
+            // Compute ideal observable, using pre-defined link end data lists.
+            const Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation =
+                    computeIdealObservationsWithLinkEndData(
+                        times[ i ], linkEndAssociatedWithTime, linkEndTimes_, linkEndStates_ );
+
+            // Set size of output from first observation.
+            const int numberOfLinkEndStates = linkEndStates_.size( );
+            if( i == 0 )
+            {
+                if( observations.rows( ) != currentObservation.rows( ) || observations.cols( ) != numberOfTimes )
+                {
+                    observations.resize( currentObservation.rows( ), numberOfTimes );
+                }
+
+                if( linkEndTimes.rows( ) != numberOfLinkEndStates || linkEndTimes.cols( ) != numberOfTimes ||
+                        linkEndStates.rows( ) != 6 * numberOfLinkEndStates || linkEndStates.cols( ) != numberOfTimes )
+                {
+                    linkEndTimes.resize( numberOfLinkEndStates, numberOfTimes );
+                    linkEndStates.resize( 6 * numberOfLinkEndStates, numberOfTimes );
+                }
+            }
+            observations.col( i ) = currentObservation;
+
+            for( int j = 0; j < numberOfLinkEndStates; j++ )
+            {
+                linkEndTimes( j, i ) = linkEndTimes_[ j ];
+                linkEndStates.block( 6 * j, i, 6, 1 ) = linkEndStates_[ j ];
+            }
+
+            // Add correction
+            if( addObservationBias && !isBiasNull_ )
+            {
+                observations.col( i ) += observationBiasCalculator_->getObservationBias(
+                            linkEndTimes_, linkEndStates_, observations.col( i ).template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+    }
+
+    //! Function to set whether observations at a list of (sorted) times are being computed.
+    /*!
+     *  Function to set whether observations at a list of (sorted) times are being computed, by which the light-time
+     *  calculators of the derived class start their iterations from the solution at the previous time. Function is
+     *  to be redefined in derived classes that use light-time calculators (default: no action).
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    virtual void setLightTimeBatchComputationMode( const bool isBatchComputationActive ){ }
+
     //! Function to compute the observable without any corrections.
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
@@ -246,9 +343,89 @@ public:
         return observationBiasCalculator_;
     }
 
+    //! Function to reset the object for calculating system-dependent errors in the observable.
+    /*!
+     * Function to reset the object for calculating system-dependent errors in the observable, for instance to use the
+     * bias objects of another observation model (which are linked to the estimated bias parameters).
+     * \param observationBiasCalculator New object for calculating system-dependent errors in the observable (NULL if
+     * none).
+     */
+    void setObservationBiasCalculator(
+            const boost::shared_ptr< ObservationBias< ObservationSize > > observationBiasCalculator )
+    {
+        observationBiasCalculator_ = observationBiasCalculator;
+
+        // Check if bias is empty
+        if( observationBiasCalculator_ != NULL )
+        {
+            isBiasNull_ = 0;
+            if( observationBiasCalculator_->getObservationSize( ) != ObservationSize )
+            {
+                throw std::runtime_error( "Error when making observation model, bias size is inconsistent" );
+            }
+        }
+        else
+        {
+            isBiasNull_ = 1;
+        }
+    }
+
+    //! Function to set whether observations at a list of times are simulated with a single batch computation.
+    /*!
+     * Function to set whether observations at a list of times are simulated (by simulateObservationsWithCheck and
+     * ObservationManager::computeObservationsWithPartials) with a single call to
+     * computeObservationsWithLinkEndDataAtTimes, instead of one call to computeObservationsWithLinkEndData per time.
+     * In batch computation, the light-time solutions are started from the solution at the previous time, so that the
+     * observations differ from those computed one at a time at the level of the light-time convergence tolerance.
+     * \param useBatchComputation Boolean denoting whether batch computation is to be used.
+     */
+    void setUseBatchComputation( const bool useBatchComputation )
+    {
+        useBatchComputation_ = useBatchComputation;
+    }
+
+    //! Function to retrieve whether observations at a list of times are simulated with a single batch computation.
+    /*!
+     * Function to retrieve whether observations at a list of times are simulated with a single batch computation (see
+     * setUseBatchComputation).
+     * \return Boolean denoting whether batch computation is to be used.
+     */
+    bool getUseBatchComputation( )
+    {
+        return useBatchComputation_;
+    }
+
 
 protected:
 
+    //! Class that sets the light-time calculators of an observation model in batch mode during its lifetime.
+    class LightTimeBatchComputationModeGuard
+    {
+    public:
+
+        //! Constructor, sets batch computation mode of observation model.
+        /*!
+         *  Constructor, sets batch computation mode of observation model.
+         *  \param observationModel Observation model for which batch computation mode is to be set.
+         */
+        LightTimeBatchComputationModeGuard( ObservationModel* observationModel ):
+            observationModel_( observationModel )
+        {
+            observationModel_->setLightTimeBatchComputationMode( true );
+        }
+
+        //! Destructor, resets batch computation mode of observation model.
+        ~LightTimeBatchComputationModeGuard( )
+        {
+            observationModel_->setLightTimeBatchComputationMode( false );
+        }
+
+    private:
+
+        //! Observation model for which batch computation mode is set.
+        ObservationModel* observationModel_;
+    };
+
     //! Type of observable, used for derived class type identification without explicit casts.
     ObservableType observableType_;
 
@@ -262,6 +439,9 @@ protected:
     //! Boolean set by constructor to denote whether observationBiasCalculator_ is NULL.
     bool isBiasNull_;
 
+    //! Boolean denoting whether observations at a list of times are simulated with a single batch computation.
+    bool useBatchComputation_;
+
 
     //! Pre-define list of times used when calling function returning link-end states/times from interface function.
     std::vector< double > linkEndTimes_;
@@ -271,6 +451,32 @@ protected:
 
 };
 
+//! Function to retrieve the link end times and states of a single observation from the output of a batch computation.
+/*!
+ *  Function to retrieve the link end times and states of a single observation from the output of
+ *  ObservationModel::computeObservationsWithLinkEndDataAtTimes, in the format used by single-observation functions.
+ *  \param linkEndTimes Matrix of times at each link end, as computed by batch observation computation.
+ *  \param linkEndStates Matrix of states at each link end, as computed by batch observation computation.
+ *  \param observationIndex Index of observation for which link end data is to be retrieved.
+ *  \param singleObservationLinkEndTimes List of times at each link end of observation (returned by reference).
+ *  \param singleObservationLinkEndStates List of states at each link end of observation (returned by reference).
+ */
+inline void getSingleObservationLinkEndData(
+        const Eigen::MatrixXd& linkEndTimes,
+        const Eigen::MatrixXd& linkEndStates,
+        const int observationIndex,
+        std::vector< double >& singleObservationLinkEndTimes,
+        std::vector< Eigen::Matrix< double, 6, 1 > >& singleObservationLinkEndStates )
+{
+    singleObservationLinkEndTimes.resize( linkEndTimes.rows( ) );
+    singleObservationLinkEndStates.resize( linkEndTimes.rows( ) );
+    for( int j = 0; j < linkEndTimes.rows( ); j++ )
+    {
+        singleObservationLinkEndTimes[ j ] = linkEndTimes( j, observationIndex );
+        singleObservationLinkEndStates[ j ] = linkEndStates.block( 6 * j, observationIndex, 6, 1 );
+    }
+}
+
 //! Function to compute an observation of size 1 at double precision, with double precision input
 /*!
  *  Function to compute an observation at double precision, with double precision input, from an observation function
@@ -62,7 +62,9 @@ std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool > sim
 //! Function to simulate observables, checking whether they are viable according to settings passed to this function
 /*!
  *  Function to simulate observables, checking whether they are viable according to settings passed to this function
- *  (if viability calculators are passed to this function).
+ *  (if viability calculators are passed to this function). If batch computation is set for the observation model (see
+ *  ObservationModel::setUseBatchComputation), all observables are computed in a single call, otherwise they are
+ *  computed one at a time.
  *  \param observationTimes Times at which observables are to be computed
  *  \param observationModel Model used to compute observables
  *  \param linkEndAssociatedWithTime Model Reference link end for observables
@@ -80,18 +82,49 @@ simulateObservationsWithCheck(
         std::vector< boost::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
-    std::pair< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, bool > simulatedObservation;
 
-    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    if( observationModel->getUseBatchComputation( ) )
     {
-        simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes.at( i ), observationModel, linkEndAssociatedWithTime, linkViabilityCalculators );
-
-        // Check if receiving station can view transmitting station.
-        if( simulatedObservation.second )
+        // Compute all observables, with link end data, in a single call.
+        Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic > calculatedObservations;
+        Eigen::MatrixXd linkEndTimes;
+        Eigen::MatrixXd linkEndStates;
+        observationModel->computeObservationsWithLinkEndDataAtTimes(
+                    observationTimes, linkEndAssociatedWithTime, calculatedObservations, linkEndTimes, linkEndStates );
+
+        std::vector< Eigen::Vector6d > vectorOfStates;
+        std::vector< double > vectorOfTimes;
+        bool observationFeasible = 1;
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            // Check if receiving station can view transmitting station.
+            if( linkViabilityCalculators.size( ) > 0 )
+            {
+                getSingleObservationLinkEndData( linkEndTimes, linkEndStates, i, vectorOfTimes, vectorOfStates );
+                observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, linkViabilityCalculators );
+            }
+
+            if( observationFeasible )
+            {
+                // If viable, add observable and time to vector of simulated data.
+                observations[ observationTimes[ i ]  ] = calculatedObservations.col( i );
+            }
+        }
+    }
+    else
+    {
+        std::pair< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, bool > simulatedObservation;
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
         {
-            // If viable, add observable and time to vector of simulated data.
-            observations[ observationTimes[ i ]  ] = simulatedObservation.first;
+            simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
+                        observationTimes.at( i ), observationModel, linkEndAssociatedWithTime, linkViabilityCalculators );
+
+            // Check if receiving station can view transmitting station.
+            if( simulatedObservation.second )
+            {
+                // If viable, add observable and time to vector of simulated data.
+                observations[ observationTimes[ i ]  ] = simulatedObservation.first;
+            }
         }
     }
 
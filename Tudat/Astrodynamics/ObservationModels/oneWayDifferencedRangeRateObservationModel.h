@@ -215,6 +215,18 @@ public:
         return arcEndLightTimeCalculator_;
     }
 
+    //! Function to set whether observations at a list of (sorted) times are being computed.
+    /*!
+     *  Function to set whether observations at a list of (sorted) times are being computed, by which the arc start and end light-time calculators
+     *  start iterations from the solution at the previous time.
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    void setLightTimeBatchComputationMode( const bool isBatchComputationActive )
+    {
+        arcStartLightTimeCalculator_->setBatchComputationMode( isBatchComputationActive );
+        arcEndLightTimeCalculator_->setBatchComputationMode( isBatchComputationActive );
+    }
+
 private:
 
     //! Light time calculator to compute light time at the beginning of the integration time
@@ -659,7 +659,16 @@ public:
         return receiverProperTimeRateCalculator_;
     }
 
-
+    //! Function to set whether observations at a list of (sorted) times are being computed.
+    /*!
+     *  Function to set whether observations at a list of (sorted) times are being computed, by which the light-time calculator
+     *  starts iterations from the solution at the previous time.
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    void setLightTimeBatchComputationMode( const bool isBatchComputationActive )
+    {
+        lightTimeCalculator_->setBatchComputationMode( isBatchComputationActive );
+    }
 
 private:
 
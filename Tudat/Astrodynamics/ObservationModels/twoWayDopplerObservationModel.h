@@ -99,12 +99,6 @@ public:
             std::vector< double >& linkEndTimes,
             std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates )
     {
-        std::vector< double > uplinkLinkEndTimes;
-        std::vector< Eigen::Matrix< double, 6, 1 > > uplinkLinkEndStates;
-
-        std::vector< double > downlinkLinkEndTimes;
-        std::vector< Eigen::Matrix< double, 6, 1 > > downlinkLinkEndStates;
-
         Eigen::Matrix< ObservationScalarType, 1, 1 > uplinkDoppler, downlinkDoppler;
 
         switch( linkEndAssociatedWithTime )
@@ -112,24 +106,24 @@ public:
         case receiver:
 
             downlinkDoppler = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        time, receiver, downlinkLinkEndTimes, downlinkLinkEndStates );
+                        time, receiver, downlinkLinkEndTimes_, downlinkLinkEndStates_ );
             uplinkDoppler = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        downlinkLinkEndTimes.at( 0 ), receiver, uplinkLinkEndTimes, uplinkLinkEndStates );
+                        downlinkLinkEndTimes_.at( 0 ), receiver, uplinkLinkEndTimes_, uplinkLinkEndStates_ );
 
             break;
         case reflector1:
 
             uplinkDoppler = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        time, receiver, uplinkLinkEndTimes, uplinkLinkEndStates );
+                        time, receiver, uplinkLinkEndTimes_, uplinkLinkEndStates_ );
             downlinkDoppler = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        time, transmitter, downlinkLinkEndTimes, downlinkLinkEndStates );
+                        time, transmitter, downlinkLinkEndTimes_, downlinkLinkEndStates_ );
 
             break;
         case transmitter:
             uplinkDoppler = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        time, transmitter, uplinkLinkEndTimes, uplinkLinkEndStates );
+                        time, transmitter, uplinkLinkEndTimes_, uplinkLinkEndStates_ );
             downlinkDoppler = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndData(
-                        uplinkLinkEndTimes.at( 1 ), transmitter, downlinkLinkEndTimes, downlinkLinkEndStates );
+                        uplinkLinkEndTimes_.at( 1 ), transmitter, downlinkLinkEndTimes_, downlinkLinkEndStates_ );
             break;
         default:
             throw std::runtime_error(
@@ -142,15 +136,15 @@ public:
         linkEndTimes.resize( 4 );
         linkEndStates.resize( 4 );
 
-        linkEndTimes[ 0 ] = uplinkLinkEndTimes.at( 0 );
-        linkEndTimes[ 1 ] = uplinkLinkEndTimes.at( 1 );
-        linkEndTimes[ 2 ] = downlinkLinkEndTimes.at( 0 );
-        linkEndTimes[ 3 ] = downlinkLinkEndTimes.at( 1 );
+        linkEndTimes[ 0 ] = uplinkLinkEndTimes_.at( 0 );
+        linkEndTimes[ 1 ] = uplinkLinkEndTimes_.at( 1 );
+        linkEndTimes[ 2 ] = downlinkLinkEndTimes_.at( 0 );
+        linkEndTimes[ 3 ] = downlinkLinkEndTimes_.at( 1 );
 
-        linkEndStates[ 0 ] = uplinkLinkEndStates.at( 0 );
-        linkEndStates[ 1 ] = uplinkLinkEndStates.at( 1 );
-        linkEndStates[ 2 ] = downlinkLinkEndStates.at( 0 );
-        linkEndStates[ 3 ] = downlinkLinkEndStates.at( 1 );
+        linkEndStates[ 0 ] = uplinkLinkEndStates_.at( 0 );
+        linkEndStates[ 1 ] = uplinkLinkEndStates_.at( 1 );
+        linkEndStates[ 2 ] = downlinkLinkEndStates_.at( 0 );
+        linkEndStates[ 3 ] = downlinkLinkEndStates_.at( 1 );
 
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << downlinkDoppler( 0 ) * uplinkDoppler( 0 ) +
                  downlinkDoppler( 0 ) + uplinkDoppler( 0 ) ).finished( );
@@ -178,6 +172,18 @@ public:
         return downlinkDopplerCalculator_;
     }
 
+    //! Function to set whether observations at a list of (sorted) times are being computed.
+    /*!
+     *  Function to set whether observations at a list of (sorted) times are being computed, by which the light-time calculators of the uplink and downlink
+     *  start iterations from the solution at the previous time.
+     *  \param isBatchComputationActive Boolean denoting whether a batch computation is active.
+     */
+    void setLightTimeBatchComputationMode( const bool isBatchComputationActive )
+    {
+        uplinkDopplerCalculator_->setLightTimeBatchComputationMode( isBatchComputationActive );
+        downlinkDopplerCalculator_->setLightTimeBatchComputationMode( isBatchComputationActive );
+    }
+
 private:
 
     //! Object that computes the one-way Doppler observable for the uplink
@@ -188,6 +194,18 @@ private:
     boost::shared_ptr< observation_models::OneWayDopplerObservationModel< ObservationScalarType, TimeType > >
     downlinkDopplerCalculator_;
 
+    //! Pre-declared vector of uplink link end times, used for computeIdealObservationsWithLinkEndData function
+    std::vector< double > uplinkLinkEndTimes_;
+
+    //! Pre-declared vector of uplink link end states, used for computeIdealObservationsWithLinkEndData function
+    std::vector< Eigen::Matrix< double, 6, 1 > > uplinkLinkEndStates_;
+
+    //! Pre-declared vector of downlink link end times, used for computeIdealObservationsWithLinkEndData function
+    std::vector< double > downlinkLinkEndTimes_;
+
+    //! Pre-declared vector of downlink link end states, used for computeIdealObservationsWithLinkEndData function
+    std::vector< Eigen::Matrix< double, 6, 1 > > downlinkLinkEndStates_;
+
     //! Pre-declared vector of link end times, used for computeIdealObservations function
     std::vector< double > linkEndTimes_;
 
@@ -306,7 +306,10 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
         const TimeType startTime = TimeType( 1.0E7 ),
         const int numberOfDaysOfData = 3,
         const int numberOfIterations = 5,
-        const bool useFullParameterSet = true )
+        const bool useFullParameterSet = true,
+        const unsigned int numberOfObservationAssemblyThreads = 1,
+        const bool useInterpolatedEphemerides = false,
+        const bool accumulateNormalEquations = false )
 {
 
     //Load spice kernels.
@@ -324,8 +327,17 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
     TimeType finalEphemerisTime = initialEphemerisTime + numberOfDaysOfData * 86400.0;
 
     // Create bodies needed in simulation
-    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
-            getDefaultBodySettings( bodyNames );
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings;
+    if( useInterpolatedEphemerides )
+    {
+        double buffer = 10.0 * 3600.0;
+        bodySettings = getDefaultBodySettings(
+                    bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    }
+    else
+    {
+        bodySettings = getDefaultBodySettings( bodyNames );
+    }
     bodySettings[ "Earth" ]->rotationModelSettings = boost::make_shared< SimpleRotationModelSettings >(
                 "ECLIPJ2000", "IAU_Earth",
                 spice_interface::computeRotationQuaternionBetweenFrames(
@@ -607,6 +619,8 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
 
     podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     podInput->defineEstimationSettings( true, true, true, true, false );
+    podInput->defineObservationAssemblySettings( numberOfObservationAssemblyThreads, 250 );
+    podInput->defineNormalEquationAccumulation( accumulateNormalEquations );
 
     // Perform estimation
     boost::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
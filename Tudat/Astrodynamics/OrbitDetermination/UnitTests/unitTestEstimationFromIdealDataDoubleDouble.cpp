@@ -85,6 +85,72 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
 
 }
 
+//! This test checks if the estimation results are identical when computing the residuals and partials on multiple
+//! threads (each using its own copy of the environment), instead of a single thread. The test is also to be run with
+//! ThreadSanitizer (see USE_THREAD_SANITIZER), to check that the threads do not share any mutable state.
+BOOST_AUTO_TEST_CASE( test_EstimationWithConcurrentObservationAssembly )
+{
+    std::vector< Eigen::VectorXd > estimationErrors;
+    std::vector< Eigen::VectorXd > residuals;
+    std::vector< unsigned int > numberOfThreadsList = { 1, 3, 4 };
+    for( unsigned int i = 0; i < numberOfThreadsList.size( ); i++ )
+    {
+        std::pair< boost::shared_ptr< simulation_setup::PodOutput< double > >,
+        boost::shared_ptr< simulation_setup::PodInput< double, double > > > podDataOutput;
+        estimationErrors.push_back( tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                                        podDataOutput, 1.0E7, 1, 2, true, numberOfThreadsList.at( i ), true ) );
+        residuals.push_back( podDataOutput.first->residuals_ );
+    }
+
+    // Results should be bit-wise identical
+    for( unsigned int i = 1; i < numberOfThreadsList.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( residuals.at( i ).rows( ), residuals.at( 0 ).rows( ) );
+        for( int j = 0; j < residuals.at( 0 ).rows( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( residuals.at( i )( j ), residuals.at( 0 )( j ) );
+        }
+
+        for( int j = 0; j < estimationErrors.at( 0 ).rows( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( estimationErrors.at( i )( j ), estimationErrors.at( 0 )( j ) );
+        }
+    }
+}
+
+//! This test checks if the estimation results are consistent when accumulating the normal equations per block of
+//! observations, instead of computing the full matrix of partials.
+BOOST_AUTO_TEST_CASE( test_EstimationWithNormalEquationAccumulation )
+{
+    std::vector< Eigen::VectorXd > estimationErrors;
+    std::vector< boost::shared_ptr< simulation_setup::PodOutput< double > > > podOutputs;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::pair< boost::shared_ptr< simulation_setup::PodOutput< double > >,
+        boost::shared_ptr< simulation_setup::PodInput< double, double > > > podDataOutput;
+        estimationErrors.push_back( tudat::unit_tests::executeEarthOrbiterParameterEstimation< double, double >(
+                                        podDataOutput, 1.0E7, 1, 3, true, 1, true, ( i == 1 ) ) );
+        podOutputs.push_back( podDataOutput.first );
+    }
+
+    // Check that partials are not saved when accumulating normal equations
+    BOOST_CHECK_EQUAL( podOutputs.at( 1 )->normalizedInformationMatrix_.rows( ), 0 );
+
+    // Compare estimated parameters, normalization and (normalized) inverse covariance
+    for( int j = 0; j < estimationErrors.at( 0 ).rows( ); j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( estimationErrors.at( 1 )( j ) - estimationErrors.at( 0 )( j ) ),
+                           1.0E-6 * std::max( std::fabs( estimationErrors.at( 0 )( j ) ), 1.0E-6 ) );
+        BOOST_CHECK_EQUAL( podOutputs.at( 1 )->informationMatrixTransformationDiagonal_( j ),
+                           podOutputs.at( 0 )->informationMatrixTransformationDiagonal_( j ) );
+    }
+
+    Eigen::MatrixXd inverseCovarianceDifference = podOutputs.at( 1 )->inverseNormalizedCovarianceMatrix_ -
+            podOutputs.at( 0 )->inverseNormalizedCovarianceMatrix_;
+    BOOST_CHECK_SMALL( inverseCovarianceDifference.cwiseAbs( ).maxCoeff( ) /
+                       podOutputs.at( 0 )->inverseNormalizedCovarianceMatrix_.cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -12,6 +12,8 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <exception>
+#include <thread>
 
 #include <boost/make_shared.hpp>
 
@@ -20,6 +22,7 @@
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/initialTranslationalState.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/copyBodies.h"
 #include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createObservationManager.h"
 
@@ -332,26 +335,165 @@ public:
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
+     *  Partials and observations are calculated by the observationManagers_. The observations of each combination of
+     *  observable type and link ends are computed in blocks of observation times, each of which is written directly into
+     *  its own (predetermined) rows of the partials matrix and residuals vector. When using multiple threads, the blocks
+     *  are distributed over the threads, each of which computes its blocks using its own observation managers, created
+     *  from a copy of the environment (see copyBodyMapForConcurrentObservationEvaluation). Since each block is computed
+     *  independently of the others, the results do not depend on the number of threads. Note that the ephemerides and
+     *  rotation models used to compute the observations must be supported by copyBodyMapForConcurrentObservationEvaluation
+     *  when using multiple threads (ephemerides retrieved directly from Spice are not).
      *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
      *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
      *  observables w.r.t. parameter vector (return by reference).
+     *  \param numberOfThreads Number of threads on which the residuals and partials are computed (0 to use the number of
+     *  concurrent threads supported by the hardware).
+     *  \param numberOfTimesPerBlock Maximum number of observation times in a single block.
      */
     void calculateObservationMatrixAndResiduals(
             const PodInputType& observationsAndTimes, const int parameterVectorSize, const int totalObservationSize,
-            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials  )
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials,
+            const unsigned int numberOfThreads = 1, const int numberOfTimesPerBlock = 1000 )
     {
         // Initialize return data.
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
+        // Retrieve all combinations of observable type and link ends, with the index of their first row.
+        std::vector< std::pair< observation_models::ObservableType,
+                typename SingleObservablePodInputType::const_iterator > > observationSets;
+        std::vector< int > observationSetStartIndices;
+        std::vector< int > numberOfBlocksPerObservationSet;
+        int startIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                observationSets.push_back( std::make_pair( observablesIterator->first, dataIterator ) );
+                observationSetStartIndices.push_back( startIndex );
+                numberOfBlocksPerObservationSet.push_back(
+                            ( static_cast< int >( dataIterator->second.second.first.size( ) ) + numberOfTimesPerBlock - 1 ) /
+                            numberOfTimesPerBlock );
+                startIndex += dataIterator->second.first.size( );
+            }
+        }
+
+        // Create list of blocks to process (observation set and index of block in set), interleaving observation sets.
+        std::vector< std::pair< unsigned int, int > > blocksToProcess;
+        int maximumNumberOfBlocks = 0;
+        if( numberOfBlocksPerObservationSet.size( ) > 0 )
+        {
+            maximumNumberOfBlocks = *std::max_element(
+                        numberOfBlocksPerObservationSet.begin( ), numberOfBlocksPerObservationSet.end( ) );
+        }
+        for( int i = 0; i < maximumNumberOfBlocks; i++ )
+        {
+            for( unsigned int j = 0; j < observationSets.size( ); j++ )
+            {
+                if( i < numberOfBlocksPerObservationSet.at( j ) )
+                {
+                    blocksToProcess.push_back( std::make_pair( j, i ) );
+                }
+            }
+        }
+
+        unsigned int numberOfUsedThreads =
+                ( numberOfThreads == 0 ) ? std::max( std::thread::hardware_concurrency( ), 1u ) : numberOfThreads;
+        numberOfUsedThreads = std::max(
+                    std::min( numberOfUsedThreads, static_cast< unsigned int >( blocksToProcess.size( ) ) ), 1u );
+        std::vector< std::exception_ptr > assemblyErrors( numberOfUsedThreads );
+
+        if( numberOfUsedThreads == 1 )
+        {
+            calculateObservationBlocksMatrixAndResiduals(
+                        observationManagers_, observationSets, observationSetStartIndices, blocksToProcess, 0, 1,
+                        parameterVectorSize, numberOfTimesPerBlock, residualsAndPartials, assemblyErrors.at( 0 ) );
+        }
+        else
+        {
+            // Create observation managers for each thread (sequentially, since this accesses the original environment).
+            std::vector< std::map< observation_models::ObservableType, boost::shared_ptr<
+                    observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >
+                    threadObservationManagers;
+            for( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+            {
+                threadObservationManagers.push_back( createObservationManagersForConcurrentEvaluation( ) );
+            }
+
+            // Compute residuals and partials, where thread i processes blocks i, i + numberOfUsedThreads, etc.
+            std::vector< std::thread > assemblyThreads;
+            for( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+            {
+                assemblyThreads.push_back(
+                            std::thread( &OrbitDeterminationManager< ObservationScalarType, TimeType >::
+                                         calculateObservationBlocksMatrixAndResiduals, this,
+                                         std::cref( threadObservationManagers.at( i ) ),
+                                         std::cref( observationSets ), std::cref( observationSetStartIndices ),
+                                         std::cref( blocksToProcess ), i, numberOfUsedThreads,
+                                         parameterVectorSize, numberOfTimesPerBlock, std::ref( residualsAndPartials ),
+                                         std::ref( assemblyErrors.at( i ) ) ) );
+            }
+            for( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+            {
+                assemblyThreads.at( i ).join( );
+            }
+        }
+
+        // Re-throw first error that occured during computation (if any).
+        for( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+        {
+            if( assemblyErrors.at( i ) )
+            {
+                std::rethrow_exception( assemblyErrors.at( i ) );
+            }
+        }
+    }
+
+    //! Function to calculate the normal equations and residuals, accumulated per block of observations
+    /*!
+     *  Function to calculate the (unnormalized) normal equations and residuals, accumulated per block of observations,
+     *  without storing the full matrix of observation partials. The observations of each observable type and set of link
+     *  ends are processed in blocks of at most numberOfTimesPerBlock observation times. For each block, the
+     *  contribution to the normal equations is added (see linear_algebra::addBlockToNormalEquations), and the range of
+     *  each column of partials is updated, to compute the same normalization terms as normalizeObservationMatrix.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsData Weights of observations, per observable type and set of link ends.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param numberOfTimesPerBlock Maximum number of observation times in a single block.
+     *  \param inverseOfCovarianceMatrix Unnormalized inverse covariance matrix A^T*W*A, without a priori information
+     *  (returned by reference).
+     *  \param rightHandSideVector Unnormalized right-hand side of normal equations A^T*W*y (returned by reference).
+     *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference).
+     *  \param normalizationTerms Values by which the columns of the matrix of partials are to be divided to normalize
+     *  its entries (returned by reference).
+     */
+    void calculateNormalEquationsAndResiduals(
+            const PodInputType& observationsAndTimes,
+            const std::map< observation_models::ObservableType,
+            std::map< observation_models::LinkEnds, Eigen::VectorXd > >& weightsData,
+            const int parameterVectorSize, const int totalObservationSize, const int numberOfTimesPerBlock,
+            Eigen::MatrixXd& inverseOfCovarianceMatrix, Eigen::VectorXd& rightHandSideVector,
+            Eigen::VectorXd& residuals, Eigen::VectorXd& normalizationTerms )
+    {
+        // Initialize return data.
+        inverseOfCovarianceMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+        rightHandSideVector = Eigen::VectorXd::Zero( parameterVectorSize );
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+
+        Eigen::VectorXd minimumPartials = Eigen::VectorXd::Zero( parameterVectorSize );
+        Eigen::VectorXd maximumPartials = Eigen::VectorXd::Zero( parameterVectorSize );
+        bool isFirstBlock = true;
+
         // Declare variable denoting current index in vector of all observations.
         int startIndex = 0;
 
         // Iterate over all observable types in observationsAndTimes
-        std::vector< TimeType > simulationInputTime;
+        std::vector< TimeType > blockTimes;
         for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
              observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
         {
@@ -359,27 +501,73 @@ public:
             for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
                  dataIterator != observablesIterator->second.end( ); dataIterator++  )
             {
-                simulationInputTime.clear( );
-                simulationInputTime = dataIterator->second.second.first;
-
-                // Compute estimated ranges and range partials from current parameter estimate.
-                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                observationsWithPartials = observationManagers_[ observablesIterator->first ]->
-                        computeObservationsWithPartials(
-                            simulationInputTime, dataIterator->first, dataIterator->second.second.second );
-
-                // Compute residuals for current link ends and observabel type.
-                residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
-                        ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
+                const std::vector< TimeType >& observationTimes = dataIterator->second.second.first;
+                const Eigen::VectorXd& currentWeights = weightsData.at( observablesIterator->first ).at( dataIterator->first );
+                const int observationSize = dataIterator->second.first.size( ) / observationTimes.size( );
 
-
-                // Set current observation partials in matrix of all partials
-                residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
-                        observationsWithPartials.second;
+                // Iterate over all blocks of observation times.
+                for( int firstTimeIndex = 0; firstTimeIndex < static_cast< int >( observationTimes.size( ) );
+                     firstTimeIndex += numberOfTimesPerBlock )
+                {
+                    const int numberOfBlockTimes = std::min(
+                                numberOfTimesPerBlock, static_cast< int >( observationTimes.size( ) ) - firstTimeIndex );
+                    blockTimes.assign( observationTimes.begin( ) + firstTimeIndex,
+                                       observationTimes.begin( ) + firstTimeIndex + numberOfBlockTimes );
+
+                    // Compute observations and partials for current block.
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            observationManagers_.at( observablesIterator->first )->computeObservationsWithPartials(
+                                blockTimes, dataIterator->first, dataIterator->second.second.second );
+
+                    // Set residuals, and add contribution of current block to normal equations.
+                    const int firstRowInObservationSet = firstTimeIndex * observationSize;
+                    const int numberOfBlockRows = numberOfBlockTimes * observationSize;
+                    residuals.segment( startIndex + firstRowInObservationSet, numberOfBlockRows ) =
+                            ( dataIterator->second.first.segment( firstRowInObservationSet, numberOfBlockRows ) -
+                              observationsWithPartials.first ).template cast< double >( );
+
+                    linear_algebra::addBlockToNormalEquations(
+                                observationsWithPartials.second,
+                                residuals.segment( startIndex + firstRowInObservationSet, numberOfBlockRows ),
+                                currentWeights.segment( firstRowInObservationSet, numberOfBlockRows ),
+                                inverseOfCovarianceMatrix, rightHandSideVector );
+
+                    // Update range of partials in each column.
+                    if( isFirstBlock )
+                    {
+                        minimumPartials = observationsWithPartials.second.colwise( ).minCoeff( ).transpose( );
+                        maximumPartials = observationsWithPartials.second.colwise( ).maxCoeff( ).transpose( );
+                        isFirstBlock = false;
+                    }
+                    else
+                    {
+                        minimumPartials = minimumPartials.cwiseMin(
+                                    observationsWithPartials.second.colwise( ).minCoeff( ).transpose( ) );
+                        maximumPartials = maximumPartials.cwiseMax(
+                                    observationsWithPartials.second.colwise( ).maxCoeff( ).transpose( ) );
+                    }
+                }
 
                 // Increment current index of observation.
                 startIndex += dataIterator->second.first.size( );
+            }
+        }
 
+        // Compute normalization terms, in the same manner as normalizeObservationMatrix
+        normalizationTerms = Eigen::VectorXd( parameterVectorSize );
+        for( int i = 0; i < parameterVectorSize; i++ )
+        {
+            if( std::fabs( minimumPartials( i ) ) > maximumPartials( i ) )
+            {
+                normalizationTerms( i ) = minimumPartials( i );
+            }
+            else
+            {
+                normalizationTerms( i ) = maximumPartials( i );
+            }
+            if( normalizationTerms( i ) == 0.0 )
+            {
+                normalizationTerms( i ) = 1.0;
             }
         }
     }
@@ -474,7 +662,11 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        Eigen::MatrixXd bestInformationMatrix;
+        if( !podInput->getAccumulateNormalEquations( ) )
+        {
+            bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        }
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
 
@@ -530,12 +722,29 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
+            Eigen::VectorXd transformationData;
+            Eigen::MatrixXd accumulatedInverseCovarianceMatrix;
+            Eigen::VectorXd accumulatedRightHandSide;
+            if( podInput->getAccumulateNormalEquations( ) )
+            {
+                calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), podInput->getWeightsMatrixDiagonals( ),
+                            parameterVectorSize, totalNumberOfObservations,
+                            podInput->getNumberOfTimesPerObservationAssemblyBlock( ),
+                            accumulatedInverseCovarianceMatrix, accumulatedRightHandSide,
+                            residualsAndPartials.first, transformationData );
+            }
+            else
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials, podInput->getNumberOfObservationAssemblyThreads( ),
+                            podInput->getNumberOfTimesPerObservationAssemblyBlock( ) );
 
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -554,11 +763,34 @@ public:
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput;
             try
             {
-                leastSquaresOutput =
-                        linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                            residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                            residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
-                            normalizedInverseAprioriCovarianceMatrix );
+                if( podInput->getAccumulateNormalEquations( ) )
+                {
+                    // Normalize accumulated normal equations
+                    for( int j = 0; j < numberOfEstimatedParameters; j++ )
+                    {
+                        for( int k = 0; k < numberOfEstimatedParameters; k++ )
+                        {
+                            accumulatedInverseCovarianceMatrix( j, k ) /=
+                                    ( transformationData( j ) * transformationData( k ) );
+                        }
+                        accumulatedRightHandSide( j ) /= transformationData( j );
+                    }
+
+                    leastSquaresOutput =
+                            linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                accumulatedInverseCovarianceMatrix.block(
+                                    0, 0, numberOfEstimatedParameters, numberOfEstimatedParameters ),
+                                accumulatedRightHandSide.segment( 0, numberOfEstimatedParameters ),
+                                normalizedInverseAprioriCovarianceMatrix );
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                                residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                                residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
+                                normalizedInverseAprioriCovarianceMatrix );
+                }
             }
             catch( std::runtime_error )
             {
@@ -609,7 +841,7 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = oldParameterEstimate;
                 bestResiduals = residualsAndPartials.first;
-                if( podInput->getSaveInformationMatrix( ) )
+                if( podInput->getSaveInformationMatrix( ) && !podInput->getAccumulateNormalEquations( ) )
                 {
                     bestInformationMatrix = residualsAndPartials.second;
                 }
@@ -763,6 +995,109 @@ public:
 
 protected:
 
+    //! Function to calculate the observation partials and residuals of a subset of the blocks of observations
+    /*!
+     *  Function to calculate the observation partials and residuals of a subset of the blocks of observations, given by
+     *  the blocks with index firstBlockIndex, firstBlockIndex + blockIndexStep, etc. in blocksToProcess. Used (as thread
+     *  function, when using multiple threads) by calculateObservationMatrixAndResiduals.
+     *  \param observationManagers Observation managers that are to be used to compute the observations and partials
+     *  \param observationSets List of all combinations of observable type and link ends (with associated data)
+     *  \param observationSetStartIndices Index of first row of each observation set in partials matrix/residuals vector
+     *  \param blocksToProcess List of all blocks, as index of observation set and index of block in observation set
+     *  \param firstBlockIndex Index in blocksToProcess of first block that is to be processed
+     *  \param blockIndexStep Difference in index in blocksToProcess between subsequent blocks that are to be processed
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param numberOfTimesPerBlock Maximum number of observation times in a single block.
+     *  \param residualsAndPartials Pair of residuals and partials, in which blocks are set (return by reference).
+     *  \param assemblyError Error that was caught during computation (returned by reference)
+     */
+    void calculateObservationBlocksMatrixAndResiduals(
+            const std::map< observation_models::ObservableType, boost::shared_ptr<
+            observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >& observationManagers,
+            const std::vector< std::pair< observation_models::ObservableType,
+            typename SingleObservablePodInputType::const_iterator > >& observationSets,
+            const std::vector< int >& observationSetStartIndices,
+            const std::vector< std::pair< unsigned int, int > >& blocksToProcess,
+            const unsigned int firstBlockIndex,
+            const unsigned int blockIndexStep,
+            const int parameterVectorSize,
+            const int numberOfTimesPerBlock,
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials,
+            std::exception_ptr& assemblyError )
+    {
+        try
+        {
+            std::vector< TimeType > blockTimes;
+            for( unsigned int currentBlockIndex = firstBlockIndex; currentBlockIndex < blocksToProcess.size( );
+                 currentBlockIndex += blockIndexStep )
+            {
+                const unsigned int observationSetIndex = blocksToProcess.at( currentBlockIndex ).first;
+                const int blockInObservationSet = blocksToProcess.at( currentBlockIndex ).second;
+                const observation_models::ObservableType observableType = observationSets.at( observationSetIndex ).first;
+                typename SingleObservablePodInputType::const_iterator dataIterator =
+                        observationSets.at( observationSetIndex ).second;
+
+                const std::vector< TimeType >& observationTimes = dataIterator->second.second.first;
+                const int observationSize = dataIterator->second.first.size( ) / observationTimes.size( );
+                const int firstTimeIndex = blockInObservationSet * numberOfTimesPerBlock;
+                const int numberOfBlockTimes = std::min(
+                            numberOfTimesPerBlock, static_cast< int >( observationTimes.size( ) ) - firstTimeIndex );
+                blockTimes.assign( observationTimes.begin( ) + firstTimeIndex,
+                                   observationTimes.begin( ) + firstTimeIndex + numberOfBlockTimes );
+
+                // Compute observations and partials for current block.
+                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                        observationManagers.at( observableType )->computeObservationsWithPartials(
+                            blockTimes, dataIterator->first, dataIterator->second.second.second );
+
+                // Set residuals and partials in rows associated with current block.
+                const int firstRowInObservationSet = firstTimeIndex * observationSize;
+                const int numberOfBlockRows = numberOfBlockTimes * observationSize;
+                const int firstRow = observationSetStartIndices.at( observationSetIndex ) + firstRowInObservationSet;
+                residualsAndPartials.first.segment( firstRow, numberOfBlockRows ) =
+                        ( dataIterator->second.first.segment( firstRowInObservationSet, numberOfBlockRows ) -
+                          observationsWithPartials.first ).template cast< double >( );
+                residualsAndPartials.second.block( firstRow, 0, numberOfBlockRows, parameterVectorSize ) =
+                        observationsWithPartials.second;
+            }
+        }
+        catch( ... )
+        {
+            assemblyError = std::current_exception( );
+        }
+    }
+
+    //! Function to create observation managers that can be used concurrently with the observationManagers_
+    /*!
+     *  Function to create observation managers that can be used concurrently with the observationManagers_ (and with
+     *  other managers created by this function), from a copy of the environment (see
+     *  copyBodyMapForConcurrentObservationEvaluation). The new observation managers use the observation bias objects
+     *  of the observationManagers_, and the same state transition/sensitivity matrix interface. Since the copied
+     *  ephemerides are fixed upon creation, new observation managers must be created after each propagation of the
+     *  dynamics.
+     *  \return Observation managers for all observable types involved in current orbit determination.
+     */
+    std::map< observation_models::ObservableType, boost::shared_ptr<
+    observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+    createObservationManagersForConcurrentEvaluation( )
+    {
+        NamedBodyMap bodyMapCopy = copyBodyMapForConcurrentObservationEvaluation( bodyMap_ );
+
+        std::map< observation_models::ObservableType, boost::shared_ptr<
+                observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > observationManagers;
+        for( observation_models::SortedObservationSettingsMap::const_iterator observablesIterator =
+             observationSettingsMap_.begin( ); observablesIterator != observationSettingsMap_.end( );
+             observablesIterator++ )
+        {
+            observationManagers[ observablesIterator->first ] =
+                    observation_models::createObservationManagerBase< ObservationScalarType, TimeType >(
+                        observablesIterator->first, observablesIterator->second, bodyMapCopy, parametersToEstimate_,
+                        stateTransitionAndSensitivityMatrixInterface_,
+                        observationManagers_.at( observablesIterator->first ) );
+        }
+        return observationManagers;
+    }
+
     //! Function called by either constructor to initialize the object.
     /*!
      *  Function called by either constructor to initialize the object.
@@ -783,6 +1118,9 @@ protected:
         using namespace orbit_determination;
         using namespace observation_models;
 
+        bodyMap_ = bodyMap;
+        observationSettingsMap_ = observationSettingsMap;
+
         // Check if any dynamics is to be estimated
         std::map< propagators::IntegratedStateType, std::vector< std::pair< std::string, std::string > > >
                 initialDynamicalStates =
@@ -897,6 +1235,12 @@ protected:
 
     }
 
+    //! Map of body objects with names of bodies, storing all environment models used in simulation.
+    NamedBodyMap bodyMap_;
+
+    //! Sets of observation model settings per link ends, per observable type.
+    observation_models::SortedObservationSettingsMap observationSettingsMap_;
+
     //! Boolean to denote whether any dynamical parameters are estimated
     bool integrateAndEstimateOrbit_;
 
@@ -64,7 +64,10 @@ public:
         reintegrateVariationalEquations_( true ),
         saveInformationMatrix_( true ),
         printOutput_( true ),
-        saveResidualsAndParametersFromEachIteration_( true )
+        saveResidualsAndParametersFromEachIteration_( true ),
+        numberOfObservationAssemblyThreads_( 1 ),
+        numberOfTimesPerObservationAssemblyBlock_( 1000 ),
+        accumulateNormalEquations_( false )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -210,6 +213,46 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define the settings for the computation of the residuals and partials of the observations
+    /*!
+     * Function to define the settings for the computation of the residuals and partials of the observations on each
+     * iteration. The observations of each observable type and set of link ends are split into blocks, which are
+     * distributed over the given number of threads. Each thread computes its blocks using its own copy of the
+     * environment, and the results are identical to those obtained on a single thread. Note that the ephemerides and
+     * rotation models used to compute the observations must be copyable (see
+     * copyBodyMapForConcurrentObservationEvaluation) if more than one thread is used (which is not the case for
+     * ephemerides that call Spice directly).
+     * \param numberOfThreads Number of threads on which to compute the residuals and partials (0 to use the number of
+     * concurrent threads supported by the hardware).
+     * \param numberOfTimesPerBlock Maximum number of observation times in a single block.
+     */
+    void defineObservationAssemblySettings( const unsigned int numberOfThreads,
+                                            const int numberOfTimesPerBlock = 1000 )
+    {
+        if( numberOfTimesPerBlock <= 0 )
+        {
+            throw std::runtime_error( "Error when defining observation assembly settings, block size must be positive" );
+        }
+        numberOfObservationAssemblyThreads_ = numberOfThreads;
+        numberOfTimesPerObservationAssemblyBlock_ = numberOfTimesPerBlock;
+    }
+
+    //! Function to define whether the normal equations are accumulated per block of observations
+    /*!
+     * Function to define whether the normal equations are accumulated per block of observations. If true, the full
+     * (observations x parameters) matrix of partials is never created. Instead, the normal equations are accumulated
+     * directly from the partials of each block of observations (of size set by defineObservationAssemblySettings), and
+     * solved using an LDLT decomposition (an SVD is used instead if the normal equations are ill-conditioned). The
+     * memory required for the partials is then independent of the number of observations. In this mode, the matrix of
+     * partials is not saved in the estimation output, regardless of the settings in defineEstimationSettings, and the
+     * blocks are processed on a single thread.
+     * \param accumulateNormalEquations Boolean denoting whether the normal equations are accumulated per block.
+     */
+    void defineNormalEquationAccumulation( const bool accumulateNormalEquations = true )
+    {
+        accumulateNormalEquations_ = accumulateNormalEquations;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -313,6 +356,37 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the number of threads on which the residuals and partials are computed
+    /*!
+     * Function to return the number of threads on which the residuals and partials are computed (0 for the number of
+     * concurrent threads supported by the hardware).
+     * \return Number of threads on which the residuals and partials are computed
+     */
+    unsigned int getNumberOfObservationAssemblyThreads( )
+    {
+        return numberOfObservationAssemblyThreads_;
+    }
+
+    //! Function to return the maximum number of observation times in a single block when computing residuals and partials
+    /*!
+     * Function to return the maximum number of observation times in a single block when computing residuals and partials
+     * \return Maximum number of observation times in a single block when computing residuals and partials
+     */
+    int getNumberOfTimesPerObservationAssemblyBlock( )
+    {
+        return numberOfTimesPerObservationAssemblyBlock_;
+    }
+
+    //! Function to return the boolean denoting whether the normal equations are accumulated per block of observations
+    /*!
+     * Function to return the boolean denoting whether the normal equations are accumulated per block of observations
+     * \return Boolean denoting whether the normal equations are accumulated per block of observations
+     */
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
@@ -345,6 +419,15 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Number of threads on which the residuals and partials are computed (0 for hardware concurrency).
+    unsigned int numberOfObservationAssemblyThreads_;
+
+    //! Maximum number of observation times in a single block when computing residuals and partials
+    int numberOfTimesPerObservationAssemblyBlock_;
+
+    //! Boolean denoting whether the normal equations are accumulated per block of observations
+    bool accumulateNormalEquations_;
+
 };
 
 //! Data structure through which the output of the orbit determination is communicated
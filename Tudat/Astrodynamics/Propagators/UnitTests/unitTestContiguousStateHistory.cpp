@@ -0,0 +1,164 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Propagators/contiguousStateHistory.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_contiguous_state_history )
+
+//! Test if contiguous state history reproduces behaviour of map-based state history, for forward and backward propagation
+BOOST_AUTO_TEST_CASE( testContiguousStateHistoryAccess )
+{
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        bool isTimeIncreasing = ( testCase == 0 );
+        double timeStep = isTimeIncreasing ? 10.0 : -10.0;
+
+        // Fill map-based and contiguous history with identical data.
+        std::map< double, Eigen::VectorXd > historyMap;
+        ContiguousStateHistory< double, double > contiguousHistory( 4 );
+        for( int i = 0; i < 25; i++ )
+        {
+            double currentTime = 100.0 + static_cast< double >( i ) * timeStep;
+            Eigen::VectorXd currentState = Eigen::VectorXd::Zero( 6 );
+            for( int j = 0; j < 6; j++ )
+            {
+                currentState( j ) = currentTime * static_cast< double >( j + 1 ) + 0.5;
+            }
+            addEntryToHistory( historyMap, currentTime, currentState );
+            addEntryToHistory( contiguousHistory, currentTime, currentState );
+        }
+
+        BOOST_CHECK_EQUAL( contiguousHistory.size( ), static_cast< int >( historyMap.size( ) ) );
+        BOOST_CHECK_EQUAL( contiguousHistory.isTimeDecreasing( ), !isTimeIncreasing );
+        BOOST_CHECK_EQUAL( getLastAddedTimeOfHistory( contiguousHistory, isTimeIncreasing ),
+                           getLastAddedTimeOfHistory( historyMap, isTimeIncreasing ) );
+
+        // Check iteration order and random access.
+        std::map< double, Eigen::VectorXd >::const_iterator mapIterator = historyMap.begin( );
+        for( ContiguousStateHistory< double, double >::const_iterator historyIterator = contiguousHistory.begin( );
+             historyIterator != contiguousHistory.end( ); historyIterator++ )
+        {
+            BOOST_CHECK_EQUAL( historyIterator->first, mapIterator->first );
+            BOOST_CHECK_EQUAL( contiguousHistory.count( mapIterator->first ), 1 );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( historyIterator->second( j ), mapIterator->second( j ) );
+                BOOST_CHECK_EQUAL( contiguousHistory.at( mapIterator->first )( j ), mapIterator->second( j ) );
+            }
+            mapIterator++;
+        }
+        BOOST_CHECK_EQUAL( contiguousHistory.count( 105.0 ), 0 );
+
+        // Check removal of last entry.
+        removeLastAddedEntryFromHistory( historyMap, isTimeIncreasing );
+        removeLastAddedEntryFromHistory( contiguousHistory, isTimeIncreasing );
+        BOOST_CHECK_EQUAL( contiguousHistory.size( ), static_cast< int >( historyMap.size( ) ) );
+        BOOST_CHECK_EQUAL( getLastAddedTimeOfHistory( contiguousHistory, isTimeIncreasing ),
+                           getLastAddedTimeOfHistory( historyMap, isTimeIncreasing ) );
+
+        // Check conversion to and from map.
+        std::map< double, Eigen::VectorXd > convertedMap =
+                contiguousHistory.template convertToMap< Eigen::VectorXd >( );
+        BOOST_CHECK_EQUAL( convertedMap.size( ), historyMap.size( ) );
+        for( mapIterator = historyMap.begin( ); mapIterator != historyMap.end( ); mapIterator++ )
+        {
+            BOOST_CHECK_EQUAL( ( convertedMap.at( mapIterator->first ) - mapIterator->second ).norm( ), 0.0 );
+        }
+
+        ContiguousStateHistory< double, double > historyFromMap( historyMap );
+        BOOST_CHECK_EQUAL( historyFromMap.size( ), static_cast< int >( historyMap.size( ) ) );
+        BOOST_CHECK_EQUAL( historyFromMap.getLastTime( ), historyMap.rbegin( )->first );
+
+        // Check that clearing retains ability to re-use history.
+        contiguousHistory.clear( );
+        BOOST_CHECK_EQUAL( contiguousHistory.empty( ), true );
+        addEntryToHistory( contiguousHistory, 0.0, Eigen::VectorXd( Eigen::VectorXd::Ones( 3 ) ) );
+        BOOST_CHECK_EQUAL( contiguousHistory.getLastEntry( ).rows( ), 3 );
+    }
+}
+
+//! Test if scalar entries, and entry overwriting at equal time, are handled correctly.
+BOOST_AUTO_TEST_CASE( testContiguousScalarHistory )
+{
+    ContiguousStateHistory< double, double > computationTimeHistory;
+    addEntryToHistory( computationTimeHistory, 0.0, 1.0 );
+    addEntryToHistory( computationTimeHistory, 1.0, 2.0 );
+    addEntryToHistory( computationTimeHistory, 1.0, 3.0 );
+
+    std::map< double, double > computationTimeMap = computationTimeHistory.convertToScalarMap( );
+    BOOST_CHECK_EQUAL( computationTimeMap.size( ), 2 );
+    BOOST_CHECK_EQUAL( computationTimeMap.at( 0.0 ), 1.0 );
+    BOOST_CHECK_EQUAL( computationTimeMap.at( 1.0 ), 3.0 );
+}
+
+//! Test if inconsistent input is rejected.
+BOOST_AUTO_TEST_CASE( testContiguousStateHistoryErrors )
+{
+    ContiguousStateHistory< double, double > history;
+    history.push_back( 0.0, Eigen::Vector3d::Zero( ) );
+    history.push_back( 1.0, Eigen::Vector3d::Zero( ) );
+
+    // Check entry of inconsistent size.
+    bool isExceptionCaught = false;
+    try
+    {
+        history.push_back( 2.0, Eigen::Vector2d::Zero( ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check non-monotonic time.
+    isExceptionCaught = false;
+    try
+    {
+        history.push_back( 0.5, Eigen::Vector3d::Zero( ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check retrieval of non-existing entry.
+    isExceptionCaught = false;
+    try
+    {
+        history.at( 0.5 );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -57,7 +57,7 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
     {
         for( unsigned int direction = 0; direction < 2; direction++ )
         {
-            for( unsigned int simulationCase = 0; simulationCase < 5; simulationCase++ )
+            for( unsigned int simulationCase = 0; simulationCase < 6; simulationCase++ )
             {
                 std::cout<<integratorCase<<" "<<direction<<" "<<simulationCase<<std::endl;
                 using namespace tudat;
@@ -183,12 +183,13 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                     terminationSettings = boost::make_shared< PropagationTimeTerminationSettings >(
                                 simulationEndEpoch - directionMultiplier * 4.5, true );
                 }
-                else if( simulationCase == 1 )
+                else if( simulationCase == 1 || simulationCase == 5 )
                 {
+                    // For case 5, use dense output of integrator to find final condition
                     terminationSettings = boost::make_shared< PropagationDependentVariableTerminationSettings >(
                                 dependentVariables.at( 0 ), 8.7E6, false, true,
                                 boost::make_shared< root_finders::RootFinderSettings >(
-                                    root_finders::bisection_root_finder, 1.0E-6, 100 ) );
+                                    root_finders::bisection_root_finder, 1.0E-6, 100 ), simulationCase == 5 );
                 }
                 else if( simulationCase == 2 )
                 {
@@ -276,7 +277,7 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                                                       ( simulationEndEpoch + 4.5 ) ), 1.0E-10 );
                     }
                 }
-                else if( simulationCase == 1 )
+                else if( simulationCase == 1 || simulationCase == 5 )
                 {
                     // Check if propagation terminated exactly on final altitude
                     if( direction == 0 )
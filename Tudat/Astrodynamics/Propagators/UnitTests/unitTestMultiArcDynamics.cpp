@@ -243,6 +243,149 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     }
 }
 
+//! Function to create the bodies used in the parallel multi-arc propagation test
+NamedBodyMap createParallelMultiArcTestBodies( const double initialTime, const double finalTime )
+{
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialTime, finalTime );
+    boost::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings[ "Moon" ]->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings[ "Earth" ]->ephemerisSettings = boost::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    return bodyMap;
+}
+
+//! Function to create the multi-arc propagator settings used in the parallel multi-arc propagation test
+boost::shared_ptr< MultiArcPropagatorSettings< double > > createParallelMultiArcTestPropagatorSettings(
+        const std::vector< NamedBodyMap >& arcBodyMaps,
+        const std::vector< double >& integrationArcStarts,
+        const std::vector< double >& integrationArcEnds,
+        const bool transferInitialStateInformationPerArc )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate, centralBodies;
+    bodiesToIntegrate.push_back( "Moon" );
+    centralBodies.push_back( "SSB" );
+
+    std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+    for( unsigned int i = 0; i < integrationArcStarts.size( ); i++ )
+    {
+        // Create accelerations from the body map of the current arc.
+        AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                    arcBodyMaps.at( i ), accelerationMap, bodiesToIntegrate, centralBodies );
+        Eigen::VectorXd arcInitialState = spice_interface::getBodyCartesianStateAtEpoch(
+                    bodiesToIntegrate[ 0 ], "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) );
+        arcPropagationSettingsList.push_back(
+                    boost::make_shared< TranslationalStatePropagatorSettings< double > >
+                    ( centralBodies, accelerationModelMap, bodiesToIntegrate,
+                      arcInitialState, integrationArcEnds.at( i ) ) );
+    }
+    return boost::make_shared< MultiArcPropagatorSettings< double > >(
+                arcPropagationSettingsList, transferInitialStateInformationPerArc );
+}
+
+//! Test whether concurrent propagation of arcs gives results identical to sequential propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcDynamics )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 2.0E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define arcs
+    std::vector< double > integrationArcStarts, integrationArcEnds;
+    double arcDuration = 1.0E6;
+    double arcOverlap = 1.0E4;
+    double currentStartTime = initialEphemerisTime + 1.0E4;
+    double currentEndTime = currentStartTime + arcDuration;
+    do
+    {
+        integrationArcStarts.push_back( currentStartTime );
+        integrationArcEnds.push_back( currentEndTime );
+
+        currentStartTime = currentEndTime - arcOverlap;
+        currentEndTime = currentStartTime + arcDuration;
+    }
+    while( currentEndTime < finalEphemerisTime - 1.0E4 );
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    // Create separate environment for each arc
+    std::vector< NamedBodyMap > arcBodyMaps;
+    for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+    {
+        arcBodyMaps.push_back( createParallelMultiArcTestBodies(
+                                   initialEphemerisTime - buffer, finalEphemerisTime + buffer ) );
+    }
+
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, initialEphemerisTime, 120.0 );
+
+    // Test independent arcs (case 0) and arcs with initial states transferred from previous arc (case 1)
+    for( unsigned testCase = 0; testCase < 2; testCase++ )
+    {
+        // Propagate arcs sequentially, using a single environment.
+        NamedBodyMap sequentialBodyMap = createParallelMultiArcTestBodies(
+                    initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+        MultiArcDynamicsSimulator< > sequentialDynamicsSimulator(
+                    sequentialBodyMap, integratorSettings, createParallelMultiArcTestPropagatorSettings(
+                        std::vector< NamedBodyMap >( numberOfIntegrationArcs, sequentialBodyMap ),
+                        integrationArcStarts, integrationArcEnds, testCase == 1 ), integrationArcStarts, true, false );
+
+        // Propagate arcs concurrently, using a separate environment for each arc.
+        NamedBodyMap parallelBodyMap = createParallelMultiArcTestBodies(
+                    initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+        boost::shared_ptr< MultiArcPropagatorSettings< double > > parallelPropagatorSettings =
+                createParallelMultiArcTestPropagatorSettings(
+                    arcBodyMaps, integrationArcStarts, integrationArcEnds, testCase == 1 );
+        parallelPropagatorSettings->setParallelArcPropagation( 4, arcBodyMaps );
+        MultiArcDynamicsSimulator< > parallelDynamicsSimulator(
+                    parallelBodyMap, integratorSettings, parallelPropagatorSettings, integrationArcStarts, true, false );
+
+        // Check that numerical results are identical
+        std::vector< std::map< double, Eigen::VectorXd > > sequentialResults =
+                sequentialDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        std::vector< std::map< double, Eigen::VectorXd > > parallelResults =
+                parallelDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_EQUAL( sequentialResults.size( ), parallelResults.size( ) );
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            BOOST_CHECK_EQUAL( sequentialResults.at( i ).size( ), parallelResults.at( i ).size( ) );
+            std::map< double, Eigen::VectorXd >::const_iterator parallelIterator = parallelResults.at( i ).begin( );
+            for( std::map< double, Eigen::VectorXd >::const_iterator sequentialIterator = sequentialResults.at( i ).begin( );
+                 sequentialIterator != sequentialResults.at( i ).end( ); sequentialIterator++ )
+            {
+                BOOST_CHECK_EQUAL( sequentialIterator->first, parallelIterator->first );
+                for( int j = 0; j < 6; j++ )
+                {
+                    BOOST_CHECK_EQUAL( sequentialIterator->second( j ), parallelIterator->second( j ) );
+                }
+                parallelIterator++;
+            }
+        }
+
+        // Check that integrated results are set in the body map provided to the simulator
+        double testTime = integrationArcStarts.at( numberOfIntegrationArcs / 2 ) + 1.0E5;
+        Eigen::Vector6d stateDifference = sequentialBodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testTime ) -
+                parallelBodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testTime );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( stateDifference( j ), 0.0 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,368 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The propagation events are tested on a harmonic oscillator, for which the event times are known analytically.
+ *      The switching functions are evaluated from the state at which the state derivative was last evaluated, to
+ *      emulate the dependence of dependent variables on the environment. In addition, events defined by dependent
+ *      variables are tested for a Keplerian orbit, propagated by the dynamics simulator.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_events )
+
+//! Class to compute the state derivative of a harmonic oscillator, storing the state at which it was last evaluated.
+class HarmonicOscillatorEnvironment
+{
+public:
+
+    //! Function to compute the state derivative (position and velocity) of a harmonic oscillator with unit frequency.
+    Eigen::VectorXd computeStateDerivative( const double time, const Eigen::VectorXd& state )
+    {
+        currentState_ = state;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    }
+
+    //! Function to retrieve the position at which the state derivative was last evaluated.
+    double getCurrentPosition( )
+    {
+        return currentState_( 0 );
+    }
+
+    //! Function to retrieve the velocity at which the state derivative was last evaluated.
+    double getCurrentVelocity( )
+    {
+        return currentState_( 1 );
+    }
+
+    //! State at which the state derivative was last evaluated.
+    Eigen::VectorXd currentState_;
+};
+
+//! Function to propagate the harmonic oscillator, with initial state (1, 0) at t=0, and (optionally) detect events.
+/*!
+ *  Function to propagate the harmonic oscillator, with initial state (1, 0) at t=0, and (optionally) detect events. The
+ *  events are zero crossings of the position (any direction), and increasing zero crossings of the velocity.
+ */
+std::map< double, Eigen::VectorXd > propagateHarmonicOscillator(
+        const double finalTime,
+        const bool detectEvents,
+        boost::shared_ptr< PropagationEventLog >& eventLog )
+{
+    boost::shared_ptr< HarmonicOscillatorEnvironment > environment =
+            boost::make_shared< HarmonicOscillatorEnvironment >( );
+    const double initialTimeStep = ( finalTime > 0.0 ) ? 0.1 : -0.1;
+
+    boost::shared_ptr< RungeKuttaVariableStepSizeIntegratorXd > integrator =
+            boost::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 ),
+                boost::bind( &HarmonicOscillatorEnvironment::computeStateDerivative, environment, _1, _2 ),
+                0.0, ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( ), 1.0E-6, 0.1, 1.0E-12, 1.0E-12 );
+
+    boost::shared_ptr< PropagationTerminationCondition > terminationCondition =
+            boost::make_shared< FixedTimePropagationTerminationCondition >( finalTime, finalTime > 0.0 );
+
+    if( detectEvents )
+    {
+        std::vector< boost::function< double( ) > > switchingFunctions;
+        switchingFunctions.push_back(
+                    boost::bind( &HarmonicOscillatorEnvironment::getCurrentPosition, environment ) );
+        switchingFunctions.push_back(
+                    boost::bind( &HarmonicOscillatorEnvironment::getCurrentVelocity, environment ) );
+
+        std::vector< PropagationEventDirection > eventDirections;
+        eventDirections.push_back( any_event_direction );
+        eventDirections.push_back( increasing_event_direction );
+
+        std::vector< std::string > eventNames;
+        eventNames.push_back( "Position zero crossing" );
+        eventNames.push_back( "Velocity increasing zero crossing" );
+
+        std::vector< boost::shared_ptr< root_finders::RootFinderSettings > > rootFinderSettings(
+                    2, boost::make_shared< root_finders::RootFinderSettings >(
+                        root_finders::bisection_root_finder, 1.0E-14, 100 ) );
+
+        terminationCondition->setEventDetector(
+                    boost::make_shared< PropagationEventDetector >(
+                        switchingFunctions, eventDirections, eventNames, rootFinderSettings ) );
+    }
+
+    std::map< double, Eigen::VectorXd > stateHistory;
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    std::map< double, double > cpuTimeHistory;
+    integrateEquationsFromIntegrator< Eigen::VectorXd, double, double >(
+                integrator, initialTimeStep, terminationCondition, stateHistory, dependentVariableHistory,
+                cpuTimeHistory, boost::function< Eigen::VectorXd( ) >( ), 1 );
+
+    if( detectEvents )
+    {
+        eventLog = terminationCondition->getEventDetector( )->getEventLog( );
+    }
+
+    return stateHistory;
+}
+
+//! Test whether events are detected at the correct time and state, and in the correct order, without modifying the
+//! propagation.
+BOOST_AUTO_TEST_CASE( testPropagationEventDetection )
+{
+    using mathematical_constants::PI;
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Propagate forwards (test 0) or backwards (test 1), with and without event detection.
+        const double finalTime = ( test == 0 ) ? 10.0 : -10.0;
+        boost::shared_ptr< PropagationEventLog > eventLog;
+        std::map< double, Eigen::VectorXd > stateHistory = propagateHarmonicOscillator( finalTime, false, eventLog );
+        std::map< double, Eigen::VectorXd > eventStateHistory = propagateHarmonicOscillator( finalTime, true, eventLog );
+
+        // Check that propagation is not modified (or terminated) by event detection.
+        BOOST_CHECK_EQUAL( stateHistory.size( ), eventStateHistory.size( ) );
+        std::map< double, Eigen::VectorXd >::const_iterator eventStateIterator = eventStateHistory.begin( );
+        for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = stateHistory.begin( );
+             stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            BOOST_CHECK_EQUAL( stateIterator->first, eventStateIterator->first );
+            BOOST_CHECK_EQUAL( stateIterator->second( 0 ), eventStateIterator->second( 0 ) );
+            BOOST_CHECK_EQUAL( stateIterator->second( 1 ), eventStateIterator->second( 1 ) );
+            eventStateIterator++;
+        }
+        BOOST_CHECK( std::fabs( ( test == 0 ) ? eventStateHistory.rbegin( )->first :
+                                                eventStateHistory.begin( )->first ) >= 10.0 );
+
+        // Set expected events (in order of propagation): position zero crossings at +/-( pi/2 + k pi ), and
+        // increasing velocity zero crossings at (2k+1) pi (forwards) or -2k pi (backwards)
+        std::vector< double > expectedEventTimes;
+        std::vector< unsigned int > expectedEventIndices;
+        std::vector< int > expectedEventDirections;
+        if( test == 0 )
+        {
+            expectedEventTimes = { PI / 2.0, PI, 3.0 * PI / 2.0, 5.0 * PI / 2.0, 3.0 * PI };
+            expectedEventIndices = { 0, 1, 0, 0, 1 };
+            expectedEventDirections = { -1, 1, 1, -1, 1 };
+        }
+        else
+        {
+            expectedEventTimes = { -PI / 2.0, -3.0 * PI / 2.0, -2.0 * PI, -5.0 * PI / 2.0 };
+            expectedEventIndices = { 0, 0, 1, 0 };
+            expectedEventDirections = { -1, 1, 1, -1 };
+        }
+
+        // Check logged events (accuracy is limited by the cubic interpolation of the state in each step)
+        BOOST_CHECK_EQUAL( eventLog->getNumberOfEvents( ), expectedEventTimes.size( ) );
+        for( unsigned int i = 0; i < eventLog->getNumberOfEvents( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( eventLog->getEventIndices( ).at( i ), expectedEventIndices.at( i ) );
+            BOOST_CHECK_EQUAL( eventLog->getEventDirections( ).at( i ), expectedEventDirections.at( i ) );
+            BOOST_CHECK_SMALL( eventLog->getEventTimes( ).at( i ) - expectedEventTimes.at( i ), 1.0E-7 );
+
+            const double eventTime = eventLog->getEventTimes( ).at( i );
+            const Eigen::VectorXd eventState = eventLog->getEventState( i );
+            BOOST_CHECK_SMALL( eventState( 0 ) - std::cos( eventTime ), 1.0E-6 );
+            BOOST_CHECK_SMALL( eventState( 1 ) + std::sin( eventTime ), 1.0E-6 );
+        }
+
+        // Check retrieval of events per type
+        BOOST_CHECK_EQUAL( eventLog->getEventTimesOfType( 0 ).size( ), 3 );
+        BOOST_CHECK_EQUAL( eventLog->getEventTimesOfType( 1 ).size( ), expectedEventTimes.size( ) - 3 );
+    }
+}
+
+//! Test detection of events defined by dependent variables, when propagating with the dynamics simulator.
+BOOST_AUTO_TEST_CASE( testPropagationEventDetectionFromSettings )
+{
+    using namespace simulation_setup;
+    using namespace orbital_element_conversions;
+    using mathematical_constants::PI;
+
+    // Create point mass Earth and vehicle.
+    const double earthGravitationalParameter = 3.986004418E14;
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = boost::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = boost::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings =
+            boost::make_shared< CentralGravityFieldSettings >( earthGravitationalParameter );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "J2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Define orbit, starting at periapsis, and propagate for one orbital period.
+    const double semiMajorAxis = 7000.0E3;
+    const double eccentricity = 0.1;
+    Eigen::Vector6d initialKeplerianElements;
+    initialKeplerianElements << semiMajorAxis, eccentricity, 0.3, 0.5, 0.7, 0.0;
+    const Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerianElements, earthGravitationalParameter );
+    const double meanMotion = std::sqrt( earthGravitationalParameter / std::pow( semiMajorAxis, 3.0 ) );
+    const double orbitalPeriod = 2.0 * PI / meanMotion;
+
+    boost::shared_ptr< SingleDependentVariableSaveSettings > distanceSettings =
+            boost::make_shared< SingleDependentVariableSaveSettings >(
+                relative_distance_dependent_variable, "Vehicle", "Earth" );
+    boost::shared_ptr< SingleDependentVariableSaveSettings > speedSettings =
+            boost::make_shared< SingleDependentVariableSaveSettings >(
+                relative_speed_dependent_variable, "Vehicle", "Earth" );
+
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                1.0E-3, 60.0, 1.0E-12, 1.0E-12 );
+
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Detect events in second propagation: distance equal to semi-major axis (both directions), speed equal to
+        // circular speed at this distance (decreasing only), and distance event without converged root finder.
+        boost::shared_ptr< PropagationTerminationSettings > terminationSettings =
+                boost::make_shared< PropagationTimeTerminationSettings >( orbitalPeriod );
+        if( test == 1 )
+        {
+            terminationSettings->eventSettings_.push_back(
+                        boost::make_shared< PropagationEventSettings >(
+                            "Mean distance", distanceSettings, semiMajorAxis ) );
+            terminationSettings->eventSettings_.push_back(
+                        boost::make_shared< PropagationEventSettings >(
+                            "Decreasing circular speed", speedSettings,
+                            std::sqrt( earthGravitationalParameter / semiMajorAxis ), decreasing_event_direction ) );
+            terminationSettings->eventSettings_.push_back(
+                        boost::make_shared< PropagationEventSettings >(
+                            "Unconverged mean distance", distanceSettings, semiMajorAxis, any_event_direction,
+                            boost::make_shared< root_finders::RootFinderSettings >(
+                                root_finders::bisection_root_finder, 1.0E-15, 2 ) ) );
+        }
+
+        boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState, terminationSettings );
+        SingleArcDynamicsSimulator< > dynamicsSimulator(
+                    bodyMap, integratorSettings, propagatorSettings, true, false, false );
+
+        if( test == 0 )
+        {
+            stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+            BOOST_CHECK( dynamicsSimulator.getPropagationTerminationCondition( )->getEventDetector( ) == NULL );
+            continue;
+        }
+
+        // Check that propagation is not modified by event detection.
+        std::map< double, Eigen::VectorXd > eventStateHistory =
+                dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_EQUAL( stateHistory.size( ), eventStateHistory.size( ) );
+        BOOST_CHECK_EQUAL( stateHistory.rbegin( )->first, eventStateHistory.rbegin( )->first );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( stateHistory.rbegin( )->second( i ), eventStateHistory.rbegin( )->second( i ) );
+        }
+
+        // Check events, with distance equal to semi-major axis at eccentric anomalies of pi/2 and 3pi/2.
+        boost::shared_ptr< PropagationEventLog > eventLog =
+                dynamicsSimulator.getPropagationTerminationCondition( )->getEventDetector( )->getEventLog( );
+        const std::vector< double > expectedEventTimes =
+        { ( PI / 2.0 - eccentricity ) / meanMotion, ( 3.0 * PI / 2.0 + eccentricity ) / meanMotion };
+
+        const std::vector< double > distanceEventTimes = eventLog->getEventTimesOfType( 0 );
+        BOOST_CHECK_EQUAL( distanceEventTimes.size( ), 2 );
+        for( unsigned int i = 0; i < distanceEventTimes.size( ); i++ )
+        {
+            BOOST_CHECK_SMALL( distanceEventTimes.at( i ) - expectedEventTimes.at( i ), 1.0E-3 );
+        }
+
+        const std::vector< double > speedEventTimes = eventLog->getEventTimesOfType( 1 );
+        BOOST_CHECK_EQUAL( speedEventTimes.size( ), 1 );
+        BOOST_CHECK_SMALL( speedEventTimes.at( 0 ) - expectedEventTimes.at( 0 ), 1.0E-3 );
+
+        // Check event states and directions, and that only the events of the last type are reported as unconverged.
+        std::vector< unsigned int > expectedUnconvergedEventNumbers;
+        for( unsigned int i = 0; i < eventLog->getNumberOfEvents( ); i++ )
+        {
+            const Eigen::VectorXd eventState = eventLog->getEventState( i );
+            const bool isFirstEvent = eventLog->getEventTimes( ).at( i ) < orbitalPeriod / 2.0;
+            switch( eventLog->getEventIndices( ).at( i ) )
+            {
+            case 0:
+                BOOST_CHECK_SMALL( eventState.segment( 0, 3 ).norm( ) - semiMajorAxis, 1.0E-3 );
+                BOOST_CHECK_EQUAL( eventLog->getEventDirections( ).at( i ), isFirstEvent ? 1 : -1 );
+                break;
+            case 1:
+                BOOST_CHECK_SMALL( eventState.segment( 3, 3 ).norm( ) -
+                                   std::sqrt( earthGravitationalParameter / semiMajorAxis ), 1.0E-6 );
+                BOOST_CHECK_EQUAL( eventLog->getEventDirections( ).at( i ), -1 );
+                break;
+            case 2:
+                expectedUnconvergedEventNumbers.push_back( i );
+                break;
+            }
+        }
+        BOOST_CHECK_EQUAL( expectedUnconvergedEventNumbers.size( ), 2 );
+        std::vector< unsigned int > unconvergedEventNumbers =
+                dynamicsSimulator.getPropagationTerminationReason( )->getUnconvergedPropagationEventNumbers( );
+        BOOST_CHECK( unconvergedEventNumbers == expectedUnconvergedEventNumbers );
+        BOOST_CHECK( eventLog->getUnconvergedEventNumbers( ) == expectedUnconvergedEventNumbers );
+    }
+
+    // Check that events cannot be defined in the constituents of hybrid termination settings.
+    boost::shared_ptr< PropagationTerminationSettings > constituentTerminationSettings =
+            boost::make_shared< PropagationDependentVariableTerminationSettings >(
+                distanceSettings, 1.1 * semiMajorAxis, false );
+    constituentTerminationSettings->eventSettings_.push_back(
+                boost::make_shared< PropagationEventSettings >( "Mean distance", distanceSettings, semiMajorAxis ) );
+    std::vector< boost::shared_ptr< PropagationTerminationSettings > > terminationSettingsList;
+    terminationSettingsList.push_back( boost::make_shared< PropagationTimeTerminationSettings >( orbitalPeriod ) );
+    terminationSettingsList.push_back( constituentTerminationSettings );
+    BOOST_CHECK_THROW( createPropagationTerminationConditions(
+                           boost::make_shared< PropagationHybridTerminationSettings >( terminationSettingsList, true ),
+                           bodyMap, 10.0 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
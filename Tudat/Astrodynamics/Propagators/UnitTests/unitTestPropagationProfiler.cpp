@@ -0,0 +1,198 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+//! State derivative model for uncoupled harmonic oscillators.
+class HarmonicOscillatorStateDerivative: public SingleStateTypeDerivative< double, double >
+{
+public:
+
+    HarmonicOscillatorStateDerivative( const int numberOfOscillators, const double angularFrequency ):
+        SingleStateTypeDerivative< double, double >( custom_state ),
+        numberOfOscillators_( numberOfOscillators ), squaredAngularFrequency_( angularFrequency * angularFrequency ){ }
+
+    void calculateSystemStateDerivative(
+            const double time,
+            const Eigen::VectorXd& stateOfSystemToBeIntegrated,
+            Eigen::Block< Eigen::MatrixXd > stateDerivative )
+    {
+        for( int i = 0; i < numberOfOscillators_; i++ )
+        {
+            stateDerivative( 2 * i, 0 ) = stateOfSystemToBeIntegrated( 2 * i + 1 );
+            stateDerivative( 2 * i + 1, 0 ) = -squaredAngularFrequency_ * stateOfSystemToBeIntegrated( 2 * i );
+        }
+    }
+
+    void clearStateDerivativeModel( ){ }
+
+    void updateStateDerivativeModel( const double currentTime ){ }
+
+    void convertCurrentStateToGlobalRepresentation(
+            const Eigen::VectorXd& internalSolution, const double& time,
+            Eigen::Block< Eigen::VectorXd > currentCartesianLocalSoluton )
+    {
+        currentCartesianLocalSoluton = internalSolution;
+    }
+
+    Eigen::MatrixXd convertFromOutputSolution( const Eigen::MatrixXd& outputSolution, const double& time )
+    {
+        return outputSolution;
+    }
+
+    void convertToOutputSolution( const Eigen::MatrixXd& internalSolution, const double& time,
+                                  Eigen::Block< Eigen::VectorXd > currentCartesianLocalSoluton )
+    {
+        currentCartesianLocalSoluton = internalSolution;
+    }
+
+    int getStateSize( )
+    {
+        return 2 * numberOfOscillators_;
+    }
+
+private:
+
+    int numberOfOscillators_;
+
+    double squaredAngularFrequency_;
+};
+
+//! Environment update function that does nothing.
+void updateDummyEnvironment(
+        const double currentTime,
+        const std::unordered_map< IntegratedStateType, Eigen::VectorXd >& integratedStatesToSet,
+        const std::vector< IntegratedStateType >& setIntegratedStatesFromEnvironment )
+{ }
+
+BOOST_AUTO_TEST_SUITE( test_propagation_profiler )
+
+//! Test registration, aggregation, reset and reporting of profiling entries.
+BOOST_AUTO_TEST_CASE( testPropagationProfilerEntries )
+{
+    PropagationProfiler profiler;
+
+    // Register entries, and check that identical models are aggregated.
+    const unsigned int firstIndex = profiler.registerEntry(
+                acceleration_model_profiling, "spherical harmonic gravity", "Vehicle", "Earth" );
+    const unsigned int secondIndex = profiler.registerEntry(
+                acceleration_model_profiling, "aerodynamic", "Vehicle", "Earth" );
+    const unsigned int thirdIndex = profiler.registerEntry(
+                environment_update_profiling, "flight conditions", "Vehicle" );
+    BOOST_CHECK_EQUAL( profiler.registerEntry(
+                           acceleration_model_profiling, "spherical harmonic gravity", "Vehicle", "Earth" ),
+                       firstIndex );
+    BOOST_CHECK_EQUAL( profiler.registerEntry(
+                           environment_update_profiling, "flight conditions", "Vehicle" ), thirdIndex );
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).size( ), 3 );
+    BOOST_CHECK( firstIndex != secondIndex );
+
+    // Add timings, and check call counts and totals.
+    profiler.addComputationTime( firstIndex, 1.0 );
+    profiler.addComputationTime( firstIndex, 2.0 );
+    profiler.addComputationTime( firstIndex, 0.5, false );
+    profiler.addComputationTime( secondIndex, 0.25 );
+    profiler.addComputationTime( thirdIndex, 4.0 );
+
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).at( firstIndex ).numberOfCalls_, 2 );
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).at( firstIndex ).computationTime_, 3.5 );
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).at( secondIndex ).numberOfCalls_, 1 );
+    BOOST_CHECK_EQUAL( profiler.getTotalComputationTime( acceleration_model_profiling ), 3.75 );
+    BOOST_CHECK_EQUAL( profiler.getTotalComputationTime( environment_update_profiling ), 4.0 );
+    BOOST_CHECK_EQUAL( profiler.getTotalComputationTime( dependent_variable_profiling ), 0.0 );
+
+    // Check that all entries are reported in the table.
+    std::ostringstream tableStream;
+    profiler.printTable( tableStream );
+    const std::string table = tableStream.str( );
+    BOOST_CHECK( table.find( "spherical harmonic gravity" ) != std::string::npos );
+    BOOST_CHECK( table.find( "aerodynamic" ) != std::string::npos );
+    BOOST_CHECK( table.find( "flight conditions" ) != std::string::npos );
+    BOOST_CHECK( table.find( getPropagationProfilingCategoryName( environment_update_profiling ) ) !=
+                 std::string::npos );
+
+    // Check that reset retains entries, but clears timings.
+    profiler.resetEntries( );
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).size( ), 3 );
+    BOOST_CHECK_EQUAL( profiler.getEntries( ).at( firstIndex ).numberOfCalls_, 0 );
+    BOOST_CHECK_EQUAL( profiler.getTotalComputationTime( acceleration_model_profiling ), 0.0 );
+}
+
+//! Test profiling of state derivative models, and whether profiling modifies the state derivative.
+BOOST_AUTO_TEST_CASE( testStateDerivativeModelProfiling )
+{
+    std::vector< boost::shared_ptr< SingleStateTypeDerivative< double, double > > > stateDerivativeModels;
+    stateDerivativeModels.push_back( boost::make_shared< HarmonicOscillatorStateDerivative >( 2, 1.0 ) );
+    stateDerivativeModels.push_back( boost::make_shared< HarmonicOscillatorStateDerivative >( 1, 3.0 ) );
+
+    boost::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            boost::make_shared< DynamicsStateDerivativeModel< double, double > >(
+                stateDerivativeModels, boost::bind( &updateDummyEnvironment, _1, _2, _3 ) );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
+
+    Eigen::MatrixXd state = Eigen::MatrixXd::Zero( 6, 1 );
+    state << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+    const Eigen::MatrixXd stateDerivative = dynamicsStateDerivative->computeStateDerivative( 0.0, state );
+    BOOST_CHECK( dynamicsStateDerivative->getPropagationProfiler( ) == NULL );
+
+    // Set profiler and evaluate state derivative repeatedly
+    boost::shared_ptr< PropagationProfiler > profiler = boost::make_shared< PropagationProfiler >( );
+    dynamicsStateDerivative->setPropagationProfiler( profiler );
+    BOOST_CHECK( dynamicsStateDerivative->getPropagationProfiler( ) == profiler );
+
+    const int numberOfEvaluations = 100;
+    Eigen::MatrixXd profiledStateDerivative;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        profiledStateDerivative = dynamicsStateDerivative->computeStateDerivative( 0.0, state );
+    }
+
+    // Check that state derivative is not modified
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( stateDerivative( i, 0 ), profiledStateDerivative( i, 0 ) );
+    }
+
+    // Check that both models (of the same type) are aggregated into a single entry, with a call per model evaluation.
+    BOOST_CHECK_EQUAL( profiler->getEntries( ).size( ), 1 );
+    BOOST_CHECK_EQUAL( profiler->getEntries( ).at( 0 ).category_, state_derivative_model_profiling );
+    BOOST_CHECK_EQUAL( profiler->getEntries( ).at( 0 ).modelName_,
+                       getIntegratedStateTypeName( custom_state ) );
+    BOOST_CHECK_EQUAL( profiler->getEntries( ).at( 0 ).numberOfCalls_, 2 * numberOfEvaluations );
+    BOOST_CHECK( profiler->getEntries( ).at( 0 ).computationTime_ > 0.0 );
+
+    // Check that profiling is stopped when removing profiler.
+    dynamicsStateDerivative->setPropagationProfiler( boost::shared_ptr< PropagationProfiler >( ) );
+    dynamicsStateDerivative->computeStateDerivative( 0.0, state );
+    BOOST_CHECK_EQUAL( profiler->getEntries( ).at( 0 ).numberOfCalls_, 2 * numberOfEvaluations );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
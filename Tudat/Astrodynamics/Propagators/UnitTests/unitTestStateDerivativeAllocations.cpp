@@ -0,0 +1,320 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+// Let Eigen throw an exception if it allocates memory when this is not allowed.
+#define EIGEN_RUNTIME_NO_MALLOC
+#include <stdexcept>
+#define eigen_assert( condition ) \
+    do { if( !( condition ) ){ throw std::runtime_error( "Eigen assertion failed: " #condition ); } } while( false )
+
+#include <cstdlib>
+#include <new>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+#include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
+#include "Tudat/Astrodynamics/Propagators/nBodyCowellStateDerivative.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createEnvironmentUpdater.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createStateDerivativeModel.h"
+
+//! Number of calls to global operator new since program start
+static long long numberOfMemoryAllocations = 0;
+
+void* operator new( std::size_t size )
+{
+    numberOfMemoryAllocations++;
+    void* allocatedMemory = std::malloc( size == 0 ? 1 : size );
+    if( allocatedMemory == NULL )
+    {
+        throw std::bad_alloc( );
+    }
+    return allocatedMemory;
+}
+
+void operator delete( void* memoryToFree ) noexcept
+{
+    std::free( memoryToFree );
+}
+
+void operator delete( void* memoryToFree, std::size_t ) noexcept
+{
+    std::free( memoryToFree );
+}
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+//! State derivative model for uncoupled harmonic oscillators, which does not allocate memory itself.
+class HarmonicOscillatorStateDerivative: public SingleStateTypeDerivative< double, double >
+{
+public:
+
+    HarmonicOscillatorStateDerivative( const int numberOfOscillators, const double angularFrequency ):
+        SingleStateTypeDerivative< double, double >( custom_state ),
+        numberOfOscillators_( numberOfOscillators ), squaredAngularFrequency_( angularFrequency * angularFrequency ),
+        numberOfUpdates_( 0 ){ }
+
+    void calculateSystemStateDerivative(
+            const double time,
+            const Eigen::VectorXd& stateOfSystemToBeIntegrated,
+            Eigen::Block< Eigen::MatrixXd > stateDerivative )
+    {
+        for( int i = 0; i < numberOfOscillators_; i++ )
+        {
+            stateDerivative( 2 * i, 0 ) = stateOfSystemToBeIntegrated( 2 * i + 1 );
+            stateDerivative( 2 * i + 1, 0 ) = -squaredAngularFrequency_ * stateOfSystemToBeIntegrated( 2 * i );
+        }
+    }
+
+    void clearStateDerivativeModel( ){ }
+
+    void updateStateDerivativeModel( const double currentTime )
+    {
+        numberOfUpdates_++;
+    }
+
+    void convertCurrentStateToGlobalRepresentation(
+            const Eigen::VectorXd& internalSolution, const double& time,
+            Eigen::Block< Eigen::VectorXd > currentCartesianLocalSoluton )
+    {
+        currentCartesianLocalSoluton = internalSolution;
+    }
+
+    Eigen::MatrixXd convertFromOutputSolution( const Eigen::MatrixXd& outputSolution, const double& time )
+    {
+        return outputSolution;
+    }
+
+    void convertToOutputSolution( const Eigen::MatrixXd& internalSolution, const double& time,
+                                  Eigen::Block< Eigen::VectorXd > currentCartesianLocalSoluton )
+    {
+        currentCartesianLocalSoluton = internalSolution;
+    }
+
+    int getStateSize( )
+    {
+        return 2 * numberOfOscillators_;
+    }
+
+    int getNumberOfUpdates( )
+    {
+        return numberOfUpdates_;
+    }
+
+private:
+
+    int numberOfOscillators_;
+
+    double squaredAngularFrequency_;
+
+    int numberOfUpdates_;
+};
+
+//! Environment update function that only stores the last-provided states.
+class DummyEnvironment
+{
+public:
+
+    void updateEnvironment(
+            const double currentTime,
+            const std::unordered_map< IntegratedStateType, Eigen::VectorXd >& integratedStatesToSet,
+            const std::vector< IntegratedStateType >& setIntegratedStatesFromEnvironment )
+    {
+        if( integratedStatesToSet.count( custom_state ) > 0 )
+        {
+            lastState_ = integratedStatesToSet.at( custom_state );
+        }
+    }
+
+    Eigen::VectorXd lastState_;
+};
+
+BOOST_AUTO_TEST_SUITE( test_state_derivative_allocations )
+
+//! Test if state derivative is computed correctly, and without memory allocation after first evaluation.
+BOOST_AUTO_TEST_CASE( testStateDerivativeAllocations )
+{
+    // Create two state derivative models of the same type.
+    std::vector< boost::shared_ptr< SingleStateTypeDerivative< double, double > > > stateDerivativeModels;
+    stateDerivativeModels.push_back( boost::make_shared< HarmonicOscillatorStateDerivative >( 2, 1.0 ) );
+    stateDerivativeModels.push_back( boost::make_shared< HarmonicOscillatorStateDerivative >( 1, 3.0 ) );
+
+    boost::shared_ptr< DummyEnvironment > environment = boost::make_shared< DummyEnvironment >( );
+    boost::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            boost::make_shared< DynamicsStateDerivativeModel< double, double > >(
+                stateDerivativeModels, boost::bind( &DummyEnvironment::updateEnvironment, environment, _1, _2, _3 ) );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
+
+    Eigen::MatrixXd state = Eigen::MatrixXd::Zero( 6, 1 );
+    state << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+    environment->lastState_ = Eigen::VectorXd::Zero( 6 );
+
+    // Evaluate state derivative once, to allow all internal variables to be sized.
+    dynamicsStateDerivative->evaluateStateDerivative( 0.0, state );
+
+    // Evaluate state derivative repeatedly, and check number of allocations (by operator new and by Eigen).
+    long long numberOfAllocationsBeforeEvaluation = numberOfMemoryAllocations;
+    bool isEigenAllocationDetected = false;
+    Eigen::internal::set_is_malloc_allowed( false );
+    try
+    {
+        for( int i = 0; i < 100; i++ )
+        {
+            state( 0, 0 ) = static_cast< double >( i );
+            dynamicsStateDerivative->evaluateStateDerivative( static_cast< double >( i ), state );
+        }
+    }
+    catch( const std::runtime_error& )
+    {
+        isEigenAllocationDetected = true;
+    }
+    Eigen::internal::set_is_malloc_allowed( true );
+    BOOST_CHECK_EQUAL( numberOfMemoryAllocations - numberOfAllocationsBeforeEvaluation, 0 );
+    BOOST_CHECK_EQUAL( isEigenAllocationDetected, false );
+
+    // Check computed state derivative, and states provided to the environment.
+    Eigen::MatrixXd stateDerivative = dynamicsStateDerivative->computeStateDerivative( 0.0, state );
+    Eigen::VectorXd expectedStateDerivative = Eigen::VectorXd::Zero( 6 );
+    expectedStateDerivative << 2.0, -99.0, 4.0, -3.0, 6.0, -45.0;
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( stateDerivative( i, 0 ), expectedStateDerivative( i ) );
+        BOOST_CHECK_EQUAL( environment->lastState_( i ), state( i, 0 ) );
+    }
+
+    for( unsigned int i = 0; i < stateDerivativeModels.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( boost::dynamic_pointer_cast< HarmonicOscillatorStateDerivative >(
+                               stateDerivativeModels.at( i ) )->getNumberOfUpdates( ), 102 );
+    }
+    BOOST_CHECK_EQUAL( dynamicsStateDerivative->getNumberOfFunctionEvaluations( ), 102 );
+}
+
+//! Test if translational state derivative, with environment updated by EnvironmentUpdater, is computed without memory
+//! allocation after first evaluation.
+BOOST_AUTO_TEST_CASE( testTranslationalStateDerivativeAllocations )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::basic_astrodynamics;
+
+    // Create Earth, with spherical harmonic gravity field in rotating frame, and vehicle.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( boost::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                    Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) ),
+                                                    7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.8E-4;
+    cosineCoefficients( 2, 2 ) = 2.4E-6;
+    sineCoefficients( 2, 2 ) = -1.4E-6;
+    cosineCoefficients( 4, 3 ) = 9.9E-7;
+    sineCoefficients( 4, 3 ) = -2.0E-7;
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                                  3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients,
+                                                  "IAU_Earth" ) );
+
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create acceleration models and propagation settings.
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< SphericalHarmonicAccelerationSettings >( 4, 4 ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 7.0E6, 1.0E5, -2.0E5, 100.0, 6.0E3, 4.0E3;
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, 3600.0 );
+
+    // Create state derivative model as in SingleArcDynamicsSimulator.
+    boost::shared_ptr< EnvironmentUpdater< double, double > > environmentUpdater =
+            createEnvironmentUpdaterForDynamicalEquations< double, double >( propagatorSettings, bodyMap );
+    std::vector< boost::shared_ptr< SingleStateTypeDerivative< double, double > > > stateDerivativeModels;
+    stateDerivativeModels.push_back(
+                boost::make_shared< NBodyCowellStateDerivative< double, double > >(
+                    accelerationModelMap,
+                    createCentralBodyData< double, double >( centralBodies, bodiesToPropagate, bodyMap ),
+                    bodiesToPropagate ) );
+    boost::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            boost::make_shared< DynamicsStateDerivativeModel< double, double > >(
+                stateDerivativeModels, boost::bind( &EnvironmentUpdater< double, double >::updateEnvironment,
+                                                    environmentUpdater, _1, _2, _3 ) );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
+
+    // Evaluate state derivative once, to allow all internal variables to be sized.
+    Eigen::MatrixXd state = initialState;
+    dynamicsStateDerivative->evaluateStateDerivative( 0.0, state );
+
+    // Evaluate state derivative repeatedly at different times and states, and check number of allocations.
+    long long numberOfAllocationsBeforeEvaluation = numberOfMemoryAllocations;
+    bool isEigenAllocationDetected = false;
+    Eigen::internal::set_is_malloc_allowed( false );
+    try
+    {
+        for( int i = 0; i < 100; i++ )
+        {
+            state( 0, 0 ) = initialState( 0 ) + 1.0E3 * static_cast< double >( i );
+            dynamicsStateDerivative->evaluateStateDerivative( 10.0 * static_cast< double >( i ), state );
+        }
+    }
+    catch( const std::runtime_error& )
+    {
+        isEigenAllocationDetected = true;
+    }
+    Eigen::internal::set_is_malloc_allowed( true );
+    BOOST_CHECK_EQUAL( numberOfMemoryAllocations - numberOfAllocationsBeforeEvaluation, 0 );
+    BOOST_CHECK_EQUAL( isEigenAllocationDetected, false );
+
+    // Check state derivative against direct evaluation of acceleration model, with environment updated by evaluation.
+    const double evaluationTime = 990.0;
+    Eigen::MatrixXd stateDerivative = dynamicsStateDerivative->computeStateDerivative( evaluationTime, state );
+    Eigen::Vector3d expectedAcceleration =
+            accelerationModelMap.at( "Vehicle" ).at( "Earth" ).at( 0 )->getAcceleration( );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( bodyMap.at( "Vehicle" )->getState( )( i ), state( i, 0 ) );
+        BOOST_CHECK_EQUAL( bodyMap.at( "Vehicle" )->getState( )( i + 3 ), state( i + 3, 0 ) );
+        BOOST_CHECK_EQUAL( stateDerivative( i, 0 ), state( i + 3, 0 ) );
+        BOOST_CHECK_EQUAL( stateDerivative( i + 3, 0 ), expectedAcceleration( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -183,8 +183,9 @@ public:
      *  \param areInputStateLocal True if the internalState vector is given in the local frames of the integrated
      *   bodies, or the global frame.
      */
+    template< typename Derived >
     void getReferenceFrameOriginInertialStates(
-            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalState, const TimeType time,
+            const Eigen::MatrixBase< Derived >& internalState, const TimeType time,
             std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& referenceFrameOriginStates,
             const bool areInputStateLocal = true )
     {
@@ -0,0 +1,587 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CONTIGUOUSSTATEHISTORY_H
+#define TUDAT_CONTIGUOUSSTATEHISTORY_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class to store a history of (equally sized) states/matrices as a function of time, in contiguous memory.
+/*!
+ *  Class to store a history of (equally sized) states/matrices as a function of time, in contiguous memory. This class is
+ *  used as an alternative to a std::map< TimeType, StateType >, for which each entry requires a separate tree node and
+ *  (for dynamically sized Eigen types) a separate heap allocation. Here, all epochs are stored in a single vector, and all
+ *  entries are stored (column-major, one after the other) in a single vector of scalars. Entries can only be added to the
+ *  end of the history (and the last entry removed), with the epochs strictly increasing or strictly decreasing (as for
+ *  forward and backward propagation, respectively). Clearing the history retains the allocated memory, so that it can be
+ *  reused by a subsequent propagation without new allocations.
+ *
+ *  Entries are accessed either by index (in the order in which they were added), or through a map-like interface (at,
+ *  count, begin/end, which iterate in order of increasing time, as std::map does). Conversion to a std::map is provided for
+ *  compatibility with existing interfaces.
+ */
+template< typename TimeType = double, typename ScalarType = double >
+class ContiguousStateHistory
+{
+public:
+
+    //! Type of a single entry of the history
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > EntryType;
+
+    //! Type of read-only view on a single entry of the history, without copying data
+    typedef Eigen::Map< const EntryType > ConstEntryMap;
+
+    //! Element of history, as returned by const_iterator, mimicking the value_type of std::map
+    struct Element
+    {
+        //! Epoch of element
+        TimeType first;
+
+        //! Entry (state) of element
+        ConstEntryMap second;
+    };
+
+    //! Iterator over history, in order of increasing time.
+    class const_iterator: public std::iterator< std::bidirectional_iterator_tag, Element >
+    {
+    public:
+
+        //! Proxy returned by operator->, holding the element by value.
+        struct ElementPointer
+        {
+            Element element;
+
+            const Element* operator->( ) const
+            {
+                return &element;
+            }
+        };
+
+        //! Constructor
+        /*!
+         * Constructor
+         * \param history History over which to iterate
+         * \param index Index of element (in order of increasing time).
+         */
+        const_iterator( const ContiguousStateHistory* history, const int index ):
+            history_( history ), index_( index ){ }
+
+        //! Dereference operator
+        Element operator*( ) const
+        {
+            return history_->getElementInTimeOrder( index_ );
+        }
+
+        //! Member access operator
+        ElementPointer operator->( ) const
+        {
+            return ElementPointer{ history_->getElementInTimeOrder( index_ ) };
+        }
+
+        //! Pre-increment operator
+        const_iterator& operator++( )
+        {
+            index_++;
+            return *this;
+        }
+
+        //! Post-increment operator
+        const_iterator operator++( int )
+        {
+            const_iterator previousIterator = *this;
+            index_++;
+            return previousIterator;
+        }
+
+        //! Pre-decrement operator
+        const_iterator& operator--( )
+        {
+            index_--;
+            return *this;
+        }
+
+        //! Post-decrement operator
+        const_iterator operator--( int )
+        {
+            const_iterator previousIterator = *this;
+            index_--;
+            return previousIterator;
+        }
+
+        //! Equality operator
+        bool operator==( const const_iterator& otherIterator ) const
+        {
+            return ( history_ == otherIterator.history_ ) && ( index_ == otherIterator.index_ );
+        }
+
+        //! Inequality operator
+        bool operator!=( const const_iterator& otherIterator ) const
+        {
+            return !( *this == otherIterator );
+        }
+
+    private:
+
+        //! History over which to iterate
+        const ContiguousStateHistory* history_;
+
+        //! Index of current element (in order of increasing time).
+        int index_;
+    };
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param initialCapacity Number of entries for which memory is to be allocated (upon addition of first entry).
+     */
+    ContiguousStateHistory( const int initialCapacity = 0 ):
+        numberOfRows_( 0 ), numberOfColumns_( 0 ), isTimeDecreasing_( false ), reservedCapacity_( 0 )
+    {
+        reserve( initialCapacity );
+    }
+
+    //! Constructor from std::map
+    /*!
+     * Constructor from std::map, in which the entries are added in order of increasing time.
+     * \param historyMap History of states as std::map, with time as key.
+     */
+    template< typename StateType >
+    ContiguousStateHistory( const std::map< TimeType, StateType >& historyMap ):
+        numberOfRows_( 0 ), numberOfColumns_( 0 ), isTimeDecreasing_( false ), reservedCapacity_( 0 )
+    {
+        setFromMap( historyMap );
+    }
+
+    //! Function to allocate memory for a given number of entries
+    /*!
+     * Function to allocate memory for a given number of entries. If no entries have been added yet (so that the size of
+     * the entries is unknown), the memory for the entries is allocated upon addition of the first entry.
+     * \param numberOfEntries Number of entries for which memory is to be allocated.
+     */
+    void reserve( const int numberOfEntries )
+    {
+        reservedCapacity_ = std::max( reservedCapacity_, numberOfEntries );
+        times_.reserve( numberOfEntries );
+        if( numberOfRows_ * numberOfColumns_ > 0 )
+        {
+            values_.reserve( numberOfEntries * numberOfRows_ * numberOfColumns_ );
+        }
+    }
+
+    //! Function to add an entry to the end of the history
+    /*!
+     * Function to add an entry to the end of the history. The size of the entry must be equal to that of previous entries
+     * (unless the history is empty), and the time must continue the (strictly increasing or decreasing) series of epochs.
+     * \param time Epoch of entry
+     * \param entry Entry (state) that is to be added
+     */
+    template< typename Derived >
+    void push_back( const TimeType time, const Eigen::MatrixBase< Derived >& entry )
+    {
+        if( times_.size( ) == 0 )
+        {
+            numberOfRows_ = entry.rows( );
+            numberOfColumns_ = entry.cols( );
+            values_.reserve( std::max( reservedCapacity_, 1 ) * numberOfRows_ * numberOfColumns_ );
+        }
+        else
+        {
+            if( ( entry.rows( ) != numberOfRows_ ) || ( entry.cols( ) != numberOfColumns_ ) )
+            {
+                throw std::runtime_error( "Error when adding entry to contiguous state history, entry size is inconsistent" );
+            }
+
+            if( times_.size( ) == 1 )
+            {
+                isTimeDecreasing_ = ( time < times_.back( ) );
+            }
+
+            if( isTimeDecreasing_ ? !( time < times_.back( ) ) : !( times_.back( ) < time ) )
+            {
+                throw std::runtime_error( "Error when adding entry to contiguous state history, epochs are not monotonic" );
+            }
+        }
+
+        times_.push_back( time );
+
+        const int entrySize = numberOfRows_ * numberOfColumns_;
+        values_.resize( values_.size( ) + entrySize );
+        Eigen::Map< EntryType >( values_.data( ) + values_.size( ) - entrySize, numberOfRows_, numberOfColumns_ ) = entry;
+    }
+
+    //! Function to add a scalar entry to the end of the history
+    /*!
+     * Function to add a scalar entry to the end of the history (entry is stored as a 1x1 matrix).
+     * \param time Epoch of entry
+     * \param entry Entry that is to be added
+     */
+    void push_back( const TimeType time, const ScalarType entry )
+    {
+        push_back( time, Eigen::Matrix< ScalarType, 1, 1 >::Constant( entry ) );
+    }
+
+    //! Function to remove the last entry that was added to the history
+    void pop_back( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from contiguous state history, history is empty" );
+        }
+        times_.pop_back( );
+        values_.resize( values_.size( ) - numberOfRows_ * numberOfColumns_ );
+    }
+
+    //! Function to remove all entries from the history (retaining allocated memory)
+    void clear( )
+    {
+        times_.clear( );
+        values_.clear( );
+        isTimeDecreasing_ = false;
+    }
+
+    //! Function to return the number of entries in the history
+    /*!
+     * Function to return the number of entries in the history
+     * \return Number of entries in the history
+     */
+    int size( ) const
+    {
+        return static_cast< int >( times_.size( ) );
+    }
+
+    //! Function to return whether the history is empty
+    /*!
+     * Function to return whether the history is empty
+     * \return True if no entries are stored in the history
+     */
+    bool empty( ) const
+    {
+        return times_.empty( );
+    }
+
+    //! Function to return the epoch of an entry, with index in order of addition
+    /*!
+     * Function to return the epoch of an entry, with index in order of addition
+     * \param index Index of entry (in order of addition)
+     * \return Epoch of entry
+     */
+    const TimeType& getTimeAtIndex( const int index ) const
+    {
+        return times_[ index ];
+    }
+
+    //! Function to return (read-only view of) an entry, with index in order of addition
+    /*!
+     * Function to return (read-only view of) an entry, with index in order of addition
+     * \param index Index of entry (in order of addition)
+     * \return Entry at given index
+     */
+    ConstEntryMap getEntryAtIndex( const int index ) const
+    {
+        return ConstEntryMap( values_.data( ) + index * numberOfRows_ * numberOfColumns_, numberOfRows_, numberOfColumns_ );
+    }
+
+    //! Function to return the epoch of the last entry that was added
+    /*!
+     * Function to return the epoch of the last entry that was added
+     * \return Epoch of the last entry that was added
+     */
+    const TimeType& getLastTime( ) const
+    {
+        return times_.back( );
+    }
+
+    //! Function to return (read-only view of) the last entry that was added
+    /*!
+     * Function to return (read-only view of) the last entry that was added
+     * \return Last entry that was added
+     */
+    ConstEntryMap getLastEntry( ) const
+    {
+        return getEntryAtIndex( size( ) - 1 );
+    }
+
+    //! Function to return all epochs, in order of addition
+    /*!
+     * Function to return all epochs, in order of addition
+     * \return All epochs, in order of addition
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to return whether the epochs are decreasing (i.e. the history is from a backward propagation)
+    /*!
+     * Function to return whether the epochs are decreasing (i.e. the history is from a backward propagation)
+     * \return True if epochs are decreasing.
+     */
+    bool isTimeDecreasing( ) const
+    {
+        return isTimeDecreasing_;
+    }
+
+    //! Function to return the number of entries with a given epoch (0 or 1), as std::map::count
+    /*!
+     * Function to return the number of entries with a given epoch (0 or 1), as std::map::count
+     * \param time Epoch that is to be found
+     * \return Number of entries with a given epoch
+     */
+    int count( const TimeType& time ) const
+    {
+        return ( findIndex( time ) >= 0 ) ? 1 : 0;
+    }
+
+    //! Function to return (read-only view of) the entry at a given epoch, as std::map::at
+    /*!
+     * Function to return (read-only view of) the entry at a given epoch, as std::map::at. An exception is thrown if no
+     * entry exists at the given epoch.
+     * \param time Epoch of entry that is to be returned
+     * \return Entry at given epoch
+     */
+    ConstEntryMap at( const TimeType& time ) const
+    {
+        int index = findIndex( time );
+        if( index < 0 )
+        {
+            throw std::runtime_error( "Error when retrieving entry from contiguous state history, epoch not found" );
+        }
+        return getEntryAtIndex( index );
+    }
+
+    //! Function to return iterator to first element (in order of increasing time)
+    const_iterator begin( ) const
+    {
+        return const_iterator( this, 0 );
+    }
+
+    //! Function to return iterator past the last element (in order of increasing time)
+    const_iterator end( ) const
+    {
+        return const_iterator( this, size( ) );
+    }
+
+    //! Function to return the element with given index, in order of increasing time
+    /*!
+     * Function to return the element with given index, in order of increasing time
+     * \param index Index of element, in order of increasing time
+     * \return Element with given index
+     */
+    Element getElementInTimeOrder( const int index ) const
+    {
+        int storageIndex = isTimeDecreasing_ ? ( size( ) - 1 - index ) : index;
+        return Element{ times_[ storageIndex ], getEntryAtIndex( storageIndex ) };
+    }
+
+    //! Function to reset the history from a std::map
+    /*!
+     * Function to reset the history from a std::map, in which the entries are added in order of increasing time.
+     * \param historyMap History of states as std::map, with time as key.
+     */
+    template< typename StateType >
+    void setFromMap( const std::map< TimeType, StateType >& historyMap )
+    {
+        clear( );
+        reserve( historyMap.size( ) );
+        for( typename std::map< TimeType, StateType >::const_iterator mapIterator = historyMap.begin( );
+             mapIterator != historyMap.end( ); mapIterator++ )
+        {
+            push_back( mapIterator->first, mapIterator->second );
+        }
+    }
+
+    //! Function to convert the history to a std::map with (Eigen) state type as value.
+    /*!
+     * Function to convert the history to a std::map with (Eigen) state type as value.
+     * \return History of states as std::map, with time as key.
+     */
+    template< typename StateType >
+    std::map< TimeType, StateType > convertToMap( ) const
+    {
+        std::map< TimeType, StateType > historyMap;
+        for( int i = 0; i < size( ); i++ )
+        {
+            historyMap.insert( historyMap.end( ), std::make_pair( times_[ i ], StateType( getEntryAtIndex( i ) ) ) );
+        }
+        return historyMap;
+    }
+
+    //! Function to convert a history of scalars (1x1 entries) to a std::map with scalar as value.
+    /*!
+     * Function to convert a history of scalars (1x1 entries) to a std::map with scalar as value.
+     * \return History of scalars as std::map, with time as key.
+     */
+    std::map< TimeType, ScalarType > convertToScalarMap( ) const
+    {
+        if( size( ) > 0 && ( numberOfRows_ * numberOfColumns_ != 1 ) )
+        {
+            throw std::runtime_error( "Error when converting contiguous state history to scalar map, entries are not scalar" );
+        }
+
+        std::map< TimeType, ScalarType > historyMap;
+        for( int i = 0; i < size( ); i++ )
+        {
+            historyMap.insert( historyMap.end( ), std::make_pair( times_[ i ], values_[ i ] ) );
+        }
+        return historyMap;
+    }
+
+private:
+
+    //! Function to find the index (in order of addition) of the entry at a given epoch (-1 if not found).
+    int findIndex( const TimeType& time ) const
+    {
+        typename std::vector< TimeType >::const_iterator timeIterator;
+        if( isTimeDecreasing_ )
+        {
+            timeIterator = std::lower_bound( times_.begin( ), times_.end( ), time, std::greater< TimeType >( ) );
+        }
+        else
+        {
+            timeIterator = std::lower_bound( times_.begin( ), times_.end( ), time );
+        }
+
+        if( timeIterator == times_.end( ) || *timeIterator != time )
+        {
+            return -1;
+        }
+        return static_cast< int >( std::distance( times_.begin( ), timeIterator ) );
+    }
+
+    //! Epochs of entries, in order of addition
+    std::vector< TimeType > times_;
+
+    //! Concatenated (column-major) entries, in order of addition
+    std::vector< ScalarType > values_;
+
+    //! Number of rows of each entry
+    int numberOfRows_;
+
+    //! Number of columns of each entry
+    int numberOfColumns_;
+
+    //! Boolean denoting whether the epochs are decreasing
+    bool isTimeDecreasing_;
+
+    //! Number of entries for which memory is to be allocated
+    int reservedCapacity_;
+};
+
+//! Function to add an entry to a history stored as a std::map
+/*!
+ * Function to add an entry to a history stored as a std::map
+ * \param history History to which entry is to be added
+ * \param time Epoch of entry
+ * \param entry Entry that is to be added
+ */
+template< typename TimeType, typename StateType >
+void addEntryToHistory( std::map< TimeType, StateType >& history, const TimeType time, const StateType& entry )
+{
+    history[ time ] = entry;
+}
+
+//! Function to add an entry to a history stored as a ContiguousStateHistory
+/*!
+ * Function to add an entry to a history stored as a ContiguousStateHistory. If the epoch is equal to that of the last
+ * entry, the last entry is replaced (consistent with the behaviour of the std::map overload of this function).
+ * \param history History to which entry is to be added
+ * \param time Epoch of entry
+ * \param entry Entry that is to be added
+ */
+template< typename TimeType, typename ScalarType, typename EntryType >
+void addEntryToHistory( ContiguousStateHistory< TimeType, ScalarType >& history, const TimeType time,
+                        const EntryType& entry )
+{
+    if( !history.empty( ) && ( history.getLastTime( ) == time ) )
+    {
+        history.pop_back( );
+    }
+    history.push_back( time, entry );
+}
+
+//! Function to remove the last entry that was added to a history stored as a std::map
+/*!
+ * Function to remove the last entry that was added to a history stored as a std::map, i.e. the entry with the latest
+ * epoch for a forward propagation, and the entry with the earliest epoch for a backward propagation.
+ * \param history History from which entry is to be removed
+ * \param isTimeIncreasing Boolean denoting whether the history was generated with increasing time.
+ */
+template< typename TimeType, typename StateType >
+void removeLastAddedEntryFromHistory( std::map< TimeType, StateType >& history, const bool isTimeIncreasing )
+{
+    if( isTimeIncreasing )
+    {
+        history.erase( std::prev( history.end( ) ) );
+    }
+    else
+    {
+        history.erase( history.begin( ) );
+    }
+}
+
+//! Function to remove the last entry that was added to a history stored as a ContiguousStateHistory
+/*!
+ * Function to remove the last entry that was added to a history stored as a ContiguousStateHistory
+ * \param history History from which entry is to be removed
+ * \param isTimeIncreasing Boolean denoting whether the history was generated with increasing time (unused).
+ */
+template< typename TimeType, typename ScalarType >
+void removeLastAddedEntryFromHistory( ContiguousStateHistory< TimeType, ScalarType >& history,
+                                      const bool isTimeIncreasing )
+{
+    history.pop_back( );
+}
+
+//! Function to retrieve the epoch of the last entry that was added to a history stored as a std::map
+/*!
+ * Function to retrieve the epoch of the last entry that was added to a history stored as a std::map
+ * \param history History from which epoch is to be retrieved
+ * \param isTimeIncreasing Boolean denoting whether the history was generated with increasing time.
+ * \return Epoch of the last entry that was added
+ */
+template< typename TimeType, typename StateType >
+TimeType getLastAddedTimeOfHistory( const std::map< TimeType, StateType >& history, const bool isTimeIncreasing )
+{
+    return isTimeIncreasing ? history.rbegin( )->first : history.begin( )->first;
+}
+
+//! Function to retrieve the epoch of the last entry that was added to a history stored as a ContiguousStateHistory
+/*!
+ * Function to retrieve the epoch of the last entry that was added to a history stored as a ContiguousStateHistory
+ * \param history History from which epoch is to be retrieved
+ * \param isTimeIncreasing Boolean denoting whether the history was generated with increasing time (unused).
+ * \return Epoch of the last entry that was added
+ */
+template< typename TimeType, typename ScalarType >
+TimeType getLastAddedTimeOfHistory( const ContiguousStateHistory< TimeType, ScalarType >& history,
+                                    const bool isTimeIncreasing )
+{
+    return history.getLastTime( );
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_CONTIGUOUSSTATEHISTORY_H
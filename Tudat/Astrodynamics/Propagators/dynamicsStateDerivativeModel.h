@@ -25,8 +25,10 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/contiguousStateHistory.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
 #include "Tudat/Astrodynamics/Propagators/rotationalMotionStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/variationalEquations.h"
 
@@ -65,7 +67,7 @@ public:
             stateDerivativeModels,
             const boost::function< void(
                 const TimeType, const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-                const std::vector< IntegratedStateType > ) > environmentUpdateFunction,
+                const std::vector< IntegratedStateType >& ) > environmentUpdateFunction,
             const boost::shared_ptr< VariationalEquations > variationalEquations =
             boost::shared_ptr< VariationalEquations >( ) ):
         environmentUpdateFunction_( environmentUpdateFunction ), variationalEquations_( variationalEquations ),
@@ -119,8 +121,16 @@ public:
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
                         stateTypeSize_.at( stateDerivativeModels.at( i )->getIntegratedStateType( )  ), 1 );
         }
+
+        createEvaluationPlan( stateDerivativeModels );
     }
 
+    //! Copy constructor (deleted, as the evaluation plan refers to member variables of this object)
+    DynamicsStateDerivativeModel( const DynamicsStateDerivativeModel& ) = delete;
+
+    //! Assignment operator (deleted, as the evaluation plan refers to member variables of this object)
+    DynamicsStateDerivativeModel& operator=( const DynamicsStateDerivativeModel& ) = delete;
+
 
     //! Function to calculate the system state derivative
     /*!
@@ -135,7 +145,21 @@ public:
      */
     StateType computeStateDerivative( const TimeType time, const StateType& state )
     {
-        //std::cout << "Computing state derivative: " << state.transpose( ) << std::endl;
+        return evaluateStateDerivative( time, state );
+    }
+
+    //! Function to calculate the system state derivative, without copying the result
+    /*!
+     *  Function to calculate the system state derivative, identical to computeStateDerivative, but returning a reference
+     *  to the member variable in which the state derivative is stored (which is overwritten by the next call). The
+     *  dynamical equations are evaluated using the evaluation plan created in the constructor, so that no memory is
+     *  allocated by this object once the state derivative has been computed for a state of the current size.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \return Calculated state derivative.
+     */
+    const StateType& evaluateStateDerivative( const TimeType time, const StateType& state )
+    {
         // Initialize state derivative
         if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
         {
@@ -145,16 +169,10 @@ public:
         // If dynamical equations are integrated, update the environment with the current state.
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            // Clear all state derivative models
+            for( unsigned int i = 0; i < evaluationPlan_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
-                }
+                evaluationPlan_[ i ].stateDerivativeModel->clearStateDerivativeModel( );
             }
 
             convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
@@ -163,10 +181,7 @@ public:
         }
         else
         {
-            environmentUpdateFunction_(
-                        time, std::unordered_map<
-                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
-                        integratedStatesFromEnvironment_ );
+            environmentUpdateFunction_( time, emptyStatesPerType_, integratedStatesFromEnvironment_ );
         }
 
         if( evaluateVariationalEquations_ )
@@ -175,37 +190,25 @@ public:
         }
 
         // If dynamical equations are integrated, evaluate dynamics state derivatives.
-        std::pair< int, int > currentIndices;
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            // Update state derivative models
+            for( unsigned int i = 0; i < evaluationPlan_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Update state derivative models
-                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
-                }
+                ScopedProfilingTimer modelTimer( propagationProfiler_.get( ), evaluationPlan_[ i ].profilingIndex );
+                evaluationPlan_[ i ].stateDerivativeModel->updateStateDerivativeModel( time );
             }
 
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-
+            // Evaluate and set current dynamical state derivative (current state segments were set by
+            // convertCurrentStateToGlobalRepresentationPerType)
+            for( unsigned int i = 0; i < evaluationPlan_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Evaluate and set current dynamical state derivative
-                    currentIndices = stateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
-
-                }
+                StateDerivativeEvaluationStep& currentStep = evaluationPlan_[ i ];
+                ScopedProfilingTimer modelTimer( propagationProfiler_.get( ), currentStep.profilingIndex, false );
+                currentStep.stateDerivativeModel->calculateSystemStateDerivative(
+                            time, currentStep.currentStateSegment,
+                            stateDerivative_.block( currentStep.startIndex, dynamicsStartColumn_,
+                                                    currentStep.stateSize, 1 ) );
             }
         }
 
@@ -215,6 +218,8 @@ public:
         {
             variationalEquations_->updatePartials( time );
 
+            ScopedProfilingTimer variationalEquationsTimer(
+                        propagationProfiler_.get( ), variationalEquationsProfilingIndex_ );
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
                         time, state.block( 0, 0, totalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ),
                         stateDerivative_.block( 0, 0, totalStateSize_, variationalEquations_->getNumberOfParameterValues( ) )  );
@@ -340,6 +345,31 @@ public:
         }
     }
 
+    //! Function to convert a contiguous state history from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a contiguous state history from propagator-specific form to the conventional form
+     * (not necessarily in inertial frame).
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            ContiguousStateHistory< TimeType, StateScalarType >& convertedSolution,
+            const ContiguousStateHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        convertedSolution.reserve( rawSolution.size( ) );
+
+        // Iterate over all times (in order in which they were propagated).
+        for( int i = 0; i < rawSolution.size( ); i++ )
+        {
+            convertedSolution.push_back(
+                        rawSolution.getTimeAtIndex( i ),
+                        convertToOutputSolution( rawSolution.getEntryAtIndex( i ), rawSolution.getTimeAtIndex( i ) ) );
+        }
+    }
+
     //! Function to add variational equations to the state derivative model
     /*!
      * Function to add variational equations to the state derivative model.
@@ -348,6 +378,55 @@ public:
     void addVariationalEquations( boost::shared_ptr< VariationalEquations > variationalEquations )
     {
         variationalEquations_ = variationalEquations;
+        if( propagationProfiler_ != NULL )
+        {
+            setPropagationProfiler( propagationProfiler_ );
+        }
+    }
+
+    //! Function to set the profiler to which the computation times of the propagation models are to be added.
+    /*!
+     * Function to set the profiler to which the computation times of the propagation models are to be added. The
+     * profiler is passed on to the state derivative models and variational equations. In addition, the total time
+     * spent in each state derivative model, and in the evaluation of the variational equations from the partials, is
+     * profiled. Note that the environment updater is not accessible from this object, so that the profiler needs to
+     * be provided to it separately.
+     * \param propagationProfiler Profiler to which computation times are to be added (NULL if no profiling is to be
+     * performed).
+     */
+    void setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+
+        for( unsigned int i = 0; i < evaluationPlan_.size( ); i++ )
+        {
+            evaluationPlan_[ i ].stateDerivativeModel->setPropagationProfiler( propagationProfiler_ );
+            evaluationPlan_[ i ].profilingIndex = ( propagationProfiler_ == NULL ) ? 0 :
+                    propagationProfiler_->registerEntry(
+                        state_derivative_model_profiling,
+                        getIntegratedStateTypeName( evaluationPlan_[ i ].stateDerivativeModel->getIntegratedStateType( ) ) );
+        }
+
+        variationalEquationsProfilingIndex_ = 0;
+        if( variationalEquations_ != NULL )
+        {
+            variationalEquations_->setPropagationProfiler( propagationProfiler_ );
+            if( propagationProfiler_ != NULL )
+            {
+                variationalEquationsProfilingIndex_ = propagationProfiler_->registerEntry(
+                            variational_equations_profiling, "state transition and sensitivity matrix derivative" );
+            }
+        }
+    }
+
+    //! Function to retrieve the profiler to which the computation times of the propagation models are added.
+    /*!
+     * Function to retrieve the profiler to which the computation times of the propagation models are added.
+     * \return Profiler to which the computation times of the propagation models are added (NULL if not profiled).
+     */
+    boost::shared_ptr< PropagationProfiler > getPropagationProfiler( )
+    {
+        return propagationProfiler_;
     }
 
 
@@ -500,35 +579,88 @@ private:
             startColumn = 0;
         }
 
-        std::pair< int, int > currentIndices;
-
         // Iterate over all state derivative models
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < evaluationPlan_.size( ); i++ )
         {
-            int currentStateTypeSize = 0;
+            StateDerivativeEvaluationStep& currentStep = evaluationPlan_[ i ];
 
-            // Iterate over all state derivative models of current type
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-            {
-                // Get state block indices of current state derivative model
-                currentIndices = stateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                // Set current block in split state (in global form)
-                stateDerivativeModelsIterator_->second.at( i )->convertCurrentStateToGlobalRepresentation(
-                            state.block( currentIndices.first, startColumn, currentIndices.second, 1 ), time,
-                            currentStatesPerTypeInConventionalRepresentation_.at(
-                                stateDerivativeModelsIterator_->first ).block(
-                                currentStateTypeSize, 0, currentIndices.second, 1 ) );
-            }
+            // Copy state block of current state derivative model into preallocated vector
+            currentStep.currentStateSegment = state.block( currentStep.startIndex, startColumn, currentStep.stateSize, 1 );
+
+            // Set current block in split state (in global form)
+            currentStep.stateDerivativeModel->convertCurrentStateToGlobalRepresentation(
+                        currentStep.currentStateSegment, time,
+                        currentStep.conventionalStateOfType->block(
+                            currentStep.startIndexInStateType, 0, currentStep.stateSize, 1 ) );
         }
     }
 
+    //! Function to create the list of operations to perform when evaluating the dynamical equations.
+    /*!
+     * Function to create the list of operations to perform when evaluating the dynamical equations (evaluationPlan_),
+     * in the order in which the state derivative models are provided. Called once from the constructor.
+     * \param stateDerivativeModels Vector of state derivative models, as provided to the constructor.
+     */
+    void createEvaluationPlan(
+            const std::vector< boost::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > >&
+            stateDerivativeModels )
+    {
+        evaluationPlan_.clear( );
+        evaluationPlan_.reserve( stateDerivativeModels.size( ) );
+
+        std::map< IntegratedStateType, int > currentModelIndexPerStateType;
+        std::map< IntegratedStateType, int > currentSizePerStateType;
+        for( unsigned int i = 0; i < stateDerivativeModels.size( ); i++ )
+        {
+            IntegratedStateType currentStateType = stateDerivativeModels.at( i )->getIntegratedStateType( );
+            std::pair< int, int > currentIndices = stateIndices_.at( currentStateType ).at(
+                        currentModelIndexPerStateType[ currentStateType ]++ );
+
+            StateDerivativeEvaluationStep currentStep;
+            currentStep.stateDerivativeModel = stateDerivativeModels.at( i );
+            currentStep.startIndex = currentIndices.first;
+            currentStep.stateSize = currentIndices.second;
+            currentStep.startIndexInStateType = currentSizePerStateType[ currentStateType ];
+            currentStep.conventionalStateOfType =
+                    &currentStatesPerTypeInConventionalRepresentation_.at( currentStateType );
+            currentStep.currentStateSegment = Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
+                        currentStep.stateSize );
+            currentStep.profilingIndex = 0;
+            evaluationPlan_.push_back( currentStep );
+
+            currentSizePerStateType[ currentStateType ] += currentStep.stateSize;
+        }
+    }
+
+    //! Single operation in the evaluation of the dynamical equations
+    struct StateDerivativeEvaluationStep
+    {
+        //! State derivative model that is evaluated.
+        boost::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > stateDerivativeModel;
+
+        //! Start index of state of model in full state vector
+        int startIndex;
+
+        //! Size of state of model
+        int stateSize;
+
+        //! Start index of state of model in (conventional) state vector of all models of the same type.
+        int startIndexInStateType;
+
+        //! Conventional state of all models of the same type (entry of currentStatesPerTypeInConventionalRepresentation_)
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >* conventionalStateOfType;
+
+        //! Preallocated vector in which current (propagator-specific) state of model is stored.
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentStateSegment;
+
+        //! Index of profiling entry of model (zero if not profiled).
+        unsigned int profilingIndex;
+    };
+
     boost::function<
     void( const TimeType, const std::unordered_map< IntegratedStateType,
           Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-          const std::vector< IntegratedStateType > ) > environmentUpdateFunction_;
+          const std::vector< IntegratedStateType >& ) > environmentUpdateFunction_;
 
     //! Object used for computing the state derivative in the variational equations
     boost::shared_ptr< VariationalEquations > variationalEquations_;
@@ -576,8 +708,26 @@ private:
     std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
     currentStatesPerTypeInConventionalRepresentation_;
 
+    //! Empty list of states, passed to environment update function if dynamical equations are not evaluated.
+    const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+    emptyStatesPerType_;
+
+    //! List of operations to perform when evaluating the dynamical equations, in order of evaluation
+    /*!
+     * List of operations to perform when evaluating the dynamical equations, in order of evaluation. Created once in
+     * the constructor, so that no map lookups or memory allocations are required during the computation of the state
+     * derivative.
+     */
+    std::vector< StateDerivativeEvaluationStep > evaluationPlan_;
+
     //! Variable to keep track of the number of calls to the computeStateDerivative function
     int functionEvaluationCounter_ = 0;
+
+    //! Profiler to which the computation times of the propagation models are added (NULL if not profiled).
+    boost::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Index of profiling entry of evaluation of variational equations (zero if not profiled).
+    unsigned int variationalEquationsProfilingIndex_ = 0;
 };
 
 //! Function to retrieve a single given acceleration model from a list of models
@@ -47,6 +47,14 @@ void addEnvironmentUpdates(
         const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >
         updatesToAdd );
 
+//! Function to get a string representing an environment model update type
+/*!
+ * Function to get a string representing an environment model update type
+ * \param updateType Type of environment model update.
+ * \return String representing the environment model update type.
+ */
+std::string getEnvironmentModelUpdateName( const EnvironmentModelsToUpdate updateType );
+
 } // namespace propagators
 
 } // namespace tudat
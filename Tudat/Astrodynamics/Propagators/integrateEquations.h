@@ -13,6 +13,7 @@
 
 #include <Eigen/Core>
 #include <boost/lambda/lambda.hpp>
+#include <algorithm>
 #include <chrono>
 #include <limits>
 
@@ -22,6 +23,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Astrodynamics/Propagators/contiguousStateHistory.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -66,13 +68,190 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
     return dependentVariableError;
 }
 
+//! Function to determine, for a given time step, the error in termination dependent variable from the dense output
+/*!
+ *  Function to determine, for a given time step from the start of the last integration step, the error in termination
+ *  dependent variable, using the dense output of the integrator to obtain the state (instead of performing an
+ *  integration step). This function is used as input for the root finder when the propagation must terminate exactly
+ *  on a dependent variable value, and requires only a single state derivative evaluation (to update the environment).
+ *  \param timeStep Time step w.r.t. start of last integration step at which the dependent variable is to be evaluated
+ *  \param integrator Numerical integrator used for propagation (dense output must be available for the last step)
+ *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which
+ *  propagation is to terminate
+ *  \param stepStartTime Time at the start of the last integration step
+ *  \return The difference between the reached and required value of the termination dependent variable
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+TimeStepType getTerminationDependentVariableErrorForGivenTimeStepFromDenseOutput(
+        TimeStepType timeStep,
+        const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const boost::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition,
+        const TimeType stepStartTime )
+{
+    // Retrieve value of dependent variable at interpolated state
+    const TimeType currentTime = stepStartTime + timeStep;
+    integrator->getStateDerivativeFunction( )( currentTime, integrator->getDenseOutputState( currentTime ) );
+    return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+}
+
+//! Function to determine, for a given time step, the switching function of a propagation event at an interpolated state
+/*!
+ *  Function to determine, for a given time step from the start of the last integration step, the value of the switching
+ *  function of a propagation event, using an interpolated state. The environment is updated to the interpolated state
+ *  (by evaluating the state derivative) before evaluating the switching function. This function is used as input for the
+ *  root finder when locating an event inside the last integration step.
+ *  \param timeStep Time step w.r.t. start of last integration step at which the switching function is to be evaluated
+ *  \param stateInterpolant Function returning the interpolated state in the last integration step, as a function of time
+ *  \param stateDerivativeFunction Function returning the state derivative (and updating the environment)
+ *  \param eventDetector Object used to detect propagation events
+ *  \param eventIndex Index of the event type for which the switching function is to be evaluated
+ *  \param stepStartTime Time at the start of the last integration step
+ *  \return Value of the switching function at the requested time
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+TimeStepType getPropagationEventSwitchingFunctionForGivenTimeStep(
+        TimeStepType timeStep,
+        const boost::function< StateType( const TimeType ) > stateInterpolant,
+        const boost::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
+        const boost::shared_ptr< PropagationEventDetector > eventDetector,
+        const unsigned int eventIndex,
+        const TimeType stepStartTime )
+{
+    // Update environment to interpolated state
+    const TimeType currentTime = stepStartTime + timeStep;
+    stateDerivativeFunction( currentTime, stateInterpolant( currentTime ) );
+
+    return static_cast< TimeStepType >( eventDetector->computeSwitchingFunction( eventIndex ) );
+}
+
+//! Function to detect, locate and log the propagation events that occurred during the last integration step
+/*!
+ *  Function to detect, locate and log the propagation events that occurred during the last integration step (from the
+ *  given step start time/state to the current time/state of the integrator). The switching functions are evaluated at the
+ *  end of the step, after the environment is updated by the state derivative evaluation at the end of the step (which
+ *  the integrator reuses for its dense output and next step, if possible), and compared to their values at the start of
+ *  the step. For each bracketed sign change, the event time is found by a root finder, using a cubic Hermite
+ *  interpolation of the state in the step (so that no re-integration is required). The accuracy of the event time and
+ *  state is therefore limited by that of the (fourth-order) interpolation, which may require a maximum step size to be
+ *  imposed for high-order integrators. The events are added to the event log in chronological order, and the
+ *  propagation itself is not modified. If the root finder does not converge for an event, the event is logged at the
+ *  end of the step, and its number is stored in the list of unconverged events of the event log.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param eventDetector Object used to detect propagation events
+ *  \param stepStartTime Time at the start of the last integration step (updated to the end of the step; returned by
+ *  reference)
+ *  \param stepStartState State at the start of the last integration step (updated to the end of the step; returned by
+ *  reference)
+ *  \param stepStartStateDerivative State derivative at the start of the last integration step (updated to the end of the
+ *  step; returned by reference)
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+void detectPropagationEventsInLastStep(
+        const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const boost::shared_ptr< PropagationEventDetector > eventDetector,
+        TimeType& stepStartTime,
+        StateType& stepStartState,
+        StateType& stepStartStateDerivative )
+{
+    typedef Eigen::Matrix< typename StateType::Scalar, Eigen::Dynamic, 1 > StateVectorType;
+
+    // Update environment to state at end of step, and find sign changes of switching functions.
+    const TimeType stepEndTime = integrator->getCurrentIndependentVariable( );
+    const StateType stepEndState = integrator->getCurrentState( );
+    const StateType stepEndStateDerivative = integrator->computeCurrentStateDerivative( );
+    const std::vector< unsigned int > bracketedEventIndices = eventDetector->updateSwitchingFunctionValues( );
+
+    if( bracketedEventIndices.size( ) > 0 )
+    {
+        // Create interpolant of state in last step
+        const TimeStepType stepSize = static_cast< TimeStepType >( stepEndTime - stepStartTime );
+        boost::function< StateType( const TimeType ) > stateInterpolant = boost::bind(
+                    &numerical_integrators::computeCubicHermiteDenseOutputState<
+                    TimeType, StateType, StateType, TimeStepType >,
+                    stepStartTime, stepStartState, stepStartStateDerivative,
+                    stepEndTime, stepEndState, stepEndStateDerivative, _1 );
+
+        // Locate each of the events in the step
+        std::vector< std::pair< TimeStepType, unsigned int > > eventTimeSteps;
+        std::vector< unsigned int > unconvergedEventIndices;
+        for( unsigned int i = 0; i < bracketedEventIndices.size( ); i++ )
+        {
+            const unsigned int eventIndex = bracketedEventIndices.at( i );
+            boost::function< TimeStepType( TimeStepType ) > switchingFunction = boost::bind(
+                        &getPropagationEventSwitchingFunctionForGivenTimeStep< StateType, TimeType, TimeStepType >,
+                        _1, stateInterpolant, integrator->getStateDerivativeFunction( ), eventDetector, eventIndex,
+                        stepStartTime );
+
+            boost::shared_ptr< root_finders::RootFinderCore< TimeStepType > > eventRootFinder;
+            if( stepSize > 0 )
+            {
+                eventRootFinder = root_finders::createRootFinder< TimeStepType >(
+                            eventDetector->getRootFinderSettings( eventIndex ),
+                            static_cast< TimeStepType >( std::numeric_limits< double >::min( ) ), stepSize,
+                            stepSize / 2.0 );
+            }
+            else
+            {
+                eventRootFinder = root_finders::createRootFinder< TimeStepType >(
+                            eventDetector->getRootFinderSettings( eventIndex ),
+                            stepSize, static_cast< TimeStepType >( -std::numeric_limits< double >::min( ) ),
+                            stepSize / 2.0 );
+            }
+
+            TimeStepType eventTimeStep;
+            try
+            {
+                eventTimeStep = eventRootFinder->execute(
+                            boost::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
+                                switchingFunction ), stepSize / 2.0 );
+            }
+            // If root finder did not converge, set event at end of step
+            catch( const std::runtime_error& )
+            {
+                eventTimeStep = stepSize;
+                unconvergedEventIndices.push_back( eventIndex );
+            }
+            eventTimeSteps.push_back( std::make_pair( eventTimeStep, eventIndex ) );
+        }
+
+        // Add events to log in chronological order
+        std::sort( eventTimeSteps.begin( ), eventTimeSteps.end( ) );
+        if( stepSize < 0 )
+        {
+            std::reverse( eventTimeSteps.begin( ), eventTimeSteps.end( ) );
+        }
+        for( unsigned int i = 0; i < eventTimeSteps.size( ); i++ )
+        {
+            const TimeType eventTime = stepStartTime + eventTimeSteps.at( i ).first;
+            const StateType eventState = stateInterpolant( eventTime );
+            const unsigned int eventIndex = eventTimeSteps.at( i ).second;
+            eventDetector->getEventLog( )->addEvent(
+                        eventIndex, static_cast< double >( eventTime ), eventDetector->getLastEventDirection( eventIndex ),
+                        Eigen::Map< const StateVectorType >( eventState.data( ), eventState.size( ) ).
+                        template cast< double >( ),
+                        std::find( unconvergedEventIndices.begin( ), unconvergedEventIndices.end( ), eventIndex ) ==
+                        unconvergedEventIndices.end( ) );
+        }
+    }
+
+    // Set start of next step
+    stepStartTime = stepEndTime;
+    stepStartState = stepEndState;
+    stepStartStateDerivative = stepEndStateDerivative;
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition.
  * Determines the time step that is to be taken by using a root finder, and returns (by reference) the converged final time
- * and state.
+ * and state. If the dense output of the integrator is used (only if requested in the termination settings), the root
+ * finder evaluates the dependent variable at interpolated states, after which a single integration step is taken to the
+ * converged final time. The error in the final condition is then limited by the accuracy of the dense output.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
- * back to the secondToLastTime/secondToLastState
+ * back to the secondToLastTime/secondToLastState (if useDenseOutput is false), or at the lastTime/lastState with dense
+ * output available for the step from secondToLastTime (if useDenseOutput is true)
  * \param dependentVariableTerminationCondition Termination condition that is to be used
  * \param secondToLastTime Second to last time (e.g. last time at which integration did not exceed termination condition)
  * \param lastTime Time at which integration first exceeded termination condition
@@ -80,6 +259,7 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
  * \param lastState State at time where integration first exceeded termination condition
  * \param endTime Time at which exact termination condition is met (returned by reference).
  * \param endState State at time where exact termination condition is met (returned by reference).
+ * \param useDenseOutput Boolean denoting whether the dense output of the integrator is to be used by the root finder
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
 void getFinalStateForExactDependentVariableTerminationCondition(
@@ -91,13 +271,24 @@ void getFinalStateForExactDependentVariableTerminationCondition(
         const StateType& secondToLastState,
         const StateType& lastState,
         TimeType& endTime,
-        StateType& endState )
+        StateType& endState,
+        const bool useDenseOutput = false )
 {
 
     // Function for which the root (zero value) occurs at the required end time/state
-    boost::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction =
-            boost::bind( &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >, _1,
-                         integrator, dependentVariableTerminationCondition );
+    boost::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction;
+    if( useDenseOutput )
+    {
+        dependentVariableErrorFunction = boost::bind(
+                    &getTerminationDependentVariableErrorForGivenTimeStepFromDenseOutput< StateType, TimeType, TimeStepType >,
+                    _1, integrator, dependentVariableTerminationCondition, secondToLastTime );
+    }
+    else
+    {
+        dependentVariableErrorFunction = boost::bind(
+                    &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >, _1,
+                    integrator, dependentVariableTerminationCondition );
+    }
 
     // Create root finder.
     double timeStepSign = ( static_cast< double >( lastTime - secondToLastTime ) > 0.0 ) ? 1.0 : -1.0;
@@ -128,6 +319,11 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                     boost::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
                         dependentVariableErrorFunction ), ( lastTime - secondToLastTime ) / 2.0 );
 
+        // Take single step to converged final time
+        if( useDenseOutput )
+        {
+            integrator->rollbackToPreviousState( );
+        }
         endState = integrator->performIntegrationStep( finalTimeStep );
         endTime = integrator->getCurrentIndependentVariable( );
     }
@@ -296,13 +492,22 @@ void getFinalStateForExactTerminationCondition(
 
     case dependent_variable_stopping_condition:
     {
-        integrator->rollbackToPreviousState( );
-
         boost::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition =
                 boost::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >( terminationCondition );
+
+        // Use dense output of integrator to find final time, if requested and available for the step that is to be refined.
+        const bool useDenseOutput = dependentVariableTerminationCondition->getUseDenseOutputToFindFinalCondition( ) &&
+                integrator->isDenseOutputAvailable( ) &&
+                ( integrator->getPreviousIndependentVariable( ) == secondToLastTime ) &&
+                ( integrator->getCurrentIndependentVariable( ) == lastTime );
+        if( !useDenseOutput )
+        {
+            integrator->rollbackToPreviousState( );
+        }
+
         getFinalStateForExactDependentVariableTerminationCondition(
                     integrator, dependentVariableTerminationCondition, secondToLastTime, lastTime,
-                    secondToLastState, lastState, endTime, endState );
+                    secondToLastState, lastState, endTime, endState, useDenseOutput );
 
         break;
     }
@@ -330,20 +535,22 @@ void getFinalStateForExactTerminationCondition(
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ * \param solutionHistory History of state variables that are to be saved given as map or ContiguousStateHistory
  * (time as key; returned by reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved given as map or
+ * ContiguousStateHistory (time as key; returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename SolutionHistoryType = std::map< TimeType, StateType >,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd > >
 void propagateToExactTerminationCondition(
         const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const boost::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const boost::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        SolutionHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step sie control
@@ -364,37 +571,23 @@ void propagateToExactTerminationCondition(
     bool recomputeDependentVariables = false;
     if( dependentVariableHistory.size( ) > 0 )
     {
-        if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+        if( getLastAddedTimeOfHistory( dependentVariableHistory, timeStep > 0 ) ==
+                getLastAddedTimeOfHistory( solutionHistory, timeStep > 0 ) )
         {
-            if( timeStep > 0 )
-            {
-                dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-            }
-            else
-            {
-                dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-            }
+            removeLastAddedEntryFromHistory( dependentVariableHistory, timeStep > 0 );
             recomputeDependentVariables = true;
         }
     }
 
     // Remove state entry last added, and enter converged final state
-    if( timeStep > 0 )
-    {
-        solutionHistory.erase( std::prev( solutionHistory.end() ) );
-        solutionHistory[ endTime ] = endState;
-    }
-    else
-    {
-        solutionHistory.erase( solutionHistory.begin( ) );
-        solutionHistory[ endTime ] = endState;
-    }
+    removeLastAddedEntryFromHistory( solutionHistory, timeStep > 0 );
+    addEntryToHistory( solutionHistory, endTime, endState );
 
     // Recompute final dependent variables, if required
     if( recomputeDependentVariables )
     {
         integrator->getStateDerivativeFunction( )( endTime, endState );
-        dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+        addEntryToHistory( dependentVariableHistory, endTime, Eigen::VectorXd( dependentVariableFunction( ) ) );
 
         // Check stopping conditions to be able to save details
         propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -410,12 +603,12 @@ void propagateToExactTerminationCondition(
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
- *  \param solutionHistory History of state variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  \param solutionHistory History of state variables that are to be saved given as map or ContiguousStateHistory
  *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map or
+ *  ContiguousStateHistory (time as key; returned by reference)
  *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
- *  as map (time as key; returned by reference)
+ *  as map or ContiguousStateHistory (time as key; returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
  *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
@@ -425,14 +618,17 @@ void propagateToExactTerminationCondition(
  *  By default now(), i.e. the moment at which this function is called.
  *  \return Event that triggered the termination of the propagation
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename SolutionHistoryType = std::map< TimeType, StateType >,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd >,
+          typename ComputationTimeHistoryType = std::map< TimeType, double > >
 boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
         const boost::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const boost::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        std::map< TimeType, double >& cummulativeComputationTimeHistory,
+        SolutionHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
+        ComputationTimeHistoryType& cummulativeComputationTimeHistory,
         const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
         boost::function< Eigen::VectorXd( ) >( ),
         const int saveFrequency = TUDAT_NAN,
@@ -448,20 +644,32 @@ boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegra
 
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    addEntryToHistory( solutionHistory, currentTime, newState );
 
     dependentVariableHistory.clear( );
     if( !dependentVariableFunction.empty( ) )
     {
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        addEntryToHistory( dependentVariableHistory, currentTime, Eigen::VectorXd( dependentVariableFunction( ) ) );
+    }
+
+    // Initialize detection of propagation events
+    boost::shared_ptr< PropagationEventDetector > eventDetector = propagationTerminationCondition->getEventDetector( );
+    TimeType eventStepStartTime = currentTime;
+    StateType eventStepStartState, eventStepStartStateDerivative;
+    if( eventDetector != NULL )
+    {
+        eventDetector->getEventLog( )->clear( );
+        eventStepStartState = newState;
+        eventStepStartStateDerivative = integrator->computeCurrentStateDerivative( );
+        eventDetector->resetSwitchingFunctionValues( );
     }
 
     // CPU time
     cummulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count() * 1.0e-9;
-    cummulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    addEntryToHistory( cummulativeComputationTimeHistory, currentTime, currentCPUTime );
 
 
     // Set initial time step and total integration time.
@@ -508,12 +716,13 @@ boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegra
                 saveIndex = saveIndex % saveFrequency;
                 if( saveIndex == 0 )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    addEntryToHistory( solutionHistory, currentTime, newState );
 
                     if( !dependentVariableFunction.empty( ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        addEntryToHistory( dependentVariableHistory, currentTime,
+                                           Eigen::VectorXd( dependentVariableFunction( ) ) );
                     }
                 }
             }
@@ -529,7 +738,7 @@ boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegra
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count() * 1.0e-9;
-            cummulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            addEntryToHistory( cummulativeComputationTimeHistory, currentTime, currentCPUTime );
 
 
             // Print solutions
@@ -577,6 +786,14 @@ boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegra
                 breakPropagation = true;
             }
 
+            // Detect and log propagation events in last step (after exact termination, if applicable)
+            if( ( eventDetector != NULL ) && ( integrator->getCurrentIndependentVariable( ) != eventStepStartTime ) )
+            {
+                detectPropagationEventsInLastStep(
+                            integrator, eventDetector, eventStepStartTime, eventStepStartState,
+                            eventStepStartStateDerivative );
+            }
+
         }
         catch( const std::exception &caughtException )
         {
@@ -590,6 +807,13 @@ boost::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegra
     }
     while( !breakPropagation );
 
+    // Report propagation events that could not be located exactly
+    if( eventDetector != NULL )
+    {
+        propagationTerminationReason->setUnconvergedPropagationEventNumbers(
+                    eventDetector->getEventLog( )->getUnconvergedEventNumbers( ) );
+    }
+
     return propagationTerminationReason;
 }
 
@@ -611,14 +835,15 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map or ContiguousStateHistory (time as key; returned
+     *  by reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map or
+     *  ContiguousStateHistory (time as key; returned by reference)
      *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
-     *  as map (time as key; returned by reference)
+     *  as map or ContiguousStateHistory (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
      *  derivative model).
      *  \param printInterval Frequency with which to print progress to console (nan = never).
@@ -626,14 +851,16 @@ public:
      *  By default now(), i.e. the moment at which this function is called.
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType, typename DependentVariableHistoryType,
+              typename ComputationTimeHistoryType >
     static boost::shared_ptr< PropagationTerminationDetails > integrateEquations(
             boost::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
-            std::map< TimeType, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const boost::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-            std::map< TimeType, double >& cummulativeComputationTimeHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& cummulativeComputationTimeHistory,
             const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
             boost::function< Eigen::VectorXd( ) >( ),
             const TimeType printInterval = TUDAT_NAN,
@@ -651,14 +878,15 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map or ContiguousStateHistory (time as key; returned
+     *  by reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map or
+     *  ContiguousStateHistory (time as key; returned by reference)
      *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
-     *  as map (time as key; returned by reference)
+     *  as map or ContiguousStateHistory (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
      *  derivative model).
      *  \param printInterval Frequency with which to print progress to console (nan = never).
@@ -666,14 +894,16 @@ public:
      *  By default now(), i.e. the moment at which this function is called.
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType, typename DependentVariableHistoryType,
+              typename ComputationTimeHistoryType >
     static boost::shared_ptr< PropagationTerminationDetails > integrateEquations(
             boost::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
-            std::map< double, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
             const boost::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< double, Eigen::VectorXd >& dependentVariableHistory,
-            std::map< double, double >& cummulativeComputationTimeHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& cummulativeComputationTimeHistory,
             const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
             boost::function< Eigen::VectorXd( ) >( ),
             const double printInterval = TUDAT_NAN,
@@ -714,14 +944,15 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map or ContiguousStateHistory (time as key; returned
+     *  by reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map or
+     *  ContiguousStateHistory (time as key; returned by reference)
      *  \param cummulativeComputationTimeHistory History of cummulative computation times that are to be saved given
-     *  as map (time as key; returned by reference)
+     *  as map or ContiguousStateHistory (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
      *  derivative model).
      *  \param printInterval Frequency with which to print progress to console (nan = never).
@@ -729,14 +960,16 @@ public:
      *  By default now(), i.e. the moment at which this function is called.
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType, typename DependentVariableHistoryType,
+              typename ComputationTimeHistoryType >
     static boost::shared_ptr< PropagationTerminationDetails > integrateEquations(
             boost::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
-            std::map< Time, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
             const boost::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< Time, Eigen::VectorXd >& dependentVariableHistory,
-            std::map< Time, double >& cummulativeComputationTimeHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& cummulativeComputationTimeHistory,
             const boost::function< Eigen::VectorXd( ) > dependentVariableFunction =
             boost::function< Eigen::VectorXd( ) >( ),
             const Time printInterval = TUDAT_NAN,
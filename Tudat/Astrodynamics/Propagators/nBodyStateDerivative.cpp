@@ -17,6 +17,22 @@ namespace propagators
 {
 
 
+//! Function to get the name with which an acceleration model is identified when profiling the propagation.
+std::string getProfiledAccelerationModelName(
+        const boost::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel )
+{
+    basic_astrodynamics::AvailableAcceleration accelerationType =
+            basic_astrodynamics::getAccelerationModelType( accelerationModel );
+    if( accelerationType == basic_astrodynamics::undefined_acceleration )
+    {
+        return "custom acceleration";
+    }
+    else
+    {
+        return basic_astrodynamics::getAccelerationModelName( accelerationType );
+    }
+}
+
 //! Function to remove the central gravity acceleration from an AccelerationMap
 std::vector< boost::function< double( ) > > removeCentralGravityAccelerations(
         const std::vector< std::string >& centralBodies, const std::vector< std::string >& bodiesToIntegrate,
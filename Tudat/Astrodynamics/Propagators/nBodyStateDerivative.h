@@ -74,6 +74,16 @@ std::vector< std::string > determineEphemerisUpdateorder( std::vector< std::stri
                                                           std::vector< std::string > centralBodies,
                                                           std::vector< std::string > ephemerisOrigins );
 
+//! Function to get the name with which an acceleration model is identified when profiling the propagation.
+/*!
+ * Function to get the name with which an acceleration model is identified when profiling the propagation, i.e. the name
+ * of the acceleration type, or "custom acceleration" if the type is not recognized.
+ * \param accelerationModel Acceleration model for which the name is to be retrieved.
+ * \return Name of the acceleration model.
+ */
+std::string getProfiledAccelerationModelName(
+        const boost::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel );
+
 //! State derivative for the translational dynamics of N bodies
 /*!
  * This class calculates the trabnslational state derivative of any
@@ -188,10 +198,25 @@ public:
     {
         for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
         {
+            ScopedProfilingTimer accelerationTimer( propagationProfiler_.get( ), accelerationProfilingIndices_[ i ] );
             accelerationModelList_.at( i )->updateMembers( currentTime );
         }
     }
 
+    //! Function to set the profiler to which the computation times of the acceleration models are to be added.
+    /*!
+     * Function to set the profiler to which the computation times of the acceleration models are to be added. The time
+     * spent in updating and retrieving each acceleration is profiled, aggregated per acceleration type for each pair
+     * of bodies undergoing and exerting the acceleration.
+     * \param propagationProfiler Profiler to which computation times are to be added (NULL if no profiling is to be
+     * performed).
+     */
+    void setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+        createAccelerationModelList( );
+    }
+
     //! Function to convert the propagator-specific form of the state to the conventional form in the global frame.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the
@@ -208,7 +233,9 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentCartesianLocalSoluton )
     {
-        this->convertToOutputSolution( internalSolution, time, currentCartesianLocalSoluton );
+        // Copy to member matrix, so that no temporary is allocated when converting to the argument type.
+        internalSolutionMatrix_ = internalSolution;
+        this->convertToOutputSolution( internalSolutionMatrix_, time, currentCartesianLocalSoluton );
 
         centralBodyData_->getReferenceFrameOriginInertialStates(
                     currentCartesianLocalSoluton, time, centralBodyStatesWrtGlobalOrigin_, true );
@@ -330,9 +357,14 @@ protected:
 
     //! Function to set the vector of acceleration models (accelerationModelList_) form the map of map of
     //! acceleration models (accelerationModelsPerBody_).
+    /*!
+     * Function to set the vector of acceleration models (accelerationModelList_) form the map of map of acceleration
+     * models (accelerationModelsPerBody_), and register the acceleration models with the propagation profiler (if any).
+     */
     void createAccelerationModelList( )
     {
         accelerationModelList_.clear( );
+        accelerationProfilingIndices_.clear( );
         // Iterate over all accelerations and update their internal state.
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
              outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
@@ -346,6 +378,11 @@ protected:
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
                     accelerationModelList_.push_back( innerAccelerationIterator->second.at( j ) );
+                    accelerationProfilingIndices_.push_back(
+                                ( propagationProfiler_ == NULL ) ? 0 : propagationProfiler_->registerEntry(
+                                    acceleration_model_profiling,
+                                    getProfiledAccelerationModelName( innerAccelerationIterator->second.at( j ) ),
+                                    outerAccelerationIterator->first, innerAccelerationIterator->first ) );
                 }
             }
         }
@@ -372,6 +409,7 @@ protected:
 
         int currentBodyIndex = 0;
         int currentAccelerationIndex = 0;
+        int currentAccelerationModelIndex = 0;
 
         // Iterate over all bodies with accelerations.
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
@@ -387,6 +425,10 @@ protected:
             {
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
+                    ScopedProfilingTimer accelerationTimer(
+                                propagationProfiler_.get( ),
+                                accelerationProfilingIndices_[ currentAccelerationModelIndex++ ], false );
+
                     //std::cout << "Getting acceleration " << outerAccelerationIterator->first << " " << innerAccelerationIterator->first << std::endl;
                     // Calculate acceleration and add to state derivative.
                     stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) += (
@@ -419,6 +461,12 @@ protected:
     //! Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< boost::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    //! Profiler to which the computation times of the acceleration models are added (NULL if not profiled).
+    boost::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Index of profiling entry for each entry of accelerationModelList_ (all zero if not profiled).
+    std::vector< unsigned int > accelerationProfilingIndices_;
+
     //! Object responsible for providing the current integration origins from the global origins.
     boost::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
@@ -440,6 +488,9 @@ protected:
 
     //! List of states of teh central bodies of the propagated bodies.
     std::vector< Eigen::Matrix< StateScalarType, 6, 1 >  > centralBodyStatesWrtGlobalOrigin_;
+
+    //! Propagated state, as provided to convertCurrentStateToGlobalRepresentation, stored as matrix.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > internalSolutionMatrix_;
 };
 
 } // namespace propagators
@@ -0,0 +1,154 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <iomanip>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to get a string representing a profiling category
+std::string getPropagationProfilingCategoryName( const PropagationProfilingCategory category )
+{
+    std::string categoryName;
+    switch( category )
+    {
+    case environment_update_profiling:
+        categoryName = "Environment update";
+        break;
+    case state_derivative_model_profiling:
+        categoryName = "State derivative model";
+        break;
+    case acceleration_model_profiling:
+        categoryName = "Acceleration model";
+        break;
+    case variational_equations_profiling:
+        categoryName = "Variational equations";
+        break;
+    case state_derivative_partial_profiling:
+        categoryName = "State derivative partial";
+        break;
+    case dependent_variable_profiling:
+        categoryName = "Dependent variables";
+        break;
+    default:
+        throw std::runtime_error( "Error, did not recognize propagation profiling category " +
+                                  std::to_string( category ) );
+    }
+    return categoryName;
+}
+
+//! Function to register a model that is to be profiled.
+unsigned int PropagationProfiler::registerEntry( const PropagationProfilingCategory category,
+                                                 const std::string& modelName,
+                                                 const std::string& bodyUndergoing,
+                                                 const std::string& bodyExerting )
+{
+    const boost::tuple< int, std::string, std::string, std::string > entryKey =
+            boost::make_tuple( static_cast< int >( category ), modelName, bodyUndergoing, bodyExerting );
+
+    // Aggregate with existing entry, if present.
+    std::map< boost::tuple< int, std::string, std::string, std::string >, unsigned int >::const_iterator
+            entryIterator = entryIndices_.find( entryKey );
+    if( entryIterator != entryIndices_.end( ) )
+    {
+        return entryIterator->second;
+    }
+
+    entries_.push_back( PropagationProfilingEntry( category, modelName, bodyUndergoing, bodyExerting ) );
+    entryIndices_[ entryKey ] = entries_.size( ) - 1;
+    return entries_.size( ) - 1;
+}
+
+//! Function to retrieve the total computation time of all entries in a single category.
+double PropagationProfiler::getTotalComputationTime( const PropagationProfilingCategory category ) const
+{
+    double totalComputationTime = 0.0;
+    for( unsigned int i = 0; i < entries_.size( ); i++ )
+    {
+        if( entries_.at( i ).category_ == category )
+        {
+            totalComputationTime += entries_.at( i ).computationTime_;
+        }
+    }
+    return totalComputationTime;
+}
+
+//! Function to set the call counts and computation times of all entries to zero, retaining the registered entries.
+void PropagationProfiler::resetEntries( )
+{
+    for( unsigned int i = 0; i < entries_.size( ); i++ )
+    {
+        entries_[ i ].numberOfCalls_ = 0;
+        entries_[ i ].computationTime_ = 0.0;
+    }
+}
+
+//! Function to print the call counts and computation times of all entries as a table.
+void PropagationProfiler::printTable( std::ostream& outputStream ) const
+{
+    // Sort entries by category, retaining order of registration within each category.
+    std::multimap< int, unsigned int > entriesPerCategory;
+    for( unsigned int i = 0; i < entries_.size( ); i++ )
+    {
+        entriesPerCategory.insert( std::make_pair( static_cast< int >( entries_.at( i ).category_ ), i ) );
+    }
+
+    outputStream << std::left << std::setw( 26 ) << "Category" << std::setw( 40 ) << "Model"
+                 << std::setw( 20 ) << "Body undergoing" << std::setw( 20 ) << "Body exerting"
+                 << std::right << std::setw( 12 ) << "Calls" << std::setw( 14 ) << "Time [s]"
+                 << std::setw( 14 ) << "Time/call [us]" << std::endl;
+
+    int currentCategory = -1;
+    for( std::multimap< int, unsigned int >::const_iterator entryIterator = entriesPerCategory.begin( );
+         entryIterator != entriesPerCategory.end( ); entryIterator++ )
+    {
+        const PropagationProfilingEntry& entry = entries_.at( entryIterator->second );
+
+        // Print total of previous category when moving to next category.
+        if( currentCategory >= 0 && entryIterator->first != currentCategory )
+        {
+            outputStream << std::left << std::setw( 118 ) << "  Total" << std::right << std::setw( 14 )
+                         << std::scientific << std::setprecision( 4 )
+                         << getTotalComputationTime( static_cast< PropagationProfilingCategory >( currentCategory ) )
+                         << std::endl;
+        }
+        currentCategory = entryIterator->first;
+
+        outputStream << std::left << std::setw( 26 ) << getPropagationProfilingCategoryName( entry.category_ )
+                     << std::setw( 40 ) << entry.modelName_
+                     << std::setw( 20 ) << ( entry.bodyUndergoing_.empty( ) ? "-" : entry.bodyUndergoing_ )
+                     << std::setw( 20 ) << ( entry.bodyExerting_.empty( ) ? "-" : entry.bodyExerting_ )
+                     << std::right << std::setw( 12 ) << entry.numberOfCalls_
+                     << std::setw( 14 ) << std::scientific << std::setprecision( 4 ) << entry.computationTime_
+                     << std::setw( 14 ) << std::fixed << std::setprecision( 3 )
+                     << ( entry.numberOfCalls_ > 0 ?
+                              1.0E6 * entry.computationTime_ / static_cast< double >( entry.numberOfCalls_ ) : 0.0 )
+                     << std::endl;
+    }
+
+    if( currentCategory >= 0 )
+    {
+        outputStream << std::left << std::setw( 118 ) << "  Total" << std::right << std::setw( 14 )
+                     << std::scientific << std::setprecision( 4 )
+                     << getTotalComputationTime( static_cast< PropagationProfilingCategory >( currentCategory ) )
+                     << std::endl;
+    }
+    outputStream << std::defaultfloat;
+}
+
+} // namespace propagators
+
+} // namespace tudat
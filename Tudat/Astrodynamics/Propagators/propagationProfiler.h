@@ -0,0 +1,249 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONPROFILER_H
+#define TUDAT_PROPAGATIONPROFILER_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Enum defining the parts of the state derivative evaluation for which computation time can be profiled.
+enum PropagationProfilingCategory
+{
+    environment_update_profiling = 0,
+    state_derivative_model_profiling = 1,
+    acceleration_model_profiling = 2,
+    variational_equations_profiling = 3,
+    state_derivative_partial_profiling = 4,
+    dependent_variable_profiling = 5
+};
+
+//! Function to get a string representing a profiling category
+/*!
+ * Function to get a string representing a profiling category
+ * \param category Profiling category for which the name is to be retrieved.
+ * \return String representing the profiling category.
+ */
+std::string getPropagationProfilingCategoryName( const PropagationProfilingCategory category );
+
+//! Call count and computation time of a single (aggregated) model in the propagation.
+struct PropagationProfilingEntry
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param category Part of the state derivative evaluation to which the model belongs.
+     * \param modelName Name of model (e.g. acceleration type or environment update type).
+     * \param bodyUndergoing Name of body undergoing the model (body being updated/accelerated), empty if not applicable.
+     * \param bodyExerting Name of body exerting the model (e.g. body exerting acceleration), empty if not applicable.
+     */
+    PropagationProfilingEntry( const PropagationProfilingCategory category,
+                               const std::string& modelName,
+                               const std::string& bodyUndergoing,
+                               const std::string& bodyExerting ):
+        category_( category ), modelName_( modelName ), bodyUndergoing_( bodyUndergoing ),
+        bodyExerting_( bodyExerting ), numberOfCalls_( 0 ), computationTime_( 0.0 ){ }
+
+    //! Part of the state derivative evaluation to which the model belongs.
+    PropagationProfilingCategory category_;
+
+    //! Name of model (e.g. acceleration type or environment update type).
+    std::string modelName_;
+
+    //! Name of body undergoing the model, empty if not applicable.
+    std::string bodyUndergoing_;
+
+    //! Name of body exerting the model, empty if not applicable.
+    std::string bodyExerting_;
+
+    //! Number of calls to the model.
+    long long numberOfCalls_;
+
+    //! Total (wall clock) computation time spent in the model, in seconds.
+    double computationTime_;
+};
+
+//! Class to collect call counts and computation times of the models that are evaluated during a propagation.
+/*!
+ *  Class to collect call counts and computation times of the models that are evaluated during a propagation. Models are
+ *  registered once (before the propagation) with the registerEntry function, which returns the index with which
+ *  timings are to be added during the propagation. Models of the same category and type, acting between the same pair
+ *  of bodies, are aggregated into a single entry. The object is not thread-safe: a separate profiler is to be used for
+ *  each concurrently running propagation.
+ */
+class PropagationProfiler
+{
+public:
+
+    //! Constructor
+    PropagationProfiler( ){ }
+
+    //! Function to register a model that is to be profiled.
+    /*!
+     * Function to register a model that is to be profiled. If a model with the same category, name and bodies already
+     * exists, the index of the existing entry is returned, so that the timings of the models are aggregated.
+     * \param category Part of the state derivative evaluation to which the model belongs.
+     * \param modelName Name of model (e.g. acceleration type or environment update type).
+     * \param bodyUndergoing Name of body undergoing the model, empty if not applicable.
+     * \param bodyExerting Name of body exerting the model, empty if not applicable.
+     * \return Index of the entry, to be used when adding timings.
+     */
+    unsigned int registerEntry( const PropagationProfilingCategory category,
+                                const std::string& modelName,
+                                const std::string& bodyUndergoing = "",
+                                const std::string& bodyExerting = "" );
+
+    //! Function to add the computation time of a single evaluation of a model.
+    /*!
+     * Function to add the computation time of a single evaluation of a model.
+     * \param entryIndex Index of entry, as returned by registerEntry.
+     * \param computationTime Computation time of evaluation, in seconds.
+     * \param countCall Boolean denoting whether the evaluation is to be counted as a separate call of the model (false
+     * if the time is spent in a different function of a model for which the call is already counted).
+     */
+    void addComputationTime( const unsigned int entryIndex, const double computationTime, const bool countCall = true )
+    {
+        PropagationProfilingEntry& entry = entries_[ entryIndex ];
+        entry.computationTime_ += computationTime;
+        if( countCall )
+        {
+            entry.numberOfCalls_++;
+        }
+    }
+
+    //! Function to retrieve the list of profiling entries, in order of registration.
+    /*!
+     * Function to retrieve the list of profiling entries, in order of registration.
+     * \return List of profiling entries, in order of registration.
+     */
+    const std::vector< PropagationProfilingEntry >& getEntries( ) const
+    {
+        return entries_;
+    }
+
+    //! Function to retrieve the total computation time of all entries in a single category.
+    /*!
+     * Function to retrieve the total computation time of all entries in a single category.
+     * \param category Category for which the total computation time is to be retrieved.
+     * \return Total computation time of all entries in the category, in seconds.
+     */
+    double getTotalComputationTime( const PropagationProfilingCategory category ) const;
+
+    //! Function to set the call counts and computation times of all entries to zero, retaining the registered entries.
+    void resetEntries( );
+
+    //! Function to print the call counts and computation times of all entries as a table.
+    /*!
+     * Function to print the call counts and computation times of all entries as a table, sorted by category and with
+     * the total per category.
+     * \param outputStream Stream to which the table is to be written.
+     */
+    void printTable( std::ostream& outputStream = std::cout ) const;
+
+private:
+
+    //! List of profiling entries, in order of registration.
+    std::vector< PropagationProfilingEntry > entries_;
+
+    //! Index in entries_ of each combination of category, model name, body undergoing and body exerting.
+    std::map< boost::tuple< int, std::string, std::string, std::string >, unsigned int > entryIndices_;
+
+};
+
+//! Class that adds the time elapsed during its lifetime to a profiling entry.
+/*!
+ *  Class that adds the time elapsed during its lifetime to a profiling entry. If the profiler is NULL, the object does
+ *  nothing, so that the timer can be left in place when the propagation is not profiled at the expense of a single
+ *  comparison.
+ */
+class ScopedProfilingTimer
+{
+public:
+
+    //! Constructor, starts the timer.
+    /*!
+     * Constructor, starts the timer.
+     * \param profiler Profiler to which the elapsed time is to be added (no timing if NULL).
+     * \param entryIndex Index of entry in profiler to which the elapsed time is to be added.
+     * \param countCall Boolean denoting whether the timed evaluation is to be counted as a call of the model.
+     */
+    ScopedProfilingTimer( PropagationProfiler* profiler, const unsigned int entryIndex, const bool countCall = true ):
+        profiler_( profiler ), entryIndex_( entryIndex ), countCall_( countCall )
+    {
+        if( profiler_ != NULL )
+        {
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds the elapsed time to the profiler.
+    ~ScopedProfilingTimer( )
+    {
+        if( profiler_ != NULL )
+        {
+            profiler_->addComputationTime(
+                        entryIndex_, std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - startTime_ ).count( ), countCall_ );
+        }
+    }
+
+private:
+
+    //! Profiler to which the elapsed time is to be added (no timing if NULL).
+    PropagationProfiler* profiler_;
+
+    //! Index of entry in profiler to which the elapsed time is to be added.
+    unsigned int entryIndex_;
+
+    //! Boolean denoting whether the timed evaluation is to be counted as a call of the model.
+    bool countCall_;
+
+    //! Time at which the timer was started.
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+//! Function to evaluate a function, while adding its computation time to a profiling entry.
+/*!
+ * Function to evaluate a function, while adding its computation time to a profiling entry. Typically bound to a
+ * profiler to replace an existing function object when profiling a propagation.
+ * \param functionToEvaluate Function that is to be evaluated.
+ * \param profiler Profiler to which the computation time is to be added.
+ * \param entryIndex Index of entry in profiler to which the computation time is to be added.
+ * \return Output of functionToEvaluate.
+ */
+template< typename OutputType >
+OutputType evaluateProfiledFunction(
+        const boost::function< OutputType( ) >& functionToEvaluate,
+        const boost::shared_ptr< PropagationProfiler > profiler,
+        const unsigned int entryIndex )
+{
+    ScopedProfilingTimer timer( profiler.get( ), entryIndex );
+    return functionToEvaluate( );
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONPROFILER_H
@@ -58,6 +58,35 @@ int getSingleIntegrationDifferentialEquationOrder( const IntegratedStateType sta
     return singleStateSize;
 }
 
+//! Get a string representing a type of dynamics.
+std::string getIntegratedStateTypeName( const IntegratedStateType stateType )
+{
+    std::string stateTypeName;
+    switch( stateType )
+    {
+    case hybrid:
+        stateTypeName = "hybrid";
+        break;
+    case translational_state:
+        stateTypeName = "translational";
+        break;
+    case rotational_state:
+        stateTypeName = "rotational";
+        break;
+    case body_mass_state:
+        stateTypeName = "mass";
+        break;
+    case custom_state:
+        stateTypeName = "custom";
+        break;
+    default:
+        std::string errorMessage =
+                "Did not recognize state type " + std::to_string( stateType ) + " when getting name";
+        throw std::runtime_error( errorMessage );
+    }
+    return stateTypeName;
+}
+
 }
 
 }
@@ -11,8 +11,14 @@
 #ifndef TUDAT_STATEDERIVATIVE_H
 #define TUDAT_STATEDERIVATIVE_H
 
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
 #include <Eigen/Core>
 
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
 namespace tudat
 {
 
@@ -49,6 +55,14 @@ int getSingleIntegrationSize( const IntegratedStateType stateType );
  */
 int getSingleIntegrationDifferentialEquationOrder( const IntegratedStateType stateType );
 
+//! Get a string representing a type of dynamics.
+/*!
+ * Get a string representing a type of dynamics.
+ * \param stateType Type of state
+ * \return String representing the type of dynamics.
+ */
+std::string getIntegratedStateTypeName( const IntegratedStateType stateType );
+
 
 //! Base class for calculating the state derivative model for a single type of dynamics.
 /*!
@@ -108,6 +122,17 @@ public:
      */
     virtual void updateStateDerivativeModel( const TimeType currentTime ) = 0;
 
+    //! Function to set the profiler to which the computation times of the constituent models are to be added.
+    /*!
+     * Function to set the profiler to which the computation times of the constituent models (i.e. acceleration models)
+     * are to be added, when profiling the propagation. The default implementation does not profile the constituent
+     * models, in which case only the total time of the state derivative model is profiled (by the
+     * DynamicsStateDerivativeModel).
+     * \param propagationProfiler Profiler to which computation times are to be added (NULL if no profiling is to be
+     * performed).
+     */
+    virtual void setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler ){ }
+
     //! Function to convert the propagator-specific form of the state to the conventional form in
     //! the global frame.
     /*!
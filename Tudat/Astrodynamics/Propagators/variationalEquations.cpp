@@ -92,6 +92,9 @@ void VariationalEquations::clearPartials( )
 //! This function updates all state derivative models to the current time and state.
 void VariationalEquations::updatePartials( const double currentTime )
 {
+    PropagationProfiler* propagationProfiler = propagationProfiler_.get( );
+    unsigned int currentPartialIndex = 0;
+
     // Update all acceleration partials to current state and time. Information is passed indirectly from here, through
     // (function) pointers set in acceleration partial classes
     for( stateDerivativeTypeIterator_ = stateDerivativePartialList_.begin( );
@@ -102,6 +105,9 @@ void VariationalEquations::updatePartials( const double currentTime )
         {
             for( unsigned int j = 0; j < stateDerivativeTypeIterator_->second.at( i ).size( ); j++ )
             {
+                ScopedProfilingTimer partialTimer(
+                            propagationProfiler, ( propagationProfiler == NULL ) ? 0 :
+                                                                           partialProfilingIndices_[ currentPartialIndex++ ] );
                 stateDerivativeTypeIterator_->second.at( i ).at( j )->update( currentTime );
             }
 
@@ -116,12 +122,68 @@ void VariationalEquations::updatePartials( const double currentTime )
         {
             for( unsigned int j = 0; j < stateDerivativeTypeIterator_->second.at( i ).size( ); j++ )
             {
+                ScopedProfilingTimer partialTimer(
+                            propagationProfiler, ( propagationProfiler == NULL ) ? 0 :
+                                                                           partialProfilingIndices_[ currentPartialIndex++ ],
+                            false );
                 stateDerivativeTypeIterator_->second.at( i ).at( j )->updateParameterPartials( );
             }
 
         }
     }
 }
+
+//! Function to set the profiler to which the computation times of the state derivative partials are to be added.
+void VariationalEquations::setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler )
+{
+    propagationProfiler_ = propagationProfiler;
+    partialProfilingIndices_.clear( );
+    if( propagationProfiler_ == NULL )
+    {
+        return;
+    }
+
+    // Register partials in order of updatePartials function
+    std::vector< unsigned int > profilingIndices;
+    for( stateDerivativeTypeIterator_ = stateDerivativePartialList_.begin( );
+         stateDerivativeTypeIterator_ != stateDerivativePartialList_.end( );
+         stateDerivativeTypeIterator_++ )
+    {
+        for( unsigned int i = 0; i < stateDerivativeTypeIterator_->second.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < stateDerivativeTypeIterator_->second.at( i ).size( ); j++ )
+            {
+                boost::shared_ptr< orbit_determination::StateDerivativePartial > currentPartial =
+                        stateDerivativeTypeIterator_->second.at( i ).at( j );
+                boost::shared_ptr< acceleration_partials::AccelerationPartial > currentAccelerationPartial =
+                        boost::dynamic_pointer_cast< acceleration_partials::AccelerationPartial >( currentPartial );
+                if( currentAccelerationPartial != NULL )
+                {
+                    profilingIndices.push_back(
+                                propagationProfiler_->registerEntry(
+                                    state_derivative_partial_profiling,
+                                    basic_astrodynamics::getAccelerationModelName(
+                                        currentAccelerationPartial->getAccelerationType( ) ) + " partial",
+                                    currentAccelerationPartial->getAcceleratedBody( ),
+                                    currentAccelerationPartial->getAcceleratingBody( ) ) );
+                }
+                else
+                {
+                    profilingIndices.push_back(
+                                propagationProfiler_->registerEntry(
+                                    state_derivative_partial_profiling,
+                                    getIntegratedStateTypeName( currentPartial->getIntegratedStateType( ) ) +
+                                    " state derivative partial",
+                                    currentPartial->getIntegrationReferencePoint( ).first ) );
+                }
+            }
+        }
+    }
+
+    // Partials are iterated over twice in updatePartials function
+    partialProfilingIndices_ = profilingIndices;
+    partialProfilingIndices_.insert( partialProfilingIndices_.end( ), profilingIndices.begin( ), profilingIndices.end( ) );
+}
 \
 //! Function (called by constructor) to set up the statePartialList_ member from the state derivative partials
 void VariationalEquations::setStatePartialFunctionList( )
@@ -216,6 +216,16 @@ public:
      *  \param currentTime Time to  which the system is to be updated.
      */
     void updatePartials( const double currentTime );
+
+    //! Function to set the profiler to which the computation times of the state derivative partials are to be added.
+    /*!
+     * Function to set the profiler to which the computation times of the state derivative partials are to be added.
+     * Acceleration partials are aggregated per acceleration type for each pair of bodies undergoing and exerting the
+     * acceleration, other partials per type of dynamics and propagated body.
+     * \param propagationProfiler Profiler to which computation times are to be added (NULL if no profiling is to be
+     * performed).
+     */
+    void setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler );
     
     //! Returns the number of parameter values.
     /*!
@@ -495,6 +505,12 @@ private:
 
     //! Total matrix of partial derivatives of state derivatives w.r.t. parameter vectors.
     Eigen::MatrixXd variationalParameterMatrix_;
+
+    //! Profiler to which the computation times of the state derivative partials are added (NULL if not profiled).
+    boost::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Index of profiling entry for each state derivative partial, in the order in which they are updated.
+    std::vector< unsigned int > partialProfilingIndices_;
 };
 
 
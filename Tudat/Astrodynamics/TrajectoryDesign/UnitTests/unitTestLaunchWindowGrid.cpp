@@ -0,0 +1,215 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/MissionSegments/escapeAndCapture.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/launchWindowGrid.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::transfer_trajectories;
+
+//! Function to create a launch window grid for an Earth-Mars transfer in 2005.
+boost::shared_ptr< LaunchWindowGrid > createEarthMarsLaunchWindowGrid(
+        const LambertTargeterType lambertTargeterType,
+        const boost::shared_ptr< LaunchWindowCullingSettings > cullingSettings,
+        const unsigned int numberOfThreads )
+{
+    std::vector< double > departureEpochs, timesOfFlight;
+    for( unsigned int i = 0; i < 30; i++ )
+    {
+        departureEpochs.push_back( ( 2000.0 + 5.0 * i ) * physical_constants::JULIAN_DAY );
+    }
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        timesOfFlight.push_back( ( 100.0 + 15.0 * i ) * physical_constants::JULIAN_DAY );
+    }
+
+    return boost::make_shared< LaunchWindowGrid >(
+                boost::make_shared< ephemerides::ApproximatePlanetPositions >(
+                    ephemerides::ApproximatePlanetPositionsBase::earthMoonBarycenter ),
+                boost::make_shared< ephemerides::ApproximatePlanetPositions >(
+                    ephemerides::ApproximatePlanetPositionsBase::mars ),
+                1.32712428e20, departureEpochs, timesOfFlight, lambertTargeterType, cullingSettings,
+                numberOfThreads );
+}
+
+BOOST_AUTO_TEST_SUITE( test_launch_window_grid )
+
+//! Test whether the cells of the grid are identical to individually computed transfers.
+BOOST_AUTO_TEST_CASE( testLaunchWindowGridCells )
+{
+    const double sunGravitationalParameter = 1.32712428e20;
+    ephemerides::ApproximatePlanetPositions earthEphemeris(
+                ephemerides::ApproximatePlanetPositionsBase::earthMoonBarycenter );
+    ephemerides::ApproximatePlanetPositions marsEphemeris( ephemerides::ApproximatePlanetPositionsBase::mars );
+
+    for( unsigned int targeter = 0; targeter < 2; targeter++ )
+    {
+        const LambertTargeterType lambertTargeterType =
+                ( targeter == 0 ) ? izzo_lambert_targeter : gooding_lambert_targeter;
+        boost::shared_ptr< LaunchWindowGrid > launchWindowGrid = createEarthMarsLaunchWindowGrid(
+                    lambertTargeterType, boost::make_shared< LaunchWindowCullingSettings >( ), 1 );
+        launchWindowGrid->setArrivalParkingOrbit( 4.2828e13, 1.0e7, 0.5 );
+        launchWindowGrid->evaluateGrid( );
+
+        // The Gooding targeter does not converge for part of the long-way transfers, which are marked as failed.
+        if( lambertTargeterType == izzo_lambert_targeter )
+        {
+            BOOST_CHECK_EQUAL( launchWindowGrid->getNumberOfCellsWithStatus( feasible_cell ), 600 );
+        }
+        else
+        {
+            BOOST_CHECK( launchWindowGrid->getNumberOfCellsWithStatus( feasible_cell ) > 0 );
+            BOOST_CHECK_EQUAL( launchWindowGrid->getNumberOfCellsWithStatus( feasible_cell ) +
+                               launchWindowGrid->getNumberOfCellsWithStatus( failed_cell ), 600 );
+        }
+
+        // Departure epochs and times of flight are multiples of 5 days, so arrival epochs coincide.
+        BOOST_CHECK_EQUAL( launchWindowGrid->getNumberOfUniqueArrivalEpochs( ), 87 );
+
+        Eigen::MatrixXd totalDeltaVMatrix = launchWindowGrid->getTotalDeltaVMatrix( );
+        for( unsigned int i = 0; i < 30; i += 7 )
+        {
+            for( unsigned int j = 0; j < 20; j += 3 )
+            {
+                const double departureEpoch = ( 2000.0 + 5.0 * i ) * physical_constants::JULIAN_DAY;
+                const double timeOfFlight = ( 100.0 + 15.0 * j ) * physical_constants::JULIAN_DAY;
+                const Eigen::Vector6d earthState = earthEphemeris.getCartesianState( departureEpoch );
+                const Eigen::Vector6d marsState = marsEphemeris.getCartesianState( departureEpoch + timeOfFlight );
+                const unsigned int cellIndex = launchWindowGrid->getCellIndex( i, j );
+
+                Eigen::Vector3d departureVelocity, arrivalVelocity;
+                if( lambertTargeterType == izzo_lambert_targeter )
+                {
+                    mission_segments::solveLambertProblemIzzo(
+                                earthState.segment( 0, 3 ), marsState.segment( 0, 3 ), timeOfFlight,
+                                sunGravitationalParameter, departureVelocity, arrivalVelocity );
+                }
+                else if( launchWindowGrid->getCellStatuses( ).at( cellIndex ) == failed_cell )
+                {
+                    BOOST_CHECK_THROW( mission_segments::solveLambertProblemGooding(
+                                           earthState.segment( 0, 3 ), marsState.segment( 0, 3 ), timeOfFlight,
+                                           sunGravitationalParameter, departureVelocity, arrivalVelocity ),
+                                       std::runtime_error );
+                    BOOST_CHECK( std::isnan( launchWindowGrid->getTotalDeltaVs( ).at( cellIndex ) ) );
+                    continue;
+                }
+                else
+                {
+                    mission_segments::solveLambertProblemGooding(
+                                earthState.segment( 0, 3 ), marsState.segment( 0, 3 ), timeOfFlight,
+                                sunGravitationalParameter, departureVelocity, arrivalVelocity );
+                }
+
+                const double departureExcessVelocity = ( departureVelocity - earthState.segment( 3, 3 ) ).norm( );
+                const double arrivalExcessVelocity = ( arrivalVelocity - marsState.segment( 3, 3 ) ).norm( );
+                const double expectedTotalDeltaV = departureExcessVelocity +
+                        mission_segments::computeEscapeOrCaptureDeltaV( 4.2828e13, 1.0e7, 0.5, arrivalExcessVelocity );
+
+                BOOST_CHECK_CLOSE_FRACTION( launchWindowGrid->getDepartureExcessVelocities( ).at( cellIndex ),
+                                            departureExcessVelocity, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( launchWindowGrid->getCharacteristicEnergies( ).at( cellIndex ),
+                                            departureExcessVelocity * departureExcessVelocity, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( launchWindowGrid->getArrivalExcessVelocities( ).at( cellIndex ),
+                                            arrivalExcessVelocity, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( launchWindowGrid->getTotalDeltaVs( ).at( cellIndex ),
+                                            expectedTotalDeltaV, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( totalDeltaVMatrix( i, j ), expectedTotalDeltaV, 1.0E-12 );
+            }
+        }
+    }
+}
+
+//! Test whether results are independent of the number of threads, and whether culling is applied correctly.
+BOOST_AUTO_TEST_CASE( testLaunchWindowGridThreadingAndCulling )
+{
+    boost::shared_ptr< LaunchWindowGrid > serialGrid = createEarthMarsLaunchWindowGrid(
+                izzo_lambert_targeter, boost::make_shared< LaunchWindowCullingSettings >( ), 1 );
+    serialGrid->evaluateGrid( );
+
+    boost::shared_ptr< LaunchWindowGrid > parallelGrid = createEarthMarsLaunchWindowGrid(
+                izzo_lambert_targeter, boost::make_shared< LaunchWindowCullingSettings >( ), 4 );
+    parallelGrid->evaluateGrid( );
+
+    BOOST_CHECK( serialGrid->getTotalDeltaVs( ) == parallelGrid->getTotalDeltaVs( ) );
+    BOOST_CHECK( serialGrid->getDepartureExcessVelocities( ) == parallelGrid->getDepartureExcessVelocities( ) );
+    BOOST_CHECK( serialGrid->getArrivalExcessVelocities( ) == parallelGrid->getArrivalExcessVelocities( ) );
+
+    // Cull cells with high excess velocities, and all cells with a time of flight above 300 days.
+    const double maximumDepartureExcessVelocity = 5.0E3;
+    const double maximumArrivalExcessVelocity = 6.0E3;
+    boost::shared_ptr< LaunchWindowCullingSettings > cullingSettings =
+            boost::make_shared< LaunchWindowCullingSettings >(
+                maximumDepartureExcessVelocity, maximumArrivalExcessVelocity,
+                std::numeric_limits< double >::infinity( ),
+                [ ]( const double, const double timeOfFlight )
+    {
+        return timeOfFlight <= 300.0 * physical_constants::JULIAN_DAY;
+    } );
+    boost::shared_ptr< LaunchWindowGrid > culledGrid = createEarthMarsLaunchWindowGrid(
+                izzo_lambert_targeter, cullingSettings, 3 );
+    culledGrid->evaluateGrid( );
+
+    BOOST_CHECK( culledGrid->getNumberOfCellsWithStatus( culled_cell ) > 0 );
+    BOOST_CHECK( culledGrid->getNumberOfCellsWithStatus( feasible_cell ) > 0 );
+    BOOST_CHECK_EQUAL( culledGrid->getNumberOfCellsWithStatus( failed_cell ), 0 );
+
+    for( unsigned int i = 0; i < culledGrid->getNumberOfDepartureEpochs( ); i++ )
+    {
+        for( unsigned int j = 0; j < culledGrid->getNumberOfTimesOfFlight( ); j++ )
+        {
+            const unsigned int cellIndex = culledGrid->getCellIndex( i, j );
+            const double departureExcessVelocity = serialGrid->getDepartureExcessVelocities( ).at( cellIndex );
+            const double arrivalExcessVelocity = serialGrid->getArrivalExcessVelocities( ).at( cellIndex );
+            const bool isFeasible = ( 100.0 + 15.0 * j <= 300.0 ) &&
+                    departureExcessVelocity <= maximumDepartureExcessVelocity &&
+                    arrivalExcessVelocity <= maximumArrivalExcessVelocity;
+
+            // Cells culled before solving the Lambert problem must be infeasible.
+            const LaunchWindowGridCellStatus status = culledGrid->getCellStatuses( ).at( cellIndex );
+            BOOST_CHECK_EQUAL( status == feasible_cell, isFeasible );
+            if( status == culled_cell )
+            {
+                BOOST_CHECK( std::isnan( culledGrid->getTotalDeltaVs( ).at( cellIndex ) ) );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( culledGrid->getTotalDeltaVs( ).at( cellIndex ),
+                                   serialGrid->getTotalDeltaVs( ).at( cellIndex ) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -36,6 +36,9 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/make_shared.hpp>
@@ -494,6 +497,94 @@ BOOST_AUTO_TEST_CASE( testUpdateMGA1DSMVFTrajectory )
     BOOST_CHECK_CLOSE_FRACTION( expectedDeltaV, resultingDeltaV, tolerance );
 }
 
+//! Test calculation of a population of MGA-1DSM Velocity Formulation trajectories.
+BOOST_AUTO_TEST_CASE( testMGA1DSMVFTrajectoryPopulation )
+{
+    // Specify the Messenger trajectory, as in testMGA1DSMVFTrajectory1.
+    const int numberOfLegs = 5;
+    std::vector< int > legTypeVector;
+    legTypeVector.resize( numberOfLegs );
+    legTypeVector[0] = mga1DsmVelocity_Departure; legTypeVector[1] = mga1DsmVelocity_Swingby;
+    legTypeVector[2] = mga1DsmVelocity_Swingby; legTypeVector[3] = mga1DsmVelocity_Swingby;
+    legTypeVector[4] = capture;
+
+    // Create the ephemeris vector.
+    std::vector< ephemerides::EphemerisPointer >
+            ephemerisVector( numberOfLegs );
+    ephemerisVector[ 0 ] = boost::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter );
+    ephemerisVector[ 1 ] = boost::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter );
+    ephemerisVector[ 2 ] = boost::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus );
+    ephemerisVector[ 3 ] = boost::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus );
+    ephemerisVector[ 4 ] = boost::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::mercury );
+
+    // Create gravitational parameter vector
+    Eigen::VectorXd gravitationalParameterVector( numberOfLegs );
+    gravitationalParameterVector << 3.9860119e14, 3.9860119e14, 3.24860e14, 3.24860e14, 2.2321e13;
+
+    // Create variable vector.
+    Eigen::VectorXd variableVector ( numberOfLegs + 1 + 4 * ( numberOfLegs - 1 ) );
+    variableVector << 1171.64503236 * physical_constants::JULIAN_DAY,
+                      399.999999715 * physical_constants::JULIAN_DAY,
+                      178.372255301 * physical_constants::JULIAN_DAY,
+                      299.223139512 * physical_constants::JULIAN_DAY,
+                      180.510754824 * physical_constants::JULIAN_DAY,
+                      1, // The capture time is irrelevant for the final leg.
+                      0.234594654679, 1408.99421278, 0.37992647165 * 2 * 3.14159265358979,
+                      std::acos(  2 * 0.498004040298 - 1. ) - 3.14159265358979 / 2, // 1st leg.
+                      0.0964769387134, 1.35077257078, 1.80629232251 * 6.378e6, 0.0, // 2nd leg.
+                      0.829948744508, 1.09554368115, 3.04129845698 * 6.052e6, 0.0, // 3rd leg.
+                      0.317174785637, 1.34317576594, 1.10000000891 * 6.052e6, 0.0; //4th leg.
+
+    const double sunGravitationalParameter = 1.32712428e20;
+    Eigen::VectorXd minimumPericenterRadii ( numberOfLegs );
+    minimumPericenterRadii << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN;
+    Eigen::VectorXd semiMajorAxes ( 2 ), eccentricities ( 2 );
+    semiMajorAxes << std::numeric_limits< double >::infinity( ),
+                     std::numeric_limits< double >::infinity( );
+    eccentricities << 0., 0.;
+
+    Trajectory messenger ( numberOfLegs, legTypeVector, ephemerisVector,
+                           gravitationalParameterVector, variableVector, sunGravitationalParameter,
+                           minimumPericenterRadii, semiMajorAxes, eccentricities );
+
+    // Create a population by perturbing the epochs, times of flight and DSM variables.
+    const int populationSize = 50;
+    Eigen::MatrixXd populationMatrix( populationSize, variableVector.rows( ) );
+    for ( int i = 0; i < populationSize; i++ )
+    {
+        populationMatrix.row( i ) = variableVector.transpose( );
+        populationMatrix.block( i, 0, 1, numberOfLegs ) *= 1.0 + 0.02 * std::sin( 1.0 + i );
+        populationMatrix( i, numberOfLegs + 1 ) = 0.1 + 0.8 * i / populationSize;
+        populationMatrix( i, numberOfLegs + 2 ) *= 1.0 + 0.1 * std::cos( 2.0 * i );
+    }
+
+    // Calculate the population one by one, using the update functions.
+    Eigen::VectorXd expectedDeltaVs( populationSize );
+    for ( int i = 0; i < populationSize; i++ )
+    {
+        messenger.updateVariableVector( populationMatrix.row( i ).transpose( ) );
+        messenger.updateEphemeris( );
+        messenger.calculateTrajectory( expectedDeltaVs[ i ] );
+    }
+
+    // Calculate the population on a single and on multiple threads.
+    for ( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        Eigen::VectorXd populationDeltaVs = messenger.calculateTrajectories( populationMatrix,
+                                                                             numberOfThreads );
+        BOOST_CHECK_EQUAL( populationDeltaVs.rows( ), populationSize );
+        for ( int i = 0; i < populationSize; i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( expectedDeltaVs[ i ], populationDeltaVs[ i ],
+                                        std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    // Check that a population with the wrong number of variables is rejected.
+    BOOST_CHECK_THROW( messenger.calculateTrajectories( populationMatrix.leftCols( numberOfLegs ) ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,336 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Battin, R.H. An Introduction to the Mathematics and Methods of Astrodynamics,
+ *          AIAA Education Series, 1999.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "Tudat/Astrodynamics/MissionSegments/escapeAndCapture.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/launchWindowGrid.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace transfer_trajectories
+{
+
+//! Number of rows (departure epochs) of the grid that are evaluated by a thread before a new batch is requested.
+static const unsigned int ROWS_PER_BATCH = 4;
+
+//! Constructor.
+LaunchWindowGrid::LaunchWindowGrid( const ephemerides::EphemerisPointer departureBodyEphemeris,
+                                    const ephemerides::EphemerisPointer arrivalBodyEphemeris,
+                                    const double centralBodyGravitationalParameter,
+                                    const std::vector< double >& departureEpochs,
+                                    const std::vector< double >& timesOfFlight,
+                                    const LambertTargeterType lambertTargeterType,
+                                    const boost::shared_ptr< LaunchWindowCullingSettings > cullingSettings,
+                                    const unsigned int numberOfThreads ):
+    departureBodyEphemeris_( departureBodyEphemeris ), arrivalBodyEphemeris_( arrivalBodyEphemeris ),
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+    departureEpochs_( departureEpochs ), timesOfFlight_( timesOfFlight ),
+    lambertTargeterType_( lambertTargeterType ), cullingSettings_( cullingSettings ),
+    numberOfThreads_( numberOfThreads )
+{
+    if( departureBodyEphemeris_ == NULL || arrivalBodyEphemeris_ == NULL )
+    {
+        throw std::runtime_error( "Error when creating launch window grid, ephemeris of departure or arrival body not "
+                                  "provided." );
+    }
+
+    if( cullingSettings_ == NULL )
+    {
+        cullingSettings_ = boost::make_shared< LaunchWindowCullingSettings >( );
+    }
+
+    for( unsigned int i = 0; i < timesOfFlight_.size( ); i++ )
+    {
+        if( !( timesOfFlight_.at( i ) > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating launch window grid, time of flight " +
+                                      std::to_string( timesOfFlight_.at( i ) ) + " s is not strictly positive." );
+        }
+    }
+
+    departureParkingOrbit_.setConstant( TUDAT_NAN );
+    arrivalParkingOrbit_.setConstant( TUDAT_NAN );
+}
+
+//! Function to set the parking orbit from which the spacecraft departs.
+void LaunchWindowGrid::setDepartureParkingOrbit( const double gravitationalParameter, const double semiMajorAxis,
+                                                 const double eccentricity )
+{
+    departureParkingOrbit_ << gravitationalParameter, semiMajorAxis, eccentricity;
+}
+
+//! Function to set the parking orbit into which the spacecraft is captured.
+void LaunchWindowGrid::setArrivalParkingOrbit( const double gravitationalParameter, const double semiMajorAxis,
+                                               const double eccentricity )
+{
+    arrivalParkingOrbit_ << gravitationalParameter, semiMajorAxis, eccentricity;
+}
+
+//! Function to evaluate all cells of the grid.
+void LaunchWindowGrid::evaluateGrid( )
+{
+    computeBodyStates( );
+
+    const unsigned int numberOfCells = departureEpochs_.size( ) * timesOfFlight_.size( );
+    departureExcessVelocities_.assign( numberOfCells, TUDAT_NAN );
+    characteristicEnergies_.assign( numberOfCells, TUDAT_NAN );
+    arrivalExcessVelocities_.assign( numberOfCells, TUDAT_NAN );
+    totalDeltaVs_.assign( numberOfCells, TUDAT_NAN );
+    cellStatuses_.assign( numberOfCells, culled_cell );
+
+    // Evaluate all rows (departure epochs), on a single or multiple threads.
+    const unsigned int numberOfBatches = ( departureEpochs_.size( ) + ROWS_PER_BATCH - 1 ) / ROWS_PER_BATCH;
+    unsigned int numberOfThreads = ( numberOfThreads_ == 0 ) ?
+                std::max( std::thread::hardware_concurrency( ), 1u ) : numberOfThreads_;
+    numberOfThreads = std::max( std::min( numberOfThreads, numberOfBatches ), 1u );
+
+    std::atomic< unsigned int > nextRowIndex( 0 );
+    std::vector< std::exception_ptr > evaluationErrors( numberOfThreads );
+    if( numberOfThreads == 1 )
+    {
+        evaluateRows( nextRowIndex, evaluationErrors.at( 0 ) );
+    }
+    else
+    {
+        std::vector< std::thread > evaluationThreads;
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            evaluationThreads.push_back(
+                        std::thread( &LaunchWindowGrid::evaluateRows, this,
+                                     std::ref( nextRowIndex ), std::ref( evaluationErrors.at( i ) ) ) );
+        }
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            evaluationThreads.at( i ).join( );
+        }
+    }
+
+    // Re-throw first error that occured during evaluation (if any).
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        if( evaluationErrors.at( i ) )
+        {
+            std::rethrow_exception( evaluationErrors.at( i ) );
+        }
+    }
+}
+
+//! Function to retrieve the total Delta V of all cells as a matrix.
+Eigen::MatrixXd LaunchWindowGrid::getTotalDeltaVMatrix( ) const
+{
+    if( totalDeltaVs_.size( ) != departureEpochs_.size( ) * timesOfFlight_.size( ) )
+    {
+        throw std::runtime_error( "Error when retrieving Delta V of launch window grid, grid not yet evaluated." );
+    }
+
+    return Eigen::Map< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > >(
+                totalDeltaVs_.data( ), departureEpochs_.size( ), timesOfFlight_.size( ) );
+}
+
+//! Function to retrieve the number of cells with a given status.
+unsigned int LaunchWindowGrid::getNumberOfCellsWithStatus( const LaunchWindowGridCellStatus status ) const
+{
+    return std::count( cellStatuses_.begin( ), cellStatuses_.end( ), status );
+}
+
+//! Function to retrieve the states of the departure and arrival body at all (unique) epochs of the grid.
+void LaunchWindowGrid::computeBodyStates( )
+{
+    // Ephemerides are not required to be thread-safe, so all states are retrieved here, before the grid is evaluated.
+    departureBodyStates_.resize( 6, departureEpochs_.size( ) );
+    for( unsigned int i = 0; i < departureEpochs_.size( ); i++ )
+    {
+        departureBodyStates_.col( i ) = departureBodyEphemeris_->getCartesianState( departureEpochs_.at( i ) );
+    }
+
+    // On a regular grid, most arrival epochs are shared by many combinations of departure epoch and time of flight.
+    arrivalEpochs_.clear( );
+    arrivalEpochs_.reserve( departureEpochs_.size( ) * timesOfFlight_.size( ) );
+    for( unsigned int i = 0; i < departureEpochs_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < timesOfFlight_.size( ); j++ )
+        {
+            arrivalEpochs_.push_back( departureEpochs_.at( i ) + timesOfFlight_.at( j ) );
+        }
+    }
+    std::sort( arrivalEpochs_.begin( ), arrivalEpochs_.end( ) );
+    arrivalEpochs_.erase( std::unique( arrivalEpochs_.begin( ), arrivalEpochs_.end( ) ), arrivalEpochs_.end( ) );
+    arrivalEpochs_.shrink_to_fit( );
+
+    arrivalBodyStates_.resize( 6, arrivalEpochs_.size( ) );
+    for( unsigned int i = 0; i < arrivalEpochs_.size( ); i++ )
+    {
+        arrivalBodyStates_.col( i ) = arrivalBodyEphemeris_->getCartesianState( arrivalEpochs_.at( i ) );
+    }
+}
+
+//! Function to evaluate batches of rows (departure epochs) of the grid, until all rows have been evaluated.
+void LaunchWindowGrid::evaluateRows( std::atomic< unsigned int >& nextRowIndex, std::exception_ptr& evaluationError )
+{
+    try
+    {
+        const unsigned int numberOfDepartureEpochs = departureEpochs_.size( );
+        const unsigned int numberOfTimesOfFlight = timesOfFlight_.size( );
+        const double gravitationalParameter = centralBodyGravitationalParameter_;
+        const LaunchWindowCullingSettings& culling = *cullingSettings_;
+
+        // Root finder is re-used for all Gooding solutions on this thread.
+        root_finders::RootFinderPointer goodingRootFinder;
+        if( lambertTargeterType_ == gooding_lambert_targeter )
+        {
+            goodingRootFinder = boost::make_shared< root_finders::NewtonRaphson >( 1.0e-12, 1000 );
+        }
+
+        Eigen::Vector3d departureVelocity, arrivalVelocity;
+        unsigned int currentRowIndex = nextRowIndex.fetch_add( ROWS_PER_BATCH );
+        while( currentRowIndex < numberOfDepartureEpochs )
+        {
+            const unsigned int batchEndIndex = std::min( currentRowIndex + ROWS_PER_BATCH, numberOfDepartureEpochs );
+            for( unsigned int i = currentRowIndex; i < batchEndIndex; i++ )
+            {
+                const double departureEpoch = departureEpochs_[ i ];
+                const Eigen::Vector3d departurePosition = departureBodyStates_.block( 0, i, 3, 1 );
+                const Eigen::Vector3d departureBodyVelocity = departureBodyStates_.block( 3, i, 3, 1 );
+                const double departureRadius = departurePosition.norm( );
+
+                // Arrival epochs increase with time of flight, so the search for the arrival state index starts at the
+                // index of the previous cell if the times of flight are sorted.
+                std::vector< double >::const_iterator arrivalEpochIterator = arrivalEpochs_.cbegin( );
+                for( unsigned int j = 0; j < numberOfTimesOfFlight; j++ )
+                {
+                    const unsigned int cellIndex = i * numberOfTimesOfFlight + j;
+                    const double timeOfFlight = timesOfFlight_[ j ];
+                    const double arrivalEpoch = departureEpoch + timeOfFlight;
+
+                    if( !culling.cellSelectionFunction_.empty( ) &&
+                            !culling.cellSelectionFunction_( departureEpoch, timeOfFlight ) )
+                    {
+                        continue;
+                    }
+
+                    if( arrivalEpochIterator == arrivalEpochs_.cend( ) || *arrivalEpochIterator > arrivalEpoch )
+                    {
+                        arrivalEpochIterator = arrivalEpochs_.cbegin( );
+                    }
+                    arrivalEpochIterator = std::lower_bound( arrivalEpochIterator, arrivalEpochs_.cend( ),
+                                                             arrivalEpoch );
+                    const unsigned int arrivalIndex = arrivalEpochIterator - arrivalEpochs_.cbegin( );
+                    const Eigen::Vector3d arrivalPosition = arrivalBodyStates_.block( 0, arrivalIndex, 3, 1 );
+                    const Eigen::Vector3d arrivalBodyVelocity = arrivalBodyStates_.block( 3, arrivalIndex, 3, 1 );
+
+                    // Lower bounds on excess velocities from the minimum-energy transfer (semi-major axis equal to
+                    // half the semi-perimeter of the transfer triangle), see [Battin, 1999].
+                    const double arrivalRadius = arrivalPosition.norm( );
+                    const double semiPerimeter =
+                            0.5 * ( departureRadius + arrivalRadius + ( arrivalPosition - departurePosition ).norm( ) );
+                    const double minimumDepartureExcessVelocity = std::max(
+                                std::sqrt( std::max( 2.0 * gravitationalParameter *
+                                                     ( 1.0 / departureRadius - 1.0 / semiPerimeter ), 0.0 ) ) -
+                                departureBodyVelocity.norm( ), 0.0 );
+                    const double minimumArrivalExcessVelocity = std::max(
+                                std::sqrt( std::max( 2.0 * gravitationalParameter *
+                                                     ( 1.0 / arrivalRadius - 1.0 / semiPerimeter ), 0.0 ) ) -
+                                arrivalBodyVelocity.norm( ), 0.0 );
+                    if( minimumDepartureExcessVelocity > culling.maximumDepartureExcessVelocity_ ||
+                            minimumArrivalExcessVelocity > culling.maximumArrivalExcessVelocity_ ||
+                            computeDepartureDeltaV( minimumDepartureExcessVelocity ) +
+                            computeArrivalDeltaV( minimumArrivalExcessVelocity ) > culling.maximumTotalDeltaV_ )
+                    {
+                        continue;
+                    }
+
+                    try
+                    {
+                        if( lambertTargeterType_ == izzo_lambert_targeter )
+                        {
+                            mission_segments::solveLambertProblemIzzo(
+                                        departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                                        departureVelocity, arrivalVelocity );
+                        }
+                        else
+                        {
+                            mission_segments::solveLambertProblemGooding(
+                                        departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                                        departureVelocity, arrivalVelocity, goodingRootFinder );
+                        }
+                    }
+                    catch( std::runtime_error& )
+                    {
+                        cellStatuses_[ cellIndex ] = failed_cell;
+                        continue;
+                    }
+
+                    const double departureExcessVelocity = ( departureVelocity - departureBodyVelocity ).norm( );
+                    const double arrivalExcessVelocity = ( arrivalVelocity - arrivalBodyVelocity ).norm( );
+                    const double totalDeltaV = computeDepartureDeltaV( departureExcessVelocity ) +
+                            computeArrivalDeltaV( arrivalExcessVelocity );
+                    if( !std::isfinite( totalDeltaV ) )
+                    {
+                        cellStatuses_[ cellIndex ] = failed_cell;
+                        continue;
+                    }
+
+                    departureExcessVelocities_[ cellIndex ] = departureExcessVelocity;
+                    characteristicEnergies_[ cellIndex ] = departureExcessVelocity * departureExcessVelocity;
+                    arrivalExcessVelocities_[ cellIndex ] = arrivalExcessVelocity;
+                    totalDeltaVs_[ cellIndex ] = totalDeltaV;
+                    cellStatuses_[ cellIndex ] =
+                            ( departureExcessVelocity > culling.maximumDepartureExcessVelocity_ ||
+                              arrivalExcessVelocity > culling.maximumArrivalExcessVelocity_ ||
+                              totalDeltaV > culling.maximumTotalDeltaV_ ) ? infeasible_cell : feasible_cell;
+                }
+            }
+            currentRowIndex = nextRowIndex.fetch_add( ROWS_PER_BATCH );
+        }
+    }
+    catch( ... )
+    {
+        evaluationError = std::current_exception( );
+    }
+}
+
+//! Function to compute the Delta V required to escape from the departure parking orbit.
+double LaunchWindowGrid::computeDepartureDeltaV( const double departureExcessVelocity ) const
+{
+    if( std::isnan( departureParkingOrbit_( 0 ) ) )
+    {
+        return departureExcessVelocity;
+    }
+    return mission_segments::computeEscapeOrCaptureDeltaV(
+                departureParkingOrbit_( 0 ), departureParkingOrbit_( 1 ), departureParkingOrbit_( 2 ),
+                departureExcessVelocity );
+}
+
+//! Function to compute the Delta V required to be captured into the arrival parking orbit.
+double LaunchWindowGrid::computeArrivalDeltaV( const double arrivalExcessVelocity ) const
+{
+    if( std::isnan( arrivalParkingOrbit_( 0 ) ) )
+    {
+        return arrivalExcessVelocity;
+    }
+    return mission_segments::computeEscapeOrCaptureDeltaV(
+                arrivalParkingOrbit_( 0 ), arrivalParkingOrbit_( 1 ), arrivalParkingOrbit_( 2 ),
+                arrivalExcessVelocity );
+}
+
+} // namespace transfer_trajectories
+} // namespace tudat
@@ -0,0 +1,306 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_LAUNCH_WINDOW_GRID_H
+#define TUDAT_LAUNCH_WINDOW_GRID_H
+
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+
+namespace tudat
+{
+namespace transfer_trajectories
+{
+
+//! Enum of Lambert targeters that can be used to evaluate a launch window grid.
+enum LambertTargeterType
+{
+    izzo_lambert_targeter,
+    gooding_lambert_targeter
+};
+
+//! Enum of the status of a single cell (combination of departure epoch and time of flight) of a launch window grid.
+enum LaunchWindowGridCellStatus
+{
+    //! Lambert problem solved, and transfer satisfies all culling criteria.
+    feasible_cell,
+    //! Lambert problem not solved, as the cell was culled before solving it.
+    culled_cell,
+    //! Lambert problem solved, but transfer violates at least one of the culling criteria.
+    infeasible_cell,
+    //! Lambert targeter did not converge to a valid solution.
+    failed_cell
+};
+
+//! Settings for the culling of infeasible cells of a launch window grid.
+/*!
+ * Settings for the culling of infeasible cells of a launch window grid. Before solving the Lambert problem of a cell,
+ * lower bounds on the departure and arrival excess velocities are computed from the minimum-energy transfer between
+ * the departure and arrival positions, which no (single-revolution) transfer between these positions can improve upon.
+ * If one of these bounds exceeds its maximum value, or if the user-defined cell selection function rejects the cell,
+ * the Lambert problem is not solved. Cells for which the Lambert problem is solved, but which exceed one of the
+ * maximum values, are marked as infeasible.
+ */
+struct LaunchWindowCullingSettings
+{
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param maximumDepartureExcessVelocity Maximum excess velocity at departure (m/s).
+     * \param maximumArrivalExcessVelocity Maximum excess velocity at arrival (m/s).
+     * \param maximumTotalDeltaV Maximum total Delta V of the transfer (m/s).
+     * \param cellSelectionFunction Function that returns whether a cell is to be evaluated, with the departure epoch
+     * and time of flight (both in seconds) as input. If empty, no cells are rejected based on this function.
+     */
+    LaunchWindowCullingSettings(
+            const double maximumDepartureExcessVelocity = std::numeric_limits< double >::infinity( ),
+            const double maximumArrivalExcessVelocity = std::numeric_limits< double >::infinity( ),
+            const double maximumTotalDeltaV = std::numeric_limits< double >::infinity( ),
+            const boost::function< bool( const double, const double ) > cellSelectionFunction =
+            boost::function< bool( const double, const double ) >( ) ):
+        maximumDepartureExcessVelocity_( maximumDepartureExcessVelocity ),
+        maximumArrivalExcessVelocity_( maximumArrivalExcessVelocity ),
+        maximumTotalDeltaV_( maximumTotalDeltaV ),
+        cellSelectionFunction_( cellSelectionFunction ){ }
+
+    //! Maximum excess velocity at departure (m/s).
+    double maximumDepartureExcessVelocity_;
+
+    //! Maximum excess velocity at arrival (m/s).
+    double maximumArrivalExcessVelocity_;
+
+    //! Maximum total Delta V of the transfer (m/s).
+    double maximumTotalDeltaV_;
+
+    //! Function that returns whether a cell (departure epoch, time of flight) is to be evaluated.
+    boost::function< bool( const double, const double ) > cellSelectionFunction_;
+};
+
+//! Class to evaluate a grid of transfers between two bodies (porkchop plot).
+/*!
+ * Class to evaluate a grid of transfers between two bodies, for all combinations of a list of departure epochs and
+ * times of flight, by solving the Lambert problem for each combination (cell). The states of the departure and arrival
+ * body are retrieved from their ephemerides once for each unique epoch before the Lambert problems are solved, after
+ * which the cells are evaluated in batches of departure epochs, distributed over multiple threads. The excess
+ * velocities, C3 and total Delta V of all cells are stored in contiguous arrays (row-major, i.e. with the index of the
+ * time of flight running fastest). The total Delta V is the sum of the excess velocities, or of the Delta V required
+ * to escape from/capture into a parking orbit, if such an orbit is set for the departure/arrival body.
+ */
+class LaunchWindowGrid
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param departureBodyEphemeris Ephemeris of the departure body, w.r.t. the central body.
+     * \param arrivalBodyEphemeris Ephemeris of the arrival body, w.r.t. the central body.
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body of the transfer.
+     * \param departureEpochs List of departure epochs (seconds since J2000).
+     * \param timesOfFlight List of times of flight (seconds).
+     * \param lambertTargeterType Lambert targeter used to compute the transfers.
+     * \param cullingSettings Settings for the culling of infeasible cells (no culling by default).
+     * \param numberOfThreads Number of threads used to evaluate the grid. If 0, the number of concurrent threads
+     * supported by the hardware is used.
+     */
+    LaunchWindowGrid( const ephemerides::EphemerisPointer departureBodyEphemeris,
+                      const ephemerides::EphemerisPointer arrivalBodyEphemeris,
+                      const double centralBodyGravitationalParameter,
+                      const std::vector< double >& departureEpochs,
+                      const std::vector< double >& timesOfFlight,
+                      const LambertTargeterType lambertTargeterType = izzo_lambert_targeter,
+                      const boost::shared_ptr< LaunchWindowCullingSettings > cullingSettings =
+            boost::make_shared< LaunchWindowCullingSettings >( ),
+                      const unsigned int numberOfThreads = 0 );
+
+    //! Function to set the parking orbit from which the spacecraft departs.
+    /*!
+     * Function to set the parking orbit from which the spacecraft departs, so that the departure Delta V is computed
+     * as the Delta V required to escape from this orbit (instead of the departure excess velocity).
+     * \param gravitationalParameter Gravitational parameter of the departure body.
+     * \param semiMajorAxis Semi-major axis of the parking orbit.
+     * \param eccentricity Eccentricity of the parking orbit.
+     */
+    void setDepartureParkingOrbit( const double gravitationalParameter, const double semiMajorAxis,
+                                   const double eccentricity );
+
+    //! Function to set the parking orbit into which the spacecraft is captured.
+    /*!
+     * Function to set the parking orbit into which the spacecraft is captured, so that the arrival Delta V is computed
+     * as the Delta V required to be captured into this orbit (instead of the arrival excess velocity).
+     * \param gravitationalParameter Gravitational parameter of the arrival body.
+     * \param semiMajorAxis Semi-major axis of the parking orbit.
+     * \param eccentricity Eccentricity of the parking orbit.
+     */
+    void setArrivalParkingOrbit( const double gravitationalParameter, const double semiMajorAxis,
+                                 const double eccentricity );
+
+    //! Function to evaluate all cells of the grid.
+    /*!
+     * Function to evaluate all cells of the grid. Values of cells that are culled, or for which the Lambert targeter
+     * fails, are set to NaN.
+     */
+    void evaluateGrid( );
+
+    //! Function to retrieve the number of departure epochs (rows of the grid).
+    unsigned int getNumberOfDepartureEpochs( ) const
+    {
+        return departureEpochs_.size( );
+    }
+
+    //! Function to retrieve the number of times of flight (columns of the grid).
+    unsigned int getNumberOfTimesOfFlight( ) const
+    {
+        return timesOfFlight_.size( );
+    }
+
+    //! Function to retrieve the index of a cell in the contiguous output arrays.
+    unsigned int getCellIndex( const unsigned int departureEpochIndex, const unsigned int timeOfFlightIndex ) const
+    {
+        return departureEpochIndex * timesOfFlight_.size( ) + timeOfFlightIndex;
+    }
+
+    //! Function to retrieve the departure excess velocities of all cells (m/s).
+    const std::vector< double >& getDepartureExcessVelocities( ) const
+    {
+        return departureExcessVelocities_;
+    }
+
+    //! Function to retrieve the characteristic energies (C3) at departure of all cells (m^2/s^2).
+    const std::vector< double >& getCharacteristicEnergies( ) const
+    {
+        return characteristicEnergies_;
+    }
+
+    //! Function to retrieve the arrival excess velocities of all cells (m/s).
+    const std::vector< double >& getArrivalExcessVelocities( ) const
+    {
+        return arrivalExcessVelocities_;
+    }
+
+    //! Function to retrieve the total Delta V of all cells (m/s).
+    const std::vector< double >& getTotalDeltaVs( ) const
+    {
+        return totalDeltaVs_;
+    }
+
+    //! Function to retrieve the status of all cells.
+    const std::vector< LaunchWindowGridCellStatus >& getCellStatuses( ) const
+    {
+        return cellStatuses_;
+    }
+
+    //! Function to retrieve the total Delta V of all cells as a matrix (rows: departure epochs, columns: times of
+    //! flight).
+    Eigen::MatrixXd getTotalDeltaVMatrix( ) const;
+
+    //! Function to retrieve the number of cells with a given status.
+    unsigned int getNumberOfCellsWithStatus( const LaunchWindowGridCellStatus status ) const;
+
+    //! Function to retrieve the number of unique epochs at which the ephemeris of the arrival body was evaluated.
+    unsigned int getNumberOfUniqueArrivalEpochs( ) const
+    {
+        return arrivalEpochs_.size( );
+    }
+
+private:
+
+    //! Function to retrieve the states of the departure and arrival body at all (unique) epochs of the grid.
+    void computeBodyStates( );
+
+    //! Function to evaluate batches of rows (departure epochs) of the grid, until all rows have been evaluated.
+    /*!
+     * Function to evaluate batches of rows (departure epochs) of the grid, until all rows have been evaluated. This
+     * function is run concurrently on each of the threads.
+     * \param nextRowIndex Index of the next row that is to be evaluated, shared between all threads.
+     * \param evaluationError Exception that occurred during evaluation on this thread (if any).
+     */
+    void evaluateRows( std::atomic< unsigned int >& nextRowIndex, std::exception_ptr& evaluationError );
+
+    //! Function to compute the Delta V required to escape from the departure parking orbit (or the excess velocity, if
+    //! no parking orbit is set).
+    double computeDepartureDeltaV( const double departureExcessVelocity ) const;
+
+    //! Function to compute the Delta V required to be captured into the arrival parking orbit (or the excess velocity,
+    //! if no parking orbit is set).
+    double computeArrivalDeltaV( const double arrivalExcessVelocity ) const;
+
+    //! Ephemeris of the departure body, w.r.t. the central body.
+    ephemerides::EphemerisPointer departureBodyEphemeris_;
+
+    //! Ephemeris of the arrival body, w.r.t. the central body.
+    ephemerides::EphemerisPointer arrivalBodyEphemeris_;
+
+    //! Gravitational parameter of the central body of the transfer.
+    double centralBodyGravitationalParameter_;
+
+    //! List of departure epochs (seconds since J2000).
+    std::vector< double > departureEpochs_;
+
+    //! List of times of flight (seconds).
+    std::vector< double > timesOfFlight_;
+
+    //! Lambert targeter used to compute the transfers.
+    LambertTargeterType lambertTargeterType_;
+
+    //! Settings for the culling of infeasible cells.
+    boost::shared_ptr< LaunchWindowCullingSettings > cullingSettings_;
+
+    //! Number of threads used to evaluate the grid (0 if equal to the number supported by the hardware).
+    unsigned int numberOfThreads_;
+
+    //! Gravitational parameter of the departure body, semi-major axis and eccentricity of the departure parking orbit
+    //! (NaN if not set).
+    Eigen::Vector3d departureParkingOrbit_;
+
+    //! Gravitational parameter of the arrival body, semi-major axis and eccentricity of the arrival parking orbit (NaN
+    //! if not set).
+    Eigen::Vector3d arrivalParkingOrbit_;
+
+    //! Cartesian states of the departure body at each of the departure epochs (one column per epoch).
+    Eigen::MatrixXd departureBodyStates_;
+
+    //! Sorted list of unique arrival epochs of the grid.
+    std::vector< double > arrivalEpochs_;
+
+    //! Cartesian states of the arrival body at each of the unique arrival epochs (one column per epoch).
+    Eigen::MatrixXd arrivalBodyStates_;
+
+    //! Departure excess velocities of all cells (m/s).
+    std::vector< double > departureExcessVelocities_;
+
+    //! Characteristic energies (C3) at departure of all cells (m^2/s^2).
+    std::vector< double > characteristicEnergies_;
+
+    //! Arrival excess velocities of all cells (m/s).
+    std::vector< double > arrivalExcessVelocities_;
+
+    //! Total Delta V of all cells (m/s).
+    std::vector< double > totalDeltaVs_;
+
+    //! Status of all cells.
+    std::vector< LaunchWindowGridCellStatus > cellStatuses_;
+};
+
+} // namespace transfer_trajectories
+} // namespace tudat
+
+#endif // TUDAT_LAUNCH_WINDOW_GRID_H
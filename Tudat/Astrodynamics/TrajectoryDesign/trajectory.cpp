@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -164,13 +169,30 @@ void Trajectory::updateEphemeris( )
     // Calculate the ephemeris and store it in the corresponding variables in this class.
     extractEphemeris( );
 
-    // Loop through all the mission legs and update their ephemeris variables.
-    for ( int counter = 0; counter < numberOfLegs_; counter++ )
+    // Update the ephemeris variables of the mission legs.
+    updateLegEphemeris( );
+}
+
+//! Update the ephemeris from given planet states.
+void Trajectory::updateEphemeris( const Eigen::MatrixXd& planetStates )
+{
+    if ( planetStates.rows( ) != 6 || planetStates.cols( ) != numberOfLegs_ )
     {
-        missionLegPtrVector_[ counter ]->updateEphemeris( planetPositionVector_[ counter ],
-                                                              planetPositionVector_[ counter + 1],
-                                                              planetVelocityVector_[ counter ] );
+        throw std::runtime_error( "Error when updating ephemeris of trajectory, planet states matrix has size " +
+                                  std::to_string( planetStates.rows( ) ) + "x" +
+                                  std::to_string( planetStates.cols( ) ) + ", expected 6x" +
+                                  std::to_string( static_cast< int >( numberOfLegs_ ) ) + "." );
     }
+
+    // Set planet position and velocity from the Cartesian elements.
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        planetPositionVector_[ counter ] = planetStates.block( 0, counter, 3, 1 );
+        planetVelocityVector_[ counter ] = planetStates.block( 3, counter, 3, 1 );
+    }
+
+    // Update the ephemeris variables of the mission legs.
+    updateLegEphemeris( );
 }
 
     //! Update the variable vector.
@@ -527,5 +549,152 @@ void Trajectory::getLaunchConditions( Eigen::Vector3d& departureBodyPosition,
                                                              velocityAfterDeparture );
 }
 
+//! Return the planet states at the visitation times.
+Eigen::MatrixXd Trajectory::getPlanetStates( const Eigen::VectorXd& trajectoryVariableVector ) const
+{
+    Eigen::MatrixXd planetStates( 6, static_cast< int >( numberOfLegs_ ) );
+
+    // Obtain positions and velocities at the visitation times, as in extractEphemeris.
+    double time = 0.0;
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        time = time + trajectoryVariableVector[ counter ];
+        planetStates.col( counter ) = ephemerisVector_[ counter ]->getCartesianState( time );
+    }
+
+    return planetStates;
+}
+
+//! Create a copy of the trajectory.
+boost::shared_ptr< Trajectory > Trajectory::clone( ) const
+{
+    if ( missionLegPtrVector_.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when copying trajectory, trajectory has not been initialized." );
+    }
+
+    // Creating a new trajectory from the same variables creates a new set of mission legs.
+    return boost::make_shared< Trajectory >( numberOfLegs_, legTypeVector_, ephemerisVector_,
+                                             gravitationalParameterVector_, trajectoryVariableVector_,
+                                             centralBodyGravitationalParameter_,
+                                             minimumPericenterRadiiVector_, semiMajorAxesVector_,
+                                             eccentricityVector_ );
+}
+
+//! Calculate the delta V of a population of trajectories.
+Eigen::VectorXd Trajectory::calculateTrajectories( const Eigen::MatrixXd& trajectoryVariableMatrix,
+                                                   const unsigned int numberOfThreads ) const
+{
+    if ( trajectoryVariableMatrix.cols( ) != trajectoryVariableVector_.size( ) )
+    {
+        throw std::runtime_error( "Error when calculating population of trajectories, number of variables (" +
+                                  std::to_string( trajectoryVariableMatrix.cols( ) ) +
+                                  ") is incompatible with trajectory (" +
+                                  std::to_string( trajectoryVariableVector_.size( ) ) + ")." );
+    }
+
+    // Extract all ephemeris data beforehand, as the ephemeris objects are shared between all
+    // copies of the trajectory (and are not necessarily thread-safe).
+    const unsigned int numberOfTrajectories = trajectoryVariableMatrix.rows( );
+    std::vector< Eigen::MatrixXd > planetStatesVector( numberOfTrajectories );
+    for ( unsigned int i = 0; i < numberOfTrajectories; i++ )
+    {
+        planetStatesVector[ i ] = getPlanetStates( trajectoryVariableMatrix.row( i ).transpose( ) );
+    }
+
+    // Calculate all trajectories, on a single or multiple threads.
+    Eigen::VectorXd totalDeltaVs = Eigen::VectorXd::Constant( numberOfTrajectories, TUDAT_NAN );
+    unsigned int numberOfUsedThreads = ( numberOfThreads == 0 ) ?
+                std::max( std::thread::hardware_concurrency( ), 1u ) : numberOfThreads;
+    numberOfUsedThreads = std::max( std::min( numberOfUsedThreads, numberOfTrajectories ), 1u );
+
+    // Each thread uses its own copy of the trajectory, since the mission legs store the
+    // intermediate results of the calculation. The copies are created here, since creating them
+    // requires ephemeris data.
+    std::vector< boost::shared_ptr< Trajectory > > threadTrajectories( numberOfUsedThreads );
+    for ( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+    {
+        threadTrajectories[ i ] = clone( );
+    }
+
+    std::atomic< unsigned int > nextTrajectoryIndex( 0 );
+    std::vector< std::exception_ptr > calculationErrors( numberOfUsedThreads );
+    if ( numberOfUsedThreads == 1 )
+    {
+        calculateTrajectoriesOnThread( threadTrajectories.at( 0 ), trajectoryVariableMatrix,
+                                       planetStatesVector, totalDeltaVs, nextTrajectoryIndex,
+                                       calculationErrors.at( 0 ) );
+    }
+    else
+    {
+        std::vector< std::thread > calculationThreads;
+        for ( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+        {
+            calculationThreads.push_back(
+                        std::thread( &Trajectory::calculateTrajectoriesOnThread,
+                                     threadTrajectories.at( i ), std::cref( trajectoryVariableMatrix ),
+                                     std::cref( planetStatesVector ),
+                                     std::ref( totalDeltaVs ), std::ref( nextTrajectoryIndex ),
+                                     std::ref( calculationErrors.at( i ) ) ) );
+        }
+        for ( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+        {
+            calculationThreads.at( i ).join( );
+        }
+    }
+
+    // Re-throw first error that occured during calculation (if any).
+    for ( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+    {
+        if ( calculationErrors.at( i ) )
+        {
+            std::rethrow_exception( calculationErrors.at( i ) );
+        }
+    }
+
+    return totalDeltaVs;
+}
+
+//! Update the ephemeris of the mission legs.
+void Trajectory::updateLegEphemeris( )
+{
+    // Loop through all the mission legs and update their ephemeris variables.
+    for ( int counter = 0; counter < numberOfLegs_; counter++ )
+    {
+        missionLegPtrVector_[ counter ]->updateEphemeris( planetPositionVector_[ counter ],
+                                                              planetPositionVector_[ counter + 1],
+                                                              planetVelocityVector_[ counter ] );
+    }
+}
+
+//! Calculate the delta V of the trajectories in a population on the current thread.
+void Trajectory::calculateTrajectoriesOnThread(
+        const boost::shared_ptr< Trajectory > trajectory,
+        const Eigen::MatrixXd& trajectoryVariableMatrix,
+        const std::vector< Eigen::MatrixXd >& planetStatesVector,
+        Eigen::VectorXd& totalDeltaVs,
+        std::atomic< unsigned int >& nextTrajectoryIndex,
+        std::exception_ptr& calculationError )
+{
+    try
+    {
+        const unsigned int numberOfTrajectories = trajectoryVariableMatrix.rows( );
+        unsigned int currentTrajectoryIndex = nextTrajectoryIndex++;
+        while ( currentTrajectoryIndex < numberOfTrajectories )
+        {
+            trajectory->updateVariableVector(
+                        trajectoryVariableMatrix.row( currentTrajectoryIndex ).transpose( ) );
+            trajectory->updateEphemeris( planetStatesVector[ currentTrajectoryIndex ] );
+            trajectory->calculateTrajectory( totalDeltaVs[ currentTrajectoryIndex ] );
+
+            currentTrajectoryIndex = nextTrajectoryIndex++;
+        }
+    }
+    catch ( ... )
+    {
+        calculationError = std::current_exception( );
+    }
+}
+
 } // namespace transfer_trajectories
 } // namespace tudat
@@ -28,6 +28,8 @@
 #ifndef TUDAT_TRAJECTORY_H
 #define TUDAT_TRAJECTORY_H
 
+#include <atomic>
+#include <exception>
 #include <vector>
 
 #include <boost/make_shared.hpp>
@@ -200,6 +202,50 @@ public:
                               Eigen::Vector3d& departureBodyVelocity,
                               Eigen::Vector3d& velocityAfterDeparture );
 
+    //! Update the ephemeris from given planet states.
+    /*!
+     * Sets all the positions and the velocities of the trajectory class and the underlying mission
+     * leg classes to the given values, instead of extracting them from the ephemerides.
+     * \param planetStates Cartesian states of the visited planets at the visitation times (one
+     * column per planet, in the order of visitation).
+     */
+    void updateEphemeris( const Eigen::MatrixXd& planetStates );
+
+    //! Return the planet states at the visitation times.
+    /*!
+     * Returns the Cartesian states of the visited planets at the visitation times defined by a
+     * trajectory variable vector, extracted from the ephemerides.
+     * \param trajectoryVariableVector the variable vector defining the visitation times.
+     * \return Cartesian states of the visited planets (one column per planet).
+     */
+    Eigen::MatrixXd getPlanetStates( const Eigen::VectorXd& trajectoryVariableVector ) const;
+
+    //! Create a copy of the trajectory.
+    /*!
+     * Creates a copy of the trajectory, with its own mission legs, such that the copy can be
+     * updated and calculated independently of this trajectory. The ephemeris objects are shared
+     * with this trajectory.
+     * \return Copy of the trajectory.
+     */
+    boost::shared_ptr< Trajectory > clone( ) const;
+
+    //! Calculate the delta V of a population of trajectories.
+    /*!
+     * Calculates the total delta V of each of a population of trajectories, defined by their
+     * trajectory variable vectors, as is for instance required by population-based optimizers.
+     * The planet states at all visitation times are extracted from the ephemerides before the
+     * trajectories are calculated, after which they are only read. The trajectories are calculated
+     * on multiple threads, each using its own copy (see clone) of this trajectory. This trajectory
+     * itself is not modified.
+     * \param trajectoryVariableMatrix the variable vectors of the population (one row per
+     * trajectory).
+     * \param numberOfThreads the number of threads used to calculate the trajectories. If 0, the
+     * number of concurrent threads supported by the hardware is used.
+     * \return the total delta V of each trajectory in the population.
+     */
+    Eigen::VectorXd calculateTrajectories( const Eigen::MatrixXd& trajectoryVariableMatrix,
+                                           const unsigned int numberOfThreads = 0 ) const;
+
 protected:
 
 private:
@@ -337,6 +383,33 @@ private:
      * Extracts the ephemeris data and stores it into the associated position and velocity vectors.
      */
     void extractEphemeris( );
+
+    //! Update the ephemeris of the mission legs.
+    /*!
+     * Passes the planet positions and velocities stored in this class to the mission legs.
+     */
+    void updateLegEphemeris( );
+
+    //! Calculate the delta V of the trajectories in a population on the current thread.
+    /*!
+     * Calculates the total delta V of trajectories in a population on the current thread, until
+     * all trajectories have been calculated.
+     * \param trajectory the copy of the trajectory that is used by the current thread.
+     * \param trajectoryVariableMatrix the variable vectors of the population (one row per
+     * trajectory).
+     * \param planetStatesVector the planet states of each trajectory (see getPlanetStates).
+     * \param totalDeltaVs the total delta V of each trajectory (updated by this function).
+     * \param nextTrajectoryIndex the index of the next trajectory that is to be calculated,
+     * shared between all threads.
+     * \param calculationError the exception that occured on this thread (if any).
+     */
+    static void calculateTrajectoriesOnThread(
+            const boost::shared_ptr< Trajectory > trajectory,
+            const Eigen::MatrixXd& trajectoryVariableMatrix,
+            const std::vector< Eigen::MatrixXd >& planetStatesVector,
+            Eigen::VectorXd& totalDeltaVs,
+            std::atomic< unsigned int >& nextTrajectoryIndex,
+            std::exception_ptr& calculationError );
 };
 } // namespace transfer_trajectories
 } // namespace tudat
@@ -0,0 +1,460 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmarks of the numerical kernels that dominate the cost of a typical propagation or estimation. All input
+ *      data is generated deterministically (fixed random seed), so that timings are reproducible between runs and
+ *      releases. Usage: benchmark_NumericalKernels [outputFile] [numberOfRepetitions]
+ *
+ */
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/recursiveSphericalHarmonicsGravity.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/fixedSizeRungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+
+using namespace tudat;
+using namespace tudat::benchmarks;
+
+//! Seed of the random number generator used to generate the benchmark input.
+const unsigned int benchmarkSeed = 42;
+
+//! Number of kernel evaluations in a single repetition of the (non-integrator) kernel benchmarks.
+const int numberOfKernelEvaluations = 10000;
+
+//! Gravitational parameter and reference radius of the Earth, used throughout the benchmarks.
+const double earthGravitationalParameter = 3.986004418E14;
+const double earthRadius = 6378.137E3;
+
+//! Function to update a Legendre cache for a list of polynomial parameters (sine of latitude).
+void evaluateLegendreCache( const boost::shared_ptr< basic_mathematics::LegendreCache > legendreCache,
+                            const std::vector< double >& polynomialParameters )
+{
+    for( unsigned int i = 0; i < polynomialParameters.size( ); i++ )
+    {
+        legendreCache->update( polynomialParameters[ i ] );
+        consumeBenchmarkOutput( legendreCache->getLegendrePolynomial( 2, 0 ) );
+    }
+}
+
+//! Function to evaluate the spherical harmonic acceleration for a list of positions, with the selected method.
+void evaluateSphericalHarmonicAcceleration(
+        const gravitation::SphericalHarmonicsEvaluationMethod evaluationMethod,
+        const std::vector< Eigen::Vector3d >& positions,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const boost::shared_ptr< gravitation::CunninghamRecursionCache > recursionCache )
+{
+    std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
+    Eigen::Vector3d acceleration;
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        switch( evaluationMethod )
+        {
+        case gravitation::term_by_term_evaluation:
+            acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions[ i ], earthGravitationalParameter, earthRadius, cosineCoefficients,
+                        sineCoefficients, sphericalHarmonicsCache, accelerationPerTerm );
+            break;
+        case gravitation::order_major_vectorized_evaluation:
+            acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSumPerOrder(
+                        positions[ i ], earthGravitationalParameter, earthRadius, cosineCoefficients,
+                        sineCoefficients, sphericalHarmonicsCache );
+            break;
+        case gravitation::cunningham_recursive_evaluation:
+            acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSumRecursively(
+                        positions[ i ], earthGravitationalParameter, earthRadius, cosineCoefficients,
+                        sineCoefficients, recursionCache );
+            break;
+        }
+        consumeBenchmarkOutput( acceleration.x( ) );
+    }
+}
+
+//! Function to add benchmarks of the spherical harmonic acceleration, for a field with Kaula-rule coefficients.
+/*!
+ * Function to add benchmarks of the spherical harmonic acceleration, for a field with Kaula-rule coefficients up to
+ * given degree and order, at random LEO positions, for each of the selected evaluation methods.
+ * \param benchmarkSuite Suite to which the benchmarks are added.
+ * \param randomNumberGenerator Random number generator used to generate coefficients and positions.
+ * \param maximumDegree Maximum degree and order of the gravity field.
+ * \param evaluationMethods Evaluation methods that are to be benchmarked.
+ */
+void addSphericalHarmonicAccelerationBenchmarks(
+        BenchmarkSuite& benchmarkSuite, std::mt19937& randomNumberGenerator, const int maximumDegree,
+        const std::vector< gravitation::SphericalHarmonicsEvaluationMethod >& evaluationMethods )
+{
+    std::uniform_real_distribution< double > unitDistribution( 0.0, 1.0 );
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) =
+                    1.0E-5 / ( degree * degree ) * ( 2.0 * unitDistribution( randomNumberGenerator ) - 1.0 );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) =
+                        1.0E-5 / ( degree * degree ) * ( 2.0 * unitDistribution( randomNumberGenerator ) - 1.0 );
+            }
+        }
+    }
+
+    std::vector< Eigen::Vector3d > positions;
+    for( int i = 0; i < numberOfKernelEvaluations / 10; i++ )
+    {
+        const double longitude = 2.0 * mathematical_constants::PI * unitDistribution( randomNumberGenerator );
+        const double latitude = std::asin( 2.0 * unitDistribution( randomNumberGenerator ) - 1.0 );
+        const double radius = earthRadius + 200.0E3 + 800.0E3 * unitDistribution( randomNumberGenerator );
+        positions.push_back( radius * ( Eigen::Vector3d( ) <<
+                                        std::cos( latitude ) * std::cos( longitude ),
+                                        std::cos( latitude ) * std::sin( longitude ),
+                                        std::sin( latitude ) ).finished( ) );
+    }
+
+    boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+    boost::shared_ptr< gravitation::CunninghamRecursionCache > recursionCache =
+            boost::make_shared< gravitation::CunninghamRecursionCache >( maximumDegree + 1, maximumDegree + 1 );
+
+    const std::string fieldSize = " (" + std::to_string( maximumDegree ) + "x" + std::to_string( maximumDegree ) + ")";
+    for( unsigned int i = 0; i < evaluationMethods.size( ); i++ )
+    {
+        std::string methodName;
+        switch( evaluationMethods.at( i ) )
+        {
+        case gravitation::term_by_term_evaluation:
+            methodName = "term-by-term";
+            break;
+        case gravitation::order_major_vectorized_evaluation:
+            methodName = "per order";
+            break;
+        case gravitation::cunningham_recursive_evaluation:
+            methodName = "Cunningham";
+            break;
+        }
+        benchmarkSuite.addBenchmark(
+                    "Spherical harmonic acceleration, " + methodName + fieldSize,
+                    boost::bind( &evaluateSphericalHarmonicAcceleration, evaluationMethods.at( i ),
+                                 positions, cosineCoefficients, sineCoefficients, sphericalHarmonicsCache,
+                                 recursionCache ), positions.size( ) );
+    }
+}
+
+//! Function to interpolate a state history at a list of times.
+void evaluateLagrangeInterpolator(
+        const boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > interpolator,
+        const std::vector< double >& interpolationTimes )
+{
+    for( unsigned int i = 0; i < interpolationTimes.size( ); i++ )
+    {
+        consumeBenchmarkOutput( interpolator->interpolate( interpolationTimes[ i ] )( 0 ) );
+    }
+}
+
+//! Function to convert a list of mean anomalies to eccentric anomalies.
+void evaluateMeanToEccentricAnomalyConversion( const std::vector< double >& eccentricities,
+                                               const std::vector< double >& meanAnomalies )
+{
+    for( unsigned int i = 0; i < meanAnomalies.size( ); i++ )
+    {
+        consumeBenchmarkOutput( orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                                    eccentricities[ i ], meanAnomalies[ i ] ) );
+    }
+}
+
+//! Function to compute the light time for a list of reception times.
+void evaluateLightTimeCalculator(
+        const boost::shared_ptr< observation_models::LightTimeCalculator< double, double > > lightTimeCalculator,
+        const std::vector< double >& receptionTimes )
+{
+    for( unsigned int i = 0; i < receptionTimes.size( ); i++ )
+    {
+        consumeBenchmarkOutput( lightTimeCalculator->calculateLightTime( receptionTimes[ i ], true ) );
+    }
+}
+
+//! Function to compute the state derivative of a Keplerian orbit around the Earth.
+template< typename StateType >
+StateType computeKeplerStateDerivative( const double time, const StateType& state )
+{
+    StateType stateDerivative = state;
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -earthGravitationalParameter * state.segment( 0, 3 ) /
+            std::pow( state.segment( 0, 3 ).norm( ), 3 );
+    return stateDerivative;
+}
+
+//! Function to integrate one day of a Keplerian orbit around the Earth with the given integrator settings.
+template< typename StateType >
+void integrateKeplerOrbit(
+        const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const StateType& initialState )
+{
+    boost::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
+            numerical_integrators::createIntegrator< double, StateType >(
+                boost::bind( &computeKeplerStateDerivative< StateType >, _1, _2 ), initialState, integratorSettings );
+    consumeBenchmarkOutput( integrator->integrateTo( 86400.0, integratorSettings->initialTimeStep_ )( 0 ) );
+}
+
+//! Function to count the number of state derivative evaluations when integrating one day of a Keplerian orbit.
+template< typename StateType >
+long long getNumberOfKeplerStateDerivativeEvaluations(
+        const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const StateType& initialState )
+{
+    long long numberOfEvaluations = 0;
+    boost::function< StateType( const double, const StateType& ) > countingStateDerivativeFunction =
+            [ &numberOfEvaluations ]( const double time, const StateType& state )
+    {
+        numberOfEvaluations++;
+        return computeKeplerStateDerivative< StateType >( time, state );
+    };
+
+    boost::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
+            numerical_integrators::createIntegrator< double, StateType >(
+                countingStateDerivativeFunction, initialState, integratorSettings );
+    integrator->integrateTo( 86400.0, integratorSettings->initialTimeStep_ );
+    return numberOfEvaluations;
+}
+
+//! Function to add the benchmark of a numerical integrator to a suite, timed per state derivative evaluation.
+template< typename StateType >
+void addIntegratorBenchmark(
+        BenchmarkSuite& benchmarkSuite, const std::string& name,
+        const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const StateType& initialState )
+{
+    benchmarkSuite.addBenchmark(
+                name, boost::bind( &integrateKeplerOrbit< StateType >, integratorSettings, initialState ),
+                getNumberOfKeplerStateDerivativeEvaluations( integratorSettings, initialState ) );
+}
+
+//! Function to perform a number of Runge-Kutta integration steps with a constant step size.
+void performRungeKuttaIntegrationSteps(
+        const numerical_integrators::RungeKuttaVariableStepSizeIntegratorXdPointer integrator,
+        const int numberOfSteps )
+{
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        consumeBenchmarkOutput( integrator->performIntegrationStep( 1.0 )( 0 ) );
+    }
+}
+
+//! Function to add the benchmarks of the fixed-size and generic Runge-Kutta integrators for a coefficient set.
+void addFixedSizeRungeKuttaIntegratorBenchmarks(
+        BenchmarkSuite& benchmarkSuite, const std::string& name,
+        const numerical_integrators::RungeKuttaCoefficients::CoefficientSets coefficientSet,
+        const Eigen::VectorXd& initialState )
+{
+    using namespace tudat::numerical_integrators;
+
+    // Step size control is switched off, so that both integrators take identical steps.
+    RungeKuttaVariableStepSizeIntegratorXdPointer fixedSizeIntegrator =
+            createFixedSizeRungeKuttaVariableStepSizeIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double >(
+                coefficientSet, boost::bind( &computeKeplerStateDerivative< Eigen::VectorXd >, _1, _2 ), 0.0,
+                initialState, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12, 0.8, 4.0, 0.1 );
+    fixedSizeIntegrator->setStepSizeControl( false );
+    RungeKuttaVariableStepSizeIntegratorXdPointer genericIntegrator =
+            boost::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                RungeKuttaCoefficients::get( coefficientSet ),
+                boost::bind( &computeKeplerStateDerivative< Eigen::VectorXd >, _1, _2 ), 0.0,
+                initialState, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12, 0.8, 4.0, 0.1 );
+    genericIntegrator->setStepSizeControl( false );
+
+    const int numberOfSteps = numberOfKernelEvaluations;
+    benchmarkSuite.addBenchmark(
+                name + " step (fixed-size, 6 states)",
+                boost::bind( &performRungeKuttaIntegrationSteps, fixedSizeIntegrator, numberOfSteps ), numberOfSteps );
+    benchmarkSuite.addBenchmark(
+                name + " step (generic, 6 states)",
+                boost::bind( &performRungeKuttaIntegrationSteps, genericIntegrator, numberOfSteps ), numberOfSteps );
+}
+
+//! Execute benchmarks of numerical kernels.
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat::numerical_integrators;
+
+    BenchmarkSuite benchmarkSuite( "numerical_kernels", argc, argv );
+
+    std::mt19937 randomNumberGenerator( benchmarkSeed );
+    std::uniform_real_distribution< double > unitDistribution( 0.0, 1.0 );
+
+    // Benchmark Legendre polynomial (and derivative) computation up to degree and order 100.
+    {
+        std::vector< double > polynomialParameters;
+        for( int i = 0; i < numberOfKernelEvaluations / 10; i++ )
+        {
+            polynomialParameters.push_back( 2.0 * unitDistribution( randomNumberGenerator ) - 1.0 );
+        }
+        boost::shared_ptr< basic_mathematics::LegendreCache > legendreCache =
+                boost::make_shared< basic_mathematics::LegendreCache >( 100, 100 );
+        benchmarkSuite.addBenchmark(
+                    "LegendreCache::update (100x100)",
+                    boost::bind( &evaluateLegendreCache, legendreCache, polynomialParameters ),
+                    polynomialParameters.size( ) );
+    }
+
+    // Benchmark spherical harmonic acceleration of 100x100 field, with Kaula-rule coefficients, at LEO positions.
+    addSphericalHarmonicAccelerationBenchmarks(
+                benchmarkSuite, randomNumberGenerator, 100,
+                { gravitation::term_by_term_evaluation, gravitation::order_major_vectorized_evaluation,
+                  gravitation::cunningham_recursive_evaluation } );
+
+    // Benchmark 8-point Lagrange interpolation of a Keplerian state history, at random times.
+    {
+        std::map< double, Eigen::Vector6d > stateHistory;
+        const Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    ( Eigen::Vector6d( ) << 7000.0E3, 0.01, 1.0, 0.5, 0.5, 0.0 ).finished( ),
+                    earthGravitationalParameter );
+        ephemerides::KeplerEphemeris keplerEphemeris(
+                    orbital_element_conversions::convertCartesianToKeplerianElements(
+                        initialState, earthGravitationalParameter ), 0.0, earthGravitationalParameter );
+        for( int i = 0; i <= 8640; i++ )
+        {
+            stateHistory[ 10.0 * i ] = keplerEphemeris.getCartesianState( 10.0 * i );
+        }
+
+        std::vector< double > interpolationTimes;
+        for( int i = 0; i < numberOfKernelEvaluations; i++ )
+        {
+            interpolationTimes.push_back( 86400.0 * unitDistribution( randomNumberGenerator ) );
+        }
+
+        boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > interpolator =
+                boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                    stateHistory, 8 );
+        benchmarkSuite.addBenchmark(
+                    "LagrangeInterpolator::interpolate (8 points)",
+                    boost::bind( &evaluateLagrangeInterpolator, interpolator, interpolationTimes ),
+                    numberOfKernelEvaluations );
+    }
+
+    // Benchmark conversion from mean to eccentric anomaly, for eccentricities up to 0.9.
+    {
+        std::vector< double > eccentricities;
+        std::vector< double > meanAnomalies;
+        for( int i = 0; i < numberOfKernelEvaluations; i++ )
+        {
+            eccentricities.push_back( 0.9 * unitDistribution( randomNumberGenerator ) );
+            meanAnomalies.push_back( 2.0 * mathematical_constants::PI * unitDistribution( randomNumberGenerator ) );
+        }
+        benchmarkSuite.addBenchmark(
+                    "convertMeanAnomalyToEccentricAnomaly",
+                    boost::bind( &evaluateMeanToEccentricAnomalyConversion, eccentricities, meanAnomalies ),
+                    numberOfKernelEvaluations );
+    }
+
+    // Benchmark light-time computation between Keplerian (Earth- and Mars-like) orbits around the Sun.
+    {
+        const double sunGravitationalParameter = 1.32712440018E20;
+        boost::shared_ptr< ephemerides::KeplerEphemeris > transmitterEphemeris =
+                boost::make_shared< ephemerides::KeplerEphemeris >(
+                    ( Eigen::Vector6d( ) << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.1 ).finished( ), 0.0,
+                    sunGravitationalParameter );
+        boost::shared_ptr< ephemerides::KeplerEphemeris > receiverEphemeris =
+                boost::make_shared< ephemerides::KeplerEphemeris >(
+                    ( Eigen::Vector6d( ) << 2.279E11, 0.0934, 0.032, 5.0, 0.86, 2.0 ).finished( ), 0.0,
+                    sunGravitationalParameter );
+
+        boost::shared_ptr< observation_models::LightTimeCalculator< double, double > > lightTimeCalculator =
+                boost::make_shared< observation_models::LightTimeCalculator< double, double > >(
+                    boost::bind( &ephemerides::Ephemeris::getCartesianState, transmitterEphemeris, _1 ),
+                    boost::bind( &ephemerides::Ephemeris::getCartesianState, receiverEphemeris, _1 ) );
+
+        std::vector< double > receptionTimes;
+        for( int i = 0; i < numberOfKernelEvaluations / 10; i++ )
+        {
+            receptionTimes.push_back( 1.0E8 * unitDistribution( randomNumberGenerator ) );
+        }
+        benchmarkSuite.addBenchmark(
+                    "LightTimeCalculator::calculateLightTime (Kepler ephemerides)",
+                    boost::bind( &evaluateLightTimeCalculator, lightTimeCalculator, receptionTimes ),
+                    receptionTimes.size( ) );
+    }
+
+    // Benchmark numerical integrators, integrating one day of an eccentric Earth orbit. Timings are per state
+    // derivative evaluation, so that the integrator overhead can be compared.
+    {
+        const Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    ( Eigen::Vector6d( ) << 8000.0E3, 0.1, 1.0, 0.5, 0.5, 0.0 ).finished( ),
+                    earthGravitationalParameter );
+        const Eigen::VectorXd initialDynamicState = initialState;
+
+        addIntegratorBenchmark(
+                    benchmarkSuite, "RK4 integrator (10 s step)",
+                    boost::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ),
+                    initialDynamicState );
+        addIntegratorBenchmark(
+                    benchmarkSuite, "RKF7(8) integrator (Eigen::VectorXd)",
+                    boost::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                        rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                        1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 ), initialDynamicState );
+        addIntegratorBenchmark(
+                    benchmarkSuite, "RKF7(8) integrator (Eigen::Vector6d)",
+                    boost::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                        rungeKuttaVariableStepSize, 0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                        1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 ), initialState );
+        addIntegratorBenchmark(
+                    benchmarkSuite, "Bulirsch-Stoer integrator",
+                    boost::make_shared< BulirschStoerIntegratorSettings< double > >(
+                        0.0, 10.0, bulirsch_stoer_sequence, 6, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 ),
+                    initialDynamicState );
+        addIntegratorBenchmark(
+                    benchmarkSuite, "Adams-Bashforth-Moulton integrator",
+                    boost::make_shared< AdamsBashforthMoultonSettings< double > >(
+                        0.0, 10.0, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 ), initialDynamicState );
+
+        // Compare fixed-size Runge-Kutta integrators to the generic integrator, timed per (constant-size) step.
+        addFixedSizeRungeKuttaIntegratorBenchmarks(
+                    benchmarkSuite, "RKF4(5)", RungeKuttaCoefficients::rungeKuttaFehlberg45, initialDynamicState );
+        addFixedSizeRungeKuttaIntegratorBenchmarks(
+                    benchmarkSuite, "RKF5(6)", RungeKuttaCoefficients::rungeKuttaFehlberg56, initialDynamicState );
+        addFixedSizeRungeKuttaIntegratorBenchmarks(
+                    benchmarkSuite, "RKF7(8)", RungeKuttaCoefficients::rungeKuttaFehlberg78, initialDynamicState );
+        addFixedSizeRungeKuttaIntegratorBenchmarks(
+                    benchmarkSuite, "DP8(7)", RungeKuttaCoefficients::rungeKutta87DormandPrince, initialDynamicState );
+    }
+
+    // Benchmark spherical harmonic acceleration of a high-degree (200x200) field.
+    addSphericalHarmonicAccelerationBenchmarks(
+                benchmarkSuite, randomNumberGenerator, 200,
+                { gravitation::term_by_term_evaluation, gravitation::order_major_vectorized_evaluation,
+                  gravitation::cunningham_recursive_evaluation } );
+
+    benchmarkSuite.writeResults( );
+
+    return EXIT_SUCCESS;
+}
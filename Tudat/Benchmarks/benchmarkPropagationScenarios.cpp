@@ -0,0 +1,492 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmarks of complete propagation and estimation scenarios. The environment and simulation objects are created
+ *      once, outside of the timed region, so that the timings represent the throughput of the propagation (or
+ *      estimation) itself. All scenarios start at a fixed epoch, from fixed initial conditions, with fixed step or
+ *      tightly controlled integrators, so that timings are reproducible between runs and releases.
+ *      Usage: benchmark_PropagationScenarios [outputFile] [numberOfRepetitions]
+ *
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGroundStations.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+
+using namespace tudat;
+using namespace tudat::benchmarks;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+
+//! Epoch at which all scenarios start.
+const double scenarioStartEpoch = 1.0E7;
+
+//! Function to add a vehicle with constant drag and radiation pressure properties to a body map.
+void addBenchmarkVehicle( NamedBodyMap& bodyMap, const std::string& centralBody )
+{
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 400.0 );
+
+    bodyMap[ "Vehicle" ]->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    boost::make_shared< ConstantAerodynamicCoefficientSettings >(
+                        4.0, ( Eigen::Vector3d( ) << 1.2, 0.0, 0.0 ).finished( ), 1, 1 ), "Vehicle" ) );
+
+    std::vector< std::string > occultingBodies;
+    occultingBodies.push_back( "Earth" );
+    bodyMap[ "Vehicle" ]->setRadiationPressureInterface(
+                "Sun", createRadiationPressureInterface(
+                    boost::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                        "Sun", 4.0, 1.2, occultingBodies ), "Vehicle", bodyMap ) );
+
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), centralBody, "ECLIPJ2000" ) );
+}
+
+//! Function to create the initial state of a low Earth orbiter.
+Eigen::Vector6d getLowEarthOrbiterInitialState( const NamedBodyMap& bodyMap )
+{
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements( semiMajorAxisIndex ) = 6378.0E3 + 350.0E3;
+    initialStateInKeplerianElements( eccentricityIndex ) = 0.001;
+    initialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 87.0 );
+    initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 30.0 );
+    initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 60.0 );
+    initialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 0.0 );
+
+    return convertKeplerianToCartesianElements(
+                initialStateInKeplerianElements,
+                bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+}
+
+//! Propagation scenario that is to be benchmarked, with the objects needed to re-run the propagation.
+struct PropagationScenario
+{
+    //! Body map used in the propagation (retained, since the simulator only stores its dependencies).
+    NamedBodyMap bodyMap_;
+
+    //! Dynamics simulator used to re-run the propagation.
+    boost::shared_ptr< SingleArcDynamicsSimulator< double, double > > dynamicsSimulator_;
+
+    //! Initial state of the propagation.
+    Eigen::VectorXd initialState_;
+};
+
+//! Function to run the propagation of a scenario.
+void propagateScenario( const boost::shared_ptr< PropagationScenario > scenario )
+{
+    scenario->dynamicsSimulator_->integrateEquationsOfMotion( scenario->initialState_ );
+    consumeBenchmarkOutput( scenario->dynamicsSimulator_->getEquationsOfMotionNumericalSolution( ).rbegin( )->second( 0 ) );
+}
+
+//! Function to retrieve the number of state derivative evaluations in a single propagation of a scenario.
+long long getNumberOfScenarioStateDerivativeEvaluations( const boost::shared_ptr< PropagationScenario > scenario )
+{
+    propagateScenario( scenario );
+    return scenario->dynamicsSimulator_->getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+}
+
+//! Function to create the scenario of a 1 day propagation of a low Earth orbiter, with 100x100 gravity field and drag.
+boost::shared_ptr< PropagationScenario > createLowEarthOrbiterScenario( )
+{
+    boost::shared_ptr< PropagationScenario > scenario = boost::make_shared< PropagationScenario >( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, scenarioStartEpoch - 3600.0, scenarioStartEpoch + 86400.0 + 3600.0 );
+    scenario->bodyMap_ = createBodies( bodySettings );
+    addBenchmarkVehicle( scenario->bodyMap_, "Earth" );
+    setGlobalFrameBodyEphemerides( scenario->bodyMap_, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< boost::shared_ptr< AccelerationSettings > > > accelerationsOfVehicle;
+    accelerationsOfVehicle[ "Earth" ].push_back( boost::make_shared< SphericalHarmonicAccelerationSettings >( 100, 100 ) );
+    accelerationsOfVehicle[ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( aerodynamic ) );
+    accelerationsOfVehicle[ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationsOfVehicle[ "Moon" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ] = accelerationsOfVehicle;
+
+    std::vector< std::string > bodiesToPropagate;
+    bodiesToPropagate.push_back( "Vehicle" );
+    std::vector< std::string > centralBodies;
+    centralBodies.push_back( "Earth" );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                scenario->bodyMap_, accelerationMap, bodiesToPropagate, centralBodies );
+
+    scenario->initialState_ = getLowEarthOrbiterInitialState( scenario->bodyMap_ );
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, scenario->initialState_,
+                scenarioStartEpoch + 86400.0 );
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, scenarioStartEpoch, 10.0 );
+
+    scenario->dynamicsSimulator_ = boost::make_shared< SingleArcDynamicsSimulator< double, double > >(
+                scenario->bodyMap_, integratorSettings, propagatorSettings, false, false, false );
+    return scenario;
+}
+
+//! Function to create the scenario of a 200 day heliocentric cruise, with planetary perturbations and radiation pressure.
+boost::shared_ptr< PropagationScenario > createInterplanetaryCruiseScenario( )
+{
+    boost::shared_ptr< PropagationScenario > scenario = boost::make_shared< PropagationScenario >( );
+    const double cruiseDuration = 200.0 * physical_constants::JULIAN_DAY;
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Venus" );
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+    bodyNames.push_back( "Mars" );
+    bodyNames.push_back( "Jupiter" );
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, scenarioStartEpoch - 86400.0, scenarioStartEpoch + cruiseDuration + 86400.0 );
+    scenario->bodyMap_ = createBodies( bodySettings );
+    addBenchmarkVehicle( scenario->bodyMap_, "Sun" );
+    setGlobalFrameBodyEphemerides( scenario->bodyMap_, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< boost::shared_ptr< AccelerationSettings > > > accelerationsOfVehicle;
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        accelerationsOfVehicle[ bodyNames.at( i ) ].push_back(
+                    boost::make_shared< AccelerationSettings >( central_gravity ) );
+    }
+    accelerationsOfVehicle[ "Sun" ].push_back( boost::make_shared< AccelerationSettings >(
+                                                   cannon_ball_radiation_pressure ) );
+    accelerationMap[ "Vehicle" ] = accelerationsOfVehicle;
+
+    std::vector< std::string > bodiesToPropagate;
+    bodiesToPropagate.push_back( "Vehicle" );
+    std::vector< std::string > centralBodies;
+    centralBodies.push_back( "Sun" );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                scenario->bodyMap_, accelerationMap, bodiesToPropagate, centralBodies );
+
+    // Start outside the sphere of influence of the Earth, with a velocity increment of 3 km/s along the Earth's velocity
+    Eigen::Vector6d earthState = scenario->bodyMap_.at( "Earth" )->getStateInBaseFrameFromEphemeris( scenarioStartEpoch ) -
+            scenario->bodyMap_.at( "Sun" )->getStateInBaseFrameFromEphemeris( scenarioStartEpoch );
+    Eigen::Vector6d initialState = earthState;
+    initialState.segment( 0, 3 ) += 2.0E9 * earthState.segment( 3, 3 ).normalized( );
+    initialState.segment( 3, 3 ) += 3.0E3 * earthState.segment( 3, 3 ).normalized( );
+    scenario->initialState_ = initialState;
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, scenario->initialState_,
+                scenarioStartEpoch + cruiseDuration );
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                rungeKuttaVariableStepSize, scenarioStartEpoch, 3600.0,
+                RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0, 10.0 * 86400.0, 1.0E-12, 1.0E-12 );
+
+    scenario->dynamicsSimulator_ = boost::make_shared< SingleArcDynamicsSimulator< double, double > >(
+                scenario->bodyMap_, integratorSettings, propagatorSettings, false, false, false );
+    return scenario;
+}
+
+//! Multi-arc propagation scenario that is to be benchmarked, with the objects needed to re-run the propagation.
+struct MultiArcPropagationScenario
+{
+    //! Body map used by the dynamics simulator, in which the integrated results are set.
+    NamedBodyMap bodyMap_;
+
+    //! Body maps used for the propagation of the individual arcs.
+    std::vector< NamedBodyMap > arcBodyMaps_;
+
+    //! Dynamics simulator used to re-run the propagation.
+    boost::shared_ptr< MultiArcDynamicsSimulator< double, double > > dynamicsSimulator_;
+
+    //! Initial states of the arcs.
+    std::vector< Eigen::VectorXd > initialStates_;
+};
+
+//! Function to run the propagation of a multi-arc scenario.
+void propagateMultiArcScenario( const boost::shared_ptr< MultiArcPropagationScenario > scenario )
+{
+    scenario->dynamicsSimulator_->integrateEquationsOfMotion( scenario->initialStates_ );
+    consumeBenchmarkOutput(
+                scenario->dynamicsSimulator_->getEquationsOfMotionNumericalSolution( ).back( ).rbegin( )->second( 0 ) );
+}
+
+//! Function to create the bodies used in the multi-arc scenario, with all ephemerides tabulated.
+NamedBodyMap createMultiArcScenarioBodies( const double initialTime, const double finalTime )
+{
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialTime, finalTime );
+    boost::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings[ "Moon" ]->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings[ "Earth" ]->ephemerisSettings = boost::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    return bodyMap;
+}
+
+//! Function to create the scenario of a multi-arc propagation of the Moon, with 10 arcs of about 11.6 days.
+/*!
+ *  Function to create the scenario of a multi-arc propagation of the Moon, with 10 arcs of about 11.6 days (RK4, with
+ *  120 s time step), where each arc uses its own body map, so that the arcs can be propagated concurrently.
+ *  \param numberOfThreads Number of threads on which the arcs are propagated.
+ *  \return Multi-arc propagation scenario.
+ */
+boost::shared_ptr< MultiArcPropagationScenario > createMultiArcScenario( const unsigned int numberOfThreads )
+{
+    boost::shared_ptr< MultiArcPropagationScenario > scenario = boost::make_shared< MultiArcPropagationScenario >( );
+    const double scenarioEndEpoch = scenarioStartEpoch + 1.0E7;
+
+    // Define overlapping arcs.
+    std::vector< double > arcStartTimes, arcEndTimes;
+    const double arcDuration = 1.0E6;
+    const double arcOverlap = 1.0E4;
+    double currentStartTime = scenarioStartEpoch + 1.0E4;
+    while( currentStartTime + arcDuration < scenarioEndEpoch - 1.0E4 )
+    {
+        arcStartTimes.push_back( currentStartTime );
+        arcEndTimes.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration - arcOverlap;
+    }
+
+    scenario->bodyMap_ = createMultiArcScenarioBodies( scenarioStartEpoch - 3600.0, scenarioEndEpoch + 3600.0 );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    std::vector< std::string > bodiesToPropagate;
+    bodiesToPropagate.push_back( "Moon" );
+    std::vector< std::string > centralBodies;
+    centralBodies.push_back( "SSB" );
+
+    std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagatorSettings;
+    for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+    {
+        scenario->arcBodyMaps_.push_back(
+                    createMultiArcScenarioBodies( scenarioStartEpoch - 3600.0, scenarioEndEpoch + 3600.0 ) );
+        scenario->initialStates_.push_back( spice_interface::getBodyCartesianStateAtEpoch(
+                                                "Moon", "Earth", "ECLIPJ2000", "NONE", arcStartTimes.at( i ) ) );
+        arcPropagatorSettings.push_back(
+                    boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, createAccelerationModelsMap(
+                            scenario->arcBodyMaps_.at( i ), accelerationMap, bodiesToPropagate, centralBodies ),
+                        bodiesToPropagate, scenario->initialStates_.at( i ), arcEndTimes.at( i ) ) );
+    }
+    boost::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< MultiArcPropagatorSettings< double > >( arcPropagatorSettings );
+    propagatorSettings->setParallelArcPropagation( numberOfThreads, scenario->arcBodyMaps_ );
+
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, scenarioStartEpoch, 120.0 );
+
+    scenario->dynamicsSimulator_ = boost::make_shared< MultiArcDynamicsSimulator< double, double > >(
+                scenario->bodyMap_, integratorSettings, propagatorSettings, arcStartTimes, false, false );
+    return scenario;
+}
+
+//! Estimation scenario that is to be benchmarked, with the objects needed to re-run the estimation.
+struct EstimationScenario
+{
+    //! Body map used in the estimation.
+    NamedBodyMap bodyMap_;
+
+    //! Orbit determination manager used to re-run the estimation.
+    boost::shared_ptr< OrbitDeterminationManager< double, double > > orbitDeterminationManager_;
+
+    //! Input (observations and settings) of the estimation.
+    boost::shared_ptr< PodInput< double, double > > podInput_;
+};
+
+//! Function to run the estimation of a scenario, with two iterations.
+void estimateScenario( const boost::shared_ptr< EstimationScenario > scenario )
+{
+    boost::shared_ptr< PodOutput< double > > podOutput = scenario->orbitDeterminationManager_->estimateParameters(
+                scenario->podInput_, boost::make_shared< EstimationConvergenceChecker >( 2, 0.0, 0.0, 10 ) );
+    consumeBenchmarkOutput( podOutput->parameterEstimate_( 0 ) );
+}
+
+//! Function to create the scenario of an estimation of a low Earth orbiter from 1 day of one-way Doppler data.
+boost::shared_ptr< EstimationScenario > createDopplerOrbitDeterminationScenario( )
+{
+    boost::shared_ptr< EstimationScenario > scenario = boost::make_shared< EstimationScenario >( );
+    const double scenarioEndEpoch = scenarioStartEpoch + 86400.0;
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, scenarioStartEpoch - 3600.0, scenarioEndEpoch + 3600.0 );
+    scenario->bodyMap_ = createBodies( bodySettings );
+    addBenchmarkVehicle( scenario->bodyMap_, "Earth" );
+    setGlobalFrameBodyEphemerides( scenario->bodyMap_, "SSB", "ECLIPJ2000" );
+
+    std::vector< std::string > groundStationNames;
+    groundStationNames.push_back( "Station1" );
+    groundStationNames.push_back( "Station2" );
+    createGroundStation( scenario->bodyMap_.at( "Earth" ), "Station1",
+                         ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), coordinate_conversions::geodetic_position );
+    createGroundStation( scenario->bodyMap_.at( "Earth" ), "Station2",
+                         ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), coordinate_conversions::geodetic_position );
+
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< boost::shared_ptr< AccelerationSettings > > > accelerationsOfVehicle;
+    accelerationsOfVehicle[ "Earth" ].push_back( boost::make_shared< SphericalHarmonicAccelerationSettings >( 20, 20 ) );
+    accelerationsOfVehicle[ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( aerodynamic ) );
+    accelerationsOfVehicle[ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationsOfVehicle[ "Moon" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ] = accelerationsOfVehicle;
+
+    std::vector< std::string > bodiesToPropagate;
+    bodiesToPropagate.push_back( "Vehicle" );
+    std::vector< std::string > centralBodies;
+    centralBodies.push_back( "Earth" );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                scenario->bodyMap_, accelerationMap, bodiesToPropagate, centralBodies );
+
+    const Eigen::Vector6d initialState = getLowEarthOrbiterInitialState( scenario->bodyMap_ );
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, scenarioEndEpoch );
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, scenarioStartEpoch, 30.0 );
+
+    // Estimate initial state and drag coefficient.
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialState, "Earth" ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >(
+                                  "Vehicle", constant_drag_coefficient ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, scenario->bodyMap_ );
+
+    // Define one-way Doppler links from the vehicle to each ground station.
+    ObservationSettingsMap observationSettingsMap;
+    std::vector< LinkEnds > linkEndsList;
+    for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = std::make_pair( "Vehicle", "" );
+        linkEnds[ receiver ] = std::make_pair( "Earth", groundStationNames.at( i ) );
+        linkEndsList.push_back( linkEnds );
+        observationSettingsMap.insert( std::make_pair( linkEnds, boost::make_shared< ObservationSettings >(
+                                                           one_way_doppler ) ) );
+    }
+
+    scenario->orbitDeterminationManager_ =
+            boost::make_shared< OrbitDeterminationManager< double, double > >(
+                scenario->bodyMap_, parametersToEstimate, observationSettingsMap, integratorSettings,
+                propagatorSettings );
+
+    // Simulate Doppler observations every 60 s for both links.
+    std::vector< double > observationTimes;
+    for( double observationTime = scenarioStartEpoch + 600.0; observationTime < scenarioEndEpoch - 600.0;
+         observationTime += 60.0 )
+    {
+        observationTimes.push_back( observationTime );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    for( unsigned int i = 0; i < linkEndsList.size( ); i++ )
+    {
+        measurementSimulationInput[ one_way_doppler ][ linkEndsList.at( i ) ] =
+                std::make_pair( observationTimes, receiver );
+    }
+
+    typedef std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::VectorXd,
+            std::pair< std::vector< double >, LinkEndType > > > > PodInputDataType;
+    PodInputDataType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, scenario->orbitDeterminationManager_->getObservationSimulators( ) );
+
+    const int numberOfParameters = parametersToEstimate->getEstimatedParameterSetSize( );
+    scenario->podInput_ = boost::make_shared< PodInput< double, double > >(
+                observationsAndTimes, numberOfParameters,
+                Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ),
+                Eigen::VectorXd::Zero( numberOfParameters ) );
+    scenario->podInput_->setConstantWeightsMatrix( 1.0 / ( 1.0E-12 * 1.0E-12 ) );
+    scenario->podInput_->defineEstimationSettings( true, true, false, false, false );
+
+    return scenario;
+}
+
+//! Execute benchmarks of propagation and estimation scenarios.
+int main( int argc, char* argv[ ] )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    BenchmarkSuite benchmarkSuite( "propagation_scenarios", argc, argv, 3 );
+
+    // Timings of propagations are per state derivative evaluation, and of the estimation per observation.
+    boost::shared_ptr< PropagationScenario > lowEarthOrbiterScenario = createLowEarthOrbiterScenario( );
+    benchmarkSuite.addBenchmark(
+                "LEO, 1 day, 100x100 gravity field and drag (RK4)",
+                boost::bind( &propagateScenario, lowEarthOrbiterScenario ),
+                getNumberOfScenarioStateDerivativeEvaluations( lowEarthOrbiterScenario ) );
+
+    boost::shared_ptr< PropagationScenario > interplanetaryCruiseScenario = createInterplanetaryCruiseScenario( );
+    benchmarkSuite.addBenchmark(
+                "Interplanetary cruise, 200 days, planetary perturbations (RKF7(8))",
+                boost::bind( &propagateScenario, interplanetaryCruiseScenario ),
+                getNumberOfScenarioStateDerivativeEvaluations( interplanetaryCruiseScenario ) );
+
+    // Timings of multi-arc propagations are per arc, for sequential and concurrent propagation of the arcs.
+    const unsigned int numberOfHardwareThreads = std::max( std::thread::hardware_concurrency( ), 1u );
+    boost::shared_ptr< MultiArcPropagationScenario > sequentialMultiArcScenario = createMultiArcScenario( 1 );
+    benchmarkSuite.addBenchmark(
+                "Multi-arc Moon propagation, 10 arcs, central gravity (RK4), 1 thread",
+                boost::bind( &propagateMultiArcScenario, sequentialMultiArcScenario ),
+                sequentialMultiArcScenario->initialStates_.size( ) );
+
+    boost::shared_ptr< MultiArcPropagationScenario > concurrentMultiArcScenario =
+            createMultiArcScenario( numberOfHardwareThreads );
+    benchmarkSuite.addBenchmark(
+                "Multi-arc Moon propagation, 10 arcs, central gravity (RK4), " +
+                std::to_string( numberOfHardwareThreads ) + " threads",
+                boost::bind( &propagateMultiArcScenario, concurrentMultiArcScenario ),
+                concurrentMultiArcScenario->initialStates_.size( ) );
+
+    boost::shared_ptr< EstimationScenario > dopplerOrbitDeterminationScenario =
+            createDopplerOrbitDeterminationScenario( );
+    benchmarkSuite.addBenchmark(
+                "LEO orbit determination, 1 day of one-way Doppler (2 iterations)",
+                boost::bind( &estimateScenario, dopplerOrbitDeterminationScenario ),
+                OrbitDeterminationManager< double, double >::getNumberOfObservationsPerObservable(
+                    dopplerOrbitDeterminationScenario->podInput_->getObservationsAndTimes( ) ).second );
+
+    benchmarkSuite.writeResults( );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <stdexcept>
+
+#include "Tudat/tudatVersion.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Variable in which benchmarked values are accumulated, to prevent the compiler from optimizing them away.
+volatile double benchmarkOutputSink = 0.0;
+
+//! Constructor
+BenchmarkResult::BenchmarkResult( const std::string& name,
+                                  const long long numberOfEvaluationsPerRepetition,
+                                  const std::vector< double >& repetitionTimes ):
+    name_( name ), numberOfEvaluationsPerRepetition_( numberOfEvaluationsPerRepetition ),
+    repetitionTimes_( repetitionTimes )
+{
+    if( repetitionTimes_.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating result of benchmark " + name + ", no repetitions provided." );
+    }
+
+    std::vector< double > sortedTimes = repetitionTimes_;
+    std::sort( sortedTimes.begin( ), sortedTimes.end( ) );
+
+    const unsigned int numberOfTimes = sortedTimes.size( );
+    minimumTime_ = sortedTimes.front( );
+    medianTime_ = ( numberOfTimes % 2 == 1 ) ? sortedTimes.at( numberOfTimes / 2 ) :
+                                               0.5 * ( sortedTimes.at( numberOfTimes / 2 - 1 ) +
+                                                       sortedTimes.at( numberOfTimes / 2 ) );
+    meanTime_ = std::accumulate( sortedTimes.begin( ), sortedTimes.end( ), 0.0 ) /
+            static_cast< double >( numberOfTimes );
+}
+
+//! Function to time a benchmark.
+BenchmarkResult runBenchmark( const std::string& name,
+                              const boost::function< void( ) >& benchmarkFunction,
+                              const long long numberOfEvaluationsPerRepetition,
+                              const int numberOfRepetitions,
+                              const int numberOfWarmUpRepetitions )
+{
+    if( numberOfRepetitions < 1 )
+    {
+        throw std::runtime_error( "Error when running benchmark " + name + ", number of repetitions must be positive." );
+    }
+
+    for( int i = 0; i < numberOfWarmUpRepetitions; i++ )
+    {
+        benchmarkFunction( );
+    }
+
+    std::vector< double > repetitionTimes;
+    for( int i = 0; i < numberOfRepetitions; i++ )
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        benchmarkFunction( );
+        repetitionTimes.push_back(
+                    std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( ) );
+    }
+
+    return BenchmarkResult( name, numberOfEvaluationsPerRepetition, repetitionTimes );
+}
+
+//! Function to prevent the compiler from optimizing away the computation of a benchmarked value.
+void consumeBenchmarkOutput( const double value )
+{
+    benchmarkOutputSink = benchmarkOutputSink + value;
+}
+
+//! Constructor, parses the command line arguments of a benchmark program.
+BenchmarkSuite::BenchmarkSuite( const std::string& suiteName, int argc, char* argv[ ],
+                                const int defaultNumberOfRepetitions ):
+    suiteName_( suiteName ), outputFile_( suiteName + ".json" ), numberOfRepetitions_( defaultNumberOfRepetitions )
+{
+    if( argc > 1 )
+    {
+        outputFile_ = argv[ 1 ];
+    }
+
+    if( argc > 2 )
+    {
+        numberOfRepetitions_ = std::stoi( argv[ 2 ] );
+        if( numberOfRepetitions_ < 1 )
+        {
+            throw std::runtime_error( "Error when parsing arguments of benchmark suite " + suiteName +
+                                      ", number of repetitions must be positive." );
+        }
+    }
+
+    std::cout << "Running benchmark suite " << suiteName_ << " (" << numberOfRepetitions_ << " repetitions)"
+              << std::endl;
+    std::cout << std::left << std::setw( 64 ) << "Benchmark" << std::right << std::setw( 14 ) << "Median [s]"
+              << std::setw( 14 ) << "Minimum [s]" << std::setw( 16 ) << "Evaluations/s" << std::endl;
+}
+
+//! Function to time a benchmark, and add its result to the suite.
+void BenchmarkSuite::addBenchmark( const std::string& name,
+                                   const boost::function< void( ) >& benchmarkFunction,
+                                   const long long numberOfEvaluationsPerRepetition,
+                                   const double repetitionScaling )
+{
+    const int numberOfRepetitions =
+            std::max( 1, static_cast< int >( std::round( repetitionScaling * numberOfRepetitions_ ) ) );
+    results_.push_back( runBenchmark( name, benchmarkFunction, numberOfEvaluationsPerRepetition,
+                                      numberOfRepetitions ) );
+
+    const BenchmarkResult& result = results_.back( );
+    std::cout << std::left << std::setw( 64 ) << result.name_ << std::right << std::scientific
+              << std::setprecision( 4 ) << std::setw( 14 ) << result.medianTime_ << std::setw( 14 )
+              << result.minimumTime_ << std::setw( 16 ) << result.getEvaluationsPerSecond( ) << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+//! Function to write the results of the benchmarks to the JSON output file.
+void BenchmarkSuite::writeResults( ) const
+{
+    std::ofstream outputStream( outputFile_.c_str( ) );
+    if( !outputStream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing results of benchmark suite " + suiteName_ + ", could not open " +
+                                  outputFile_ );
+    }
+
+    outputStream << std::setprecision( 10 );
+    outputStream << "{" << std::endl;
+    outputStream << "  \"suite\": \"" << suiteName_ << "\"," << std::endl;
+    outputStream << "  \"tudatVersion\": \"" << TUDAT_VERSION_MAJOR << "." << TUDAT_VERSION_MINOR << "\","
+                 << std::endl;
+#if defined( __VERSION__ )
+    outputStream << "  \"compiler\": \"" << __VERSION__ << "\"," << std::endl;
+#endif
+    outputStream << "  \"numberOfRepetitions\": " << numberOfRepetitions_ << "," << std::endl;
+    outputStream << "  \"benchmarks\": [" << std::endl;
+    for( unsigned int i = 0; i < results_.size( ); i++ )
+    {
+        const BenchmarkResult& result = results_.at( i );
+        outputStream << "    {" << std::endl;
+        outputStream << "      \"name\": \"" << result.name_ << "\"," << std::endl;
+        outputStream << "      \"evaluationsPerRepetition\": " << result.numberOfEvaluationsPerRepetition_ << ","
+                     << std::endl;
+        outputStream << "      \"repetitionTimes\": [";
+        for( unsigned int j = 0; j < result.repetitionTimes_.size( ); j++ )
+        {
+            outputStream << ( j > 0 ? ", " : "" ) << result.repetitionTimes_.at( j );
+        }
+        outputStream << "]," << std::endl;
+        outputStream << "      \"minimumTime\": " << result.minimumTime_ << "," << std::endl;
+        outputStream << "      \"medianTime\": " << result.medianTime_ << "," << std::endl;
+        outputStream << "      \"meanTime\": " << result.meanTime_ << "," << std::endl;
+        outputStream << "      \"evaluationsPerSecond\": " << result.getEvaluationsPerSecond( ) << std::endl;
+        outputStream << "    }" << ( i + 1 < results_.size( ) ? "," : "" ) << std::endl;
+    }
+    outputStream << "  ]" << std::endl;
+    outputStream << "}" << std::endl;
+    outputStream.close( );
+
+    std::cout << "Benchmark results written to " << outputFile_ << std::endl;
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,163 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKTOOLS_H
+#define TUDAT_BENCHMARKTOOLS_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Timings of a single benchmark.
+struct BenchmarkResult
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param name Name of the benchmark.
+     * \param numberOfEvaluationsPerRepetition Number of evaluations of the benchmarked kernel (e.g. number of function
+     * calls or state derivative evaluations) in a single repetition of the benchmark.
+     * \param repetitionTimes Wall clock time of each repetition of the benchmark, in seconds.
+     */
+    BenchmarkResult( const std::string& name,
+                     const long long numberOfEvaluationsPerRepetition,
+                     const std::vector< double >& repetitionTimes );
+
+    //! Function to retrieve the number of evaluations per second, based on the median repetition time.
+    double getEvaluationsPerSecond( ) const
+    {
+        return static_cast< double >( numberOfEvaluationsPerRepetition_ ) / medianTime_;
+    }
+
+    //! Name of the benchmark.
+    std::string name_;
+
+    //! Number of evaluations of the benchmarked kernel in a single repetition of the benchmark.
+    long long numberOfEvaluationsPerRepetition_;
+
+    //! Wall clock time of each repetition of the benchmark, in seconds.
+    std::vector< double > repetitionTimes_;
+
+    //! Minimum wall clock time of a single repetition, in seconds.
+    double minimumTime_;
+
+    //! Median wall clock time of a single repetition, in seconds.
+    double medianTime_;
+
+    //! Mean wall clock time of a single repetition, in seconds.
+    double meanTime_;
+};
+
+//! Function to time a benchmark.
+/*!
+ * Function to time a benchmark. The benchmark is first run numberOfWarmUpRepetitions times without timing (to fill
+ * caches and let the processor reach a steady clock frequency), after which each of the numberOfRepetitions
+ * repetitions is timed separately.
+ * \param name Name of the benchmark.
+ * \param benchmarkFunction Function performing a single repetition of the benchmark.
+ * \param numberOfEvaluationsPerRepetition Number of evaluations of the benchmarked kernel in a single repetition.
+ * \param numberOfRepetitions Number of timed repetitions.
+ * \param numberOfWarmUpRepetitions Number of repetitions that are run before the timed repetitions.
+ * \return Timings of the benchmark.
+ */
+BenchmarkResult runBenchmark( const std::string& name,
+                              const boost::function< void( ) >& benchmarkFunction,
+                              const long long numberOfEvaluationsPerRepetition,
+                              const int numberOfRepetitions,
+                              const int numberOfWarmUpRepetitions = 1 );
+
+//! Function to prevent the compiler from optimizing away the computation of a benchmarked value.
+/*!
+ * Function to prevent the compiler from optimizing away the computation of a benchmarked value, by accumulating it in
+ * a volatile variable defined in a different translation unit.
+ * \param value Value computed by the benchmarked kernel.
+ */
+void consumeBenchmarkOutput( const double value );
+
+//! Class to collect the results of a suite of benchmarks, and write them to a machine-readable file.
+class BenchmarkSuite
+{
+public:
+
+    //! Constructor, parses the command line arguments of a benchmark program.
+    /*!
+     * Constructor, parses the command line arguments of a benchmark program, which are (both optional) the path of the
+     * JSON file to which the results are to be written (default: <suiteName>.json in the working directory) and the
+     * number of timed repetitions of each benchmark (default: defaultNumberOfRepetitions).
+     * \param suiteName Name of the benchmark suite.
+     * \param argc Number of command line arguments, as passed to main.
+     * \param argv Command line arguments, as passed to main.
+     * \param defaultNumberOfRepetitions Number of repetitions of each benchmark if not provided on the command line.
+     */
+    BenchmarkSuite( const std::string& suiteName, int argc, char* argv[ ], const int defaultNumberOfRepetitions = 5 );
+
+    //! Function to time a benchmark, and add its result to the suite.
+    /*!
+     * Function to time a benchmark (see runBenchmark), add its result to the suite and print it to the console.
+     * \param name Name of the benchmark.
+     * \param benchmarkFunction Function performing a single repetition of the benchmark.
+     * \param numberOfEvaluationsPerRepetition Number of evaluations of the benchmarked kernel in a single repetition.
+     * \param repetitionScaling Factor by which the number of repetitions of the suite is multiplied for this benchmark
+     * (e.g. to reduce the number of repetitions of long-running scenarios).
+     */
+    void addBenchmark( const std::string& name,
+                       const boost::function< void( ) >& benchmarkFunction,
+                       const long long numberOfEvaluationsPerRepetition,
+                       const double repetitionScaling = 1.0 );
+
+    //! Function to retrieve the results of the benchmarks run so far.
+    const std::vector< BenchmarkResult >& getResults( ) const
+    {
+        return results_;
+    }
+
+    //! Function to retrieve the number of timed repetitions of each benchmark.
+    int getNumberOfRepetitions( ) const
+    {
+        return numberOfRepetitions_;
+    }
+
+    //! Function to write the results of the benchmarks to the JSON output file.
+    /*!
+     * Function to write the results of the benchmarks to the JSON output file. The file contains the suite name, the
+     * Tudat version, the compiler and, for each benchmark, its name, number of evaluations per repetition, the time of
+     * each repetition, the minimum, median and mean repetition time (in seconds) and the number of evaluations per
+     * second.
+     */
+    void writeResults( ) const;
+
+private:
+
+    //! Name of the benchmark suite.
+    std::string suiteName_;
+
+    //! Path of the JSON file to which the results are to be written.
+    std::string outputFile_;
+
+    //! Number of timed repetitions of each benchmark.
+    int numberOfRepetitions_;
+
+    //! Results of the benchmarks run so far.
+    std::vector< BenchmarkResult > results_;
+};
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#endif // TUDAT_BENCHMARKTOOLS_H
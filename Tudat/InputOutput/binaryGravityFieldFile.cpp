@@ -0,0 +1,213 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+
+#include "Tudat/InputOutput/binaryGravityFieldFile.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Identifier at the start of binary gravity field files.
+const char binaryGravityFieldFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'H', 'G' };
+
+//! Version of the binary gravity field file format.
+const boost::uint64_t binaryGravityFieldFileFormatVersion = 1;
+
+//! Function to get the number of coefficients in a triangle of coefficients with given maximum degree and order.
+boost::uint64_t getNumberOfGravityFieldTriangleCoefficients(
+        const boost::uint64_t maximumDegree, const boost::uint64_t maximumOrder )
+{
+    // Degrees up to maximumOrder contain degree + 1 coefficients, higher degrees contain maximumOrder + 1 coefficients.
+    const boost::uint64_t maximumFullDegree = std::min( maximumDegree, maximumOrder );
+    return ( maximumFullDegree + 1 ) * ( maximumFullDegree + 2 ) / 2 +
+            ( maximumDegree - maximumFullDegree ) * ( maximumOrder + 1 );
+}
+
+//! Function to get the path of the binary gravity field file that is used instead of a (text) gravity field file.
+std::string getBinaryGravityFieldFilePath( const std::string& gravityFieldFile )
+{
+    return gravityFieldFile + ".bin";
+}
+
+//! Function to write spherical harmonic coefficients to a binary gravity field file.
+void writeBinaryGravityFieldFile(
+        const std::string& binaryFile,
+        const double gravitationalParameter, const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+        const bool areCoefficientsNormalized,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const std::string& sourceFile )
+{
+    if( cosineCoefficients.rows( ) == 0 || cosineCoefficients.cols( ) == 0 ||
+            cosineCoefficients.rows( ) != sineCoefficients.rows( ) ||
+            cosineCoefficients.cols( ) != sineCoefficients.cols( ) )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file, inconsistent coefficient sizes" );
+    }
+
+    BinaryGravityFieldFileHeader header;
+    std::memcpy( header.identifier, binaryGravityFieldFileIdentifier, sizeof( header.identifier ) );
+    header.formatVersion = binaryGravityFieldFileFormatVersion;
+    header.gravitationalParameter = gravitationalParameter;
+    header.referenceRadius = referenceRadius;
+    header.areCoefficientsNormalized = areCoefficientsNormalized;
+    header.maximumDegree = static_cast< boost::uint64_t >( cosineCoefficients.rows( ) - 1 );
+    header.maximumOrder = static_cast< boost::uint64_t >(
+                std::min( cosineCoefficients.cols( ), cosineCoefficients.rows( ) ) - 1 );
+    header.gravitationalParameterIndex = gravitationalParameterIndex;
+    header.referenceRadiusIndex = referenceRadiusIndex;
+    header.sourceFileSize = 0;
+    header.sourceFileModificationTime = 0;
+    if( sourceFile != "" )
+    {
+        header.sourceFileSize = boost::filesystem::file_size( sourceFile );
+        header.sourceFileModificationTime = boost::filesystem::last_write_time( sourceFile );
+    }
+
+    // Pack coefficient triangles.
+    const boost::uint64_t numberOfCoefficients =
+            getNumberOfGravityFieldTriangleCoefficients( header.maximumDegree, header.maximumOrder );
+    std::vector< double > coefficientTriangles( 2 * numberOfCoefficients );
+    boost::uint64_t currentIndex = 0;
+    for( unsigned int i = 0; i <= header.maximumDegree; i++ )
+    {
+        for( unsigned int j = 0; j <= std::min< boost::uint64_t >( i, header.maximumOrder ); j++ )
+        {
+            coefficientTriangles[ currentIndex ] = cosineCoefficients( i, j );
+            coefficientTriangles[ numberOfCoefficients + currentIndex ] = sineCoefficients( i, j );
+            currentIndex++;
+        }
+    }
+
+    // Write to temporary file, and move it to its final name when complete.
+    const std::string temporaryFile =
+            binaryFile + boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" ).string( );
+    {
+        std::ofstream fileStream( temporaryFile.c_str( ), std::ios::binary );
+        fileStream.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+        fileStream.write( reinterpret_cast< const char* >( coefficientTriangles.data( ) ),
+                          coefficientTriangles.size( ) * sizeof( double ) );
+        if( !fileStream.good( ) )
+        {
+            fileStream.close( );
+            std::remove( temporaryFile.c_str( ) );
+            throw std::runtime_error( "Error when writing binary gravity field file " + binaryFile );
+        }
+    }
+    boost::filesystem::rename( temporaryFile, binaryFile );
+}
+
+//! Constructor, maps the file into memory and validates its header.
+BinaryGravityFieldFile::BinaryGravityFieldFile( const std::string& binaryFile ):
+    binaryFile_( binaryFile )
+{
+    try
+    {
+        // The mapping remains valid when the file_mapping object is destroyed.
+        boost::interprocess::file_mapping fileMapping( binaryFile.c_str( ), boost::interprocess::read_only );
+        mappedRegion_ = boost::interprocess::mapped_region( fileMapping, boost::interprocess::read_only );
+    }
+    catch( boost::interprocess::interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error, could not map binary gravity field file " + binaryFile + ": " +
+                                  caughtException.what( ) );
+    }
+
+    // Check header.
+    if( mappedRegion_.get_size( ) < sizeof( header_ ) )
+    {
+        throw std::runtime_error( "Error, binary gravity field file " + binaryFile + " is too small" );
+    }
+    const char* fileData = static_cast< const char* >( mappedRegion_.get_address( ) );
+    std::memcpy( &header_, fileData, sizeof( header_ ) );
+    if( std::memcmp( header_.identifier, binaryGravityFieldFileIdentifier, sizeof( header_.identifier ) ) != 0 ||
+            header_.formatVersion != binaryGravityFieldFileFormatVersion )
+    {
+        throw std::runtime_error( "Error, " + binaryFile + " is not a (compatible) binary gravity field file" );
+    }
+    if( header_.maximumOrder > header_.maximumDegree ||
+            mappedRegion_.get_size( ) != sizeof( header_ ) + 2 * sizeof( double ) *
+            getNumberOfGravityFieldTriangleCoefficients( header_.maximumDegree, header_.maximumOrder ) )
+    {
+        throw std::runtime_error( "Error, size of binary gravity field file " + binaryFile +
+                                  " is inconsistent with its header" );
+    }
+
+    // The mapped region is page-aligned and the header size is a multiple of 8 bytes, so coefficients are aligned.
+    cosineCoefficients_ = reinterpret_cast< const double* >( fileData + sizeof( header_ ) );
+    sineCoefficients_ = cosineCoefficients_ +
+            getNumberOfGravityFieldTriangleCoefficients( header_.maximumDegree, header_.maximumOrder );
+}
+
+//! Function to retrieve the coefficients up to given degree and order.
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > BinaryGravityFieldFile::getCoefficients(
+        const int maximumDegree, const int maximumOrder ) const
+{
+    if( maximumDegree < 0 || maximumOrder < 0 ||
+            maximumDegree > getMaximumDegree( ) || std::min( maximumOrder, maximumDegree ) > getMaximumOrder( ) )
+    {
+        throw std::runtime_error( "Error, requested degree " + std::to_string( maximumDegree ) + " and order " +
+                                  std::to_string( maximumOrder ) + " not available in binary gravity field file " +
+                                  binaryFile_ );
+    }
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    for( int i = 0; i <= maximumDegree; i++ )
+    {
+        const boost::uint64_t degreeStartIndex = getTriangleIndex( i, 0 );
+        for( int j = 0; j <= std::min( i, maximumOrder ); j++ )
+        {
+            cosineCoefficients( i, j ) = cosineCoefficients_[ degreeStartIndex + j ];
+            sineCoefficients( i, j ) = sineCoefficients_[ degreeStartIndex + j ];
+        }
+    }
+    return std::make_pair( cosineCoefficients, sineCoefficients );
+}
+
+//! Function to check whether the file was created from the current version of a (text) gravity field file.
+bool BinaryGravityFieldFile::isCreatedFromFile( const std::string& sourceFile ) const
+{
+    boost::system::error_code errorCode;
+    const boost::uintmax_t sourceFileSize = boost::filesystem::file_size( sourceFile, errorCode );
+    if( errorCode )
+    {
+        return false;
+    }
+    const std::time_t sourceFileModificationTime = boost::filesystem::last_write_time( sourceFile, errorCode );
+    if( errorCode )
+    {
+        return false;
+    }
+    return ( header_.sourceFileSize == sourceFileSize ) &&
+            ( header_.sourceFileModificationTime == static_cast< boost::int64_t >( sourceFileModificationTime ) );
+}
+
+//! Function to get the index in a coefficient triangle of the coefficient with given degree and order.
+boost::uint64_t BinaryGravityFieldFile::getTriangleIndex( const int degree, const int order ) const
+{
+    return ( degree == 0 ? 0 : getNumberOfGravityFieldTriangleCoefficients( degree - 1, header_.maximumOrder ) ) +
+            order;
+}
+
+} // namespace input_output
+} // namespace tudat
@@ -0,0 +1,216 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BINARY_GRAVITY_FIELD_FILE_H
+#define TUDAT_BINARY_GRAVITY_FIELD_FILE_H
+
+#include <string>
+#include <utility>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Header of a binary spherical harmonic gravity field file.
+/*!
+ *  Header of a binary spherical harmonic gravity field file. All entries are 8 bytes, so that the coefficients that
+ *  follow the header are aligned. The gravitational parameter and reference radius are NaN if they were not read from
+ *  the header of the source (text) file, in which case gravitationalParameterIndex and referenceRadiusIndex are -1.
+ *  The size and modification time of the source file are stored so that an outdated binary file can be detected.
+ */
+struct BinaryGravityFieldFileHeader
+{
+    //! Identifier of the file format.
+    char identifier[ 8 ];
+
+    //! Version of the file format.
+    boost::uint64_t formatVersion;
+
+    //! Gravitational parameter of the gravity field.
+    double gravitationalParameter;
+
+    //! Reference radius of the gravity field.
+    double referenceRadius;
+
+    //! Boolean (0 or 1) denoting whether the coefficients are geodesy-normalized.
+    boost::uint64_t areCoefficientsNormalized;
+
+    //! Maximum degree of the coefficients in the file.
+    boost::uint64_t maximumDegree;
+
+    //! Maximum order of the coefficients in the file.
+    boost::uint64_t maximumOrder;
+
+    //! Index in the header of the source file from which the gravitational parameter was read (-1 if none).
+    boost::int64_t gravitationalParameterIndex;
+
+    //! Index in the header of the source file from which the reference radius was read (-1 if none).
+    boost::int64_t referenceRadiusIndex;
+
+    //! Size (in bytes) of the source file.
+    boost::uint64_t sourceFileSize;
+
+    //! Modification time of the source file (as std::time_t).
+    boost::int64_t sourceFileModificationTime;
+};
+
+//! Function to get the number of coefficients in a triangle of coefficients with given maximum degree and order.
+/*!
+ *  Function to get the number of coefficients in a triangle of coefficients with given maximum degree and order,
+ *  i.e. the number of (degree, order) combinations with order <= min( degree, maximumOrder ).
+ *  \param maximumDegree Maximum degree of the coefficients.
+ *  \param maximumOrder Maximum order of the coefficients.
+ *  \return Number of coefficients in the triangle.
+ */
+boost::uint64_t getNumberOfGravityFieldTriangleCoefficients(
+        const boost::uint64_t maximumDegree, const boost::uint64_t maximumOrder );
+
+//! Function to get the path of the binary gravity field file that is used instead of a (text) gravity field file.
+/*!
+ *  Function to get the path of the binary gravity field file that is used instead of a (text) gravity field file, if it
+ *  exists. The binary file is located in the same directory, with ".bin" appended to the file name.
+ *  \param gravityFieldFile Path of the (text) gravity field file.
+ *  \return Path of the binary gravity field file.
+ */
+std::string getBinaryGravityFieldFilePath( const std::string& gravityFieldFile );
+
+//! Function to write spherical harmonic coefficients to a binary gravity field file.
+/*!
+ *  Function to write spherical harmonic coefficients to a binary gravity field file. The file consists of a
+ *  BinaryGravityFieldFileHeader, followed by the triangles of cosine and sine coefficients (up to the order given by the
+ *  number of columns of the coefficient matrices), each stored per degree, with increasing order. The file is first
+ *  written under a temporary name and then renamed, so that other processes never read a partially written file.
+ *  \param binaryFile Name of the binary file that is to be written.
+ *  \param gravitationalParameter Gravitational parameter of the gravity field.
+ *  \param referenceRadius Reference radius of the gravity field.
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (entry (i,j) is degree i, order j).
+ *  \param sineCoefficients Sine spherical harmonic coefficients (entry (i,j) is degree i, order j).
+ *  \param areCoefficientsNormalized Boolean denoting whether the coefficients are geodesy-normalized.
+ *  \param gravitationalParameterIndex Index in the source file header of the gravitational parameter (-1 if none).
+ *  \param referenceRadiusIndex Index in the source file header of the reference radius (-1 if none).
+ *  \param sourceFile Name of the (text) file from which the coefficients were read, used to detect when the binary file
+ *  is outdated (no check is performed if empty).
+ */
+void writeBinaryGravityFieldFile(
+        const std::string& binaryFile,
+        const double gravitationalParameter, const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+        const bool areCoefficientsNormalized = true,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1,
+        const std::string& sourceFile = "" );
+
+//! Class to read spherical harmonic coefficients from a memory-mapped binary gravity field file.
+/*!
+ *  Class to read spherical harmonic coefficients from a binary gravity field file (see writeBinaryGravityFieldFile).
+ *  The file is mapped read-only into memory, instead of being read, so that only the pages that contain the requested
+ *  coefficients are loaded, and these pages are shared (through the page cache of the operating system) by all
+ *  processes that load the same file. The header is validated on construction; an exception is thrown if the file
+ *  cannot be mapped or is not a valid binary gravity field file.
+ */
+class BinaryGravityFieldFile
+{
+public:
+
+    //! Constructor, maps the file into memory and validates its header.
+    /*!
+     *  Constructor, maps the file into memory and validates its header.
+     *  \param binaryFile Name of the binary gravity field file.
+     */
+    BinaryGravityFieldFile( const std::string& binaryFile );
+
+    //! Function to retrieve the coefficients up to given degree and order.
+    /*!
+     *  Function to retrieve the cosine and sine coefficients up to given degree and order, as (maximumDegree + 1) x
+     *  (maximumOrder + 1) matrices (with zeros for order > degree). An exception is thrown if the file does not contain
+     *  the requested degree and order.
+     *  \param maximumDegree Maximum degree of the coefficients that are to be retrieved.
+     *  \param maximumOrder Maximum order of the coefficients that are to be retrieved.
+     *  \return Pair of cosine and sine coefficients.
+     */
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > getCoefficients(
+            const int maximumDegree, const int maximumOrder ) const;
+
+    //! Function to check whether the file was created from the current version of a (text) gravity field file.
+    /*!
+     *  Function to check whether the file was created from the current version of a (text) gravity field file, by
+     *  comparing the size and modification time of the source file with those stored in the header.
+     *  \param sourceFile Name of the (text) gravity field file.
+     *  \return True if the size and modification time of sourceFile match the header.
+     */
+    bool isCreatedFromFile( const std::string& sourceFile ) const;
+
+    //! Function to retrieve the header of the file.
+    const BinaryGravityFieldFileHeader& getHeader( ) const
+    {
+        return header_;
+    }
+
+    //! Function to retrieve the gravitational parameter of the gravity field.
+    double getGravitationalParameter( ) const
+    {
+        return header_.gravitationalParameter;
+    }
+
+    //! Function to retrieve the reference radius of the gravity field.
+    double getReferenceRadius( ) const
+    {
+        return header_.referenceRadius;
+    }
+
+    //! Function to retrieve whether the coefficients are geodesy-normalized.
+    bool areCoefficientsNormalized( ) const
+    {
+        return header_.areCoefficientsNormalized != 0;
+    }
+
+    //! Function to retrieve the maximum degree of the coefficients in the file.
+    int getMaximumDegree( ) const
+    {
+        return static_cast< int >( header_.maximumDegree );
+    }
+
+    //! Function to retrieve the maximum order of the coefficients in the file.
+    int getMaximumOrder( ) const
+    {
+        return static_cast< int >( header_.maximumOrder );
+    }
+
+private:
+
+    //! Function to get the index in a coefficient triangle of the coefficient with given degree and order.
+    boost::uint64_t getTriangleIndex( const int degree, const int order ) const;
+
+    //! Name of the binary gravity field file.
+    std::string binaryFile_;
+
+    //! Read-only mapped region of the complete file.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Header of the file.
+    BinaryGravityFieldFileHeader header_;
+
+    //! Pointer to the first cosine coefficient in the mapped region.
+    const double* cosineCoefficients_;
+
+    //! Pointer to the first sine coefficient in the mapped region.
+    const double* sineCoefficients_;
+};
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_BINARY_GRAVITY_FIELD_FILE_H
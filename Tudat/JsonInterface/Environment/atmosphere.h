@@ -26,11 +26,14 @@ static std::map< AtmosphereTypes, std::string > atmosphereTypes =
 {
     { exponential_atmosphere, "exponential" },
     { tabulated_atmosphere, "tabulated" },
-    { nrlmsise00, "nrlmsise00" }
+    { nrlmsise00, "nrlmsise00" },
+    { fused_tabulated_atmosphere, "fusedTabulated" },
+    { nrlmsise00_surrogate_atmosphere, "nrlmsise00Surrogate" }
 };
 
 //! `AtmosphereTypes` not supported by `json_interface`.
-static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { };
+static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { fused_tabulated_atmosphere,
+                                                                   nrlmsise00_surrogate_atmosphere };
 
 //! Convert `AtmosphereTypes` to `json`.
 inline void to_json( nlohmann::json& jsonObject, const AtmosphereTypes& atmosphereType )
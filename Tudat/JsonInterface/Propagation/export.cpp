@@ -51,6 +51,49 @@ void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< ExportSetti
     updateFromJSONIfDefined( exportSettings->numericalPrecision_, jsonObject, K::numericalPrecision );
 }
 
+//! Create a `json` object from a shared pointer to a `PropagationProfiler` object.
+void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< propagators::PropagationProfiler >& profiler )
+{
+    if ( ! profiler )
+    {
+        return;
+    }
+    using K = Keys::Profiling;
+
+    jsonObject = nlohmann::json::array( );
+    for ( const propagators::PropagationProfilingEntry& entry : profiler->getEntries( ) )
+    {
+        nlohmann::json jsonEntry;
+        jsonEntry[ K::category ] = propagators::getPropagationProfilingCategoryName( entry.category_ );
+        jsonEntry[ K::model ] = entry.modelName_;
+        assignIfNotEmpty( jsonEntry, K::bodyUndergoing, entry.bodyUndergoing_ );
+        assignIfNotEmpty( jsonEntry, K::bodyExerting, entry.bodyExerting_ );
+        jsonEntry[ K::numberOfCalls ] = entry.numberOfCalls_;
+        jsonEntry[ K::computationTime ] = entry.computationTime_;
+        jsonObject.push_back( jsonEntry );
+    }
+}
+
+//! Export the number of calls and computation times of the propagation models to a JSON file.
+void exportPropagationProfile( const boost::shared_ptr< propagators::PropagationProfiler >& profiler,
+                               const boost::filesystem::path& exportPath )
+{
+    if ( ! profiler )
+    {
+        return;
+    }
+
+    if ( ! boost::filesystem::exists( exportPath.parent_path( ) ) )
+    {
+        boost::filesystem::create_directories( exportPath.parent_path( ) );
+    }
+    nlohmann::json jsonObject;
+    to_json( jsonObject, profiler );
+    std::ofstream outputFile( exportPath.string( ) );
+    outputFile << jsonObject.dump( 2 );
+    outputFile.close( );
+}
+
 } // namespace simulation_setup
 
 } // namespace tudat
@@ -70,6 +70,24 @@ void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< ExportSetting
 //! Create a shared pointer to a `ExportSettings` object from a `json` object.
 void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< ExportSettings >& saveSettings );
 
+//! Create a `json` object from a shared pointer to a `PropagationProfiler` object.
+/*!
+ * Create a `json` object from a shared pointer to a `PropagationProfiler` object. The `json` object is an array
+ * containing, for each profiled (aggregated) model, its category, name, bodies, number of calls and total computation
+ * time in seconds.
+ */
+void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< propagators::PropagationProfiler >& profiler );
+
+//! Export the number of calls and computation times of the propagation models to a JSON file.
+/*!
+ * @copybrief exportPropagationProfile
+ * \param profiler The profiler containing the number of calls and computation times of the propagation models, as
+ * retrieved from the dynamics simulator. If NULL (i.e. if the propagation was not profiled), no file is written.
+ * \param exportPath Path of the JSON file to which the profile is to be written.
+ */
+void exportPropagationProfile( const boost::shared_ptr< propagators::PropagationProfiler >& profiler,
+                               const boost::filesystem::path& exportPath );
+
 
 //! Export results of \p dynamicsSimulator according to the settings specified in \p exportSettingsVector.
 /*!
@@ -87,11 +105,11 @@ void exportResultsOfDynamicsSimulator(
     using namespace propagators;
     using namespace input_output;
 
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > statesHistory =
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& statesHistory =
             singleArcDynamicsSimulator->getEquationsOfMotionNumericalSolution( );
-    std::map< TimeType, Eigen::VectorXd > dependentVariables =
+    const std::map< TimeType, Eigen::VectorXd >& dependentVariables =
             singleArcDynamicsSimulator->getDependentVariableHistory( );
-    std::map< TimeType, double > cpuTimes =
+    const std::map< TimeType, double >& cpuTimes =
             singleArcDynamicsSimulator->getCummulativeComputationTimeHistory( );
 
     for ( boost::shared_ptr< ExportSettings > exportSettings : exportSettingsVector )
@@ -382,6 +382,15 @@ const std::string Keys::Options::defaultValueUsedForMissingKey = "defaultValueUs
 const std::string Keys::Options::unusedKey = "unusedKey";
 const std::string Keys::Options::fullSettingsFile = "fullSettingsFile";
 const std::string Keys::Options::tagOutputFilesIfPropagationFails = "tagOutputFilesIfPropagationFails";
+const std::string Keys::Options::profileFile = "profileFile";
+
+//  Profiling
+const std::string Keys::Profiling::category = "category";
+const std::string Keys::Profiling::model = "model";
+const std::string Keys::Profiling::bodyUndergoing = "bodyUndergoing";
+const std::string Keys::Profiling::bodyExerting = "bodyExerting";
+const std::string Keys::Profiling::numberOfCalls = "numberOfCalls";
+const std::string Keys::Profiling::computationTime = "computationTime";
 
 
 // KEYPATH
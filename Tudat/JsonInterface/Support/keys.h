@@ -416,6 +416,17 @@ struct Keys
         static const std::string unusedKey;
         static const std::string fullSettingsFile;
         static const std::string tagOutputFilesIfPropagationFails;
+        static const std::string profileFile;
+    };
+
+    struct Profiling
+    {
+        static const std::string category;
+        static const std::string model;
+        static const std::string bodyUndergoing;
+        static const std::string bodyExerting;
+        static const std::string numberOfCalls;
+        static const std::string computationTime;
     };
 };
 
@@ -32,6 +32,7 @@ void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< ApplicationOp
     jsonObject[ K::unusedKey ] = applicationOptions->unusedKey_;
     assignIfNotEmpty( jsonObject, K::fullSettingsFile, applicationOptions->fullSettingsFile_ );
     jsonObject[ K::tagOutputFilesIfPropagationFails ] = applicationOptions->tagOutputFilesIfPropagationFails_;
+    assignIfNotEmpty( jsonObject, K::profileFile, applicationOptions->profileFile_ );
 }
 
 //! Create a shared pointer to a `ApplicationOptions` object from a `json` object.
@@ -55,6 +56,8 @@ void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< Application
 
     updateFromJSONIfDefined( applicationOptions->tagOutputFilesIfPropagationFails_,
                              jsonObject, K::tagOutputFilesIfPropagationFails );
+
+    updateFromJSONIfDefined( applicationOptions->profileFile_, jsonObject, K::profileFile );
 }
 
 } // namespace json_interface
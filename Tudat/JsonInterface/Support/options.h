@@ -71,6 +71,10 @@ public:
     //! Whether the generated output files should contain the line "FAILURE" if the propagation terminates before
     //! reaching the termination condition.
     bool tagOutputFilesIfPropagationFails_ = true;
+
+    //! Path where the propagation profile (containing the number of calls and computation time of the propagation
+    //! models) is going to be saved. Empty string if the propagation should not be profiled.
+    boost::filesystem::path profileFile_ = "";
 };
 
 //! Create a `json` object from a shared pointer to a `ApplicationOptions` object.
@@ -194,6 +194,12 @@ public:
 
         exportResultsOfDynamicsSimulator( dynamicsSimulator_, exportSettingsVector_ );
 
+        // Export propagation profile if requested
+        if ( ! applicationOptions_->profileFile_.empty( ) )
+        {
+            exportPropagationProfile( dynamicsSimulator_->getPropagationProfiler( ), applicationOptions_->profileFile_ );
+        }
+
         if ( profiling )
         {
             std::cout << "exportResults: " << std::chrono::duration_cast< std::chrono::milliseconds >(
@@ -520,6 +526,12 @@ protected:
      */
     virtual void resetDynamicsSimulator( )
     {
+        // Profile propagation if requested (results are exported to file instead of printed)
+        if ( ! applicationOptions_->profileFile_.empty( ) )
+        {
+            propagatorSettings_->setProfilePropagation( true, false );
+        }
+
         dynamicsSimulator_ =
                 boost::make_shared< propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
                     bodyMap_, integratorSettings_, propagatorSettings_, false, false, false, initialClockTime_ );
@@ -0,0 +1,146 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Test if least squares solution from normal equations accumulated per block equals solution from full information matrix
+BOOST_AUTO_TEST_CASE( testNormalEquationAccumulation )
+{
+    // Create information matrix, residuals and weights (with varying weights).
+    const int numberOfObservations = 1000;
+    const int numberOfParameters = 6;
+
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Zero( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double independentVariable = static_cast< double >( i ) / static_cast< double >( numberOfObservations );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            informationMatrix( i, j ) = std::cos( static_cast< double >( j + 1 ) * independentVariable + 0.1 * j );
+        }
+        residuals( i ) = std::sin( 10.0 * independentVariable ) + 0.3 * independentVariable;
+        weights( i ) = 1.0 + 0.5 * std::sin( 3.0 * independentVariable );
+    }
+
+    Eigen::MatrixXd inverseAPrioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    inverseAPrioriCovariance( 0, 0 ) = 10.0;
+
+    // Compute least squares solution from full information matrix.
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullOutput =
+            linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, inverseAPrioriCovariance );
+
+    // Compute least squares solution from normal equations accumulated in blocks of different size.
+    std::vector< int > blockSizes = { 1, 7, 100, numberOfObservations };
+    for( unsigned int i = 0; i < blockSizes.size( ); i++ )
+    {
+        Eigen::MatrixXd inverseCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+        Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+        for( int startIndex = 0; startIndex < numberOfObservations; startIndex += blockSizes.at( i ) )
+        {
+            int currentBlockSize = std::min( blockSizes.at( i ), numberOfObservations - startIndex );
+            linear_algebra::addBlockToNormalEquations(
+                        informationMatrix.block( startIndex, 0, currentBlockSize, numberOfParameters ),
+                        residuals.segment( startIndex, currentBlockSize ),
+                        weights.segment( startIndex, currentBlockSize ),
+                        inverseCovariance, rightHandSide );
+        }
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > accumulatedOutput =
+                linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                    inverseCovariance, rightHandSide, inverseAPrioriCovariance );
+
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( accumulatedOutput.first( j ), fullOutput.first( j ), 1.0E-8 );
+            for( int k = 0; k < numberOfParameters; k++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( accumulatedOutput.second( j, k ), fullOutput.second( j, k ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check inconsistent input
+    bool isExceptionCaught = false;
+    try
+    {
+        Eigen::MatrixXd inverseCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+        Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+        linear_algebra::addBlockToNormalEquations(
+                    informationMatrix, residuals.segment( 0, 10 ), weights, inverseCovariance, rightHandSide );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test if symmetric systems are solved correctly with LDLT decomposition, and with SVD decomposition as fallback.
+BOOST_AUTO_TEST_CASE( testLdltSystemSolution )
+{
+    // Test well-conditioned positive definite system
+    {
+        Eigen::Matrix3d matrixToInvert;
+        matrixToInvert << 4.0, 1.0, 0.5,
+                1.0, 3.0, 0.2,
+                0.5, 0.2, 2.0;
+        Eigen::Vector3d rightHandSide( 1.0, -2.0, 0.5 );
+
+        Eigen::VectorXd ldltSolution = linear_algebra::solveSymmetricSystemOfEquationsWithLdlt(
+                    matrixToInvert, rightHandSide );
+        Eigen::VectorXd svdSolution = linear_algebra::solveSystemOfEquationsWithSvd(
+                    matrixToInvert, rightHandSide, false );
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( ldltSolution( i ), svdSolution( i ), 1.0E-14 );
+        }
+        BOOST_CHECK_SMALL( ( matrixToInvert * ldltSolution - rightHandSide ).norm( ),
+                           10.0 * std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Test singular system (for which SVD should be used, giving minimum-norm solution).
+    {
+        Eigen::Matrix3d matrixToInvert;
+        matrixToInvert << 1.0, 1.0, 0.0,
+                1.0, 1.0, 0.0,
+                0.0, 0.0, 2.0;
+        Eigen::Vector3d rightHandSide( 2.0, 2.0, 4.0 );
+
+        Eigen::VectorXd solution = linear_algebra::solveSymmetricSystemOfEquationsWithLdlt(
+                    matrixToInvert, rightHandSide, false );
+        BOOST_CHECK_CLOSE_FRACTION( solution( 0 ), 1.0, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( solution( 1 ), 1.0, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( solution( 2 ), 2.0, 1.0E-14 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
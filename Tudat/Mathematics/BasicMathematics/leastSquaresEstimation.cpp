@@ -58,6 +58,37 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
     return svdDecomposition.solve( rightHandSideVector );
 }
 
+//! Solve symmetric system of equations with LDLT decomposition, using SVD decomposition if ill-conditioned
+Eigen::VectorXd solveSymmetricSystemOfEquationsWithLdlt( const Eigen::MatrixXd& matrixToInvert,
+                                                         const Eigen::VectorXd& rightHandSideVector,
+                                                         const bool checkConditionNumber,
+                                                         const double maximumAllowedConditionNumber )
+{
+    Eigen::LDLT< Eigen::MatrixXd > ldltDecomposition( matrixToInvert );
+
+    // Check if decomposition can be used (positive definite and, if requested, sufficiently well-conditioned).
+    bool useLdltDecomposition = ( ldltDecomposition.info( ) == Eigen::Success ) &&
+            ( ldltDecomposition.vectorD( ).minCoeff( ) > 0.0 );
+    if( useLdltDecomposition && checkConditionNumber )
+    {
+        // Compare estimate of reciprocal condition number (in 1-norm) to maximum.
+        if( ldltDecomposition.rcond( ) * maximumAllowedConditionNumber < 1.0 )
+        {
+            useLdltDecomposition = false;
+        }
+    }
+
+    if( useLdltDecomposition )
+    {
+        return ldltDecomposition.solve( rightHandSideVector );
+    }
+    else
+    {
+        return solveSystemOfEquationsWithSvd(
+                    matrixToInvert, rightHandSideVector, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+}
+
 //! Function to multiply information matrix by diagonal weights matrix
 Eigen::MatrixXd multiplyInformationMatrixByDiagonalWeightMatrix(
         const Eigen::MatrixXd& informationMatrix,
@@ -139,6 +170,48 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
                 checkConditionNumber, maximumAllowedConditionNumber );
 }
 
+//! Function to add the contribution of a block of observations to the normal equations
+void addBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSideVector )
+{
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding block to normal equations, number of observations is inconsistent" );
+    }
+
+    if( ( inverseOfCovarianceMatrix.rows( ) != informationMatrixBlock.cols( ) ) ||
+            ( inverseOfCovarianceMatrix.cols( ) != informationMatrixBlock.cols( ) ) ||
+            ( rightHandSideVector.rows( ) != informationMatrixBlock.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when adding block to normal equations, number of parameters is inconsistent" );
+    }
+
+    inverseOfCovarianceMatrix.noalias( ) += informationMatrixBlock.transpose( ) *
+            multiplyInformationMatrixByDiagonalWeightMatrix( informationMatrixBlock, diagonalOfWeightMatrixBlock );
+    rightHandSideVector.noalias( ) += informationMatrixBlock.transpose( ) *
+            ( diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to perform an iteration of least squares estimation from accumulated normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSideVector,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber )
+{
+    Eigen::MatrixXd inverseOfUpdatedCovarianceMatrix = inverseOfAPrioriCovarianceMatrix + inverseOfCovarianceMatrix;
+    return std::make_pair( solveSymmetricSystemOfEquationsWithLdlt(
+                               inverseOfUpdatedCovarianceMatrix, rightHandSideVector,
+                               checkConditionNumber, maximumAllowedConditionNumber ),
+                           inverseOfUpdatedCovarianceMatrix );
+}
+
 //! Function to fit a univariate polynomial through a set of data
 Eigen::VectorXd getLeastSquaresPolynomialFit(
         const Eigen::VectorXd& independentValues,
@@ -15,6 +15,7 @@
 #include <map>
 
 #include <Eigen/Core>
+#include <Eigen/Cholesky>
 #include <Eigen/SVD>
 
 namespace tudat
@@ -56,6 +57,26 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
                                                const bool checkConditionNumber = 1,
                                                const double maximumAllowedConditionNumber = 1.0E-8 );
 
+//! Solve symmetric system of equations with LDLT decomposition, using SVD decomposition if ill-conditioned
+/*!
+ * Solve symmetric system of equations with LDLT decomposition (i.e. Cholesky decomposition without square roots), as is
+ * typically used to solve normal equations. If the decomposition fails, the matrix is not positive definite, or the
+ * (estimated) condition number exceeds maximumAllowedConditionNumber, the system is instead solved using the SVD
+ * decomposition (see solveSystemOfEquationsWithSvd). This function solves A*x = b for the vector x.
+ * \param matrixToInvert Symmetric matrix A that is to be inverted to solve the equation
+ * \param rightHandSideVector Vector on the righthandside of the matrix equation that is to be solved
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (if its
+ * estimate exceeds maximumAllowedConditionNumber, the SVD decomposition is used; a warning is then printed only if the
+ * condition number computed from the SVD decomposition also exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the matrix for which the LDLT decomposition
+ * is used.
+ * \return Solution x of matrix equation A*x=b
+ */
+Eigen::VectorXd solveSymmetricSystemOfEquationsWithLdlt( const Eigen::MatrixXd& matrixToInvert,
+                                                         const Eigen::VectorXd& rightHandSideVector,
+                                                         const bool checkConditionNumber = 1,
+                                                         const double maximumAllowedConditionNumber = 1.0E8 );
+
 //! Function to multiply information matrix by diagonal weights matrix
 /*!
  * Function to multiply information matrix by diagonal weights matrix
@@ -160,6 +181,51 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Function to add the contribution of a block of observations to the normal equations
+/*!
+ * Function to add the contribution of a block of observations to the normal equations (without a priori information),
+ * i.e. to add A^T*W*A to the inverse covariance matrix, and A^T*W*y to the right-hand side, with A the partials of the
+ * block of observations, W the diagonal weight matrix and y the residuals. Calling this function for consecutive blocks
+ * of rows of the full information matrix produces the same normal equations as calculateInverseOfUpdatedCovarianceMatrix,
+ * without the need to store the full information matrix.
+ * \param informationMatrixBlock Matrix containing partial derivatives of block of observations (rows) w.r.t. estimated
+ * parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations of block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of block
+ * \param inverseOfCovarianceMatrix Inverse of covariance matrix to which contribution of block is added (modified by
+ * reference)
+ * \param rightHandSideVector Right-hand side of normal equations to which contribution of block is added (modified by
+ * reference)
+ */
+void addBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSideVector );
+
+//! Function to perform an iteration of least squares estimation from accumulated normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from accumulated normal equations (see
+ * addBlockToNormalEquations), and a priori information. The normal equations are solved using
+ * solveSymmetricSystemOfEquationsWithLdlt.
+ * \param inverseOfCovarianceMatrix Accumulated inverse covariance matrix A^T*W*A, without a priori information.
+ * \param rightHandSideVector Accumulated right-hand side of normal equations A^T*W*y
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (if its
+ * estimate exceeds maximumAllowedConditionNumber, the SVD decomposition is used; a warning is then printed only if the
+ * condition number computed from the SVD decomposition also exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix for which the LDLT
+ * decomposition is used.
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSideVector,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8 );
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
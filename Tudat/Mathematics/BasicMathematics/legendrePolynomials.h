@@ -31,6 +31,8 @@
 #define TUDAT_LEGENDRE_POLYNOMIALS_H
 
 #include <cstddef>
+#include <vector>
+
 #include <boost/bind.hpp>
 
 #include <boost/circular_buffer.hpp>
@@ -136,6 +138,28 @@ public:
     */
     double getLegendrePolynomialSecondDerivative( const int degree, const int order );
 
+    //! Function to retrieve the full list of current values of Legendre polynomials.
+    /*!
+     * Function to retrieve the full list of current values of Legendre polynomials, as computed by last call to update
+     * function. The polynomial at degree and order (n,m) is at entry n * ( maximumOrder + 1 ) + m.
+     * \return List of current values of Legendre polynomials.
+     */
+    const std::vector< double >& getLegendrePolynomialList( )
+    {
+        return legendreValues_;
+    }
+
+    //! Function to retrieve the full list of current values of first derivatives of Legendre polynomials.
+    /*!
+     * Function to retrieve the full list of current values of first derivatives of Legendre polynomials, as computed by
+     * last call to update function. The derivative at degree and order (n,m) is at entry n * ( maximumOrder + 1 ) + m.
+     * \return List of current values of first derivatives of Legendre polynomials.
+     */
+    const std::vector< double >& getLegendrePolynomialDerivativeList( )
+    {
+        return legendreDerivatives_;
+    }
+
     //! Function to get the maximum degree of cache.
     /*!
      * Function to get the maximum degree of cache
@@ -36,6 +36,30 @@ void SphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegre
     sinesOfLongitude_.resize( maximumOrder_ + 1 );
     cosinesOfLongitude_.resize( maximumOrder_ + 1 );
     referenceRadiusRatioPowers_.resize( maximumDegree_ + 2 );
+
+    orderMajorLegendrePolynomials_.setZero( maximumDegree_ + 1, maximumOrder_ + 1 );
+    orderMajorLegendrePolynomialDerivatives_.setZero( maximumDegree_ + 1, maximumOrder_ + 1 );
+    orderMajorPolynomialParameter_ = TUDAT_NAN;
+}
+
+//! Function to update the order-major copies of the current Legendre polynomials and their derivatives.
+void SphericalHarmonicsCache::updateOrderMajorLegendrePolynomials( )
+{
+    // Check if update is needed.
+    const double currentPolynomialParameter = legendreCache_->getCurrentPolynomialParameter( );
+    if( !( orderMajorPolynomialParameter_ == currentPolynomialParameter ) )
+    {
+        orderMajorPolynomialParameter_ = currentPolynomialParameter;
+
+        // Legendre cache stores values degree-major (entry n * ( maximumOrder + 1 ) + m); the assignment to the
+        // (column-major) Eigen matrices transposes the storage order.
+        typedef Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > RowMajorMatrix;
+        orderMajorLegendrePolynomials_ = Eigen::Map< const RowMajorMatrix >(
+                    legendreCache_->getLegendrePolynomialList( ).data( ), maximumDegree_ + 1, maximumOrder_ + 1 );
+        orderMajorLegendrePolynomialDerivatives_ = Eigen::Map< const RowMajorMatrix >(
+                    legendreCache_->getLegendrePolynomialDerivativeList( ).data( ),
+                    maximumDegree_ + 1, maximumOrder_ + 1 );
+    }
 }
 
 
@@ -12,6 +12,8 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_H
 #define TUDAT_SPHERICAL_HARMONICS_H
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include <boost/make_shared.hpp>
@@ -128,6 +130,48 @@ public:
         return referenceRadiusRatioPowers_[ degreePlusOne ];
     }
 
+    //! Function to get the full list of integer powers of the distance divided by the reference radius.
+    /*!
+     * Function to get the full list of integer powers of the distance divided by the reference radius. Entry i
+     * denotes (reference radius/distance) to the power i.
+     * \return List of powers of reference radius divided by distance.
+     */
+    const std::vector< double >& getReferenceRadiusRatioPowersList( )
+    {
+        return referenceRadiusRatioPowers_;
+    }
+
+    //! Function to update the order-major copies of the current Legendre polynomials and their derivatives.
+    /*!
+     * Function to update the order-major copies of the current Legendre polynomials and their derivatives. In these
+     * copies, the values for all degrees at a single order are stored contiguously in memory (column-major storage),
+     * allowing the spherical harmonic summation to be vectorized per order. The copies are only recomputed if the
+     * Legendre polynomials have changed since the last call to this function.
+     */
+    void updateOrderMajorLegendrePolynomials( );
+
+    //! Function to retrieve the order-major copy of the current Legendre polynomials.
+    /*!
+     * Function to retrieve the order-major copy of the current Legendre polynomials, as computed by the last call to
+     * updateOrderMajorLegendrePolynomials. Entry (n,m) denotes the polynomial at degree n and order m.
+     * \return Order-major copy of the current Legendre polynomials.
+     */
+    const Eigen::MatrixXd& getOrderMajorLegendrePolynomials( )
+    {
+        return orderMajorLegendrePolynomials_;
+    }
+
+    //! Function to retrieve the order-major copy of the current Legendre polynomial derivatives.
+    /*!
+     * Function to retrieve the order-major copy of the current Legendre polynomial derivatives, as computed by the last
+     * call to updateOrderMajorLegendrePolynomials. Entry (n,m) denotes the derivative at degree n and order m.
+     * \return Order-major copy of the current Legendre polynomial derivatives.
+     */
+    const Eigen::MatrixXd& getOrderMajorLegendrePolynomialDerivatives( )
+    {
+        return orderMajorLegendrePolynomialDerivatives_;
+    }
+
     //! Function to get the maximum degree of cache.
     /*!
      * Function to get the maximum degree of cache
@@ -242,6 +286,15 @@ private:
     //! Object for caching and computing Legendre polynomials.
     boost::shared_ptr< LegendreCache > legendreCache_;
 
+    //! Order-major copy of current Legendre polynomials (entry (n,m) at degree n and order m).
+    Eigen::MatrixXd orderMajorLegendrePolynomials_;
+
+    //! Order-major copy of current Legendre polynomial derivatives (entry (n,m) at degree n and order m).
+    Eigen::MatrixXd orderMajorLegendrePolynomialDerivatives_;
+
+    //! Polynomial parameter at which order-major copies of Legendre polynomials were last updated.
+    double orderMajorPolynomialParameter_;
+
 
 
 };
@@ -11,13 +11,20 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include <boost/make_shared.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
+#include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
 
 namespace tudat
 {
@@ -318,7 +325,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_boundary )
                         lagrangeInterpolator.interpolate( currentTestIndependentVariable );
 
                     }
-                    catch( std::runtime_error )
+                    catch( const std::runtime_error& )
                     {
                         runtimeErrorOccurred = 1;
                     }
@@ -346,7 +353,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_boundary )
                         lagrangeInterpolator.interpolate( currentTestIndependentVariable );
 
                     }
-                    catch( std::runtime_error )
+                    catch( const std::runtime_error& )
                     {
                         runtimeErrorOccurred = true;
                     }
@@ -379,7 +386,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         dataMap, 8, interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -397,7 +404,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -416,7 +423,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -443,7 +450,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         dataMap, 8, interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -469,7 +476,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -499,7 +506,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                             dataMap, numberOfStages, interpolators::huntingAlgorithm,
                             interpolators::lagrange_no_boundary_interpolation );
             }
-            catch( std::runtime_error )
+            catch( const std::runtime_error& )
             {
                 runtimeErrorOccurred = true;
             }
@@ -524,7 +531,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                             interpolators::huntingAlgorithm,
                             interpolators::lagrange_no_boundary_interpolation );
             }
-            catch( std::runtime_error )
+            catch( const std::runtime_error& )
             {
                 runtimeErrorOccurred = true;
             }
@@ -554,7 +561,7 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
                         interpolators::huntingAlgorithm,
                         interpolators::lagrange_no_boundary_interpolation );
         }
-        catch( std::runtime_error )
+        catch( const std::runtime_error& )
         {
             runtimeErrorOccurred = true;
         }
@@ -565,7 +572,280 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
     }
 }
 
+// Test to check whether batch interpolation gives the same results as interpolation at single values
+BOOST_AUTO_TEST_CASE( test_batch_interpolation )
+{
+    // Create data on irregular grid.
+    std::map< double, Eigen::VectorXd > dataMap;
+    std::map< double, double > scalarDataMap;
+    std::vector< Eigen::VectorXd > derivativeValues;
+    std::vector< double > scalarDerivativeValues;
+    double currentIndependentVariable = 0.0;
+    for( int i = 0; i < 200; i++ )
+    {
+        currentIndependentVariable += 1.0 + 0.5 * std::sin( static_cast< double >( i ) );
+        Eigen::VectorXd currentDependentVariable = Eigen::VectorXd::Zero( 3 );
+        currentDependentVariable << std::sin( 0.1 * currentIndependentVariable ),
+                std::cos( 0.03 * currentIndependentVariable ), 1.0E3 * std::exp( -0.01 * currentIndependentVariable );
+        dataMap[ currentIndependentVariable ] = currentDependentVariable;
+        scalarDataMap[ currentIndependentVariable ] = currentDependentVariable( 0 );
+
+        // Derivatives, for Hermite interpolation.
+        Eigen::VectorXd currentDerivative = Eigen::VectorXd::Zero( 3 );
+        currentDerivative << 0.1 * std::cos( 0.1 * currentIndependentVariable ),
+                -0.03 * std::sin( 0.03 * currentIndependentVariable ),
+                -10.0 * std::exp( -0.01 * currentIndependentVariable );
+        derivativeValues.push_back( currentDerivative );
+        scalarDerivativeValues.push_back( currentDerivative( 0 ) );
+    }
+
+    // Create sorted list of interpolation points: dense (several per interval), sparse, at nodes, in boundary region
+    // and with duplicates.
+    std::vector< double > independentVariableValues;
+    for( double currentValue = dataMap.begin( )->first; currentValue < dataMap.rbegin( )->first;
+         currentValue += 0.137 )
+    {
+        independentVariableValues.push_back( currentValue );
+    }
+    for( std::map< double, double >::const_iterator dataIterator = scalarDataMap.begin( );
+         dataIterator != scalarDataMap.end( ); dataIterator++ )
+    {
+        independentVariableValues.push_back( dataIterator->first );
+    }
+    independentVariableValues.push_back( 100.0 );
+    independentVariableValues.push_back( 100.0 );
+    std::sort( independentVariableValues.begin( ), independentVariableValues.end( ) );
+
+    std::vector< double > sparseIndependentVariableValues;
+    for( unsigned int i = 0; i < independentVariableValues.size( ); i += 37 )
+    {
+        sparseIndependentVariableValues.push_back( independentVariableValues.at( i ) );
+    }
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        std::vector< double > currentIndependentVariableValues =
+                ( testCase == 0 ) ? independentVariableValues : sparseIndependentVariableValues;
+
+        // Create interpolators.
+        std::vector< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > >
+                vectorInterpolators;
+        std::vector< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > >
+                scalarInterpolators;
+        for( int numberOfStages = 4; numberOfStages <= 12; numberOfStages += 4 )
+        {
+            vectorInterpolators.push_back(
+                        boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::VectorXd > >(
+                            dataMap, numberOfStages ) );
+            scalarInterpolators.push_back(
+                        boost::make_shared< interpolators::LagrangeInterpolator< double, double > >(
+                            scalarDataMap, numberOfStages ) );
+        }
+        vectorInterpolators.push_back(
+                    boost::make_shared< interpolators::LinearInterpolator< double, Eigen::VectorXd > >( dataMap ) );
+        vectorInterpolators.push_back(
+                    boost::make_shared< interpolators::HermiteCubicSplineInterpolator< double, Eigen::VectorXd > >(
+                        dataMap, derivativeValues ) );
+        scalarInterpolators.push_back(
+                    boost::make_shared< interpolators::CubicSplineInterpolator< double, double > >( scalarDataMap ) );
+        scalarInterpolators.push_back(
+                    boost::make_shared< interpolators::HermiteCubicSplineInterpolator< double, double > >(
+                        scalarDataMap, scalarDerivativeValues ) );
+
+        // Compare batch interpolation with single-value interpolation (using newly created interpolators).
+        for( unsigned int i = 0; i < vectorInterpolators.size( ); i++ )
+        {
+            std::vector< Eigen::VectorXd > batchInterpolatedValues(
+                        currentIndependentVariableValues.size( ), Eigen::VectorXd::Zero( 3 ) );
+            vectorInterpolators.at( i )->interpolateBatch( currentIndependentVariableValues, batchInterpolatedValues );
 
+            for( unsigned int j = 0; j < currentIndependentVariableValues.size( ); j++ )
+            {
+                Eigen::VectorXd singleInterpolatedValue =
+                        vectorInterpolators.at( i )->interpolate( currentIndependentVariableValues.at( j ) );
+                for( int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( batchInterpolatedValues.at( j )( k ) - singleInterpolatedValue( k ),
+                                       1.0E-13 * std::max( std::fabs( singleInterpolatedValue( k ) ), 1.0 ) );
+                }
+            }
+        }
+
+        for( unsigned int i = 0; i < scalarInterpolators.size( ); i++ )
+        {
+            std::vector< double > batchInterpolatedValues( currentIndependentVariableValues.size( ) );
+            scalarInterpolators.at( i )->interpolateBatch( currentIndependentVariableValues, batchInterpolatedValues );
+
+            for( unsigned int j = 0; j < currentIndependentVariableValues.size( ); j++ )
+            {
+                BOOST_CHECK_SMALL( batchInterpolatedValues.at( j ) -
+                                   scalarInterpolators.at( i )->interpolate( currentIndependentVariableValues.at( j ) ),
+                                   1.0E-14 );
+            }
+        }
+    }
+
+    // Check that unsorted or inconsistent input is rejected
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > interpolator =
+            boost::make_shared< interpolators::LagrangeInterpolator< double, double > >( scalarDataMap, 8 );
+    std::vector< double > unsortedIndependentVariableValues = { 50.0, 40.0 };
+    std::vector< double > interpolatedValues( 2 );
+    bool runtimeErrorOccurred = false;
+    try
+    {
+        interpolator->interpolateBatch( unsortedIndependentVariableValues, interpolatedValues );
+    }
+    catch( const std::runtime_error& )
+    {
+        runtimeErrorOccurred = true;
+    }
+    BOOST_CHECK_EQUAL( runtimeErrorOccurred, true );
+
+    interpolatedValues.resize( 3 );
+    runtimeErrorOccurred = false;
+    try
+    {
+        interpolator->interpolateBatch( independentVariableValues, interpolatedValues );
+    }
+    catch( const std::runtime_error& )
+    {
+        runtimeErrorOccurred = true;
+    }
+    BOOST_CHECK_EQUAL( runtimeErrorOccurred, true );
+}
+
+// Test to check the interval to which the hunting algorithm look-up scheme assigns values that coincide with a data
+// point. The interval starting at the data point is used (as for the binary search), independently of the previous
+// look-up. Previously, the interval ending at the data point was returned if the previous look-up was in that interval,
+// so that the result depended on the order of the look-ups.
+BOOST_AUTO_TEST_CASE( test_hunting_lookup_at_nodes )
+{
+    std::vector< double > independentVariableValues;
+    for( int i = 0; i < 10; i++ )
+    {
+        independentVariableValues.push_back( std::pow( static_cast< double >( i ), 1.5 ) );
+    }
+
+    interpolators::HuntingAlgorithmLookupScheme< double > huntingLookupScheme( independentVariableValues );
+    interpolators::BinarySearchLookupScheme< double > binaryLookupScheme( independentVariableValues );
+
+    // Look-up at node 4 after look-up in interval ending at node 4 (previously returned 3).
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( 0.5 * ( independentVariableValues[ 3 ] +
+                                                                             independentVariableValues[ 4 ] ) ), 3 );
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( independentVariableValues[ 4 ] ), 4 );
+
+    // Look-up at node 4 after look-up in interval starting at node 4 (unchanged).
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( 0.5 * ( independentVariableValues[ 4 ] +
+                                                                             independentVariableValues[ 5 ] ) ), 4 );
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( independentVariableValues[ 4 ] ), 4 );
+
+    // Look-up at all nodes, after look-ups in all intervals, should give same result as binary search.
+    for( unsigned int i = 0; i < independentVariableValues.size( ) - 1; i++ )
+    {
+        for( unsigned int j = 0; j < independentVariableValues.size( ); j++ )
+        {
+            huntingLookupScheme.findNearestLowerNeighbour(
+                        0.5 * ( independentVariableValues[ i ] + independentVariableValues[ i + 1 ] ) );
+            BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( independentVariableValues[ j ] ),
+                               binaryLookupScheme.findNearestLowerNeighbour( independentVariableValues[ j ] ) );
+        }
+    }
+
+    // Values at the last node are assigned to the last interval.
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( independentVariableValues[ 9 ] ), 8 );
+}
+
+//! Function to interpolate at a list of values, one at a time (used as thread function)
+void interpolateAtValues(
+        const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > interpolator,
+        const std::vector< double >& independentVariableValues,
+        std::vector< Eigen::VectorXd >& interpolatedValues )
+{
+    for( unsigned int i = 0; i < independentVariableValues.size( ); i++ )
+    {
+        interpolatedValues.push_back( interpolator->interpolate( independentVariableValues[ i ] ) );
+    }
+}
+
+// Test to check whether an interpolator with a hunting algorithm look-up scheme gives the same results when used
+// concurrently from several threads, as when used on a single thread with a binary search (also to be run with
+// ThreadSanitizer, see USE_THREAD_SANITIZER).
+BOOST_AUTO_TEST_CASE( test_concurrent_interpolation )
+{
+    // Create data on irregular grid.
+    std::map< double, Eigen::VectorXd > dataMap;
+    double currentIndependentVariable = 0.0;
+    for( int i = 0; i < 200; i++ )
+    {
+        currentIndependentVariable += 1.0 + 0.5 * std::sin( static_cast< double >( i ) );
+        Eigen::VectorXd currentDependentVariable = Eigen::VectorXd::Zero( 3 );
+        currentDependentVariable << std::sin( 0.1 * currentIndependentVariable ),
+                std::cos( 0.03 * currentIndependentVariable ), 1.0E3 * std::exp( -0.01 * currentIndependentVariable );
+        dataMap[ currentIndependentVariable ] = currentDependentVariable;
+    }
+
+    // Create interpolation points (at and between nodes) in different order for each thread.
+    const unsigned int numberOfThreads = 4;
+    std::vector< double > independentVariableValues;
+    for( std::map< double, Eigen::VectorXd >::const_iterator dataIterator = dataMap.begin( );
+         dataIterator != dataMap.end( ); dataIterator++ )
+    {
+        independentVariableValues.push_back( dataIterator->first );
+        if( dataIterator->first < dataMap.rbegin( )->first )
+        {
+            independentVariableValues.push_back( dataIterator->first + 0.3 );
+        }
+    }
+    std::vector< std::vector< double > > threadIndependentVariableValues( numberOfThreads );
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        threadIndependentVariableValues[ i ] = independentVariableValues;
+        std::rotate( threadIndependentVariableValues[ i ].begin( ),
+                     threadIndependentVariableValues[ i ].begin( ) + 97 * i,
+                     threadIndependentVariableValues[ i ].end( ) );
+        if( i % 2 == 1 )
+        {
+            std::reverse( threadIndependentVariableValues[ i ].begin( ), threadIndependentVariableValues[ i ].end( ) );
+        }
+    }
+
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > sharedInterpolator =
+            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::VectorXd > >(
+                dataMap, 8, interpolators::huntingAlgorithm );
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > referenceInterpolator =
+            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::VectorXd > >(
+                dataMap, 8, interpolators::binarySearch );
+
+    // Interpolate concurrently with shared interpolator.
+    std::vector< std::vector< Eigen::VectorXd > > threadInterpolatedValues( numberOfThreads );
+    std::vector< std::thread > interpolationThreads;
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        interpolationThreads.push_back(
+                    std::thread( &interpolateAtValues, sharedInterpolator,
+                                 std::cref( threadIndependentVariableValues[ i ] ),
+                                 std::ref( threadInterpolatedValues[ i ] ) ) );
+    }
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        interpolationThreads.at( i ).join( );
+    }
+
+    // Results should be bit-wise identical to those with a binary search.
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        BOOST_CHECK_EQUAL( threadInterpolatedValues[ i ].size( ), threadIndependentVariableValues[ i ].size( ) );
+        for( unsigned int j = 0; j < threadInterpolatedValues[ i ].size( ); j++ )
+        {
+            Eigen::VectorXd expectedValue =
+                    referenceInterpolator->interpolate( threadIndependentVariableValues[ i ][ j ] );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_EQUAL( threadInterpolatedValues[ i ][ j ]( k ), expectedValue( k ) );
+            }
+        }
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
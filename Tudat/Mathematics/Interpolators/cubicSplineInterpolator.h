@@ -222,13 +222,50 @@ public:
     DependentVariableType interpolate(
             const IndependentVariableType targetIndependentVariableValue )
     {
-        using std::pow;
-
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+protected:
+
+    //! Function to perform interpolation at a list of sorted independent variable values.
+    /*!
+     * Function to perform interpolation at a list of independent variable values, sorted in ascending order, reusing
+     * the nearest lower neighbour of the previous value in the look-up of the next value.
+     * \param independentVariableValues Pointer to first of the independent variable values at which interpolation is to
+     * be performed.
+     * \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     * \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored.
+     */
+    void performBatchInterpolation( const IndependentVariableType* independentVariableValues,
+                                    const int numberOfValues,
+                                    DependentVariableType* interpolatedValues )
+    {
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( independentVariableValues[ 0 ] );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            lowerEntry = this->findNearestLowerNeighbourOfSortedValue( independentVariableValues[ i ], lowerEntry );
+            interpolatedValues[ i ] = interpolateInInterval( independentVariableValues[ i ], lowerEntry );
+        }
+    }
+
+private:
+
+    //! Function to evaluate the cubic spline in a given interval.
+    /*!
+     * Function to evaluate the cubic spline in a given interval.
+     * \param targetIndependentVariableValue Target independent variable value at which point the interpolation is
+     * performed.
+     * \param lowerEntry_ Index of the lower bound of the interval in which to interpolate.
+     * \return Interpolated dependent variable value.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry_ )
+    {
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
         ScalarType squareDifference;
@@ -253,10 +290,6 @@ public:
                 coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
     }
 
-protected:
-
-private:
-
     //! Calculates the second derivatives of the curve.
     /*!
      * This function calculates the second derivatives of the curve at the nodes, assuming
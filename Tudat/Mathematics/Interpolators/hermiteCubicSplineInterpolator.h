@@ -130,6 +130,42 @@ public:
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+protected:
+
+    //! Function to perform interpolation at a list of sorted independent variable values.
+    /*!
+     * Function to perform interpolation at a list of independent variable values, sorted in ascending order, reusing
+     * the nearest lower neighbour of the previous value in the look-up of the next value.
+     * \param independentVariableValues Pointer to first of the independent variable values at which interpolation is to
+     * be performed.
+     * \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     * \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored.
+     */
+    void performBatchInterpolation( const IndependentVariableType* independentVariableValues,
+                                    const int numberOfValues,
+                                    DependentVariableType* interpolatedValues )
+    {
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( independentVariableValues[ 0 ] );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            lowerEntry = this->findNearestLowerNeighbourOfSortedValue( independentVariableValues[ i ], lowerEntry );
+            interpolatedValues[ i ] = interpolateInInterval( independentVariableValues[ i ], lowerEntry );
+        }
+    }
+
+    //! Function to evaluate the Hermite spline in a given interval.
+    /*!
+     * Function to evaluate the Hermite spline in a given interval.
+     * \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     * \param lowerEntry_ Index of the lower bound of the interval in which to interpolate.
+     * \return Interpolated value of interpolated dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry_ )
+    {
         // Compute Hermite spline
         IndependentVariableType factor = ( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] )
                 /( independentValues_[ lowerEntry_ + 1 ] - independentValues_[ lowerEntry_ ] );
@@ -142,8 +178,6 @@ public:
         return targetValue;
     }
 
-protected:
-
     //! Compute coefficients of the splines
     void computeCoefficients( )
     {
@@ -15,10 +15,13 @@
 #ifndef TUDAT_LAGRANGEINTERPOLATOR_H
 #define TUDAT_LAGRANGEINTERPOLATOR_H
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/make_shared.hpp>
 
+#include <Eigen/Core>
+
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
@@ -40,6 +43,97 @@ enum LagrangeInterpolatorBoundaryHandling
     lagrange_no_boundary_interpolation = 1
 };
 
+//! Class to compute the Lagrange basis polynomials for a list of independent variable values.
+/*!
+ *  Class to compute the values of the Lagrange basis polynomials (i.e. the weights of the dependent variable values at
+ *  the nodes) for a list of independent variable values, all of which use the same set of nodes. This generic
+ *  implementation loops over all values and nodes, a vectorized specialization is provided for double precision.
+ */
+template< typename IndependentVariableType, typename ScalarType >
+class LagrangeBasisWeightsCalculator
+{
+public:
+
+    //! Function to compute the Lagrange basis polynomials for a list of independent variable values.
+    /*!
+     *  Function to compute the Lagrange basis polynomials for a list of independent variable values. For each value x,
+     *  the weight of node k is computed as N / ( ( x - x_k ) * D_k ), with N the product of ( x - x_j ) over all nodes
+     *  j, and D_k the (pre-computed) product of ( x_k - x_j ) over all nodes j != k. None of the independent variable
+     *  values may be equal to one of the nodes.
+     *  \param independentVariableValues Pointer to first independent variable value for which to compute the weights.
+     *  \param numberOfValues Number of independent variable values for which to compute the weights.
+     *  \param nodes Pointer to first node of the interpolating polynomial.
+     *  \param denominators Pointer to first pre-computed denominator D_k of the interpolating polynomial.
+     *  \param numberOfNodes Number of nodes of the interpolating polynomial.
+     *  \param weights Computed weights (returned by reference); entry (i,k) denotes weight of node k for value i. Must
+     *  have at least numberOfValues rows and numberOfNodes columns.
+     *  \param repeatedNumerators Vector used to store the numerator N for each value, must have at least numberOfValues
+     *  entries.
+     */
+    static void computeWeights(
+            const IndependentVariableType* independentVariableValues, const int numberOfValues,
+            const IndependentVariableType* nodes, const ScalarType* denominators, const int numberOfNodes,
+            Eigen::Array< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& weights,
+            Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& repeatedNumerators )
+    {
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            repeatedNumerators( i ) = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+            for( int k = 0; k < numberOfNodes; k++ )
+            {
+                weights( i, k ) = static_cast< ScalarType >( independentVariableValues[ i ] - nodes[ k ] );
+                repeatedNumerators( i ) *= weights( i, k );
+            }
+
+            for( int k = 0; k < numberOfNodes; k++ )
+            {
+                weights( i, k ) = repeatedNumerators( i ) / ( weights( i, k ) * denominators[ k ] );
+            }
+        }
+    }
+};
+
+//! Class to compute the Lagrange basis polynomials for a list of independent variable values, for double precision.
+/*!
+ *  Class to compute the Lagrange basis polynomials for a list of independent variable values, for double precision
+ *  independent variables and computations. All operations are performed on columns of the weights matrix, i.e.
+ *  simultaneously for all independent variable values, using the vectorized array operations of Eigen.
+ */
+template< >
+class LagrangeBasisWeightsCalculator< double, double >
+{
+public:
+
+    //! Function to compute the Lagrange basis polynomials for a list of independent variable values.
+    /*!
+     *  Function to compute the Lagrange basis polynomials for a list of independent variable values.
+     *  \sa LagrangeBasisWeightsCalculator::computeWeights
+     */
+    static void computeWeights(
+            const double* independentVariableValues, const int numberOfValues,
+            const double* nodes, const double* denominators, const int numberOfNodes,
+            Eigen::ArrayXXd& weights,
+            Eigen::ArrayXd& repeatedNumerators )
+    {
+        Eigen::Map< const Eigen::ArrayXd > values( independentVariableValues, numberOfValues );
+
+        // Compute differences w.r.t. nodes, and their product.
+        repeatedNumerators.head( numberOfValues ).setOnes( );
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            weights.col( k ).head( numberOfValues ) = values - nodes[ k ];
+            repeatedNumerators.head( numberOfValues ) *= weights.col( k ).head( numberOfValues );
+        }
+
+        // Compute weights from differences.
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            weights.col( k ).head( numberOfValues ) = repeatedNumerators.head( numberOfValues ) /
+                    ( weights.col( k ).head( numberOfValues ) * denominators[ k ] );
+        }
+    }
+};
+
 //! Class to perform Lagrange polynomial interpolation
 /*!
  *  Class to perform Lagrange polynomial interpolation from a set of independent and
@@ -131,9 +225,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -196,8 +287,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -287,18 +376,16 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // Set up repeated numerator from which interpolant is created. The differences w.r.t. the
+                // independent variable values are recomputed below, instead of cached in a member variable, so
+                // that the interpolator can be used concurrently.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
 
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
                 // Evaluate interpolating polynomial at requested data point.
@@ -307,7 +394,7 @@ public:
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
+                              ( static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ j ] ) *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
                 }
             }
@@ -329,8 +416,78 @@ public:
 
 protected:
 
+    //! Function to perform interpolation at a list of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, sorted in ascending order. Subsequent
+     *  values that fall in the same interval share the same interpolating polynomial, for which the Lagrange basis
+     *  polynomials are evaluated simultaneously (see LagrangeBasisWeightsCalculator), in blocks of at most
+     *  maximumBatchBlockSize_ values. Values in the boundary regions of the domain, and values equal to a node, are
+     *  handled by the interpolate function.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which interpolation is
+     *  to be performed.
+     *  \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     *  \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored.
+     */
+    void performBatchInterpolation( const IndependentVariableType* independentVariableValues,
+                                    const int numberOfValues,
+                                    DependentVariableType* interpolatedValues )
+    {
+        const int numberOfNodes = 2 * offsetEntries_ + 2;
+        const int blockSize = ( numberOfValues < maximumBatchBlockSize_ ) ? numberOfValues : maximumBatchBlockSize_;
+        Eigen::Array< ScalarType, Eigen::Dynamic, Eigen::Dynamic > weights( blockSize, numberOfNodes );
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 > repeatedNumerators( blockSize );
+
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( independentVariableValues[ 0 ] );
+        int currentIndex = 0;
+        while( currentIndex < numberOfValues )
+        {
+            lowerEntry = this->findNearestLowerNeighbourOfSortedValue(
+                        independentVariableValues[ currentIndex ], lowerEntry );
+
+            // Use single-value interpolation in boundary regions, or at node.
+            if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 ||
+                    independentValues_[ lowerEntry ] == independentVariableValues[ currentIndex ] )
+            {
+                interpolatedValues[ currentIndex ] = interpolate( independentVariableValues[ currentIndex ] );
+                currentIndex++;
+                continue;
+            }
+
+            // Find all subsequent values in current interval (which are not equal to a node).
+            int numberOfValuesInBlock = 1;
+            while( currentIndex + numberOfValuesInBlock < numberOfValues && numberOfValuesInBlock < blockSize &&
+                   independentVariableValues[ currentIndex + numberOfValuesInBlock ] <
+                   independentValues_[ lowerEntry + 1 ] )
+            {
+                numberOfValuesInBlock++;
+            }
+
+            // Compute Lagrange basis polynomials for all values in current block.
+            const int firstNodeIndex = lowerEntry - offsetEntries_;
+            LagrangeBasisWeightsCalculator< IndependentVariableType, ScalarType >::computeWeights(
+                        independentVariableValues + currentIndex, numberOfValuesInBlock,
+                        &independentValues_[ firstNodeIndex ], &denominators[ lowerEntry ][ 0 ], numberOfNodes,
+                        weights, repeatedNumerators );
+
+            // Evaluate interpolating polynomial at all values in current block.
+            for( int i = 0; i < numberOfValuesInBlock; i++ )
+            {
+                DependentVariableType& currentInterpolatedValue = interpolatedValues[ currentIndex + i ];
+                currentInterpolatedValue = zeroEntry_;
+                for( int k = 0; k < numberOfNodes; k++ )
+                {
+                    currentInterpolatedValue += dependentValues_[ firstNodeIndex + k ] * weights( i, k );
+                }
+            }
+            currentIndex += numberOfValuesInBlock;
+        }
+    }
+
 private:
 
+    //! Maximum number of values for which Lagrange basis polynomials are computed simultaneously in batch interpolation.
+    static const int maximumBatchBlockSize_ = 64;
+
     //! Function called at initialization which pre-computes the denominators of the
     //! interpolants at each interval.
     /*!
@@ -354,10 +511,10 @@ private:
         // Determine offset from boundary of interpolation interval where interpolant is valid.
         offsetEntries_ = numberOfStages_ / 2 - 1;
 
-        // Iterate over all intervals and calculate denominators
+        // Iterate over all intervals in which centered interpolating polynomial is used, and calculate denominators
         int currentIterationStart;
         denominators.resize( numberOfIndependentValues_ );
-        for( int i = offsetEntries_; i <= numberOfIndependentValues_ - offsetEntries_; i++ )
+        for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1; i++ )
         {
             // Determine start index in independent variables for current polynomial
             currentIterationStart = i - offsetEntries_;
@@ -452,8 +609,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     boost::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
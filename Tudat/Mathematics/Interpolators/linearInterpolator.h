@@ -151,13 +151,51 @@ public:
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
                     independentVariableValue );
 
+        return interpolateInInterval( independentVariableValue, newNearestLowerIndex );
+    }
+
+protected:
+
+    //! Function to perform interpolation at a list of sorted independent variable values.
+    /*!
+     * Function to perform interpolation at a list of independent variable values, sorted in ascending order, reusing
+     * the nearest lower neighbour of the previous value in the look-up of the next value.
+     * \param independentVariableValues Pointer to first of the independent variable values at which interpolation is to
+     * be performed.
+     * \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     * \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored.
+     */
+    void performBatchInterpolation( const IndependentVariableType* independentVariableValues,
+                                    const int numberOfValues,
+                                    DependentVariableType* interpolatedValues )
+    {
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( independentVariableValues[ 0 ] );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            lowerEntry = this->findNearestLowerNeighbourOfSortedValue( independentVariableValues[ i ], lowerEntry );
+            interpolatedValues[ i ] = interpolateInInterval( independentVariableValues[ i ], lowerEntry );
+        }
+    }
+
+private:
+
+    //! Function to perform linear interpolation in a given interval.
+    /*!
+     * Function to perform linear interpolation in a given interval.
+     * \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     * \param nearestLowerIndex Index of the lower bound of the interval in which to interpolate.
+     * \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval( const IndependentVariableType independentVariableValue,
+                                                 const int nearestLowerIndex )
+    {
         // Perform linear interpolation.
-        DependentVariableType interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
-                ( independentVariableValue - independentValues_[ newNearestLowerIndex ] ) /
-                ( independentValues_[ newNearestLowerIndex + 1 ] -
-                  independentValues_[ newNearestLowerIndex ] ) *
-                ( dependentValues_[ newNearestLowerIndex + 1 ] -
-                  dependentValues_[ newNearestLowerIndex ] );
+        DependentVariableType interpolatedValue = dependentValues_[ nearestLowerIndex ] +
+                ( independentVariableValue - independentValues_[ nearestLowerIndex ] ) /
+                ( independentValues_[ nearestLowerIndex + 1 ] -
+                  independentValues_[ nearestLowerIndex ] ) *
+                ( dependentValues_[ nearestLowerIndex + 1 ] -
+                  dependentValues_[ nearestLowerIndex ] );
 
         return interpolatedValue;
     }
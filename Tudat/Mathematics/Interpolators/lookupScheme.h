@@ -12,6 +12,8 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
@@ -80,7 +82,10 @@ protected:
 
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
 /*!
- *  Look-up scheme class for nearest left neighbour search using hunting algorithm.
+ *  Look-up scheme class for nearest left neighbour search using hunting algorithm. The result of the previous call is
+ *  used as initial guess, but does not influence the result: a value that coincides with a data point is always
+ *  assigned to the interval starting at this data point (as is done by the binary search). The initial guess is stored
+ *  atomically, so that a single object may be used by several threads concurrently.
  *  \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -92,15 +97,14 @@ public:
 
     //! Constructor, used to set data vector.
     /*!
-     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 0.
+     *  Constructor, used to set data vector. The first lookup is performed using a binary search.
      * \param independentVariableValues vector of independent variable values in which to perform
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+          previousNearestLowerIndex_( -1 )
     { }
 
     //! Default destructor
@@ -123,20 +127,20 @@ public:
         int newNearestLowerIndex = 0;
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        const int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
+        if ( previousNearestLowerIndex < 0 )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
         }
 
         else
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_,  valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex,  valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
             }
 
             // Otherwise, perform hunting algorithm.
@@ -145,29 +149,30 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
+            }
+
+            // If value coincides with upper bound of interval, use next interval (if any), as for binary search.
+            if( newNearestLowerIndex < static_cast< int >( independentVariableValues_.size( ) ) - 2 &&
+                    !( valueToLookup < independentVariableValues_[ newNearestLowerIndex + 1 ] ) )
+            {
+                newNearestLowerIndex++;
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
-    /*!
-     * Boolean to denote whether a lookup has been done.
-     */
-    bool isFirstLookupDone;
-
     //! Nearest left index during previous call.
     /*!
-     * Nearest left index during previous call
+     * Nearest left index during previous call (negative if no lookup has been done).
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
@@ -213,6 +218,36 @@ public:
     }
 };
 
+//! Function to create a look-up scheme of a given type.
+/*!
+ * Function to create a look-up scheme of a given type.
+ * \param independentVariableValues vector of independent variable values in which to perform
+ * lookup procedure.
+ * \param selectedScheme Type of look-up scheme that is to be created.
+ * \return Look-up scheme of requested type.
+ */
+template< typename IndependentVariableType >
+boost::shared_ptr< LookUpScheme< IndependentVariableType > > createLookupScheme(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const AvailableLookupScheme selectedScheme )
+{
+    boost::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme;
+    switch( selectedScheme )
+    {
+    case binarySearch:
+        lookUpScheme = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                ( new BinarySearchLookupScheme< IndependentVariableType >( independentVariableValues ) );
+        break;
+    case huntingAlgorithm:
+        lookUpScheme = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                ( new HuntingAlgorithmLookupScheme< IndependentVariableType >( independentVariableValues ) );
+        break;
+    default:
+        throw std::runtime_error( "Error, lookup scheme not found when creating look-up scheme" );
+    }
+    return lookUpScheme;
+}
+
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
 typedef boost::shared_ptr< LookUpScheme< double > > LookUpSchemeDoublePointer;
 
@@ -12,6 +12,8 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
@@ -91,6 +93,61 @@ public:
         return interpolate( independentVariableValue );
     }
 
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     * Function to perform interpolation at a list of independent variable values, which must be sorted in ascending
+     * order. The interpolated values are written to a preallocated block of memory. Compared to calling the interpolate
+     * function for each value separately, derived classes may use the ordering of the input to reuse the look-up state
+     * between subsequent values, and to evaluate the interpolant without virtual function calls.
+     * \param independentVariableValues Pointer to first of the independent variable values at which interpolation is to
+     * be performed (sorted in ascending order).
+     * \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     * \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored,
+     * must have at least numberOfValues (initialized) entries.
+     */
+    void interpolateBatch( const IndependentVariableType* independentVariableValues,
+                           const int numberOfValues,
+                           DependentVariableType* interpolatedValues )
+    {
+        if( numberOfValues <= 0 )
+        {
+            return;
+        }
+
+        if( !std::is_sorted( independentVariableValues, independentVariableValues + numberOfValues ) )
+        {
+            throw std::runtime_error(
+                        "Error in batch interpolation, independent variable values are not sorted in ascending order." );
+        }
+
+        performBatchInterpolation( independentVariableValues, numberOfValues, interpolatedValues );
+    }
+
+    //! Function to perform interpolation at a vector of independent variable values.
+    /*!
+     * Function to perform interpolation at a vector of independent variable values, which must be sorted in ascending
+     * order (see function interpolateBatch taking pointers).
+     * \param independentVariableValues Independent variable values at which interpolation is to be performed (sorted in
+     * ascending order).
+     * \param interpolatedValues Interpolated values (returned by reference), must have the same size as
+     * independentVariableValues.
+     */
+    void interpolateBatch( const std::vector< IndependentVariableType >& independentVariableValues,
+                           std::vector< DependentVariableType >& interpolatedValues )
+    {
+        if( independentVariableValues.size( ) != interpolatedValues.size( ) )
+        {
+            throw std::runtime_error(
+                        "Error in batch interpolation, input and output vectors are of different size." );
+        }
+
+        if( !independentVariableValues.empty( ) )
+        {
+            interpolateBatch( independentVariableValues.data( ), static_cast< int >( independentVariableValues.size( ) ),
+                              interpolatedValues.data( ) );
+        }
+    }
+
     //! Function to return the number of independent variables of the interpolation.
     /*!
      *  Function to return the number of independent variables of the interpolation, which is always
@@ -134,6 +191,57 @@ public:
 
 protected:
 
+    //! Function to perform interpolation at a list of sorted independent variable values.
+    /*!
+     * Function to perform interpolation at a list of independent variable values, sorted in ascending order (which is
+     * checked by interpolateBatch before calling this function). By default, the interpolate function is called for
+     * each value. Derived classes may override this function with a more efficient implementation.
+     * \param independentVariableValues Pointer to first of the independent variable values at which interpolation is to
+     * be performed.
+     * \param numberOfValues Number of independent variable values at which interpolation is to be performed.
+     * \param interpolatedValues Pointer to first entry of block in which the interpolated values are to be stored.
+     */
+    virtual void performBatchInterpolation( const IndependentVariableType* independentVariableValues,
+                                            const int numberOfValues,
+                                            DependentVariableType* interpolatedValues )
+    {
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = interpolate( independentVariableValues[ i ] );
+        }
+    }
+
+    //! Function to find the nearest lower neighbour of a value, when looking up values in ascending order.
+    /*!
+     * Function to find the nearest lower neighbour of a value, when looking up values in ascending order. Given the
+     * nearest lower neighbour of the previous (smaller) value, the new value is typically in the same or in the next
+     * interval, which is checked directly. If not, the look-up scheme is used.
+     * \param independentVariableValue Value for which the nearest lower neighbour is to be found.
+     * \param previousNearestLowerIndex Nearest lower neighbour of the previous value that was looked up (which must be
+     * smaller than or equal to independentVariableValue).
+     * \return Nearest lower neighbour of independentVariableValue.
+     */
+    int findNearestLowerNeighbourOfSortedValue( const IndependentVariableType independentVariableValue,
+                                                const int previousNearestLowerIndex )
+    {
+        const int maximumLowerIndex = static_cast< int >( independentValues_.size( ) ) - 2;
+        int nearestLowerIndex = previousNearestLowerIndex;
+        if( nearestLowerIndex < maximumLowerIndex &&
+                !( independentVariableValue < independentValues_[ nearestLowerIndex + 1 ] ) )
+        {
+            if( ( nearestLowerIndex + 1 ) < maximumLowerIndex &&
+                    !( independentVariableValue < independentValues_[ nearestLowerIndex + 2 ] ) )
+            {
+                nearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue );
+            }
+            else
+            {
+                nearestLowerIndex++;
+            }
+        }
+        return nearestLowerIndex;
+    }
+
     //! Make look-up scheme that is to be used.
     /*!
      * This function creates the look-up scheme that is to be used in determining the interval of
@@ -0,0 +1,218 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The dense output of the variable step size integrators is tested on a harmonic oscillator, for which the
+ *      analytical solution is known. In addition, it is checked that requesting the dense output does not change
+ *      the numerical solution, and does not require additional state derivative evaluations.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/bulirschStoerVariableStepsizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/fixedSizeRungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_dense_output )
+
+//! Class to compute the state derivative of a harmonic oscillator, and count the number of evaluations.
+class HarmonicOscillatorStateDerivative
+{
+public:
+
+    //! Constructor.
+    HarmonicOscillatorStateDerivative( ): numberOfEvaluations_( 0 ){ }
+
+    //! Function to compute the state derivative (position and velocity) of a harmonic oscillator with unit frequency.
+    Eigen::VectorXd computeStateDerivative( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations_++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    }
+
+    //! Function to compute the analytical solution of the harmonic oscillator, with initial state (1, 0) at t=0.
+    static Eigen::VectorXd computeAnalyticalState( const double time )
+    {
+        return ( Eigen::VectorXd( 2 ) << std::cos( time ), -std::sin( time ) ).finished( );
+    }
+
+    //! Number of state derivative evaluations.
+    int numberOfEvaluations_;
+};
+
+//! Function to create an integrator of given type for the harmonic oscillator.
+boost::shared_ptr< NumericalIntegrator< > > createDenseOutputTestIntegrator(
+        const int integratorType, const NumericalIntegrator< >::StateDerivativeFunction& stateDerivativeFunction )
+{
+    const Eigen::VectorXd initialState = HarmonicOscillatorStateDerivative::computeAnalyticalState( 0.0 );
+    const Eigen::VectorXd tolerance = Eigen::VectorXd::Constant( 2, 1.0E-12 );
+
+    boost::shared_ptr< NumericalIntegrator< > > integrator;
+    switch( integratorType )
+    {
+    case 0:
+        integrator = boost::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                    RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-6, 0.1, 1.0E-12, 1.0E-12 );
+        break;
+    case 1:
+        integrator = boost::make_shared< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                RungeKuttaCoefficients::rungeKutta87DormandPrince, 2 > >(
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-6, 0.1, 1.0E-12, 1.0E-12 );
+        break;
+    case 2:
+        integrator = boost::make_shared< BulirschStoerVariableStepSizeIntegrator< > >(
+                    getBulirschStoerStepSequence( ), stateDerivativeFunction, 0.0, initialState, 1.0E-6, 0.1,
+                    tolerance, tolerance );
+        break;
+    case 3:
+        integrator = boost::make_shared< AdamsBashforthMoultonIntegrator< > >(
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-6, 0.1, tolerance, tolerance );
+        break;
+    default:
+        throw std::runtime_error( "Error in dense output test, integrator type not recognized" );
+    }
+    return integrator;
+}
+
+//! Test accuracy of dense output, and whether it requires additional state derivative evaluations.
+BOOST_AUTO_TEST_CASE( testDenseOutputAccuracyAndEvaluations )
+{
+    const int numberOfSteps = 50;
+    for( int integratorType = 0; integratorType < 4; integratorType++ )
+    {
+        // Create integrator with and without dense output requests.
+        HarmonicOscillatorStateDerivative stateDerivativeModel, denseOutputStateDerivativeModel;
+        boost::shared_ptr< NumericalIntegrator< > > integrator = createDenseOutputTestIntegrator(
+                    integratorType, boost::bind( &HarmonicOscillatorStateDerivative::computeStateDerivative,
+                                                 &stateDerivativeModel, _1, _2 ) );
+        boost::shared_ptr< NumericalIntegrator< > > denseOutputIntegrator = createDenseOutputTestIntegrator(
+                    integratorType, boost::bind( &HarmonicOscillatorStateDerivative::computeStateDerivative,
+                                                 &denseOutputStateDerivativeModel, _1, _2 ) );
+        BOOST_CHECK( !denseOutputIntegrator->isDenseOutputAvailable( ) );
+
+        double stepSize = 0.05, denseOutputStepSize = 0.05;
+        double maximumStepSize = 0.0;
+        for( int step = 0; step < numberOfSteps; step++ )
+        {
+            const Eigen::VectorXd state = integrator->performIntegrationStep( stepSize );
+            const Eigen::VectorXd denseOutputState = denseOutputIntegrator->performIntegrationStep( denseOutputStepSize );
+            stepSize = integrator->getNextStepSize( );
+            denseOutputStepSize = denseOutputIntegrator->getNextStepSize( );
+
+            // Check that numerical solution is not modified by dense output.
+            BOOST_CHECK_EQUAL( state( 0 ), denseOutputState( 0 ) );
+            BOOST_CHECK_EQUAL( state( 1 ), denseOutputState( 1 ) );
+
+            // Check dense output at nodes and inside step.
+            BOOST_CHECK( denseOutputIntegrator->isDenseOutputAvailable( ) );
+            const double previousTime = denseOutputIntegrator->getPreviousIndependentVariable( );
+            const double currentTime = denseOutputIntegrator->getCurrentIndependentVariable( );
+            maximumStepSize = std::max( maximumStepSize, currentTime - previousTime );
+
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        denseOutputIntegrator->getDenseOutputState( currentTime ), denseOutputState, 1.0E-14 );
+            for( int i = 1; i < 4; i++ )
+            {
+                const double interpolationTime = previousTime + static_cast< double >( i ) / 4.0 *
+                        ( currentTime - previousTime );
+                const Eigen::VectorXd stateError = denseOutputIntegrator->getDenseOutputState( interpolationTime ) -
+                        HarmonicOscillatorStateDerivative::computeAnalyticalState( interpolationTime );
+                BOOST_CHECK_SMALL( stateError.cwiseAbs( ).maxCoeff( ), 1.0E-6 );
+            }
+        }
+
+        // Check that there have been steps of significant size.
+        BOOST_CHECK( maximumStepSize > 0.01 );
+
+        // Check that dense output required (at most) a single additional evaluation, at the end of the last step.
+        BOOST_CHECK( denseOutputStateDerivativeModel.numberOfEvaluations_ -
+                     stateDerivativeModel.numberOfEvaluations_ <= 1 );
+
+        // Check that dense output is not available after rollback.
+        denseOutputIntegrator->rollbackToPreviousState( );
+        BOOST_CHECK( !denseOutputIntegrator->isDenseOutputAvailable( ) );
+        bool isExceptionCaught = false;
+        try
+        {
+            denseOutputIntegrator->getDenseOutputState( denseOutputIntegrator->getCurrentIndependentVariable( ) );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK( isExceptionCaught );
+    }
+}
+
+//! Test error for dense output outside of last step.
+BOOST_AUTO_TEST_CASE( testDenseOutputOutsideOfStep )
+{
+    HarmonicOscillatorStateDerivative stateDerivativeModel;
+    boost::shared_ptr< NumericalIntegrator< > > integrator = createDenseOutputTestIntegrator(
+                0, boost::bind( &HarmonicOscillatorStateDerivative::computeStateDerivative,
+                                &stateDerivativeModel, _1, _2 ) );
+    integrator->performIntegrationStep( 0.05 );
+
+    bool isExceptionCaught = false;
+    try
+    {
+        integrator->getDenseOutputState( integrator->getCurrentIndependentVariable( ) + 0.01 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test whether all stages are re-evaluated when a Runge-Kutta step is rejected.
+BOOST_AUTO_TEST_CASE( testStateDerivativeEvaluationsForRejectedStep )
+{
+    for( int integratorType = 0; integratorType < 2; integratorType++ )
+    {
+        HarmonicOscillatorStateDerivative stateDerivativeModel;
+        boost::shared_ptr< NumericalIntegrator< > > integrator = createDenseOutputTestIntegrator(
+                    integratorType, boost::bind( &HarmonicOscillatorStateDerivative::computeStateDerivative,
+                                                 &stateDerivativeModel, _1, _2 ) );
+
+        // Take a single step that is too large, so that it is rejected (at least once).
+        integrator->performIntegrationStep( 1.0 );
+        BOOST_CHECK( integrator->getCurrentIndependentVariable( ) < 1.0 );
+
+        // Check that each attempt evaluated all 13 stages, including the first stage at the start of the step.
+        BOOST_CHECK( stateDerivativeModel.numberOfEvaluations_ > 13 );
+        BOOST_CHECK_EQUAL( stateDerivativeModel.numberOfEvaluations_ % 13, 0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,205 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The fixed-size integrators are compared to the generic RungeKuttaVariableStepSizeIntegrator,
+ *      with which their results should be identical. Their timings are compared in the numerical
+ *      kernels benchmark (Tudat/Benchmarks).
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/fixedSizeRungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_fixed_size_runge_kutta_variable_step_size_integrator )
+
+//! Function to compute the state derivative of a point mass orbiting a central body, with constant mass flow.
+/*!
+ * Function to compute the state derivative of a point mass orbiting a central body (with unit gravitational parameter)
+ * under a small constant tangential thrust, optionally with a 7th state entry (the mass) that decreases at a
+ * constant rate.
+ */
+Eigen::VectorXd computeThrustingKeplerStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( state.rows( ) );
+    const double radius = state.segment( 0, 3 ).norm( );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / ( radius * radius * radius ) +
+            1.0E-3 * ( 1.0 + 0.1 * std::sin( time ) ) * state.segment( 3, 3 ).normalized( );
+    if( state.rows( ) == 7 )
+    {
+        stateDerivative( 6 ) = -1.0E-4;
+    }
+    return stateDerivative;
+}
+
+//! Function to get the initial state for the thrusting Kepler state derivative function.
+Eigen::VectorXd getThrustingKeplerInitialState( const int stateSize )
+{
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( stateSize );
+    initialState.segment( 0, 6 ) << 1.0, 0.0, 0.1, 0.0, 1.1, 0.05;
+    if( stateSize == 7 )
+    {
+        initialState( 6 ) = 1.0;
+    }
+    return initialState;
+}
+
+//! Function to get the list of predefined coefficient sets.
+std::vector< RungeKuttaCoefficients::CoefficientSets > getCoefficientSets( )
+{
+    std::vector< RungeKuttaCoefficients::CoefficientSets > coefficientSets;
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg45 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg56 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKuttaFehlberg78 );
+    coefficientSets.push_back( RungeKuttaCoefficients::rungeKutta87DormandPrince );
+    return coefficientSets;
+}
+
+//! Function to create the fixed-size and generic integrators for a given coefficient set and state size.
+std::pair< RungeKuttaVariableStepSizeIntegratorXdPointer, RungeKuttaVariableStepSizeIntegratorXdPointer >
+createFixedSizeAndGenericIntegrators(
+        const RungeKuttaCoefficients::CoefficientSets coefficientSet, const int stateSize )
+{
+    const Eigen::VectorXd initialState = getThrustingKeplerInitialState( stateSize );
+
+    RungeKuttaVariableStepSizeIntegratorXdPointer fixedSizeIntegrator =
+            createFixedSizeRungeKuttaVariableStepSizeIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double >(
+                coefficientSet, &computeThrustingKeplerStateDerivative, 0.0, initialState,
+                1.0E-8, 1.0, 1.0E-10, 1.0E-10, 0.8, 4.0, 0.1 );
+    RungeKuttaVariableStepSizeIntegratorXdPointer genericIntegrator =
+            boost::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                RungeKuttaCoefficients::get( coefficientSet ), &computeThrustingKeplerStateDerivative, 0.0,
+                initialState, 1.0E-8, 1.0, 1.0E-10, 1.0E-10, 0.8, 4.0, 0.1 );
+    return std::make_pair( fixedSizeIntegrator, genericIntegrator );
+}
+
+//! Test whether the fixed-size integrators give results identical to the generic integrator.
+BOOST_AUTO_TEST_CASE( testFixedSizeIntegratorConsistency )
+{
+    const std::vector< RungeKuttaCoefficients::CoefficientSets > coefficientSets = getCoefficientSets( );
+
+    for( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        for( int stateSize = 6; stateSize <= 7; stateSize++ )
+        {
+            std::pair< RungeKuttaVariableStepSizeIntegratorXdPointer, RungeKuttaVariableStepSizeIntegratorXdPointer >
+                    integrators = createFixedSizeAndGenericIntegrators( coefficientSets.at( i ), stateSize );
+            BOOST_CHECK( integrators.first != NULL );
+
+            // Compare individual steps, state derivatives and step sizes.
+            double fixedSizeStepSize = 0.1;
+            double genericStepSize = 0.1;
+            for( int step = 0; step < 200; step++ )
+            {
+                const Eigen::VectorXd fixedSizeState = integrators.first->performIntegrationStep( fixedSizeStepSize );
+                const Eigen::VectorXd genericState = integrators.second->performIntegrationStep( genericStepSize );
+
+                BOOST_CHECK_EQUAL( integrators.first->getCurrentIndependentVariable( ),
+                                   integrators.second->getCurrentIndependentVariable( ) );
+                for( int j = 0; j < stateSize; j++ )
+                {
+                    BOOST_CHECK_EQUAL( fixedSizeState( j ), genericState( j ) );
+                }
+
+                fixedSizeStepSize = integrators.first->getNextStepSize( );
+                genericStepSize = integrators.second->getNextStepSize( );
+                BOOST_CHECK_EQUAL( fixedSizeStepSize, genericStepSize );
+            }
+
+            const std::vector< Eigen::VectorXd > fixedSizeStateDerivatives =
+                    integrators.first->getCurrentStateDerivatives( );
+            const std::vector< Eigen::VectorXd > genericStateDerivatives =
+                    integrators.second->getCurrentStateDerivatives( );
+            BOOST_CHECK_EQUAL( fixedSizeStateDerivatives.size( ), genericStateDerivatives.size( ) );
+            for( unsigned int j = 0; j < fixedSizeStateDerivatives.size( ); j++ )
+            {
+                for( int k = 0; k < stateSize; k++ )
+                {
+                    BOOST_CHECK_EQUAL( fixedSizeStateDerivatives.at( j )( k ), genericStateDerivatives.at( j )( k ) );
+                }
+            }
+
+            // Compare rollback to previous step.
+            BOOST_CHECK( integrators.first->rollbackToPreviousState( ) );
+            BOOST_CHECK( integrators.second->rollbackToPreviousState( ) );
+            BOOST_CHECK_EQUAL( integrators.first->getCurrentIndependentVariable( ),
+                               integrators.second->getCurrentIndependentVariable( ) );
+        }
+    }
+
+    // Check that no fixed-size integrator is created for other state sizes.
+    BOOST_CHECK( ( createFixedSizeRungeKuttaVariableStepSizeIntegrator<
+                   double, Eigen::VectorXd, Eigen::VectorXd, double >(
+                       RungeKuttaCoefficients::rungeKuttaFehlberg78, &computeThrustingKeplerStateDerivative, 0.0,
+                       Eigen::VectorXd::Zero( 5 ), 1.0E-8, 1.0, 1.0E-10, 1.0E-10, 0.8, 4.0, 0.1 ) == NULL ) );
+
+    // Check that an error is thrown when directly creating a fixed-size integrator with an inconsistent state size.
+    bool isExceptionCaught = false;
+    try
+    {
+        FixedSizeRungeKuttaVariableStepSizeIntegrator< RungeKuttaCoefficients::rungeKuttaFehlberg45, 6 > integrator(
+                    &computeThrustingKeplerStateDerivative, 0.0, getThrustingKeplerInitialState( 7 ),
+                    1.0E-8, 1.0, 1.0E-10, 1.0E-10 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test whether the integrator factory function creates the fixed-size integrators when possible.
+BOOST_AUTO_TEST_CASE( testFixedSizeIntegratorCreation )
+{
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                rungeKuttaVariableStepSize, 0.0, 0.1, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                1.0E-8, 1.0, 1.0E-10, 1.0E-10 );
+
+    for( int stateSize = 5; stateSize <= 8; stateSize++ )
+    {
+        boost::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+                createIntegrator< double, Eigen::VectorXd >(
+                    &computeThrustingKeplerStateDerivative, Eigen::VectorXd::Zero( stateSize ), integratorSettings );
+        BOOST_CHECK( boost::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegratorXd >( integrator ) != NULL );
+
+        bool isFixedSizeIntegrator =
+                ( boost::dynamic_pointer_cast< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                  RungeKuttaCoefficients::rungeKuttaFehlberg78, 6 > >( integrator ) != NULL ) ||
+                ( boost::dynamic_pointer_cast< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                  RungeKuttaCoefficients::rungeKuttaFehlberg78, 7 > >( integrator ) != NULL );
+        BOOST_CHECK_EQUAL( isFixedSizeIntegrator, ( stateSize == 6 || stateSize == 7 ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -249,6 +249,10 @@ public:
         lastDerivative_ = derivHistory_.back( );
         lastIndependentVariable_ = currentIndependentVariable_;
 
+        // Set state and state derivative at start of step, for dense output.
+        stateAtStartOfStep_ = stateHistory_.front( );
+        stateDerivativeAtStartOfStep_ = derivHistory_.front( );
+
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
         while ( stateHistory_.size( ) > order_ * 2 ) {
@@ -596,6 +600,38 @@ public:
         return lastState_;
     }
 
+    //! Function to check whether dense output is available for the last step.
+    /*!
+     * Function to check whether dense output is available for the last step, which is the case if a step has been
+     * taken since the integrator was created, rolled back, or its state was modified.
+     * \return True if dense output is available for the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        return ( currentIndependentVariable_ != lastIndependentVariable_ );
+    }
+
+    //! Function to get the state at an independent variable value within the last step, from the dense output.
+    /*!
+     * Function to get the state at an independent variable value within the last step, from the dense output. The
+     * state is computed by cubic Hermite interpolation (see computeCubicHermiteDenseOutputState), using the states and
+     * state derivatives at the start and end of the step, which are already computed by the integrator.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return State at the requested independent variable value.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error, dense output of Adams-Bashforth-Moulton integrator not available" );
+        }
+
+        return computeCubicHermiteDenseOutputState< IndependentVariableType, StateType, StateDerivativeType,
+                TimeStepType >( lastIndependentVariable_, stateAtStartOfStep_, stateDerivativeAtStartOfStep_,
+                                currentIndependentVariable_, stateHistory_.front( ), derivHistory_.front( ),
+                                independentVariable );
+    }
+
 protected:
 
 
@@ -981,6 +1017,12 @@ protected:
      * Last state derivative as computed by performIntegrationStep( ).
      */
     StateDerivativeType lastDerivative_;
+
+    //! State at the start of the last step, used for dense output.
+    StateType stateAtStartOfStep_;
+
+    //! State derivative at the start of the last step, used for dense output.
+    StateDerivativeType stateDerivativeAtStartOfStep_;
 };
 
 //! Typedef of Adam-Bashforh-Moulton integrator (state/state derivative = VectorXd, independent variable = double).
@@ -235,12 +235,18 @@ public:
                         sequence_.at( p ) );
         }
 
+        // Compute state derivative at start of step (reused for each sub-step sequence).
+        if( !isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+            isCurrentStateDerivativeSet_ = true;
+        }
+
         double errorScaleTerm = TUDAT_NAN;
         for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
         {
             // Compute Euler step and set as state at center point for use with mid-point method.
-            stateAtCenterPoint_ = currentState_ + subSteps_.at( i )
-                    * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+            stateAtCenterPoint_ = currentState_ + subSteps_.at( i ) * currentStateDerivative_;
 
             // Apply modified mid-point rule.
             stateAtFirstPoint_ = currentState_;
@@ -289,6 +295,8 @@ public:
                     // Accept the current step.
                     lastIndependentVariable_ = currentIndependentVariable_;
                     lastState_ = currentState_;
+                    lastStateDerivative_ = currentStateDerivative_;
+                    isCurrentStateDerivativeSet_ = false;
                     currentIndependentVariable_ += stepSize;
                     currentState_ = integratedStates_[ i ][ i ];
                     stepSize_ = stepSize;
@@ -316,6 +324,9 @@ public:
                 isMinimumStepSizeViolated_ = true;
                 throw std::runtime_error( "Error in BS integrator, minimum step size exceeded" );
             }
+
+            // Repeat step (state derivative at start of step is re-evaluated, so that the environment is updated).
+            isCurrentStateDerivativeSet_ = false;
             performIntegrationStep( stepSize_ );
         }
         else
@@ -355,6 +366,8 @@ public:
 
         currentIndependentVariable_ = lastIndependentVariable_;
         currentState_ = lastState_;
+        currentStateDerivative_ = lastStateDerivative_;
+        isCurrentStateDerivativeSet_ = true;
         return true;
     }
 
@@ -376,6 +389,57 @@ public:
         return lastState_;
     }
 
+    //! Function to check whether dense output is available for the last step.
+    /*!
+     * Function to check whether dense output is available for the last step, which is the case if a step has been
+     * taken since the integrator was created or rolled back.
+     * \return True if dense output is available for the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        return ( currentIndependentVariable_ != lastIndependentVariable_ );
+    }
+
+    //! Function to get the state at an independent variable value within the last step, from the dense output.
+    /*!
+     * Function to get the state at an independent variable value within the last step, from the dense output. The
+     * state is computed by cubic Hermite interpolation (see computeCubicHermiteDenseOutputState), using the state
+     * derivatives at the start and end of the step. The latter is evaluated once (when first needed) and reused
+     * for the next step, so that the dense output requires no additional state derivative evaluations.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return State at the requested independent variable value.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error, dense output of Bulirsch-Stoer integrator not available" );
+        }
+
+        if( !isCurrentStateDerivativeSet_ )
+        {
+            computeCurrentStateDerivative( );
+        }
+
+        return computeCubicHermiteDenseOutputState< IndependentVariableType, StateType, StateDerivativeType,
+                TimeStepType >( lastIndependentVariable_, lastState_, lastStateDerivative_,
+                                currentIndependentVariable_, currentState_, currentStateDerivative_,
+                                independentVariable );
+    }
+
+    //! Function to compute the state derivative at the current state.
+    /*!
+     * Function to compute the state derivative at the current state (updating the environment, if any), which is stored
+     * for the dense output of the last step, and reused at the start of the next step.
+     * \return State derivative at the current state.
+     */
+    StateDerivativeType computeCurrentStateDerivative( )
+    {
+        currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+        isCurrentStateDerivativeSet_ = true;
+        return currentStateDerivative_;
+    }
+
 private:
 
     //! Last used step size.
@@ -408,6 +472,15 @@ private:
      */
     StateType lastState_;
 
+    //! State derivative at the start of the last step, used for dense output.
+    StateDerivativeType lastStateDerivative_;
+
+    //! State derivative at the current state (if isCurrentStateDerivativeSet_ is true).
+    StateDerivativeType currentStateDerivative_;
+
+    //! Boolean denoting whether currentStateDerivative_ has been computed for the current state.
+    bool isCurrentStateDerivativeSet_ = false;
+
     //! Sequence for the integrator.
     /*!
      * Rational function sequence for the integrator.
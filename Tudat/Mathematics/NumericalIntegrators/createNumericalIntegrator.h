@@ -18,6 +18,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/euler.h"
+#include "Tudat/Mathematics/NumericalIntegrators/fixedSizeRungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 
@@ -78,6 +79,17 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the integrator settings
+    /*!
+     *  Function to create a copy of the integrator settings, for instance to allow concurrent use of the settings
+     *  (the initial time of the settings is reset when propagating an arc in a multi-arc propagation).
+     *  \return Copy of this object
+     */
+    virtual boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< IntegratorSettings< TimeType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -175,6 +187,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettings( ){ }
 
+    //! Function to create a copy of the integrator settings
+    /*!
+     *  Function to create a copy of the integrator settings
+     *  \return Copy of this object
+     */
+    virtual boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< RungeKuttaVariableStepSizeSettings< TimeType > >( *this );
+    }
+
     //! Type of numerical integrator (must be an RK variable step type)
     numerical_integrators::RungeKuttaCoefficients::CoefficientSets coefficientSet_;
 
@@ -259,6 +281,16 @@ public:
      */
     ~BulirschStoerIntegratorSettings( ){ }
 
+    //! Function to create a copy of the integrator settings
+    /*!
+     *  Function to create a copy of the integrator settings
+     *  \return Copy of this object
+     */
+    virtual boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< BulirschStoerIntegratorSettings< TimeType > >( *this );
+    }
+
     //! Type of sequence that is to be used for Bulirsch-Stoer integrator
     ExtrapolationMethodStepSequences extrapolationSequence_;
 
@@ -346,6 +378,16 @@ public:
      */
     ~AdamsBashforthMoultonSettings( ){ }
 
+    //! Function to create a copy of the integrator settings
+    /*!
+     *  Function to create a copy of the integrator settings
+     *  \return Copy of this object
+     */
+    virtual boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< AdamsBashforthMoultonSettings< TimeType > >( *this );
+    }
+
     //! Minimum step size for integration.
     /*!
      *  Minimum step size for integration. Integration stops (exception thrown) if time step comes below this value.
@@ -420,7 +462,23 @@ DependentVariableType, TimeStepType > > createIntegrator(
         }
         else
         {
-            // Get requested RK coefficients and create integrator.
+            // Create integrator with compile-time state size and number of stages, if available.
+            integrator = createFixedSizeRungeKuttaVariableStepSizeIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, TimeStepType >
+                    ( variableStepIntegratorSettings->coefficientSet_,
+                      stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                      static_cast< TimeStepType >( variableStepIntegratorSettings->minimumStepSize_ ),
+                      static_cast< TimeStepType >( variableStepIntegratorSettings->maximumStepSize_ ),
+                      variableStepIntegratorSettings->relativeErrorTolerance_,
+                      variableStepIntegratorSettings->absoluteErrorTolerance_ ,
+                      static_cast< TimeStepType >( variableStepIntegratorSettings->safetyFactorForNextStepSize_ ),
+                      static_cast< TimeStepType >( variableStepIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
+                      static_cast< TimeStepType >( variableStepIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+        }
+
+        // Get requested RK coefficients and create generic integrator, if no fixed-size integrator is available.
+        if( variableStepIntegratorSettings != NULL && integrator == NULL )
+        {
             RungeKuttaCoefficients coefficients =  RungeKuttaCoefficients::get(
                         variableStepIntegratorSettings->coefficientSet_ );
             integrator = boost::make_shared<
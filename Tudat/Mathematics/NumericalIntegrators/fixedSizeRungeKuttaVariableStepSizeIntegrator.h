@@ -0,0 +1,611 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_FIXED_SIZE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+#define TUDAT_FIXED_SIZE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Struct with the compile-time properties of a predefined Runge-Kutta coefficient set.
+/*!
+ * Struct with the compile-time properties of a predefined Runge-Kutta coefficient set (see
+ * RungeKuttaCoefficients::CoefficientSets), specialized for each of the predefined sets.
+ */
+template< RungeKuttaCoefficients::CoefficientSets CoefficientSet >
+struct RungeKuttaCoefficientSetProperties;
+
+//! Compile-time properties of the Runge-Kutta-Fehlberg 4(5) coefficient set.
+template< >
+struct RungeKuttaCoefficientSetProperties< RungeKuttaCoefficients::rungeKuttaFehlberg45 >
+{
+    //! Number of stages of the coefficient set.
+    static const int numberOfStages = 6;
+};
+
+//! Compile-time properties of the Runge-Kutta-Fehlberg 5(6) coefficient set.
+template< >
+struct RungeKuttaCoefficientSetProperties< RungeKuttaCoefficients::rungeKuttaFehlberg56 >
+{
+    //! Number of stages of the coefficient set.
+    static const int numberOfStages = 8;
+};
+
+//! Compile-time properties of the Runge-Kutta-Fehlberg 7(8) coefficient set.
+template< >
+struct RungeKuttaCoefficientSetProperties< RungeKuttaCoefficients::rungeKuttaFehlberg78 >
+{
+    //! Number of stages of the coefficient set.
+    static const int numberOfStages = 13;
+};
+
+//! Compile-time properties of the Runge-Kutta-Dormand-Prince 8(7) coefficient set.
+template< >
+struct RungeKuttaCoefficientSetProperties< RungeKuttaCoefficients::rungeKutta87DormandPrince >
+{
+    //! Number of stages of the coefficient set.
+    static const int numberOfStages = 13;
+};
+
+//! Class that implements the Runge-Kutta variable step size integrator for a state of compile-time size.
+/*!
+ * Class that implements the Runge-Kutta variable step size integrator for a column vector state, the size of which is
+ * known at compile time, using one of the predefined coefficient sets. The stage evaluations, intermediate states and
+ * estimates are stored in fixed-size Eigen vectors (the stages in a std::array) and the Butcher tableau in fixed-size
+ * arrays, so that no memory is allocated during an integration step, except by the state derivative function itself.
+ * The integration results are identical to those of the RungeKuttaVariableStepSizeIntegrator base class, for which
+ * this class is a drop-in replacement (the state passed to and from the integrator is still of type StateType).
+ * A user-defined new step size function is not supported.
+ * \tparam CoefficientSet Predefined coefficient set that is to be used.
+ * \tparam StateSize Number of entries in the state (which must be a column vector).
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state. This type should be an Eigen::Matrix derived type.
+ * \tparam StateDerivativeType The type of the state derivative. This type should be an Eigen::Matrix derived type.
+ * \tparam TimeStepType The type of the time step.
+ * \sa RungeKuttaVariableStepSizeIntegrator.
+ */
+template< RungeKuttaCoefficients::CoefficientSets CoefficientSet, int StateSize,
+          typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = StateType, typename TimeStepType = IndependentVariableType >
+class FixedSizeRungeKuttaVariableStepSizeIntegrator:
+        public RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+        TimeStepType >
+{
+public:
+
+    //! Typedef of the base class.
+    typedef RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+    TimeStepType > RungeKuttaVariableStepSizeIntegratorBase;
+
+    //! Typedef to the state derivative function.
+    typedef typename RungeKuttaVariableStepSizeIntegratorBase::StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef of the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Typedef of the fixed-size state (and state derivative) used internally by the integrator.
+    typedef Eigen::Matrix< StateScalarType, StateSize, 1 > FixedSizeStateType;
+
+    //! Number of stages of the coefficient set.
+    static const int NumberOfStages = RungeKuttaCoefficientSetProperties< CoefficientSet >::numberOfStages;
+
+    //! Constructor, with relative and absolute error tolerance per entry in the state vector.
+    /*!
+     * Constructor, with relative and absolute error tolerance per entry in the state vector, taking the same input as
+     * the corresponding constructor of RungeKuttaVariableStepSizeIntegrator (except for the coefficients and new
+     * step size function).
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state (must be a column vector of size StateSize).
+     * \param minimumStepSize The minimum step size to take.
+     * \param maximumStepSize The maximum step size to take.
+     * \param relativeErrorTolerance The relative error tolerance, for each individual state vector element.
+     * \param absoluteErrorTolerance The absolute error tolerance, for each individual state vector element.
+     * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+     * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+     * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     */
+    FixedSizeRungeKuttaVariableStepSizeIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const IndependentVariableType minimumStepSize,
+            const IndependentVariableType maximumStepSize,
+            const StateType& relativeErrorTolerance,
+            const StateType& absoluteErrorTolerance,
+            const TimeStepType safetyFactorForNextStepSize = 0.8,
+            const TimeStepType maximumFactorIncreaseForNextStepSize = 4.0,
+            const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1 ):
+        RungeKuttaVariableStepSizeIntegratorBase(
+            RungeKuttaCoefficients::get( CoefficientSet ), stateDerivativeFunction, intervalStart, initialState,
+            minimumStepSize, maximumStepSize, relativeErrorTolerance, absoluteErrorTolerance,
+            safetyFactorForNextStepSize, maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize )
+    {
+        initializeFixedSizeMembers( initialState );
+    }
+
+    //! Constructor, with relative and absolute error tolerance equal for all entries in the state vector.
+    /*!
+     * Constructor, with relative and absolute error tolerance equal for all entries in the state vector, taking the
+     * same input as the corresponding constructor of RungeKuttaVariableStepSizeIntegrator (except for the coefficients
+     * and new step size function).
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state (must be a column vector of size StateSize).
+     * \param minimumStepSize The minimum step size to take.
+     * \param maximumStepSize The maximum step size to take.
+     * \param relativeErrorTolerance The relative error tolerance, equal for all individual state vector elements.
+     * \param absoluteErrorTolerance The absolute error tolerance, equal for all individual state vector elements.
+     * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+     * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+     * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     */
+    FixedSizeRungeKuttaVariableStepSizeIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType minimumStepSize,
+            const TimeStepType maximumStepSize,
+            const StateScalarType relativeErrorTolerance,
+            const StateScalarType absoluteErrorTolerance,
+            const TimeStepType safetyFactorForNextStepSize = 0.8,
+            const TimeStepType maximumFactorIncreaseForNextStepSize = 4.0,
+            const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1 ):
+        RungeKuttaVariableStepSizeIntegratorBase(
+            RungeKuttaCoefficients::get( CoefficientSet ), stateDerivativeFunction, intervalStart, initialState,
+            minimumStepSize, maximumStepSize, relativeErrorTolerance, absoluteErrorTolerance,
+            safetyFactorForNextStepSize, maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize )
+    {
+        initializeFixedSizeMembers( initialState );
+    }
+
+    //! Destructor.
+    ~FixedSizeRungeKuttaVariableStepSizeIntegrator( ){ }
+
+    //! Get current state derivatives.
+    /*!
+     * Returns the current state derivatives, i.e., the values of k_{i} (stage evaluations) in Runge-Kutta scheme,
+     * evaluated during the last call to performIntegrationStep.
+     * \return Current state derivatives evaluated according to stages of Runge-Kutta scheme.
+     */
+    std::vector< StateDerivativeType > getCurrentStateDerivatives( )
+    {
+        std::vector< StateDerivativeType > currentStateDerivatives;
+        for( int stage = 0; stage < numberOfEvaluatedStages_; stage++ )
+        {
+            currentStateDerivatives.push_back( currentStateDerivatives_[ stage ] );
+        }
+        return currentStateDerivatives;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step and compute a new step size, using fixed-size states.
+     * \param stepSize The step size to take. If the time step is too large to satisfy the error
+     *          constraints, the step is redone until the error constraint is satisfied.
+     * \return The state at the end of the interval.
+     */
+    StateType performIntegrationStep( const TimeStepType stepSize );
+
+protected:
+
+    //! Function to check the size of the state and set the fixed-size coefficients and tolerances.
+    /*!
+     * Function to check the size of the state and set the fixed-size coefficients and tolerances, called by the
+     * constructors.
+     * \param initialState The initial state.
+     */
+    void initializeFixedSizeMembers( const StateType& initialState );
+
+    //! Compute new step size.
+    /*!
+     * Computes the new step size from the fixed-size estimates, in the same manner as
+     * RungeKuttaVariableStepSizeIntegrator::computeNewStepSize.
+     * \param stepSize Integration step size of current step.
+     * \param lowerOrderEstimate Numerical integration result using lower order scheme.
+     * \param higherOrderEstimate Numerical integration result using higher order scheme.
+     * \return Pair with new step size and a boolean denoting whether the tolerances are met.
+     */
+    std::pair< TimeStepType, bool > computeFixedSizeNewStepSize(
+            const TimeStepType stepSize,
+            const FixedSizeStateType& lowerOrderEstimate, const FixedSizeStateType& higherOrderEstimate );
+
+    //! Main table of the Butcher tableau.
+    std::array< std::array< double, NumberOfStages >, NumberOfStages > aCoefficients_;
+
+    //! Bottom rows of the Butcher tableau (lower and higher order, respectively).
+    std::array< std::array< double, NumberOfStages >, 2 > bCoefficients_;
+
+    //! First column of the Butcher tableau.
+    std::array< double, NumberOfStages > cCoefficients_;
+
+    //! Relative error tolerance per element in the state.
+    FixedSizeStateType fixedSizeRelativeErrorTolerance_;
+
+    //! Absolute error tolerance per element in the state.
+    FixedSizeStateType fixedSizeAbsoluteErrorTolerance_;
+
+    //! Values of k_{i} in Runge-Kutta scheme, evaluated during last step.
+    std::array< FixedSizeStateType, NumberOfStages > currentStateDerivatives_;
+
+    //! Number of stages that were evaluated during last step (less than NumberOfStages if propagation terminated).
+    int numberOfEvaluatedStages_;
+
+    //! Intermediate state in the format of the state derivative function input, pre-allocated.
+    StateType intermediateStateInput_;
+};
+
+//! Function to check the size of the state and set the fixed-size coefficients and tolerances.
+template< RungeKuttaCoefficients::CoefficientSets CoefficientSet, int StateSize,
+          typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void FixedSizeRungeKuttaVariableStepSizeIntegrator<
+CoefficientSet, StateSize, IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::initializeFixedSizeMembers( const StateType& initialState )
+{
+    if( initialState.rows( ) != StateSize || initialState.cols( ) != 1 )
+    {
+        throw std::runtime_error(
+                    "Error in fixed-size Runge-Kutta integrator, state size is " +
+                    std::to_string( initialState.rows( ) ) + "x" + std::to_string( initialState.cols( ) ) +
+                    ", expected " + std::to_string( StateSize ) + "x1" );
+    }
+
+    const RungeKuttaCoefficients& coefficients = this->coefficients_;
+    if( coefficients.cCoefficients.rows( ) != NumberOfStages || coefficients.bCoefficients.cols( ) != NumberOfStages )
+    {
+        throw std::runtime_error( "Error in fixed-size Runge-Kutta integrator, inconsistent number of stages" );
+    }
+
+    // Copy Butcher tableau to fixed-size arrays.
+    for( int stage = 0; stage < NumberOfStages; stage++ )
+    {
+        cCoefficients_[ stage ] = coefficients.cCoefficients( stage );
+        bCoefficients_[ 0 ][ stage ] = coefficients.bCoefficients( 0, stage );
+        bCoefficients_[ 1 ][ stage ] = coefficients.bCoefficients( 1, stage );
+        for( int column = 0; column < NumberOfStages; column++ )
+        {
+            aCoefficients_[ stage ][ column ] = ( column < stage ) ? coefficients.aCoefficients( stage, column ) : 0.0;
+        }
+    }
+
+    fixedSizeRelativeErrorTolerance_ = this->relativeErrorTolerance_;
+    fixedSizeAbsoluteErrorTolerance_ = this->absoluteErrorTolerance_;
+    intermediateStateInput_ = initialState;
+    numberOfEvaluatedStages_ = 0;
+}
+
+//! Perform a single integration step.
+template< RungeKuttaCoefficients::CoefficientSets CoefficientSet, int StateSize,
+          typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType FixedSizeRungeKuttaVariableStepSizeIntegrator<
+CoefficientSet, StateSize, IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::performIntegrationStep( const TimeStepType stepSize )
+{
+    const FixedSizeStateType currentState = this->currentState_;
+
+    // Define lower and higher order estimates.
+    FixedSizeStateType lowerOrderEstimate = currentState;
+    FixedSizeStateType higherOrderEstimate = currentState;
+    FixedSizeStateType intermediateState;
+
+    // Compute the k_i state derivatives per stage.
+    numberOfEvaluatedStages_ = 0;
+    for ( int stage = 0; stage < NumberOfStages; stage++ )
+    {
+        // Compute the intermediate state.
+        intermediateState = currentState;
+        for ( int column = 0; column < stage; column++ )
+        {
+            intermediateState += stepSize * aCoefficients_[ stage ][ column ] * currentStateDerivatives_[ column ];
+        }
+
+        // Compute the state derivative (reusing the current state derivative for the first stage, if available).
+        const IndependentVariableType time = this->currentIndependentVariable_ + cCoefficients_[ stage ] * stepSize;
+        if( stage == 0 && this->isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivatives_[ stage ] = this->currentStateDerivative_;
+        }
+        else
+        {
+            intermediateStateInput_ = intermediateState;
+            currentStateDerivatives_[ stage ] = this->stateDerivativeFunction_( time, intermediateStateInput_ );
+        }
+        numberOfEvaluatedStages_++;
+
+        // Check if propagation should terminate because the propagation termination condition has been reached
+        // while computing the intermediate state.
+        // If so, return immediately the current state (not recomputed yet), which will be discarded.
+        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+        {
+            this->propagationTerminationConditionReachedDuringStep_ = true;
+            return this->currentState_;
+        }
+
+        // Update the estimate.
+        lowerOrderEstimate += bCoefficients_[ 0 ][ stage ] * stepSize * currentStateDerivatives_[ stage ];
+        higherOrderEstimate += bCoefficients_[ 1 ][ stage ] * stepSize * currentStateDerivatives_[ stage ];
+    }
+
+    // Determine if the error was within bounds and compute a new step size.
+    bool isStepAccepted;
+    if( this->useStepSizeControl_ )
+    {
+        isStepAccepted = this->limitAndSetNextStepSize(
+                    computeFixedSizeNewStepSize( stepSize, lowerOrderEstimate, higherOrderEstimate ), stepSize );
+    }
+    else
+    {
+        this->stepSize_ = stepSize;
+        isStepAccepted = true;
+    }
+
+    if ( isStepAccepted )
+    {
+        // Accept the current step.
+        this->lastIndependentVariable_ = this->currentIndependentVariable_;
+        this->lastState_ = this->currentState_;
+        this->currentIndependentVariable_ += stepSize;
+        this->lastStateDerivative_ = currentStateDerivatives_[ 0 ];
+        this->isCurrentStateDerivativeSet_ = false;
+
+        switch ( this->coefficients_.orderEstimateToIntegrate )
+        {
+        case RungeKuttaCoefficients::lower:
+            this->currentState_ = lowerOrderEstimate;
+            return this->currentState_;
+
+        case RungeKuttaCoefficients::higher:
+            this->currentState_ = higherOrderEstimate;
+            return this->currentState_;
+
+        default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
+            throw std::runtime_error( "Order estimate to integrate is invalid." );
+        }
+    }
+    else
+    {
+        // Reject current step (first stage is re-evaluated for the new attempt, so that the environment is updated).
+        this->isCurrentStateDerivativeSet_ = false;
+        return performIntegrationStep( this->stepSize_ );
+    }
+}
+
+//! Compute new step size.
+template< RungeKuttaCoefficients::CoefficientSets CoefficientSet, int StateSize,
+          typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+std::pair< TimeStepType, bool > FixedSizeRungeKuttaVariableStepSizeIntegrator<
+CoefficientSet, StateSize, IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::computeFixedSizeNewStepSize(
+        const TimeStepType stepSize,
+        const FixedSizeStateType& lowerOrderEstimate, const FixedSizeStateType& higherOrderEstimate )
+{
+    const TimeStepType higherOrder = this->coefficients_.higherOrder;
+
+    // Compute the truncation error based on the higher and lower order estimates.
+    const FixedSizeStateType truncationError = ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( );
+
+    // Compute error tolerance based on relative and absolute error tolerances.
+    const FixedSizeStateType errorTolerance =
+            ( higherOrderEstimate.array( ).abs( ) * fixedSizeRelativeErrorTolerance_.array( ) ).matrix( )
+            + fixedSizeAbsoluteErrorTolerance_;
+
+    // Compute the maximum relative truncation error, and new step size (Montenbruck and Gill, 2005).
+    const StateScalarType maximumErrorInState =
+            ( truncationError.array( ) / errorTolerance.array( ) ).abs( ).maxCoeff( );
+    const TimeStepType newStepSize = this->safetyFactorForNextStepSize_ * stepSize
+            * std::pow( 1.0 / maximumErrorInState, 1.0 / higherOrder );
+
+    return std::make_pair( newStepSize, maximumErrorInState <= 1.0 );
+}
+
+//! Struct to determine whether a state type can be converted to and from a fixed-size column vector of given size.
+/*!
+ * Struct to determine whether a state type can be converted to and from a fixed-size column vector of given size, i.e.
+ * whether its number of rows is dynamic or equal to StateSize, and its number of columns is dynamic or equal to one.
+ */
+template< typename StateType, int StateSize >
+struct IsFixedSizeStateCompatible: public std::integral_constant< bool,
+        ( StateType::RowsAtCompileTime == Eigen::Dynamic || StateType::RowsAtCompileTime == StateSize ) &&
+        ( StateType::ColsAtCompileTime == Eigen::Dynamic || StateType::ColsAtCompileTime == 1 ) >
+{ };
+
+//! Function to create a fixed-size variable step size Runge-Kutta integrator for a given state size.
+/*!
+ * Function to create a fixed-size variable step size Runge-Kutta integrator (see
+ * FixedSizeRungeKuttaVariableStepSizeIntegrator) for a given (compile-time) state size, and a coefficient set selected
+ * at run time.
+ * \param coefficientSet Coefficient set that is to be used.
+ * \param stateDerivativeFunction State derivative function.
+ * \param intervalStart The start of the integration interval.
+ * \param initialState The initial state (must be a column vector of size StateSize).
+ * \param minimumStepSize The minimum step size to take.
+ * \param maximumStepSize The maximum step size to take.
+ * \param relativeErrorTolerance The relative error tolerance, equal for all individual state vector elements.
+ * \param absoluteErrorTolerance The absolute error tolerance, equal for all individual state vector elements.
+ * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+ * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+ * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+ * \param isStateCompatible Tag denoting that StateType is compatible with a fixed-size state of size StateSize.
+ * \return Fixed-size integrator (NULL if the coefficient set has no fixed-size implementation).
+ */
+template< int StateSize, typename IndependentVariableType, typename StateType, typename StateDerivativeType,
+          typename TimeStepType >
+boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+TimeStepType > > createFixedSizeRungeKuttaVariableStepSizeIntegrator(
+        const RungeKuttaCoefficients::CoefficientSets coefficientSet,
+        const boost::function< StateDerivativeType( const IndependentVariableType, const StateType& ) >&
+        stateDerivativeFunction,
+        const IndependentVariableType intervalStart,
+        const StateType& initialState,
+        const TimeStepType minimumStepSize,
+        const TimeStepType maximumStepSize,
+        const typename StateType::Scalar relativeErrorTolerance,
+        const typename StateType::Scalar absoluteErrorTolerance,
+        const TimeStepType safetyFactorForNextStepSize,
+        const TimeStepType maximumFactorIncreaseForNextStepSize,
+        const TimeStepType minimumFactorDecreaseForNextStepSize,
+        std::true_type isStateCompatible )
+{
+    boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+            TimeStepType > > integrator;
+    switch( coefficientSet )
+    {
+    case RungeKuttaCoefficients::rungeKuttaFehlberg45:
+        integrator = boost::make_shared< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                RungeKuttaCoefficients::rungeKuttaFehlberg45, StateSize, IndependentVariableType, StateType,
+                StateDerivativeType, TimeStepType > >(
+                    stateDerivativeFunction, intervalStart, initialState, minimumStepSize, maximumStepSize,
+                    relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                    maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize );
+        break;
+    case RungeKuttaCoefficients::rungeKuttaFehlberg56:
+        integrator = boost::make_shared< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                RungeKuttaCoefficients::rungeKuttaFehlberg56, StateSize, IndependentVariableType, StateType,
+                StateDerivativeType, TimeStepType > >(
+                    stateDerivativeFunction, intervalStart, initialState, minimumStepSize, maximumStepSize,
+                    relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                    maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize );
+        break;
+    case RungeKuttaCoefficients::rungeKuttaFehlberg78:
+        integrator = boost::make_shared< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                RungeKuttaCoefficients::rungeKuttaFehlberg78, StateSize, IndependentVariableType, StateType,
+                StateDerivativeType, TimeStepType > >(
+                    stateDerivativeFunction, intervalStart, initialState, minimumStepSize, maximumStepSize,
+                    relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                    maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize );
+        break;
+    case RungeKuttaCoefficients::rungeKutta87DormandPrince:
+        integrator = boost::make_shared< FixedSizeRungeKuttaVariableStepSizeIntegrator<
+                RungeKuttaCoefficients::rungeKutta87DormandPrince, StateSize, IndependentVariableType, StateType,
+                StateDerivativeType, TimeStepType > >(
+                    stateDerivativeFunction, intervalStart, initialState, minimumStepSize, maximumStepSize,
+                    relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                    maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize );
+        break;
+    default:
+        break;
+    }
+    return integrator;
+}
+
+//! Function to create a fixed-size variable step size Runge-Kutta integrator, for an incompatible state type.
+/*!
+ * Function to create a fixed-size variable step size Runge-Kutta integrator, for a state type that is not compatible
+ * with a fixed-size state of size StateSize (see IsFixedSizeStateCompatible), which is never used at run time.
+ * \return NULL pointer.
+ */
+template< int StateSize, typename IndependentVariableType, typename StateType, typename StateDerivativeType,
+          typename TimeStepType >
+boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+TimeStepType > > createFixedSizeRungeKuttaVariableStepSizeIntegrator(
+        const RungeKuttaCoefficients::CoefficientSets,
+        const boost::function< StateDerivativeType( const IndependentVariableType, const StateType& ) >&,
+        const IndependentVariableType,
+        const StateType&,
+        const TimeStepType,
+        const TimeStepType,
+        const typename StateType::Scalar,
+        const typename StateType::Scalar,
+        const TimeStepType,
+        const TimeStepType,
+        const TimeStepType,
+        std::false_type )
+{
+    return boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType,
+            StateDerivativeType, TimeStepType > >( );
+}
+
+//! Function to create a fixed-size variable step size Runge-Kutta integrator, if available for the state size.
+/*!
+ * Function to create a fixed-size variable step size Runge-Kutta integrator (see
+ * FixedSizeRungeKuttaVariableStepSizeIntegrator), if it is available for the size of the state. Fixed-size
+ * integrators are available for column vector states of size 6 (translational state) and 7 (translational state and
+ * mass).
+ * \param coefficientSet Coefficient set that is to be used.
+ * \param stateDerivativeFunction State derivative function.
+ * \param intervalStart The start of the integration interval.
+ * \param initialState The initial state.
+ * \param minimumStepSize The minimum step size to take.
+ * \param maximumStepSize The maximum step size to take.
+ * \param relativeErrorTolerance The relative error tolerance, equal for all individual state vector elements.
+ * \param absoluteErrorTolerance The absolute error tolerance, equal for all individual state vector elements.
+ * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+ * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+ * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+ * \return Fixed-size integrator (NULL if no fixed-size integrator is available for the state size or coefficients).
+ */
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+TimeStepType > > createFixedSizeRungeKuttaVariableStepSizeIntegrator(
+        const RungeKuttaCoefficients::CoefficientSets coefficientSet,
+        const boost::function< StateDerivativeType( const IndependentVariableType, const StateType& ) >&
+        stateDerivativeFunction,
+        const IndependentVariableType intervalStart,
+        const StateType& initialState,
+        const TimeStepType minimumStepSize,
+        const TimeStepType maximumStepSize,
+        const typename StateType::Scalar relativeErrorTolerance,
+        const typename StateType::Scalar absoluteErrorTolerance,
+        const TimeStepType safetyFactorForNextStepSize,
+        const TimeStepType maximumFactorIncreaseForNextStepSize,
+        const TimeStepType minimumFactorDecreaseForNextStepSize )
+{
+    boost::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType,
+            TimeStepType > > integrator;
+    if( initialState.cols( ) == 1 )
+    {
+        switch( initialState.rows( ) )
+        {
+        case 6:
+            integrator = createFixedSizeRungeKuttaVariableStepSizeIntegrator< 6 >(
+                        coefficientSet, stateDerivativeFunction, intervalStart, initialState, minimumStepSize,
+                        maximumStepSize, relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                        maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize,
+                        IsFixedSizeStateCompatible< StateType, 6 >( ) );
+            break;
+        case 7:
+            integrator = createFixedSizeRungeKuttaVariableStepSizeIntegrator< 7 >(
+                        coefficientSet, stateDerivativeFunction, intervalStart, initialState, minimumStepSize,
+                        maximumStepSize, relativeErrorTolerance, absoluteErrorTolerance, safetyFactorForNextStepSize,
+                        maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize,
+                        IsFixedSizeStateCompatible< StateType, 7 >( ) );
+            break;
+        default:
+            break;
+        }
+    }
+    return integrator;
+}
+
+} // namespace numerical_integrators
+} // namespace tudat
+
+#endif // TUDAT_FIXED_SIZE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
@@ -121,6 +122,46 @@ public:
         throw std::runtime_error( "Function getPreviousState not implemented in this integrator" );
     }
 
+    //! Function to check whether dense output is available for the last step.
+    /*!
+     * Function to check whether dense output (continuous extension of the numerical solution) is available for the
+     * last step taken by the integrator, i.e. whether getDenseOutputState can be called for the interval between the
+     * previous and current independent variable. Derived classes providing dense output should override this function.
+     * \return True if dense output is available for the last step.
+     */
+    virtual bool isDenseOutputAvailable( )
+    {
+        return false;
+    }
+
+    //! Function to get the state at an independent variable value within the last step, from the dense output.
+    /*!
+     * Function to get the state at an independent variable value within the last step (between the previous and current
+     * independent variable), from the dense output of the integrator. The state is computed from data stored during
+     * the last step, so that no additional state derivative evaluations are needed (other than possibly a single
+     * evaluation at the current state, which is then reused for the next step). Derived classes should override this
+     * function if they provide dense output. If not implemented, throws error.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return State at the requested independent variable value.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        throw std::runtime_error( "Function getDenseOutputState not implemented in this integrator" );
+    }
+
+    //! Function to compute the state derivative at the current state.
+    /*!
+     * Function to compute the state derivative at the current independent variable and state, which also updates the
+     * environment (if any) through the state derivative function. Derived classes providing dense output override this
+     * function to store the result, so that it is reused for the dense output of the last step and as the first stage of
+     * the next step, without additional state derivative evaluations.
+     * \return State derivative at the current state.
+     */
+    virtual StateDerivativeType computeCurrentStateDerivative( )
+    {
+        return stateDerivativeFunction_( getCurrentIndependentVariable( ), getCurrentState( ) );
+    }
+
     //! Perform an integration to a specified independent variable value.
     /*!
      * Performs an integration to independentVariableEnd with initial state and initial independent
@@ -216,6 +257,62 @@ protected:
     boost::function< bool( const double, const double ) > propagationTerminationFunction_ = boost::lambda::constant( false );
 };
 
+//! Function to compute a state within an integration step using cubic Hermite interpolation.
+/*!
+ * Function to compute a state within an integration step using cubic Hermite interpolation, from the states and state
+ * derivatives at the start and end of the step. This interpolant is used as dense output by the variable step size
+ * integrators. It is a third degree polynomial that is fourth order accurate in the step size (i.e. the interpolation
+ * error is proportional to the 4th power of the step size).
+ * \param previousIndependentVariable Independent variable at the start of the step.
+ * \param previousState State at the start of the step.
+ * \param previousStateDerivative State derivative at the start of the step.
+ * \param currentIndependentVariable Independent variable at the end of the step.
+ * \param currentState State at the end of the step.
+ * \param currentStateDerivative State derivative at the end of the step.
+ * \param independentVariable Independent variable value at which the state is to be computed (must be within the step).
+ * \return Interpolated state at the requested independent variable value.
+ */
+template < typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType computeCubicHermiteDenseOutputState(
+        const IndependentVariableType previousIndependentVariable,
+        const StateType& previousState,
+        const StateDerivativeType& previousStateDerivative,
+        const IndependentVariableType currentIndependentVariable,
+        const StateType& currentState,
+        const StateDerivativeType& currentStateDerivative,
+        const IndependentVariableType independentVariable )
+{
+    typedef typename StateType::Scalar StateScalarType;
+
+    // Compute normalized position in step, and check if it is within step.
+    const TimeStepType stepSize = static_cast< TimeStepType >( currentIndependentVariable - previousIndependentVariable );
+    const TimeStepType normalizedIndependentVariable =
+            static_cast< TimeStepType >( independentVariable - previousIndependentVariable ) / stepSize;
+    if( !( normalizedIndependentVariable >= -1.0E-12 && normalizedIndependentVariable <= 1.0 + 1.0E-12 ) )
+    {
+        throw std::runtime_error( "Error when computing dense output, requested independent variable is outside of last step" );
+    }
+
+    // Compute Hermite basis functions, and interpolated state.
+    const TimeStepType complementNormalizedIndependentVariable = 1.0 - normalizedIndependentVariable;
+    const TimeStepType squaredNormalizedIndependentVariable = normalizedIndependentVariable * normalizedIndependentVariable;
+    const TimeStepType squaredComplementNormalizedIndependentVariable =
+            complementNormalizedIndependentVariable * complementNormalizedIndependentVariable;
+
+    return static_cast< StateScalarType >(
+                ( 1.0 + 2.0 * normalizedIndependentVariable ) * squaredComplementNormalizedIndependentVariable ) *
+            previousState +
+            static_cast< StateScalarType >(
+                normalizedIndependentVariable * squaredComplementNormalizedIndependentVariable * stepSize ) *
+            previousStateDerivative +
+            static_cast< StateScalarType >(
+                squaredNormalizedIndependentVariable * ( 3.0 - 2.0 * normalizedIndependentVariable ) ) *
+            currentState -
+            static_cast< StateScalarType >(
+                squaredNormalizedIndependentVariable * complementNormalizedIndependentVariable * stepSize ) *
+            currentStateDerivative;
+}
+
 //! Perform an integration to a specified independent variable value.
 template < typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 StateType NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::integrateTo(
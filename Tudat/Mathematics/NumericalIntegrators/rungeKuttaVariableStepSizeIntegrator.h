@@ -238,7 +238,7 @@ public:
      * Runge-Kutta scheme.
      * \return Current state derivatives evaluated according to stages of Runge-Kutta scheme.
      */
-    std::vector< StateDerivativeType > getCurrentStateDerivatives( )
+    virtual std::vector< StateDerivativeType > getCurrentStateDerivatives( )
     {
         return currentStateDerivatives_;
     }
@@ -269,6 +269,10 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+
+        // State derivative at the start of the last step is the current state derivative after the rollback.
+        currentStateDerivative_ = lastStateDerivative_;
+        isCurrentStateDerivativeSet_ = isFirstStageAtStartOfStep( );
         return true;
     }
 
@@ -292,6 +296,54 @@ public:
         return this->lastState_;
     }
 
+    //! Function to check whether dense output is available for the last step.
+    /*!
+     * Function to check whether dense output is available for the last step, which is the case if a step has been
+     * taken since the integrator was created, rolled back, or its state was modified (and the first stage of the
+     * coefficient set is evaluated at the start of the step).
+     * \return True if dense output is available for the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        return ( this->currentIndependentVariable_ != this->lastIndependentVariable_ && isFirstStageAtStartOfStep( ) );
+    }
+
+    //! Function to get the state at an independent variable value within the last step, from the dense output.
+    /*!
+     * Function to get the state at an independent variable value within the last step, from the dense output. The
+     * state is computed by cubic Hermite interpolation (see computeCubicHermiteDenseOutputState), using the stage
+     * evaluation at the start of the step and the state derivative at the end of the step. The latter is evaluated
+     * once (when first needed) and reused as the first stage of the next step, so that the dense output requires no
+     * additional state derivative evaluations.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return State at the requested independent variable value.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error, dense output of Runge-Kutta integrator not available" );
+        }
+
+        return computeCubicHermiteDenseOutputState< IndependentVariableType, StateType, StateDerivativeType,
+                TimeStepType >( this->lastIndependentVariable_, this->lastState_, lastStateDerivative_,
+                                this->currentIndependentVariable_, this->currentState_, getCurrentStateDerivative( ),
+                                independentVariable );
+    }
+
+    //! Function to compute the state derivative at the current state.
+    /*!
+     * Function to compute the state derivative at the current state (updating the environment, if any), which is stored
+     * for the dense output of the last step, and reused as the first stage of the next step.
+     * \return State derivative at the current state.
+     */
+    StateDerivativeType computeCurrentStateDerivative( )
+    {
+        currentStateDerivative_ = this->stateDerivativeFunction_( this->currentIndependentVariable_, this->currentState_ );
+        isCurrentStateDerivativeSet_ = isFirstStageAtStartOfStep( );
+        return currentStateDerivative_;
+    }
+
     //! Modify the state at the current interval.
     /*!
      * Modify the state at the current interval. This allows for discrete jumps in the state, often
@@ -306,6 +358,7 @@ public:
     {
         this->currentState_ = newState;
         this->lastIndependentVariable_ = currentIndependentVariable_;
+        isCurrentStateDerivativeSet_ = false;
     }
 
     //! Function to toggle the use of step-size control
@@ -320,6 +373,34 @@ public:
 
 protected:
 
+    //! Function to get the state derivative at the current state.
+    /*!
+     * Function to get the state derivative at the current state, which is evaluated if it has not yet been computed
+     * for the current state.
+     * \return State derivative at the current state.
+     */
+    const StateDerivativeType& getCurrentStateDerivative( )
+    {
+        if( !isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivative_ = this->stateDerivativeFunction_(
+                        this->currentIndependentVariable_, this->currentState_ );
+            isCurrentStateDerivativeSet_ = true;
+        }
+        return currentStateDerivative_;
+    }
+
+    //! Function to check whether the first stage is evaluated at the start of the step.
+    /*!
+     * Function to check whether the first stage is evaluated at the start of the step (which is the case for all
+     * predefined coefficient sets), so that it is equal to the state derivative at the start of the step.
+     * \return True if the first stage is evaluated at the start of the step.
+     */
+    bool isFirstStageAtStartOfStep( )
+    {
+        return ( coefficients_.cCoefficients.rows( ) > 0 && coefficients_.cCoefficients( 0 ) == 0.0 );
+    }
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -333,6 +414,18 @@ protected:
                                                        const StateType& higherOrderEstimate,
                                                        const TimeStepType stepSize );
 
+    //! Sets the next step size from the step size predicted by the step size control.
+    /*!
+     * Sets the next step size from the step size predicted by the step size control, limiting its change w.r.t. the
+     * current step size to the minimum and maximum factors, and limiting it to the maximum step size.
+     * \param newStepSizePair Pair with predicted new step size and a boolean denoting whether the error of the current
+     * step is within bounds (as returned by computeNewStepSize).
+     * \param stepSize The step size used to obtain the current results.
+     * \return True if the error was within bounds, false otherwise.
+     */
+    bool limitAndSetNextStepSize( const std::pair< TimeStepType, bool >& newStepSizePair,
+                                  const TimeStepType stepSize );
+
     //! Compute new step size.
     /*!
      * Computes the new step size based on a generic definition of the local truncation error.
@@ -457,6 +550,15 @@ protected:
 
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
+
+    //! State derivative at the start of the last step (first stage of the last step), used for dense output.
+    StateDerivativeType lastStateDerivative_;
+
+    //! State derivative at the current state (if isCurrentStateDerivativeSet_ is true).
+    StateDerivativeType currentStateDerivative_;
+
+    //! Boolean denoting whether currentStateDerivative_ has been computed for the current state.
+    bool isCurrentStateDerivativeSet_ = false;
 };
 
 //! Perform a single integration step.
@@ -486,10 +588,17 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
                     * currentStateDerivatives_[ column ];
         }
 
-        // Compute the state derivative.
+        // Compute the state derivative (reusing the current state derivative for the first stage, if available).
         const IndependentVariableType time = this->currentIndependentVariable_ +
                 this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        if( stage == 0 && isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivatives_.push_back( currentStateDerivative_ );
+        }
+        else
+        {
+            currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        }
 
         // Check if propagation should terminate because the propagation termination condition has been reached
         // while computing the intermediate state.
@@ -515,6 +624,11 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
         this->lastState_ = this->currentState_;
         this->currentIndependentVariable_ += stepSize;
+        if( isFirstStageAtStartOfStep( ) )
+        {
+            lastStateDerivative_ = currentStateDerivatives_[ 0 ];
+        }
+        isCurrentStateDerivativeSet_ = false;
 
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
@@ -532,7 +646,8 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     }
     else
     {
-        // Reject current step.
+        // Reject current step (first stage is re-evaluated for the new attempt, so that the environment is updated).
+        isCurrentStateDerivativeSet_ = false;
         return performIntegrationStep( this->stepSize_ );
     }
 }
@@ -555,52 +670,61 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
                     this->absoluteErrorTolerance_, lowerOrderEstimate,
                     higherOrderEstimate );
 
-        // Check whether change in stepsize does not exceed bounds.
-        // If the stepsize is reduced to less than the prescibed minimum factor, set to minimum factor.
-        // If the stepsize is increased to more than the prescribed maximum factor, set to maximum
-        // factor. These bounds are necessary to prevent the stepsize changes from aliasing
-        // with the dynamics of the system of ODEs.
-        // Also check if maximum step size is exceeded and step next step size to maximum if necessary.
-        // Typically used bounds can be found in (Burden and Faires, 2001).
-        if ( newStepSizePair.first / stepSize <= this->minimumFactorDecreaseForNextStepSize_ )
-        {
-            this->stepSize_ = stepSize * this->minimumFactorDecreaseForNextStepSize_;
-        }
-
-        else if ( newStepSizePair.first / stepSize >= maximumFactorIncreaseForNextStepSize_ )
-        {
-            this->stepSize_ = stepSize * this->maximumFactorIncreaseForNextStepSize_;
-        }
+        return limitAndSetNextStepSize( newStepSizePair, stepSize );
+    }
+    else
+    {
+        this->stepSize_ = stepSize;
+        return true;
+    }
+}
 
-        else
-        {
-            this->stepSize_ = newStepSizePair.first;
-        }
+//! Sets the next step size from the step size predicted by the step size control.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+bool
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::limitAndSetNextStepSize( const std::pair< TimeStepType, bool >& newStepSizePair, const TimeStepType stepSize )
+{
+    // Check whether change in stepsize does not exceed bounds.
+    // If the stepsize is reduced to less than the prescibed minimum factor, set to minimum factor.
+    // If the stepsize is increased to more than the prescribed maximum factor, set to maximum
+    // factor. These bounds are necessary to prevent the stepsize changes from aliasing
+    // with the dynamics of the system of ODEs.
+    // Also check if maximum step size is exceeded and step next step size to maximum if necessary.
+    // Typically used bounds can be found in (Burden and Faires, 2001).
+    if ( newStepSizePair.first / stepSize <= this->minimumFactorDecreaseForNextStepSize_ )
+    {
+        this->stepSize_ = stepSize * this->minimumFactorDecreaseForNextStepSize_;
+    }
 
-        // Check if minimum step size is violated and throw exception if necessary.
-        if ( std::fabs( this->stepSize_ ) < std::fabs( this->minimumStepSize_ ) )
-        {
-            throw MinimumStepSizeExceededError( std::fabs( this->minimumStepSize_ ),
-                                                std::fabs( this->stepSize_ ) );
-        }
-        else if( std::fabs( this->stepSize_ ) > std::fabs( this->maximumStepSize_ ) )
-        {
-            this->stepSize_ = stepSize / std::fabs( stepSize ) * std::fabs( this->maximumStepSize_ );
-        }
+    else if ( newStepSizePair.first / stepSize >= maximumFactorIncreaseForNextStepSize_ )
+    {
+        this->stepSize_ = stepSize * this->maximumFactorIncreaseForNextStepSize_;
+    }
 
-        if( stepSize * this->stepSize_ < 0 )
-        {
-            throw std::runtime_error( "Error during step size control, step size flipped sign" );
-        }
+    else
+    {
+        this->stepSize_ = newStepSizePair.first;
+    }
 
-        // Check if computed error in state is too large and reject step if true.
-        return newStepSizePair.second;
+    // Check if minimum step size is violated and throw exception if necessary.
+    if ( std::fabs( this->stepSize_ ) < std::fabs( this->minimumStepSize_ ) )
+    {
+        throw MinimumStepSizeExceededError( std::fabs( this->minimumStepSize_ ),
+                                            std::fabs( this->stepSize_ ) );
     }
-    else
+    else if( std::fabs( this->stepSize_ ) > std::fabs( this->maximumStepSize_ ) )
     {
-        this->stepSize_ = stepSize;
-        return true;
+        this->stepSize_ = stepSize / std::fabs( stepSize ) * std::fabs( this->maximumStepSize_ );
     }
+
+    if( stepSize * this->stepSize_ < 0 )
+    {
+        throw std::runtime_error( "Error during step size control, step size flipped sign" );
+    }
+
+    // Check if computed error in state is too large and reject step if true.
+    return newStepSizePair.second;
 }
 
 //! Compute new step size.
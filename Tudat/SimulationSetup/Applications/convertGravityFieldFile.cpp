@@ -0,0 +1,55 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+
+//! Convert a spherical harmonic gravity field file to the binary (memory-mapped) gravity field format.
+/*!
+ *  Usage: convert_gravity_field_file GRAVITY_FIELD_FILE [GRAVITATIONAL_PARAMETER_INDEX REFERENCE_RADIUS_INDEX]
+ *  [BINARY_FILE]
+ *  The header indices default to 0 and 1 (as for the gravity field files included in Tudat); use -1 -1 for files
+ *  without header. If no binary file is provided, the binary file is written next to the gravity field file, where it is
+ *  used automatically when the gravity field file is loaded (with the same header indices).
+ */
+int main( int argumentCount, char* arguments[ ] )
+{
+    if( argumentCount != 2 && argumentCount != 4 && argumentCount != 5 )
+    {
+        std::cerr << "Usage: " << arguments[ 0 ] << " GRAVITY_FIELD_FILE "
+                  << "[GRAVITATIONAL_PARAMETER_INDEX REFERENCE_RADIUS_INDEX] [BINARY_FILE]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        const std::string gravityFieldFile = arguments[ 1 ];
+        const int gravitationalParameterIndex = ( argumentCount >= 4 ) ? std::stoi( arguments[ 2 ] ) : 0;
+        const int referenceRadiusIndex = ( argumentCount >= 4 ) ? std::stoi( arguments[ 3 ] ) : 1;
+        const std::string binaryFile = ( argumentCount == 5 ) ? arguments[ 4 ] : "";
+
+        std::cout << "Written binary gravity field file: "
+                  << tudat::simulation_setup::convertGravityFieldFileToBinary(
+                         gravityFieldFile, gravitationalParameterIndex, referenceRadiusIndex, binaryFile )
+                  << std::endl;
+    }
+    catch( std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
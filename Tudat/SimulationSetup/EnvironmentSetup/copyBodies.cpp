@@ -0,0 +1,451 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/customEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/multiArcEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/copyBodies.h"
+
+#if USE_SOFA
+#include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#endif
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to create a copy of an ephemeris, which can be evaluated concurrently with the original.
+boost::shared_ptr< ephemerides::Ephemeris > copyEphemerisForConcurrentEvaluation(
+        const boost::shared_ptr< ephemerides::Ephemeris > ephemeris, const std::string& bodyName )
+{
+    using namespace ephemerides;
+
+    boost::shared_ptr< Ephemeris > ephemerisCopy;
+
+    // Ephemerides that are not modified upon evaluation are shared with the original (the look-up scheme of the
+    // interpolator of a tabulated ephemeris may be used concurrently).
+    if( ( boost::dynamic_pointer_cast< ConstantEphemeris >( ephemeris ) != NULL ) ||
+            ( boost::dynamic_pointer_cast< CustomEphemeris >( ephemeris ) != NULL ) ||
+            ( boost::dynamic_pointer_cast< ChebyshevEphemeris >( ephemeris ) != NULL ) ||
+            ( boost::dynamic_pointer_cast< KeplerEphemeris >( ephemeris ) != NULL ) ||
+            isTabulatedEphemeris( ephemeris ) )
+    {
+        ephemerisCopy = ephemeris;
+    }
+    else if( boost::dynamic_pointer_cast< MultiArcEphemeris >( ephemeris ) != NULL )
+    {
+        boost::shared_ptr< MultiArcEphemeris > multiArcEphemeris =
+                boost::dynamic_pointer_cast< MultiArcEphemeris >( ephemeris );
+
+        std::vector< boost::shared_ptr< Ephemeris > > singleArcEphemerides =
+                multiArcEphemeris->getSingleArcEphemerides( );
+        std::vector< double > arcStartTimes = multiArcEphemeris->getArcSplitTimes( );
+        arcStartTimes.pop_back( );
+
+        std::map< double, boost::shared_ptr< Ephemeris > > singleArcEphemerisCopies;
+        for( unsigned int i = 0; i < singleArcEphemerides.size( ); i++ )
+        {
+            singleArcEphemerisCopies[ arcStartTimes.at( i ) ] =
+                    copyEphemerisForConcurrentEvaluation( singleArcEphemerides.at( i ), bodyName );
+        }
+        ephemerisCopy = boost::make_shared< MultiArcEphemeris >(
+                    singleArcEphemerisCopies, ephemeris->getReferenceFrameOrigin( ),
+                    ephemeris->getReferenceFrameOrientation( ) );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when copying ephemeris of body " + bodyName +
+                                  " for concurrent evaluation, ephemeris type not supported" );
+    }
+
+    return ephemerisCopy;
+}
+
+//! Function to create a copy of a rotation model, which can be evaluated concurrently with the original.
+boost::shared_ptr< ephemerides::RotationalEphemeris > copyRotationModelForConcurrentEvaluation(
+        const boost::shared_ptr< ephemerides::RotationalEphemeris > rotationModel, const std::string& bodyName )
+{
+    using namespace ephemerides;
+
+    boost::shared_ptr< RotationalEphemeris > rotationModelCopy;
+
+    if( boost::dynamic_pointer_cast< SimpleRotationalEphemeris >( rotationModel ) != NULL )
+    {
+        rotationModelCopy = rotationModel;
+    }
+    else if( boost::dynamic_pointer_cast< TabulatedRotationalEphemeris< double, double > >( rotationModel ) != NULL )
+    {
+        // Create new object for current rotation, sharing the interpolator with the original.
+        rotationModelCopy = boost::make_shared< TabulatedRotationalEphemeris< double, double > >(
+                    boost::dynamic_pointer_cast< TabulatedRotationalEphemeris< double, double > >(
+                        rotationModel )->getInterpolator( ),
+                    rotationModel->getBaseFrameOrientation( ), rotationModel->getTargetFrameOrientation( ) );
+    }
+#if USE_SOFA
+    else if( boost::dynamic_pointer_cast< GcrsToItrsRotationModel >( rotationModel ) != NULL )
+    {
+        boost::shared_ptr< GcrsToItrsRotationModel > gcrsToItrsRotationModel =
+                boost::dynamic_pointer_cast< GcrsToItrsRotationModel >( rotationModel );
+        rotationModelCopy = boost::make_shared< GcrsToItrsRotationModel >(
+                    earth_orientation::copyEarthOrientationAnglesCalculator(
+                        gcrsToItrsRotationModel->getAnglesCalculator( ) ),
+                    gcrsToItrsRotationModel->getInputTimeScale( ) );
+    }
+#endif
+    else
+    {
+        throw std::runtime_error( "Error when copying rotation model of body " + bodyName +
+                                  " for concurrent evaluation, rotation model type not supported" );
+    }
+
+    return rotationModelCopy;
+}
+
+//! Function to create a copy of a gravity field model, which can be evaluated concurrently with the original.
+boost::shared_ptr< gravitation::GravityFieldModel > copyGravityFieldModelForConcurrentEvaluation(
+        const boost::shared_ptr< gravitation::GravityFieldModel > gravityFieldModel, const std::string& bodyName )
+{
+    using namespace gravitation;
+
+    // Time-dependent fields are modified by gravity field variations, which depend on the state of other bodies.
+    if( boost::dynamic_pointer_cast< TimeDependentSphericalHarmonicsGravityField >( gravityFieldModel ) != NULL )
+    {
+        throw std::runtime_error( "Error when copying gravity field model of body " + bodyName +
+                                  " for concurrent evaluation, time-dependent gravity field not supported" );
+    }
+
+    // Acceleration models keep their own spherical harmonics cache, so other gravity fields are shared with the original.
+    return gravityFieldModel;
+}
+
+//! Function to create a copy of an atmosphere model, which can be evaluated concurrently with the original.
+boost::shared_ptr< aerodynamics::AtmosphereModel > copyAtmosphereModelForConcurrentEvaluation(
+        const boost::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel, const std::string& bodyName )
+{
+    using namespace aerodynamics;
+
+    boost::shared_ptr< AtmosphereModel > atmosphereModelCopy;
+
+    if( boost::dynamic_pointer_cast< ExponentialAtmosphere >( atmosphereModel ) != NULL )
+    {
+        atmosphereModelCopy = atmosphereModel;
+    }
+    else if( boost::dynamic_pointer_cast< TabulatedAtmosphere >( atmosphereModel ) != NULL )
+    {
+        // Interpolators of tabulated atmosphere are not modified upon evaluation (other than the look-up scheme, which
+        // may be used concurrently).
+        atmosphereModelCopy = atmosphereModel;
+    }
+    else if( boost::dynamic_pointer_cast< NRLMSISE00Atmosphere >( atmosphereModel ) != NULL )
+    {
+        boost::shared_ptr< NRLMSISE00Atmosphere > nrlmsise00Atmosphere =
+                boost::dynamic_pointer_cast< NRLMSISE00Atmosphere >( atmosphereModel );
+        atmosphereModelCopy = boost::make_shared< NRLMSISE00Atmosphere >(
+                    nrlmsise00Atmosphere->getNRLMSISE00InputFunction( ),
+                    nrlmsise00Atmosphere->getSpecificHeatRatio( ),
+                    nrlmsise00Atmosphere->getGasComponentProperties( ),
+                    nrlmsise00Atmosphere->getUseIdealGasLaw( ) );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when copying atmosphere model of body " + bodyName +
+                                  " for concurrent evaluation, atmosphere model type not supported" );
+    }
+
+    // Set wind model of original for a newly created atmosphere model.
+    if( atmosphereModelCopy != atmosphereModel )
+    {
+        atmosphereModelCopy->setWindModel( atmosphereModel->getWindModel( ) );
+    }
+
+    return atmosphereModelCopy;
+}
+
+//! Function to copy the radiation pressure interfaces of a body, using the copied bodies for the source and target
+//! positions.
+void copyRadiationPressureInterfaces(
+        const NamedBodyMap& bodyMap, const NamedBodyMap& bodyMapCopy, const std::string& bodyName )
+{
+    using namespace electro_magnetism;
+
+    std::map< std::string, boost::shared_ptr< RadiationPressureInterface > > radiationPressureInterfaces =
+            bodyMap.at( bodyName )->getRadiationPressureInterfaces( );
+    for( std::map< std::string, boost::shared_ptr< RadiationPressureInterface > >::const_iterator
+         interfaceIterator = radiationPressureInterfaces.begin( );
+         interfaceIterator != radiationPressureInterfaces.end( ); interfaceIterator++ )
+    {
+        boost::shared_ptr< RadiationPressureInterface > radiationPressureInterface = interfaceIterator->second;
+        if( radiationPressureInterface->getOccultingBodyPositions( ).size( ) > 0 )
+        {
+            throw std::runtime_error( "Error when copying radiation pressure interface of body " + bodyName +
+                                      " for concurrent evaluation, occulting bodies not supported" );
+        }
+        else if( bodyMapCopy.count( interfaceIterator->first ) == 0 )
+        {
+            throw std::runtime_error( "Error when copying radiation pressure interface of body " + bodyName +
+                                      " for concurrent evaluation, source body " + interfaceIterator->first +
+                                      " not found" );
+        }
+
+        bodyMapCopy.at( bodyName )->setRadiationPressureInterface(
+                    interfaceIterator->first, boost::make_shared< RadiationPressureInterface >(
+                        radiationPressureInterface->getSourcePowerFunction( ),
+                        boost::bind( &Body::getPosition, bodyMapCopy.at( interfaceIterator->first ) ),
+                        boost::bind( &Body::getPosition, bodyMapCopy.at( bodyName ) ),
+                        radiationPressureInterface->getRadiationPressureCoefficient( ),
+                        radiationPressureInterface->getArea( ),
+                        std::vector< boost::function< Eigen::Vector3d( ) > >( ),
+                        std::vector< double >( ),
+                        radiationPressureInterface->getSourceRadius( ) ) );
+    }
+}
+
+//! Function to create the ground stations of a body on its copy, sharing the station states with the original.
+void copyGroundStations( const NamedBodyMap& bodyMap, const NamedBodyMap& bodyMapCopy, const std::string& bodyName )
+{
+    std::map< std::string, boost::shared_ptr< ground_stations::GroundStation > > groundStations =
+            bodyMap.at( bodyName )->getGroundStationMap( );
+    for( std::map< std::string, boost::shared_ptr< ground_stations::GroundStation > >::const_iterator
+         stationIterator = groundStations.begin( ); stationIterator != groundStations.end( ); stationIterator++ )
+    {
+        createGroundStation( bodyMapCopy.at( bodyName ), stationIterator->first,
+                             stationIterator->second->getNominalStationState( ) );
+    }
+}
+
+//! Function to check whether the ephemeris frame of a body is linked to the global frame with the requested precision.
+template< typename TimeType, typename StateScalarType >
+bool isBaseStateInterfaceOfType( const boost::shared_ptr< Body > body )
+{
+    return ( boost::dynamic_pointer_cast< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
+                 body->getEphemerisFrameToBaseFrame( ) ) != NULL );
+}
+
+//! Function to set the global frame origin and orientation of the original bodies for the copied bodies.
+void setGlobalFrameOfCopiedBodies( const NamedBodyMap& bodyMap, const NamedBodyMap& bodyMapCopy )
+{
+    // Check if global frame is defined for original bodies
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        if( bodyIterator->second->getIsBodyGlobalFrameOrigin( ) == -1 )
+        {
+            return;
+        }
+    }
+    std::string globalFrameOrigin = getGlobalFrameOrigin( bodyMap );
+
+    // Retrieve global frame orientation, and precision of frame conversions, from original bodies.
+    std::string globalFrameOrientation = "ECLIPJ2000";
+    bool useLongDoubleStates = false;
+    bool useExtendedTime = false;
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        if( bodyIterator->second->getEphemeris( ) != NULL )
+        {
+            globalFrameOrientation = bodyIterator->second->getEphemeris( )->getReferenceFrameOrientation( );
+        }
+        else if( bodyIterator->second->getRotationalEphemeris( ) != NULL )
+        {
+            globalFrameOrientation = bodyIterator->second->getRotationalEphemeris( )->getBaseFrameOrientation( );
+        }
+
+        if( isBaseStateInterfaceOfType< double, long double >( bodyIterator->second ) ||
+                isBaseStateInterfaceOfType< Time, long double >( bodyIterator->second ) )
+        {
+            useLongDoubleStates = true;
+        }
+
+        if( isBaseStateInterfaceOfType< Time, double >( bodyIterator->second ) ||
+                isBaseStateInterfaceOfType< Time, long double >( bodyIterator->second ) )
+        {
+            useExtendedTime = true;
+        }
+    }
+
+    if( !useLongDoubleStates && !useExtendedTime )
+    {
+        setGlobalFrameBodyEphemerides< double, double >( bodyMapCopy, globalFrameOrigin, globalFrameOrientation );
+    }
+    else if( useLongDoubleStates && !useExtendedTime )
+    {
+        setGlobalFrameBodyEphemerides< long double, double >( bodyMapCopy, globalFrameOrigin, globalFrameOrientation );
+    }
+    else if( !useLongDoubleStates && useExtendedTime )
+    {
+        setGlobalFrameBodyEphemerides< double, Time >( bodyMapCopy, globalFrameOrigin, globalFrameOrientation );
+    }
+    else
+    {
+        setGlobalFrameBodyEphemerides< long double, Time >( bodyMapCopy, globalFrameOrigin, globalFrameOrientation );
+    }
+}
+
+//! Function to create a copy of a set of bodies, which can be used concurrently with the original.
+NamedBodyMap copyBodyMapForConcurrentEvaluation( const NamedBodyMap& bodyMap )
+{
+    NamedBodyMap bodyMapCopy;
+
+    // Create bodies, and copy their environment models
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        const std::string& bodyName = bodyIterator->first;
+        boost::shared_ptr< Body > body = bodyIterator->second;
+
+        if( body->getGravityFieldVariationSet( ) != NULL )
+        {
+            throw std::runtime_error( "Error when copying body " + bodyName +
+                                      " for concurrent evaluation, gravity field variations not supported" );
+        }
+
+        if( body->getAerodynamicCoefficientInterface( ) != NULL )
+        {
+            throw std::runtime_error( "Error when copying body " + bodyName +
+                                      " for concurrent evaluation, aerodynamic coefficient interface not supported" );
+        }
+
+        if( body->getVehicleSystems( ) != NULL )
+        {
+            throw std::runtime_error( "Error when copying body " + bodyName +
+                                      " for concurrent evaluation, vehicle systems not supported" );
+        }
+
+        boost::shared_ptr< Body > bodyCopy = boost::make_shared< Body >( );
+
+        if( body->getEphemeris( ) != NULL )
+        {
+            bodyCopy->setEphemeris( copyEphemerisForConcurrentEvaluation( body->getEphemeris( ), bodyName ) );
+        }
+
+        if( body->getAtmosphereModel( ) != NULL )
+        {
+            bodyCopy->setAtmosphereModel( copyAtmosphereModelForConcurrentEvaluation(
+                                              body->getAtmosphereModel( ), bodyName ) );
+        }
+
+        if( body->getShapeModel( ) != NULL )
+        {
+            bodyCopy->setShapeModel( body->getShapeModel( ) );
+        }
+
+        if( body->getRotationalEphemeris( ) != NULL )
+        {
+            bodyCopy->setRotationalEphemeris( copyRotationModelForConcurrentEvaluation(
+                                                  body->getRotationalEphemeris( ), bodyName ) );
+        }
+
+        if( body->getGravityFieldModel( ) != NULL )
+        {
+            bodyCopy->setGravityFieldModel( copyGravityFieldModelForConcurrentEvaluation(
+                                                body->getGravityFieldModel( ), bodyName ) );
+        }
+
+        // Set mass properties (after gravity field, which resets the mass function)
+        if( body->getBodyMassFunction( ) != NULL )
+        {
+            bodyCopy->setConstantBodyMass( body->getBodyMass( ) );
+            bodyCopy->setBodyMassFunction( body->getBodyMassFunction( ) );
+        }
+        bodyCopy->setBodyInertiaTensor( body->getBodyInertiaTensor( ) );
+
+        bodyMapCopy[ bodyName ] = bodyCopy;
+    }
+
+    // Create models that depend on (other) copied bodies
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        copyRadiationPressureInterfaces( bodyMap, bodyMapCopy, bodyIterator->first );
+
+        copyGroundStations( bodyMap, bodyMapCopy, bodyIterator->first );
+    }
+
+    setGlobalFrameOfCopiedBodies( bodyMap, bodyMapCopy );
+
+    return bodyMapCopy;
+}
+
+//! Function to create a copy of a set of bodies, which can be used to compute observations concurrently with the
+//! original.
+NamedBodyMap copyBodyMapForConcurrentObservationEvaluation( const NamedBodyMap& bodyMap )
+{
+    NamedBodyMap bodyMapCopy;
+
+    // Create bodies, and copy the environment models that are used to compute observations
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        const std::string& bodyName = bodyIterator->first;
+        boost::shared_ptr< Body > body = bodyIterator->second;
+
+        boost::shared_ptr< Body > bodyCopy = boost::make_shared< Body >( );
+
+        if( body->getEphemeris( ) != NULL )
+        {
+            bodyCopy->setEphemeris( copyEphemerisForConcurrentEvaluation( body->getEphemeris( ), bodyName ) );
+        }
+
+        if( body->getRotationalEphemeris( ) != NULL )
+        {
+            bodyCopy->setRotationalEphemeris( copyRotationModelForConcurrentEvaluation(
+                                                  body->getRotationalEphemeris( ), bodyName ) );
+        }
+
+        // Only constant properties of the gravity field and shape models are used to compute observations
+        if( body->getGravityFieldModel( ) != NULL )
+        {
+            bodyCopy->setGravityFieldModel( body->getGravityFieldModel( ) );
+        }
+
+        if( body->getShapeModel( ) != NULL )
+        {
+            bodyCopy->setShapeModel( body->getShapeModel( ) );
+        }
+
+        bodyMapCopy[ bodyName ] = bodyCopy;
+    }
+
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        copyGroundStations( bodyMap, bodyMapCopy, bodyIterator->first );
+    }
+
+    setGlobalFrameOfCopiedBodies( bodyMap, bodyMapCopy );
+
+    return bodyMapCopy;
+}
+
+//! Function to create a list of copies of a set of bodies, one for each thread that is to use them concurrently.
+std::vector< NamedBodyMap > copyBodyMapForConcurrentEvaluation(
+        const NamedBodyMap& bodyMap, const unsigned int numberOfCopies )
+{
+    std::vector< NamedBodyMap > bodyMapCopies;
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        bodyMapCopies.push_back( copyBodyMapForConcurrentEvaluation( bodyMap ) );
+    }
+    return bodyMapCopies;
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
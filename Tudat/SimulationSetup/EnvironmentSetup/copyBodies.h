@@ -0,0 +1,138 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COPYBODIES_H
+#define TUDAT_COPYBODIES_H
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to create a copy of an ephemeris, which can be evaluated concurrently with the original.
+/*!
+ *  Function to create a copy of an ephemeris, which can be evaluated concurrently with the original. Ephemerides that
+ *  do not modify any member when being evaluated (constant, custom, Chebyshev, Kepler and tabulated ephemerides, of
+ *  which the interpolator look-up may be used concurrently) are not copied, but returned directly. Multi-arc
+ *  ephemerides are recreated from copies of their arc ephemerides. An exception is thrown for any other type of
+ *  ephemeris (e.g. ephemerides retrieved directly from Spice, which is not thread-safe).
+ *  \param ephemeris Ephemeris that is to be copied.
+ *  \param bodyName Name of body for which ephemeris is copied (used for error messages).
+ *  \return Ephemeris that can be evaluated concurrently with the original.
+ */
+boost::shared_ptr< ephemerides::Ephemeris > copyEphemerisForConcurrentEvaluation(
+        const boost::shared_ptr< ephemerides::Ephemeris > ephemeris, const std::string& bodyName );
+
+//! Function to create a copy of a rotation model, which can be evaluated concurrently with the original.
+/*!
+ *  Function to create a copy of a rotation model, which can be evaluated concurrently with the original. Simple
+ *  rotational ephemerides are returned directly, tabulated rotational ephemerides are recreated with the interpolator of
+ *  the original, and the GCRS<->ITRS rotation model is given its own Earth orientation calculator (see
+ *  copyEarthOrientationAnglesCalculator). An exception is thrown for any other type of rotation model.
+ *  \param rotationModel Rotation model that is to be copied.
+ *  \param bodyName Name of body for which rotation model is copied (used for error messages).
+ *  \return Rotation model that can be evaluated concurrently with the original.
+ */
+boost::shared_ptr< ephemerides::RotationalEphemeris > copyRotationModelForConcurrentEvaluation(
+        const boost::shared_ptr< ephemerides::RotationalEphemeris > rotationModel, const std::string& bodyName );
+
+//! Function to create a copy of a gravity field model, which can be evaluated concurrently with the original.
+/*!
+ *  Function to create a copy of a gravity field model, which can be evaluated concurrently with the original. Point-mass
+ *  and spherical harmonic gravity field models are returned directly (acceleration models have their own spherical
+ *  harmonics cache, and the cache of the gravity field itself is locked when evaluating its potential). An exception
+ *  is thrown for time-dependent spherical harmonic gravity fields, since the gravity field variations depend on the
+ *  state of other bodies.
+ *  \param gravityFieldModel Gravity field model that is to be copied.
+ *  \param bodyName Name of body for which gravity field model is copied (used for error messages).
+ *  \return Gravity field model that can be evaluated concurrently with the original.
+ */
+boost::shared_ptr< gravitation::GravityFieldModel > copyGravityFieldModelForConcurrentEvaluation(
+        const boost::shared_ptr< gravitation::GravityFieldModel > gravityFieldModel, const std::string& bodyName );
+
+//! Function to create a copy of an atmosphere model, which can be evaluated concurrently with the original.
+/*!
+ *  Function to create a copy of an atmosphere model, which can be evaluated concurrently with the original. Exponential
+ *  and tabulated atmospheres are returned directly, NRLMSISE00 atmospheres are recreated (with their own cached input
+ *  and output). The wind model of the original is used for the
+ *  copy. An exception is thrown for any other type of atmosphere model.
+ *  \param atmosphereModel Atmosphere model that is to be copied.
+ *  \param bodyName Name of body for which atmosphere model is copied (used for error messages).
+ *  \return Atmosphere model that can be evaluated concurrently with the original.
+ */
+boost::shared_ptr< aerodynamics::AtmosphereModel > copyAtmosphereModelForConcurrentEvaluation(
+        const boost::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel, const std::string& bodyName );
+
+//! Function to create a copy of a set of bodies, which can be used concurrently with the original.
+/*!
+ *  Function to create a copy of a set of bodies, which can be used concurrently with the original (for instance to
+ *  simulate observations, propagate Monte Carlo samples or arcs on a separate thread for each copy). Each body
+ *  of the copy has its own current state and rotation, and its own copy of each environment model that keeps
+ *  data of the last evaluation (see the copy...ForConcurrentEvaluation functions), so that the environments can be
+ *  updated independently. Models and data that are not modified when evaluating the environment, such as tabulated
+ *  data, spherical harmonic coefficients, shape models, ground station states and mass functions, are shared with the
+ *  original.
+ *
+ *  The global frame origin and orientation of the original bodies are applied to the copy. Radiation pressure interfaces
+ *  and ground stations are recreated from the copied bodies. Flight conditions and dependent orientation calculators are
+ *  not copied, as these are created (and linked to the copied bodies) when creating the acceleration models from the
+ *  copy. An exception is thrown if any environment model cannot be safely copied, in particular for gravity field
+ *  variations, aerodynamic coefficient interfaces, vehicle systems and radiation pressure interfaces with occulting
+ *  bodies; such bodies should be created for each thread from their body settings instead.
+ *  \param bodyMap List of bodies that is to be copied.
+ *  \return Copy of list of bodies.
+ */
+NamedBodyMap copyBodyMapForConcurrentEvaluation( const NamedBodyMap& bodyMap );
+
+//! Function to create a copy of a set of bodies, which can be used to compute observations concurrently with the
+//! original.
+/*!
+ *  Function to create a copy of a set of bodies, which can be used to compute observations (and their partials)
+ *  concurrently with the original. Only the models that are used to compute observations are included in the copy: the
+ *  ephemerides and rotation models are copied (see copyEphemerisForConcurrentEvaluation and
+ *  copyRotationModelForConcurrentEvaluation), ground stations are recreated on the copied bodies (sharing their station
+ *  states with the original) and the gravity field and shape models, of which only constant properties are used, are
+ *  shared with the original. Models that are only used for propagation (e.g. atmosphere models, radiation pressure
+ *  interfaces and vehicle properties) are not included. The global frame origin and orientation of the original bodies
+ *  are applied to the copy.
+ *  \param bodyMap List of bodies that is to be copied.
+ *  \return Copy of list of bodies, for computation of observations.
+ */
+NamedBodyMap copyBodyMapForConcurrentObservationEvaluation( const NamedBodyMap& bodyMap );
+
+//! Function to create a list of copies of a set of bodies, one for each thread that is to use them concurrently.
+/*!
+ *  Function to create a list of copies of a set of bodies, one for each thread that is to use them concurrently, using
+ *  the copyBodyMapForConcurrentEvaluation function. The resulting list can, for instance, be provided to a
+ *  MultiArcPropagatorSettings object for concurrent propagation of arcs.
+ *  \param bodyMap List of bodies that is to be copied.
+ *  \param numberOfCopies Number of copies that is to be created.
+ *  \return List of copies of list of bodies.
+ */
+std::vector< NamedBodyMap > copyBodyMapForConcurrentEvaluation(
+        const NamedBodyMap& bodyMap, const unsigned int numberOfCopies );
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_COPYBODIES_H
@@ -12,10 +12,12 @@
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/fusedTabulatedAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00SurrogateAtmosphere.h"
 #endif
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/InputOutput/solarActivityData.h"
@@ -112,6 +114,27 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         }
         break;
     }
+    case fused_tabulated_atmosphere:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        boost::shared_ptr< FusedTabulatedAtmosphereSettings > fusedTabulatedAtmosphereSettings =
+                boost::dynamic_pointer_cast< FusedTabulatedAtmosphereSettings >( atmosphereSettings );
+        if( fusedTabulatedAtmosphereSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected fused tabulated atmosphere settings for body " + body );
+        }
+        else
+        {
+            // Create and initialize fused tabulated atmosphere model.
+            atmosphereModel = boost::make_shared< FusedTabulatedAtmosphere >(
+                        fusedTabulatedAtmosphereSettings->getAtmosphereFile( ),
+                        fusedTabulatedAtmosphereSettings->getDependentVariables( ),
+                        fusedTabulatedAtmosphereSettings->getSpecificGasConstant( ),
+                        fusedTabulatedAtmosphereSettings->getRatioOfSpecificHeats( ) );
+        }
+        break;
+    }
 #if USE_NRLMSISE00
     case nrlmsise00:
     {
@@ -138,6 +161,32 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
         break;
     }
+    case nrlmsise00_surrogate_atmosphere:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        boost::shared_ptr< NRLMSISE00SurrogateAtmosphereSettings > surrogateAtmosphereSettings =
+                boost::dynamic_pointer_cast< NRLMSISE00SurrogateAtmosphereSettings >( atmosphereSettings );
+        if( surrogateAtmosphereSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected NRLMSISE00 surrogate atmosphere settings for body " + body );
+        }
+        else
+        {
+            // Use default space weather file stored in tudatBundle, if none is specified by user.
+            std::string spaceWeatherFilePath = surrogateAtmosphereSettings->getSpaceWeatherFile( );
+            if( spaceWeatherFilePath == "" )
+            {
+                spaceWeatherFilePath = input_output::getSpaceWeatherDataPath( ) + "sw19571001.txt";
+            }
+
+            // Create and validate tabulated surrogate of NRLMSISE00 atmosphere model.
+            atmosphereModel = aerodynamics::createNRLMSISE00SurrogateAtmosphere(
+                        tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ),
+                        surrogateAtmosphereSettings->getSurrogateSettings( ) );
+        }
+        break;
+    }
 #endif
     default:
         throw std::runtime_error(
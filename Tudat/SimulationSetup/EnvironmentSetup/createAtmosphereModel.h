@@ -12,10 +12,16 @@
 #define TUDAT_CREATEATMOSPHEREMODEL_H
 
 #include <string>
+#include <vector>
 
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#if USE_NRLMSISE00
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00SurrogateAtmosphere.h"
+#endif
 
 namespace tudat
 {
@@ -125,7 +131,9 @@ enum AtmosphereTypes
 {
     exponential_atmosphere,
     tabulated_atmosphere,
-    nrlmsise00
+    nrlmsise00,
+    fused_tabulated_atmosphere,
+    nrlmsise00_surrogate_atmosphere
 };
 
 //! Class for providing settings for atmosphere model.
@@ -282,6 +290,48 @@ private:
 };
 
 
+#if USE_NRLMSISE00
+//! AtmosphereSettings for defining a tabulated surrogate of the NRLMSISE00 atmosphere.
+class NRLMSISE00SurrogateAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param surrogateSettings Settings for the creation of the surrogate model (grid and accuracy requirements).
+     *  \param spaceWeatherFile File containing space weather data, as in
+     *  https://celestrak.com/SpaceData/sw19571001.txt (default space weather file is used if empty).
+     */
+    NRLMSISE00SurrogateAtmosphereSettings( const aerodynamics::NRLMSISE00SurrogateSettings& surrogateSettings,
+                                           const std::string& spaceWeatherFile = "" ):
+        AtmosphereSettings( nrlmsise00_surrogate_atmosphere ), surrogateSettings_( surrogateSettings ),
+        spaceWeatherFile_( spaceWeatherFile ){ }
+
+    //! Function to return settings for the creation of the surrogate model.
+    /*!
+     *  Function to return settings for the creation of the surrogate model.
+     *  \return Settings for the creation of the surrogate model.
+     */
+    aerodynamics::NRLMSISE00SurrogateSettings getSurrogateSettings( ){ return surrogateSettings_; }
+
+    //! Function to return file containing space weather data.
+    /*!
+     *  Function to return file containing space weather data.
+     *  \return Filename containing space weather data (empty if default file is to be used).
+     */
+    std::string getSpaceWeatherFile( ){ return spaceWeatherFile_; }
+
+private:
+
+    //! Settings for the creation of the surrogate model.
+    aerodynamics::NRLMSISE00SurrogateSettings surrogateSettings_;
+
+    //! File containing space weather data (empty if default file is to be used).
+    std::string spaceWeatherFile_;
+};
+#endif
+
 //! AtmosphereSettings for defining an atmosphere with tabulated data from file.
 class TabulatedAtmosphereSettings: public AtmosphereSettings
 {
@@ -315,6 +365,69 @@ private:
     std::string atmosphereFile_;
 };
 
+//! AtmosphereSettings for defining an atmosphere with tabulated data from file, with all properties retrieved from a
+//! single table look-up.
+/*!
+ *  AtmosphereSettings for defining an atmosphere with tabulated data from file, with all properties retrieved from a
+ *  single table look-up (see aerodynamics::FusedTabulatedAtmosphere). The resulting properties are identical to those
+ *  of the atmosphere created from TabulatedAtmosphereSettings, but are computed more efficiently when several
+ *  properties are requested at the same conditions (as is the case during a propagation with aerodynamics).
+ */
+class FusedTabulatedAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param atmosphereFile File containing atmospheric properties, with the altitude in the first column,
+     *  and the dependent variables in the subsequent columns.
+     *  \param dependentVariables The dependent variables, in order, contained in the file.
+     *  \param specificGasConstant The constant specific gas constant of the air (used if not tabulated)
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air (used if not tabulated)
+     */
+    FusedTabulatedAtmosphereSettings(
+            const std::string& atmosphereFile,
+            const std::vector< aerodynamics::TabulatedAtmosphere::AtmosphereDependentVariables >& dependentVariables =
+    { aerodynamics::TabulatedAtmosphere::density_dependent_atmosphere,
+      aerodynamics::TabulatedAtmosphere::pressure_dependent_atmosphere,
+      aerodynamics::TabulatedAtmosphere::temperature_dependent_atmosphere },
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4 ):
+        AtmosphereSettings( fused_tabulated_atmosphere ), atmosphereFile_( atmosphereFile ),
+        dependentVariables_( dependentVariables ), specificGasConstant_( specificGasConstant ),
+        ratioOfSpecificHeats_( ratioOfSpecificHeats ){ }
+
+    //! Function to return file containing atmospheric properties.
+    std::string getAtmosphereFile( ){ return atmosphereFile_; }
+
+    //! Function to return the dependent variables, in order, contained in the file.
+    std::vector< aerodynamics::TabulatedAtmosphere::AtmosphereDependentVariables > getDependentVariables( )
+    {
+        return dependentVariables_;
+    }
+
+    //! Function to return the constant specific gas constant of the air (used if not tabulated)
+    double getSpecificGasConstant( ){ return specificGasConstant_; }
+
+    //! Function to return the constant ratio of specific heats of the air (used if not tabulated)
+    double getRatioOfSpecificHeats( ){ return ratioOfSpecificHeats_; }
+
+private:
+
+    //! File containing atmospheric properties.
+    std::string atmosphereFile_;
+
+    //! The dependent variables, in order, contained in the file.
+    std::vector< aerodynamics::TabulatedAtmosphere::AtmosphereDependentVariables > dependentVariables_;
+
+    //! The constant specific gas constant of the air (used if not tabulated)
+    double specificGasConstant_;
+
+    //! The constant ratio of specific heats of the air (used if not tabulated)
+    double ratioOfSpecificHeats_;
+};
+
 //! Function to create a wind model.
 /*!
  *  Function to create a wind model based on model-specific settings for the wind model.
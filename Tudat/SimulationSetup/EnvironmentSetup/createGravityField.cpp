@@ -16,8 +16,10 @@
 
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/triAxialEllipsoidGravity.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryGravityFieldFile.h"
 
 namespace tudat
 {
@@ -84,7 +86,7 @@ FromFileSphericalHarmonicsGravityFieldSettings::FromFileSphericalHarmonicsGravit
 {
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
     std::pair< double, double > referenceData =
-            readGravityFieldFile( filePath, maximumDegree, maximumOrder, coefficients,
+            loadGravityFieldFile( filePath, maximumDegree, maximumOrder, coefficients,
                                   gravitationalParameterIndex, referenceRadiusIndex );
     gravitationalParameter_ = gravitationalParameterIndex >= 0 ? referenceData.first : gravitationalParameter;
     referenceRadius_ = referenceRadiusIndex >= 0 ? referenceData.second : referenceRadius;
@@ -179,8 +181,8 @@ std::pair< double, double  > readGravityFieldFile(
                                  boost::algorithm::is_any_of( ", " ),
                                  boost::algorithm::token_compress_on );
 
-        // Check current line for consistency
-        if( vectorOfIndividualStrings.size( ) != 0 )
+        // Check current line for consistency (empty lines, e.g. at the end of the file, are skipped)
+        if( line.size( ) != 0 )
         {
             if( vectorOfIndividualStrings.size( ) < 4 )
             {
@@ -213,6 +215,124 @@ std::pair< double, double  > readGravityFieldFile(
     return std::make_pair( gravitationalParameter, referenceRadius );
 }
 
+//! Function to retrieve the maximum degree and order of the coefficients in a spherical harmonic gravity field file
+std::pair< int, int > getMaximumDegreeAndOrderOfGravityFieldFile(
+        const std::string& fileName, const bool fileHasHeader )
+{
+    // Attempt to open gravity file.
+    std::fstream stream( fileName.c_str( ), std::ios::in );
+    if( stream.fail( ) )
+    {
+        throw std::runtime_error( "Pds gravity field data file could not be opened: " + fileName );
+    }
+
+    std::vector< std::string > vectorOfIndividualStrings;
+    std::string line;
+    if( fileHasHeader )
+    {
+        std::getline( stream, line );
+    }
+
+    // Find maximum degree and order from first two columns of each line.
+    int maximumDegree = 0, maximumOrder = 0;
+    while( std::getline( stream, line ) )
+    {
+        boost::algorithm::trim( line );
+        boost::algorithm::split( vectorOfIndividualStrings,
+                                 line,
+                                 boost::algorithm::is_any_of( ", " ),
+                                 boost::algorithm::token_compress_on );
+        if( vectorOfIndividualStrings.size( ) >= 2 )
+        {
+            maximumDegree = std::max( maximumDegree, std::stoi( vectorOfIndividualStrings[ 0 ] ) );
+            maximumOrder = std::max( maximumOrder, std::stoi( vectorOfIndividualStrings[ 1 ] ) );
+        }
+    }
+
+    return std::make_pair( maximumDegree, maximumOrder );
+}
+
+//! Function to convert a spherical harmonic gravity field file to a binary gravity field file
+std::string convertGravityFieldFileToBinary(
+        const std::string& fileName,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const std::string& binaryFileName )
+{
+    std::pair< int, int > maximumDegreeAndOrder = getMaximumDegreeAndOrderOfGravityFieldFile(
+                fileName, ( gravitationalParameterIndex >= 0 ) && ( referenceRadiusIndex >= 0 ) );
+
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    std::pair< double, double > referenceData = readGravityFieldFile(
+                fileName, maximumDegreeAndOrder.first, maximumDegreeAndOrder.second, coefficients,
+                gravitationalParameterIndex, referenceRadiusIndex );
+
+    const std::string outputFileName = ( binaryFileName == "" ) ?
+                input_output::getBinaryGravityFieldFilePath( fileName ) : binaryFileName;
+    input_output::writeBinaryGravityFieldFile(
+                outputFileName, referenceData.first, referenceData.second, coefficients.first, coefficients.second,
+                true, gravitationalParameterIndex, referenceRadiusIndex, fileName );
+    return outputFileName;
+}
+
+//! Function to load a spherical harmonic gravity field file, using its binary version if available
+std::pair< double, double > loadGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    const std::string binaryFileName = input_output::getBinaryGravityFieldFilePath( fileName );
+    if( boost::filesystem::exists( binaryFileName ) )
+    {
+        boost::shared_ptr< input_output::BinaryGravityFieldFile > binaryFile;
+        try
+        {
+            binaryFile = boost::make_shared< input_output::BinaryGravityFieldFile >( binaryFileName );
+        }
+        catch( std::runtime_error& caughtException )
+        {
+            std::cerr << "Warning, binary gravity field file could not be used: " << caughtException.what( )
+                      << std::endl;
+        }
+
+        if( binaryFile != NULL && !binaryFile->isCreatedFromFile( fileName ) )
+        {
+            std::cerr << "Warning, binary gravity field file " << binaryFileName << " is outdated, reading "
+                      << fileName << std::endl;
+        }
+        else if( binaryFile != NULL &&
+                 binaryFile->getHeader( ).gravitationalParameterIndex == gravitationalParameterIndex &&
+                 binaryFile->getHeader( ).referenceRadiusIndex == referenceRadiusIndex &&
+                 maximumDegree <= binaryFile->getMaximumDegree( ) &&
+                 std::min( maximumDegree, maximumOrder ) <= binaryFile->getMaximumOrder( ) )
+        {
+            coefficients = binaryFile->getCoefficients( maximumDegree, maximumOrder );
+
+            // Normalize coefficients, if required.
+            if( !binaryFile->areCoefficientsNormalized( ) )
+            {
+                for( int i = 0; i <= maximumDegree; i++ )
+                {
+                    for( int j = 0; ( j <= i ) && ( j <= maximumOrder ); j++ )
+                    {
+                        const double normalizationFactor =
+                                basic_mathematics::calculateLegendreGeodesyNormalizationFactor( i, j );
+                        coefficients.first( i, j ) /= normalizationFactor;
+                        coefficients.second( i, j ) /= normalizationFactor;
+                    }
+                }
+            }
+
+            // Set cosine coefficient at (0,0) to 1.
+            coefficients.first( 0, 0 ) = 1.0;
+
+            return std::make_pair( binaryFile->getGravitationalParameter( ), binaryFile->getReferenceRadius( ) );
+        }
+    }
+
+    return readGravityFieldFile( fileName, maximumDegree, maximumOrder, coefficients,
+                                 gravitationalParameterIndex, referenceRadiusIndex );
+}
+
 //! Function to create a gravity field model.
 boost::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         const boost::shared_ptr< GravityFieldSettings > gravityFieldSettings,
@@ -326,7 +446,8 @@ boost::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                                 sphericalHarmonicFieldSettings->getAssociatedReferenceFrame( ) );
                 }
 
-
+                boost::dynamic_pointer_cast< SphericalHarmonicsGravityField >( gravityFieldModel )->setEvaluationMethod(
+                            sphericalHarmonicFieldSettings->getEvaluationMethod( ) );
             }
         }
         break;
@@ -130,7 +130,8 @@ public:
         cosineCoefficients_( cosineCoefficients ),
         sineCoefficients_( sineCoefficients ),
         associatedReferenceFrame_( associatedReferenceFrame ),
-        createTimeDependentField_( 0 )
+        createTimeDependentField_( 0 ),
+        evaluationMethod_( gravitation::term_by_term_evaluation )
     {  }
 
     //! Function to return gravitational parameter for gravity field.
@@ -199,6 +200,29 @@ public:
         createTimeDependentField_ = createTimeDependentField;
     }
 
+    //! Function to retrieve the algorithm used to evaluate accelerations due to the field
+    /*!
+     *  Function to retrieve the algorithm that spherical harmonic acceleration models use to evaluate the sum of the
+     *  spherical harmonic terms of the field.
+     *  \return Algorithm used to evaluate accelerations due to the field
+     */
+    gravitation::SphericalHarmonicsEvaluationMethod getEvaluationMethod( )
+    {
+        return evaluationMethod_;
+    }
+
+    //! Function to reset the algorithm used to evaluate accelerations due to the field
+    /*!
+     *  Function to reset the algorithm that spherical harmonic acceleration models use to evaluate the sum of the
+     *  spherical harmonic terms of the field. For high-degree fields, the order_major_vectorized_evaluation or
+     *  cunningham_recursive_evaluation are typically faster than the default term_by_term_evaluation.
+     *  \param evaluationMethod Algorithm used to evaluate accelerations due to the field
+     */
+    void setEvaluationMethod( const gravitation::SphericalHarmonicsEvaluationMethod evaluationMethod )
+    {
+        evaluationMethod_ = evaluationMethod;
+    }
+
 protected:
 
 
@@ -220,6 +244,9 @@ protected:
     //! Boolean that denotes whether the field should be created as time-dependent (even if no variations are imposed intially)
     bool createTimeDependentField_;
 
+    //! Algorithm that acceleration models use to evaluate the sum of the spherical harmonic terms of the field.
+    gravitation::SphericalHarmonicsEvaluationMethod evaluationMethod_;
+
 };
 
 
@@ -258,7 +285,8 @@ class FromFileSphericalHarmonicsGravityFieldSettings: public SphericalHarmonicsG
 public:
     //! Constructor with custom model.
     /*!
-     * Constructor with custom model.
+     * Constructor with custom model. The file is loaded with loadGravityFieldFile, so that a binary version of the file
+     * is used if it exists (see convertGravityFieldFileToBinary).
      * \param filePath Path of PDS gravity field file to be loaded.
      * \param associatedReferenceFrame Identifier for body-fixed reference frame to which the coefficients are referred.
      * \param maximumDegree Maximum degree of gravity field to be loaded.
@@ -414,6 +442,59 @@ std::pair< double, double > readGravityFieldFile(
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
         const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
 
+//! Function to retrieve the maximum degree and order of the coefficients in a spherical harmonic gravity field file
+/*!
+ *  Function to retrieve the maximum degree and order of the coefficients in a spherical harmonic gravity field file,
+ *  with the file structure as defined for readGravityFieldFile.
+ *  \param fileName Name of PDS gravity field file.
+ *  \param fileHasHeader Boolean denoting whether the first line of the file is a header with metadata.
+ *  \return Pair of maximum degree and maximum order of the coefficients in the file.
+ */
+std::pair< int, int > getMaximumDegreeAndOrderOfGravityFieldFile(
+        const std::string& fileName, const bool fileHasHeader );
+
+//! Function to convert a spherical harmonic gravity field file to a binary gravity field file
+/*!
+ *  Function to convert a spherical harmonic gravity field file (see readGravityFieldFile) to a binary gravity field file
+ *  (see input_output::writeBinaryGravityFieldFile), with all coefficients in the file. The coefficients are assumed to
+ *  be geodesy-normalized. If no name for the binary file is provided, the binary file is written next to the gravity
+ *  field file (see input_output::getBinaryGravityFieldFilePath), where it is used by loadGravityFieldFile instead of the
+ *  gravity field file.
+ *  \param fileName Name of PDS gravity field file to be converted.
+ *  \param gravitationalParameterIndex Index at which the gravitational parameter can be found in the header
+ *  (first line of the file). Set to -1 if the file has no header.
+ *  \param referenceRadiusIndex Index at which the reference radius can be found in the header
+ *  (first line of the file). Set to -1 if the file has no header.
+ *  \param binaryFileName Name of the binary file that is to be written.
+ *  \return Name of the binary file that was written.
+ */
+std::string convertGravityFieldFileToBinary(
+        const std::string& fileName,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1,
+        const std::string& binaryFileName = "" );
+
+//! Function to load a spherical harmonic gravity field file, using its binary version if available
+/*!
+ *  Function to load a spherical harmonic gravity field file, with the same interface as readGravityFieldFile. If a binary
+ *  version of the file exists (see convertGravityFieldFileToBinary), the coefficients are read from the memory-mapped
+ *  binary file, which is much faster than parsing the gravity field file (and shares the memory pages between processes
+ *  loading the same file). The binary file is only used if it was created from the current version of the gravity field
+ *  file, with the same header indices, and contains the requested degree and order; otherwise readGravityFieldFile is
+ *  used (with a warning if the binary file is outdated).
+ *  \param fileName Name of PDS gravity field file to be loaded.
+ *  \param maximumDegree Maximum degree of gravity field to be loaded.
+ *  \param maximumOrder Maximum order of gravity field to be loaded.
+ *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \param gravitationalParameterIndex Index at which the gravitational parameter can be found in the header.
+ *  \param referenceRadiusIndex Index at which the reference radius can be found in the header.
+ *  \return Pair of gravitational parameter and reference radius, values are non-NaN if
+ *  gravitationalParameterIndex and referenceRadiusIndex are >=0.
+ */
+std::pair< double, double > loadGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
+
 //! Function to create a gravity field model.
 /*!
  *  Function to create a gravity field model based on model-specific settings for the gravity field.
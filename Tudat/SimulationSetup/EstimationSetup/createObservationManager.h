@@ -278,6 +278,40 @@ void performObservationParameterEstimationClosure(
     }
 }
 
+//! Function to set the observation bias objects of an existing observation manager in the models of an observation simulator
+/*!
+ *  Function to set the observation bias objects of an existing observation manager in the models of an observation
+ *  simulator (for the same observable type and link ends), so that the biases computed by the simulator are linked to
+ *  the estimated bias parameters (see performObservationParameterEstimationClosure) of the existing manager.
+ *  \param observationSimulator Observation simulator in which the bias objects are to be set.
+ *  \param observationManager Observation manager from which the bias objects are to be retrieved.
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+void setObservationBiasesFromObservationManager(
+        const boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >
+        observationSimulator,
+        const boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager )
+{
+    boost::shared_ptr< ObservationManager< ObservationSize, ObservationScalarType, TimeType > >
+            observationManagerWithBiases = boost::dynamic_pointer_cast<
+            ObservationManager< ObservationSize, ObservationScalarType, TimeType > >( observationManager );
+    if( observationManagerWithBiases == NULL )
+    {
+        throw std::runtime_error( "Error when setting observation biases from observation manager, size is inconsistent" );
+    }
+
+    std::map< LinkEnds, boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
+            observationModels = observationSimulator->getObservationModels( );
+    for( typename std::map< LinkEnds, boost::shared_ptr<
+         ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >::const_iterator
+         modelIterator = observationModels.begin( ); modelIterator != observationModels.end( ); modelIterator++ )
+    {
+        modelIterator->second->setObservationBiasCalculator(
+                    observationManagerWithBiases->getObservationModel( modelIterator->first )->
+                    getObservationBiasCalculator( ) );
+    }
+}
+
 //! Function to create an object to simulate observations of a given type and associated partials
 /*!
  *  Function to create an object to simulate observations of a given type and associated partials
@@ -287,6 +321,9 @@ void performObservationParameterEstimationClosure(
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param observationManagerWithBiases Existing observation manager (created with the same settings) of which the
+ *  observation bias objects are to be used, for instance to compute observations concurrently using a copy of the
+ *  environment. If NULL (default), the bias objects created from the settings are linked to the estimated parameters.
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< int ObservationSize = 1, typename ObservationScalarType, typename TimeType >
@@ -297,7 +334,9 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
         const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
         parametersToEstimate,
         const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
-        stateTransitionMatrixInterface )
+        stateTransitionMatrixInterface,
+        const boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > >
+        observationManagerWithBiases = boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > >( ) )
 {
     using namespace observation_models;
     using namespace observation_partials;
@@ -307,9 +346,15 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
             createObservationSimulator< ObservationSize, ObservationScalarType, TimeType >(
                 observableType, settingsPerLinkEnds, bodyMap );
 
-
-    performObservationParameterEstimationClosure(
-                observationSimulator, parametersToEstimate );
+    if( observationManagerWithBiases == NULL )
+    {
+        performObservationParameterEstimationClosure(
+                    observationSimulator, parametersToEstimate );
+    }
+    else
+    {
+        setObservationBiasesFromObservationManager( observationSimulator, observationManagerWithBiases );
+    }
 
     // Create observation partials for all link ends/parameters
     boost::shared_ptr< ObservationPartialCreator< ObservationSize, ObservationScalarType, TimeType > > observationPartialCreator =
@@ -346,6 +391,9 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param observationManagerWithBiases Existing observation manager (created with the same settings) of which the
+ *  observation bias objects are to be used (see createObservationManager). If NULL (default), the bias objects created
+ *  from the settings are linked to the estimated parameters.
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< typename ObservationScalarType, typename TimeType >
@@ -354,7 +402,9 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
         const std::map< LinkEnds, boost::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
         const simulation_setup::NamedBodyMap &bodyMap,
         const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
-        const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface )
+        const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
+        const boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > >
+        observationManagerWithBiases = boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > >( ) )
 {
     boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager;
     switch( observableType )
@@ -362,37 +412,37 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
     case one_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case n_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case one_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case two_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case one_way_differenced_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     case position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationManagerWithBiases );
         break;
     default:
         throw std::runtime_error(
@@ -192,13 +192,16 @@ public:
      * \param lightTimeCorrections Settings for a single light-time correction that is to be used for teh observation model
      * (NULL if none)
      * \param biasSettings Settings for the observation bias model that is to be used (default none: NULL)
+     * \param useBatchComputation Boolean denoting whether observations at a list of times are simulated with a single
+     * batch computation (see ObservationModel::setUseBatchComputation; default false)
      */
     ObservationSettings(
             const observation_models::ObservableType observableType,
             const boost::shared_ptr< LightTimeCorrectionSettings > lightTimeCorrections,
-            const boost::shared_ptr< ObservationBiasSettings > biasSettings = NULL ):
+            const boost::shared_ptr< ObservationBiasSettings > biasSettings = NULL,
+            const bool useBatchComputation = false ):
         observableType_( observableType ),
-        biasSettings_( biasSettings )
+        biasSettings_( biasSettings ), useBatchComputation_( useBatchComputation )
     {
         if( lightTimeCorrections != NULL )
         {
@@ -213,14 +216,17 @@ public:
      * \param lightTimeCorrectionsList List of settings for a single light-time correction that is to be used for the observation
      * model
      * \param biasSettings Settings for the observation bias model that is to be used (default none: NULL)
+     * \param useBatchComputation Boolean denoting whether observations at a list of times are simulated with a single
+     * batch computation (see ObservationModel::setUseBatchComputation; default false)
      */
     ObservationSettings(
             const observation_models::ObservableType observableType,
             const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > > lightTimeCorrectionsList =
             std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >( ),
-            const boost::shared_ptr< ObservationBiasSettings > biasSettings = NULL ):
+            const boost::shared_ptr< ObservationBiasSettings > biasSettings = NULL,
+            const bool useBatchComputation = false ):
         observableType_( observableType ),lightTimeCorrectionsList_( lightTimeCorrectionsList ),
-        biasSettings_( biasSettings ){ }
+        biasSettings_( biasSettings ), useBatchComputation_( useBatchComputation ){ }
 
     //! Destructor
     virtual ~ObservationSettings( ){ }
@@ -233,6 +239,9 @@ public:
 
     //! Settings for the observation bias model that is to be used (default none: NULL)
     boost::shared_ptr< ObservationBiasSettings > biasSettings_;
+
+    //! Boolean denoting whether observations at a list of times are simulated with a single batch computation.
+    bool useBatchComputation_;
 };
 
 //! Enum defining all possible types of proper time rate computations in one-way Doppler
@@ -1313,6 +1322,8 @@ boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType,
         observationModels[ settingIterator->first ] = ObservationModelCreator<
                 ObservationSize, ObservationScalarType, TimeType >::createObservationModel(
                     settingIterator->first, settingIterator->second, bodyMap );
+        observationModels[ settingIterator->first ]->setUseBatchComputation(
+                    settingIterator->second->useBatchComputation_ );
     }
 
     return boost::make_shared< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >(
@@ -359,6 +359,7 @@ createSphericalHarmonicsGravityAcceleration(
                       boost::bind( &Body::getPosition, bodyExertingAcceleration ),
                       boost::bind( &Body::getCurrentRotationToGlobalFrame,
                                    bodyExertingAcceleration ), useCentralBodyFixedFrame );
+            accelerationModel->setEvaluationMethod( sphericalHarmonicsGravityField->getEvaluationMethod( ) );
         }
     }
     return accelerationModel;
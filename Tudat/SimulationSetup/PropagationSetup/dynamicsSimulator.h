@@ -11,9 +11,14 @@
 #ifndef TUDAT_DYNAMICSSIMULATOR_H
 #define TUDAT_DYNAMICSSIMULATOR_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <chrono>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #include <boost/make_shared.hpp>
 #include <boost/assign/list_of.hpp>
@@ -37,6 +42,7 @@
 #include "Tudat/SimulationSetup/PropagationSetup/createEnvironmentUpdater.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
 #include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
@@ -335,6 +341,8 @@ public:
         initialPropagationTime_( integratorSettings_->initialTime_ ), initialClockTime_( initialClockTime ),
         propagationTerminationReason_( boost::make_shared< PropagationTerminationDetails >( propagation_never_run ) )
     {
+        resetNumericalSolutionMaps( );
+
         if( propagatorSettings == NULL )
         {
             throw std::runtime_error( "Error in dynamics simulator, propagator settings not defined" );
@@ -384,6 +392,22 @@ public:
             }
         }
 
+        // Set profiler in all models, if propagation is to be profiled
+        if( propagatorSettings_->getProfilePropagation( ) )
+        {
+            propagationProfiler_ = boost::make_shared< PropagationProfiler >( );
+            environmentUpdater_->setPropagationProfiler( propagationProfiler_ );
+            dynamicsStateDerivative_->setPropagationProfiler( propagationProfiler_ );
+
+            if( !dependentVariablesFunctions_.empty( ) )
+            {
+                dependentVariablesFunctions_ = boost::bind(
+                            &evaluateProfiledFunction< Eigen::VectorXd >, dependentVariablesFunctions_,
+                            propagationProfiler_, propagationProfiler_->registerEntry(
+                                dependent_variable_profiling, "dependent variable output" ) );
+            }
+        }
+
         stateDerivativeFunction_ =
                 boost::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivative,
                              dynamicsStateDerivative_, _1, _2 );
@@ -417,9 +441,14 @@ public:
 
         equationsOfMotionNumericalSolution_.clear( );
         equationsOfMotionNumericalSolutionRaw_.clear( );
+        resetNumericalSolutionMaps( );
 
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+        if( propagationProfiler_ != NULL )
+        {
+            propagationProfiler_->resetEntries( );
+        }
 
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
@@ -439,6 +468,14 @@ public:
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
                     equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
 
+        // Print profiling results, if required
+        if( propagationProfiler_ != NULL && propagatorSettings_->getPrintProfilingTable( ) )
+        {
+            std::cout << "Propagation profile (" << dynamicsStateDerivative_->getNumberOfFunctionEvaluations( )
+                      << " state derivative evaluations):" << std::endl;
+            propagationProfiler_->printTable( std::cout );
+        }
+
         if( this->setIntegratedResult_ )
         {
             processNumericalEquationsOfMotionSolution( );
@@ -447,20 +484,57 @@ public:
 
     //! Function to return the map of state history of numerically integrated bodies.
     /*!
-     * Function to return the map of state history of numerically integrated bodies.
+     * Function to return the map of state history of numerically integrated bodies. The map is created from the
+     * contiguous history (see getEquationsOfMotionNumericalSolutionHistory) when first requested after the propagation,
+     * and stored for subsequent calls.
      * \return Map of state history of numerically integrated bodies.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&
+    getEquationsOfMotionNumericalSolution( )
+    {
+        if( !isEquationsOfMotionNumericalSolutionMapSet_ )
+        {
+            equationsOfMotionNumericalSolutionMap_ = equationsOfMotionNumericalSolution_.template convertToMap<
+                    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( );
+            isEquationsOfMotionNumericalSolutionMapSet_ = true;
+        }
+        return equationsOfMotionNumericalSolutionMap_;
+    }
+
+    //! Function to return the contiguous state history of numerically integrated bodies.
+    /*!
+     * Function to return the contiguous state history of numerically integrated bodies, without copying it into a map.
+     * \return Contiguous state history of numerically integrated bodies.
+     */
+    const ContiguousStateHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionHistory( )
     {
         return equationsOfMotionNumericalSolution_;
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
     /*!
-     * Function to return the map of dependent variable history that was saved during numerical propagation.
+     * Function to return the map of dependent variable history that was saved during numerical propagation. The map is
+     * created from the contiguous history (see getDependentVariableContiguousHistory) when first requested after the
+     * propagation, and stored for subsequent calls.
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
-    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
+    const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
+    {
+        if( !isDependentVariableHistoryMapSet_ )
+        {
+            dependentVariableHistoryMap_ = dependentVariableHistory_.template convertToMap< Eigen::VectorXd >( );
+            isDependentVariableHistoryMapSet_ = true;
+        }
+        return dependentVariableHistoryMap_;
+    }
+
+    //! Function to return the contiguous dependent variable history that was saved during numerical propagation.
+    /*!
+     * Function to return the contiguous dependent variable history that was saved during numerical propagation, without
+     * copying it into a map.
+     * \return Contiguous dependent variable history that was saved during numerical propagation.
+     */
+    const ContiguousStateHistory< TimeType, double >& getDependentVariableContiguousHistory( )
     {
         return dependentVariableHistory_;
     }
@@ -468,11 +542,18 @@ public:
     //! Function to return the map of cummulative computation time history that was saved during numerical propagation.
     /*!
      * Function to return the map of cummulative computation time history that was saved during numerical propagation.
+     * The map is created from the contiguous history when first requested after the propagation, and stored for
+     * subsequent calls.
      * \return Map of cummulative computation time history that was saved during numerical propagation.
      */
-    std::map< TimeType, double > getCummulativeComputationTimeHistory( )
+    const std::map< TimeType, double >& getCummulativeComputationTimeHistory( )
     {
-        return cummulativeComputationTimeHistory_;
+        if( !isCummulativeComputationTimeHistoryMapSet_ )
+        {
+            cummulativeComputationTimeHistoryMap_ = cummulativeComputationTimeHistory_.convertToScalarMap( );
+            isCummulativeComputationTimeHistoryMapSet_ = true;
+        }
+        return cummulativeComputationTimeHistoryMap_;
     }
 
     //! Function to return the map of state history of numerically integrated bodies (base class interface).
@@ -515,8 +596,9 @@ public:
             equationsOfMotionNumericalSolution,
             const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory)
     {
-        equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
-        dependentVariableHistory_ = dependentVariableHistory;
+        equationsOfMotionNumericalSolution_.setFromMap( equationsOfMotionNumericalSolution );
+        dependentVariableHistory_.setFromMap( dependentVariableHistory );
+        resetNumericalSolutionMaps( );
         processNumericalEquationsOfMotionSolution( );
     }
 
@@ -618,6 +700,18 @@ public:
         return propagationTerminationReason_;
     }
 
+    //! Function to retrieve the profiler containing the computation times of the models in the last propagation
+    /*!
+     * Function to retrieve the profiler containing the call counts and computation times of the propagation models in
+     * the last propagation.
+     * \return Profiler containing the computation times of the propagation models (NULL if propagation is not
+     * profiled, see SingleArcPropagatorSettings::setProfilePropagation).
+     */
+    boost::shared_ptr< PropagationProfiler > getPropagationProfiler( )
+    {
+        return propagationProfiler_;
+    }
+
     //! Get whether the integration was completed successfully.
     /*!
      * @copybrief integrationCompletedSuccessfully
@@ -675,6 +769,20 @@ public:
 
 protected:
 
+    //! Function to clear the maps of the state, dependent variable and computation time histories.
+    /*!
+     *  Function to clear the maps of the state, dependent variable and computation time histories, so that they are
+     *  recreated from the contiguous histories when next requested. Called whenever the contiguous histories change.
+     */
+    void resetNumericalSolutionMaps( )
+    {
+        equationsOfMotionNumericalSolutionMap_.clear( );
+        isEquationsOfMotionNumericalSolutionMapSet_ = false;
+        dependentVariableHistoryMap_.clear( );
+        isDependentVariableHistoryMapSet_ = false;
+        cummulativeComputationTimeHistoryMap_.clear( );
+        isCummulativeComputationTimeHistoryMapSet_ = false;
+    }
 
     //! This function updates the environment with the numerical solution of the propagation.
     /*!
@@ -684,14 +792,15 @@ protected:
      */
     void processNumericalEquationsOfMotionSolution( )
     {
-        // Create and set interpolators for ephemerides
-        resetIntegratedStates( equationsOfMotionNumericalSolution_, integratedStateProcessors_ );
+        // Create and set interpolators for ephemerides (the map of the state history is retained for later retrieval)
+        resetIntegratedStates( getEquationsOfMotionNumericalSolution( ), integratedStateProcessors_ );
 
 
         // Clear numerical solution if so required.
         if( clearNumericalSolutions_ )
         {
             equationsOfMotionNumericalSolution_.clear( );
+            equationsOfMotionNumericalSolutionMap_.clear( );
         }
 
         for( simulation_setup::NamedBodyMap::const_iterator
@@ -754,22 +863,44 @@ protected:
     //! Object for retrieving ephemerides for transformation of reference frame (origins)
     boost::shared_ptr< ephemerides::ReferenceFrameManager > frameManager_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies.
     /*!
-     *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-     *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-     *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+     *  State history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Entries are stored
+     *  contiguously in order of propagation, and are concatenated vectors of integrated body states (order defined by
+     *  propagatorSettings_). Allocated memory is retained when the equations of motion are re-integrated.
+     *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+    ContiguousStateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution_;
+
+    //! State history of numerically integrated bodies, in propagator-specific form.
+    ContiguousStateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw_;
+
+    //! Dependent variable history that was saved during numerical propagation.
+    ContiguousStateHistory< TimeType, double > dependentVariableHistory_;
+
+    //! Cummulative computation time history that was saved during numerical propagation.
+    ContiguousStateHistory< TimeType, double > cummulativeComputationTimeHistory_;
+
+    //! Map of state history of numerically integrated bodies, created from equationsOfMotionNumericalSolution_ when
+    //! first requested.
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionMap_;
+
+    //! Boolean denoting whether equationsOfMotionNumericalSolutionMap_ has been created from the current state history.
+    bool isEquationsOfMotionNumericalSolutionMapSet_;
+
+    //! Map of dependent variable history, created from dependentVariableHistory_ when first requested.
+    std::map< TimeType, Eigen::VectorXd > dependentVariableHistoryMap_;
 
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw_;
+    //! Boolean denoting whether dependentVariableHistoryMap_ has been created from the current dependent variable history.
+    bool isDependentVariableHistoryMapSet_;
 
-    //! Map of dependent variable history that was saved during numerical propagation.
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+    //! Map of cummulative computation time history, created from cummulativeComputationTimeHistory_ when first requested.
+    std::map< TimeType, double > cummulativeComputationTimeHistoryMap_;
 
-    //! Map of cummulative computation time history that was saved during numerical propagation.
-    std::map< TimeType, double > cummulativeComputationTimeHistory_;
+    //! Boolean denoting whether cummulativeComputationTimeHistoryMap_ has been created from the current computation time
+    //! history.
+    bool isCummulativeComputationTimeHistoryMapSet_;
 
     //! Initial time of propagation
     double initialPropagationTime_;
@@ -780,6 +911,9 @@ protected:
     //! Event that triggered the termination of the propagation
     boost::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Profiler containing the computation times of the propagation models (NULL if propagation is not profiled).
+    boost::shared_ptr< PropagationProfiler > propagationProfiler_;
+
 };
 
 //! Function to get a vector of initial states from a vector of propagator settings
@@ -918,16 +1052,24 @@ public:
             {
                 throw std::runtime_error( "Error when creating multi-arc dynamics simulator, input is inconsistent" );
             }
-            // Create dynamics simulators
+            // Create dynamics simulators (with separate integrator settings if arcs are to be propagated concurrently)
+            const bool propagateArcsConcurrently = ( multiArcPropagatorSettings_->getNumberOfParallelThreads( ) != 1 );
+            boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > arcIntegratorSettings =
+                    integratorSettings;
             for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
             {
-                integratorSettings->initialTime_ = arcStartTimes.at( i );
+                if( propagateArcsConcurrently )
+                {
+                    arcIntegratorSettings = integratorSettings->clone( );
+                }
+                arcIntegratorSettings->initialTime_ = arcStartTimes.at( i );
 
                 singleArcDynamicsSimulators_.push_back(
                             boost::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
-                                bodyMap, integratorSettings, singleArcSettings.at( i ), false, false, true ) );
+                                getArcBodyMap( i ), arcIntegratorSettings, singleArcSettings.at( i ), false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            setArcEnvironments( singleArcSettings.at( 0 ) );
 
             equationsOfMotionNumericalSolution_.resize( arcStartTimes.size( ) );
             dependentVariableHistory_.resize( arcStartTimes.size( ) );
@@ -983,14 +1125,18 @@ public:
 
             arcStartTimes_.resize( singleArcSettings.size( ) );
 
-            // Create dynamics simulators
+            // Create dynamics simulators (with separate integrator settings if arcs are to be propagated concurrently)
+            const bool propagateArcsConcurrently = ( multiArcPropagatorSettings_->getNumberOfParallelThreads( ) != 1 );
             for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
             {
                 singleArcDynamicsSimulators_.push_back(
                             boost::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
-                                bodyMap, integratorSettings.at( i ), singleArcSettings.at( i ), false, false, true ) );
+                                getArcBodyMap( i ),
+                                ( propagateArcsConcurrently ? integratorSettings.at( i )->clone( ) : integratorSettings.at( i ) ),
+                                singleArcSettings.at( i ), false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            setArcEnvironments( singleArcSettings.at( 0 ) );
 
             equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
             dependentVariableHistory_.resize( singleArcSettings.size( ) );
@@ -1067,40 +1213,71 @@ public:
         }
 
 
-        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentArcInitialState;
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
-        bool updateInitialStates = false;
+        arcInitialStateList.resize( singleArcDynamicsSimulators_.size( ) );
 
-        // Propagate dynamics for each arc
+        // Split arcs into sequences, where each arc (except the first) in a sequence takes its initial state from the
+        // previous arc. If initial state is NaN, this signals that the initial state is to be taken from previous arc.
+        std::vector< std::vector< unsigned int > > arcSequences;
+        bool updateInitialStates = false;
         for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
         {
-            // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from previous
-            // arc
             if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
             {
-                currentArcInitialState = initialStatesList.at( i );
+                arcSequences.push_back( std::vector< unsigned int >( ) );
             }
             else
             {
-                currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                            equationsOfMotionNumericalSolution_.at( i - 1 ),
-                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
-
-                // If arc initial state is taken from previous arc, this indicates that the initial states in propagator settings
-                // need to be updated.
+                // If arc initial state is taken from previous arc, this indicates that the initial states in propagator
+                // settings need to be updated.
                 updateInitialStates = true;
             }
-            arcInitialStateList.push_back( currentArcInitialState );
-
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( );
-            dependentVariableHistory_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( );
-            cummulativeComputationTimeHistory_[ i ] =
-                    singleArcDynamicsSimulators_.at( i )->getCummulativeComputationTimeHistory( );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
+            arcSequences.back( ).push_back( i );
+        }
+
+        // Propagate dynamics for each arc, concurrently if requested.
+        unsigned int numberOfThreads = multiArcPropagatorSettings_->getNumberOfParallelThreads( );
+        if( numberOfThreads == 0 )
+        {
+            numberOfThreads = std::max( std::thread::hardware_concurrency( ), 1u );
+        }
+        numberOfThreads = std::min( numberOfThreads, static_cast< unsigned int >( arcSequences.size( ) ) );
+
+        if( numberOfThreads <= 1 )
+        {
+            for( unsigned int i = 0; i < arcSequences.size( ); i++ )
+            {
+                propagateArcSequence( arcSequences.at( i ), initialStatesList, arcInitialStateList );
+            }
+        }
+        else
+        {
+            std::atomic< unsigned int > nextArcSequenceIndex( 0 );
+            std::vector< std::mutex > environmentMutexes( numberOfArcEnvironments_ );
+            std::vector< std::exception_ptr > propagationErrors( numberOfThreads );
+
+            std::vector< std::thread > propagationThreads;
+            for( unsigned int i = 0; i < numberOfThreads; i++ )
+            {
+                propagationThreads.push_back(
+                            std::thread( &MultiArcDynamicsSimulator< StateScalarType, TimeType >::propagateArcSequences,
+                                         this, std::cref( arcSequences ), std::ref( nextArcSequenceIndex ),
+                                         std::ref( environmentMutexes ), std::cref( initialStatesList ),
+                                         std::ref( arcInitialStateList ), std::ref( propagationErrors.at( i ) ) ) );
+            }
+            for( unsigned int i = 0; i < numberOfThreads; i++ )
+            {
+                propagationThreads.at( i ).join( );
+            }
+
+            // Re-throw first error that occured during propagation (if any).
+            for( unsigned int i = 0; i < numberOfThreads; i++ )
+            {
+                if( propagationErrors.at( i ) )
+                {
+                    std::rethrow_exception( propagationErrors.at( i ) );
+                }
+            }
         }
 
 
@@ -1267,6 +1444,167 @@ public:
 
 protected:
 
+    //! Function to retrieve the body map that is to be used for a given arc
+    /*!
+     * Function to retrieve the body map that is to be used for a given arc, as defined by the multi-arc propagator settings
+     * (or the body map of this object if no arc-specific body maps are defined).
+     * \param arcIndex Index of arc for which body map is to be retrieved
+     * \return Body map that is to be used for given arc
+     */
+    simulation_setup::NamedBodyMap getArcBodyMap( const unsigned int arcIndex )
+    {
+        if( multiArcPropagatorSettings_->getArcBodyMaps( ).size( ) == 0 )
+        {
+            return bodyMap_;
+        }
+        else
+        {
+            return multiArcPropagatorSettings_->getArcBodyMaps( ).at( arcIndex );
+        }
+    }
+
+    //! Function to determine which arcs share a body map, and to create the objects that process the integrated results.
+    /*!
+     * Function to determine which arcs share a body map (and can therefore not be propagated concurrently), and to create
+     * the objects that set the integrated results in the body map of this object.
+     * \param firstArcSettings Propagator settings of the first arc.
+     */
+    void setArcEnvironments( const boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > firstArcSettings )
+    {
+        std::vector< simulation_setup::NamedBodyMap > arcBodyMaps = multiArcPropagatorSettings_->getArcBodyMaps( );
+
+        arcEnvironmentIndices_.clear( );
+        std::vector< simulation_setup::NamedBodyMap > uniqueBodyMaps;
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        {
+            if( arcBodyMaps.size( ) == 0 )
+            {
+                arcEnvironmentIndices_.push_back( 0 );
+            }
+            else
+            {
+                unsigned int environmentIndex = std::find(
+                            uniqueBodyMaps.begin( ), uniqueBodyMaps.end( ), arcBodyMaps.at( i ) ) - uniqueBodyMaps.begin( );
+                if( environmentIndex == uniqueBodyMaps.size( ) )
+                {
+                    uniqueBodyMaps.push_back( arcBodyMaps.at( i ) );
+                }
+                arcEnvironmentIndices_.push_back( environmentIndex );
+            }
+        }
+        numberOfArcEnvironments_ = std::max( static_cast< unsigned int >( uniqueBodyMaps.size( ) ), 1u );
+
+        // If the first arc does not use the body map of this object, create separate processors for the integrated results.
+        if( ( arcBodyMaps.size( ) == 0 ) || ( arcBodyMaps.at( 0 ) == bodyMap_ ) )
+        {
+            integratedStateProcessors_ = singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( );
+        }
+        else
+        {
+            integratedStateProcessors_ = createIntegratedStateProcessors< TimeType, StateScalarType >(
+                        firstArcSettings, bodyMap_, createFrameManager( bodyMap_ ) );
+        }
+    }
+
+    //! Function to propagate a single arc, and retrieve its results.
+    /*!
+     * Function to propagate a single arc, and retrieve its results.
+     * \param arcIndex Index of arc that is to be propagated
+     * \param arcInitialState Initial state of the arc
+     */
+    void propagateArc( const unsigned int arcIndex,
+                       const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& arcInitialState )
+    {
+        singleArcDynamicsSimulators_.at( arcIndex )->integrateEquationsOfMotion( arcInitialState );
+        equationsOfMotionNumericalSolution_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getEquationsOfMotionNumericalSolution( );
+        dependentVariableHistory_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getDependentVariableHistory( );
+        cummulativeComputationTimeHistory_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getCummulativeComputationTimeHistory( );
+        propagationTerminationReasons_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getPropagationTerminationReason( );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution_[ arcIndex ].begin( )->first;
+    }
+
+    //! Function to propagate a sequence of arcs, where each arc takes its initial state from the previous arc.
+    /*!
+     * Function to propagate a sequence of arcs, where each arc (except the first) takes its initial state from the
+     * previous arc.
+     * \param arcSequence Indices of arcs in the sequence
+     * \param initialStatesList Initial states provided for all arcs
+     * \param arcInitialStateList Initial states used for all arcs (modified by this function for arcs in sequence)
+     * \param environmentMutexes Mutexes for each separate body map used by the arcs (none if arcs are propagated
+     * sequentially)
+     */
+    void propagateArcSequence(
+            const std::vector< unsigned int >& arcSequence,
+            const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatesList,
+            std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& arcInitialStateList,
+            std::vector< std::mutex >* environmentMutexes = NULL )
+    {
+        for( unsigned int i = 0; i < arcSequence.size( ); i++ )
+        {
+            const unsigned int arcIndex = arcSequence.at( i );
+            if( i == 0 )
+            {
+                arcInitialStateList[ arcIndex ] = initialStatesList.at( arcIndex );
+            }
+            else
+            {
+                arcInitialStateList[ arcIndex ] = getArcInitialStateFromPreviousArcResult(
+                            equationsOfMotionNumericalSolution_.at( arcIndex - 1 ),
+                            singleArcDynamicsSimulators_.at( arcIndex )->getInitialPropagationTime( ) );
+            }
+
+            if( environmentMutexes == NULL )
+            {
+                propagateArc( arcIndex, arcInitialStateList[ arcIndex ] );
+            }
+            else
+            {
+                std::lock_guard< std::mutex > environmentLock(
+                            environmentMutexes->at( arcEnvironmentIndices_.at( arcIndex ) ) );
+                propagateArc( arcIndex, arcInitialStateList[ arcIndex ] );
+            }
+        }
+    }
+
+    //! Function to propagate arc sequences on a single thread, until no sequences remain
+    /*!
+     * Function to propagate arc sequences on a single thread, until no sequences remain. Used as thread function for
+     * concurrent propagation of arcs.
+     * \param arcSequences List of all arc sequences that are to be propagated
+     * \param nextArcSequenceIndex Index of next arc sequence that is to be propagated (shared between threads)
+     * \param environmentMutexes Mutexes for each separate body map used by the arcs
+     * \param initialStatesList Initial states provided for all arcs
+     * \param arcInitialStateList Initial states used for all arcs
+     * \param propagationError Error that was caught during propagation on this thread (returned by reference)
+     */
+    void propagateArcSequences(
+            const std::vector< std::vector< unsigned int > >& arcSequences,
+            std::atomic< unsigned int >& nextArcSequenceIndex,
+            std::vector< std::mutex >& environmentMutexes,
+            const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatesList,
+            std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& arcInitialStateList,
+            std::exception_ptr& propagationError )
+    {
+        try
+        {
+            unsigned int currentArcSequenceIndex = nextArcSequenceIndex++;
+            while( currentArcSequenceIndex < arcSequences.size( ) )
+            {
+                propagateArcSequence( arcSequences.at( currentArcSequenceIndex ), initialStatesList,
+                                      arcInitialStateList, &environmentMutexes );
+                currentArcSequenceIndex = nextArcSequenceIndex++;
+            }
+        }
+        catch( ... )
+        {
+            propagationError = std::current_exception( );
+        }
+    }
+
     //! This function updates the environment with the numerical solution of the propagation.
     /*!
      *  This function updates the environment with the numerical solution of the propagation. It sets
@@ -1276,8 +1614,7 @@ protected:
     void processNumericalEquationsOfMotionSolution( )
     {
         resetIntegratedMultiArcStatesWithEqualArcDynamics(
-                    equationsOfMotionNumericalSolution_,
-                    singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
+                    equationsOfMotionNumericalSolution_, integratedStateProcessors_, arcStartTimes_ );
 
         if( clearNumericalSolutions_ )
         {
@@ -1313,6 +1650,15 @@ protected:
     //! Propagator settings used by this objec
     boost::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > multiArcPropagatorSettings_;
 
+    //! Index of body map used by each arc (arcs with equal index are never propagated concurrently)
+    std::vector< unsigned int > arcEnvironmentIndices_;
+
+    //! Number of separate body maps used by the arcs
+    unsigned int numberOfArcEnvironments_;
+
+    //! Objects used to set the integrated results in the body map of this object
+    std::map< IntegratedStateType, std::vector< boost::shared_ptr<
+    IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
 
 };
 
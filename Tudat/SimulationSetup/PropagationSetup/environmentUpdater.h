@@ -25,6 +25,7 @@
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 #include "Tudat/Astrodynamics/Propagators/environmentUpdateTypes.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
 
 namespace tudat
 {
@@ -119,10 +120,24 @@ public:
         // determined by setUpdateFunctions
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
+            ScopedProfilingTimer updateTimer( propagationProfiler_.get( ), updateFunctionProfilingIndices_[ i ] );
             updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
         }
     }
 
+    //! Function to set the profiler to which the computation times of the update functions are to be added.
+    /*!
+     * Function to set the profiler to which the computation times of the update functions are to be added, aggregated
+     * per type of environment model and body.
+     * \param propagationProfiler Profiler to which computation times are to be added (NULL if no profiling is to be
+     * performed).
+     */
+    void setPropagationProfiler( const boost::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+        setUpdateFunctionProfilingIndices( );
+    }
+
 private:
 
     //! Function to set numerically integrated states in environment.
@@ -658,6 +673,21 @@ private:
 
         // Set update order of functions.
         setUpdateFunctionOrder( );
+        setUpdateFunctionProfilingIndices( );
+    }
+
+    //! Function to set the profiling entry for each update function, in the order of updateFunctionVector_.
+    void setUpdateFunctionProfilingIndices( )
+    {
+        updateFunctionProfilingIndices_.clear( );
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            updateFunctionProfilingIndices_.push_back(
+                        ( propagationProfiler_ == NULL ) ? 0 : propagationProfiler_->registerEntry(
+                            environment_update_profiling,
+                            getEnvironmentModelUpdateName( updateFunctionVector_.at( i ).template get< 0 >( ) ),
+                            updateFunctionVector_.at( i ).template get< 1 >( ) ) );
+        }
     }
 
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -683,6 +713,12 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, boost::function< void( ) > > > resetFunctionVector_;
 
+    //! Profiler to which the computation times of the update functions are added (NULL if not profiled).
+    boost::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Index of profiling entry for each entry of updateFunctionVector_ (all zero if not profiled).
+    std::vector< unsigned int > updateFunctionProfilingIndices_;
+
 
 
 
@@ -220,6 +220,42 @@ public:
         return printInterval_;
     }
 
+    //! Function to set whether the computation time of the propagation models is to be profiled.
+    /*!
+     * Function to set whether the computation time and number of calls of the propagation models (environment updates,
+     * acceleration models, state derivative partials, dependent variables) are to be profiled. Profiling is disabled
+     * by default, in which case it adds no measurable overhead to the propagation.
+     * \param profilePropagation Boolean denoting whether the propagation is to be profiled.
+     * \param printProfilingTable Boolean denoting whether the profiling results are to be printed to console as a
+     * table at the end of each propagation.
+     */
+    void setProfilePropagation( const bool profilePropagation, const bool printProfilingTable = true )
+    {
+        profilePropagation_ = profilePropagation;
+        printProfilingTable_ = printProfilingTable;
+    }
+
+    //! Function to retrieve whether the computation time of the propagation models is to be profiled.
+    /*!
+     * Function to retrieve whether the computation time of the propagation models is to be profiled.
+     * \return Boolean denoting whether the propagation is to be profiled (default false).
+     */
+    bool getProfilePropagation( )
+    {
+        return profilePropagation_;
+    }
+
+    //! Function to retrieve whether the profiling results are to be printed at the end of each propagation.
+    /*!
+     * Function to retrieve whether the profiling results are to be printed at the end of each propagation.
+     * \return Boolean denoting whether the profiling results are to be printed at the end of each propagation (only
+     * used if propagation is profiled).
+     */
+    bool getPrintProfilingTable( )
+    {
+        return printProfilingTable_;
+    }
+
     //! Function to modify settings for creating the object that checks whether the propagation is finished.
     /*!
      * Function to modify settings for creating the object that checks whether the propagation is finished.
@@ -249,6 +285,12 @@ protected:
     //! current state and time are to be printed to console (default never).
     double printInterval_;
 
+    //! Boolean denoting whether the computation time of the propagation models is to be profiled.
+    bool profilePropagation_ = false;
+
+    //! Boolean denoting whether the profiling results are to be printed at the end of each propagation.
+    bool printProfilingTable_ = true;
+
 };
 
 
@@ -323,7 +365,8 @@ public:
     MultiArcPropagatorSettings(
             const std::vector< boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > >& singleArcSettings,
             const bool transferInitialStateInformationPerArc = 0 ):
-        PropagatorSettings< StateScalarType >( getConcatenatedInitialStates( singleArcSettings ), true )
+        PropagatorSettings< StateScalarType >( getConcatenatedInitialStates( singleArcSettings ), true ),
+        numberOfParallelThreads_( 1 )
     {
         singleArcSettings_ = singleArcSettings;
         for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
@@ -445,6 +488,59 @@ public:
 
     }
 
+    //! Function to set the arcs to be propagated concurrently.
+    /*!
+     * Function to set the arcs to be propagated concurrently, on a given number of threads. Arcs for which the initial
+     * state is taken from the previous arc are always propagated after (and on the same thread as) the previous arc.
+     * Arcs that use the same body map are never propagated concurrently, since the bodies contain the current state of
+     * the environment. To obtain a speed-up, each arc (or group of arcs) must therefore be defined using its own body
+     * map, with the models in the single-arc settings (e.g. acceleration models) created from that same body map. All
+     * environment models used during the propagation of an arc (e.g. ephemerides, rotation models) must then be
+     * independent of those used by other arcs. Note that this is not the case for models that call Spice directly,
+     * which is not thread-safe (tabulated ephemerides should be used instead). This function must be called before the
+     * dynamics simulator is created.
+     * \param numberOfThreads Number of threads on which arcs are propagated (1 for sequential propagation, 0 to use the
+     * number of concurrent threads supported by the hardware).
+     * \param arcBodyMaps Body map used for each arc (or empty if all arcs use the body map provided to the dynamics
+     * simulator). The integrated results are set in the body map provided to the dynamics simulator.
+     */
+    void setParallelArcPropagation(
+            const unsigned int numberOfThreads,
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps =
+            std::vector< simulation_setup::NamedBodyMap >( ) )
+    {
+        if( ( arcBodyMaps.size( ) != 0 ) && ( arcBodyMaps.size( ) != singleArcSettings_.size( ) ) )
+        {
+            throw std::runtime_error( "Error when setting parallel multi-arc propagation, number of body maps (" +
+                                      std::to_string( arcBodyMaps.size( ) ) + ") is inconsistent with number of arcs (" +
+                                      std::to_string( singleArcSettings_.size( ) ) + ")" );
+        }
+        numberOfParallelThreads_ = numberOfThreads;
+        arcBodyMaps_ = arcBodyMaps;
+    }
+
+    //! Function to retrieve the number of threads on which arcs are propagated
+    /*!
+     * Function to retrieve the number of threads on which arcs are propagated (1 for sequential propagation, 0 to use the
+     * number of concurrent threads supported by the hardware).
+     * \return Number of threads on which arcs are propagated
+     */
+    unsigned int getNumberOfParallelThreads( )
+    {
+        return numberOfParallelThreads_;
+    }
+
+    //! Function to retrieve the body map used for each arc
+    /*!
+     * Function to retrieve the body map used for each arc (empty if all arcs use the body map provided to the dynamics
+     * simulator).
+     * \return Body map used for each arc
+     */
+    std::vector< simulation_setup::NamedBodyMap > getArcBodyMaps( )
+    {
+        return arcBodyMaps_;
+    }
+
 protected:
 
     //! List of propagator settings for each arc in propagation.
@@ -453,6 +549,12 @@ protected:
     //! List of initial states for each arc in propagation.
     std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > initialStateList_;
 
+    //! Number of threads on which arcs are propagated (1 for sequential propagation, 0 for hardware concurrency).
+    unsigned int numberOfParallelThreads_;
+
+    //! Body map used for each arc (empty if all arcs use the body map provided to the dynamics simulator).
+    std::vector< simulation_setup::NamedBodyMap > arcBodyMaps_;
+
 };
 
 //! Class for defining settings for propagating translational dynamics.
@@ -16,6 +16,185 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to add an event to the log.
+void PropagationEventLog::addEvent( const unsigned int eventIndex, const double eventTime, const int eventDirection,
+                                    const Eigen::VectorXd& eventState, const bool isEventTimeConverged )
+{
+    if( eventTimes_.size( ) == 0 )
+    {
+        stateSize_ = eventState.rows( );
+    }
+    else if( static_cast< unsigned int >( eventState.rows( ) ) != stateSize_ )
+    {
+        throw std::runtime_error( "Error when adding event to log, state size is inconsistent" );
+    }
+
+    if( !isEventTimeConverged )
+    {
+        unconvergedEventNumbers_.push_back( eventTimes_.size( ) );
+    }
+    eventIndices_.push_back( eventIndex );
+    eventTimes_.push_back( eventTime );
+    eventDirections_.push_back( eventDirection );
+    eventStates_.insert( eventStates_.end( ), eventState.data( ), eventState.data( ) + stateSize_ );
+}
+
+//! Function to remove all events from the log.
+void PropagationEventLog::clear( )
+{
+    eventIndices_.clear( );
+    eventTimes_.clear( );
+    eventDirections_.clear( );
+    eventStates_.clear( );
+    unconvergedEventNumbers_.clear( );
+    stateSize_ = 0;
+}
+
+//! Function to retrieve the state of a single logged event.
+Eigen::VectorXd PropagationEventLog::getEventState( const unsigned int eventNumber )
+{
+    if( eventNumber >= eventTimes_.size( ) )
+    {
+        throw std::runtime_error( "Error when retrieving event state, requested event " + std::to_string( eventNumber ) +
+                                  " not in log of size " + std::to_string( eventTimes_.size( ) ) );
+    }
+    return Eigen::Map< const Eigen::VectorXd >( eventStates_.data( ) + eventNumber * stateSize_, stateSize_ );
+}
+
+//! Function to retrieve the times of all logged events of a single type
+std::vector< double > PropagationEventLog::getEventTimesOfType( const unsigned int eventIndex )
+{
+    std::vector< double > eventTimesOfType;
+    for( unsigned int i = 0; i < eventTimes_.size( ); i++ )
+    {
+        if( eventIndices_.at( i ) == eventIndex )
+        {
+            eventTimesOfType.push_back( eventTimes_.at( i ) );
+        }
+    }
+    return eventTimesOfType;
+}
+
+//! Constructor
+PropagationEventDetector::PropagationEventDetector(
+        const std::vector< boost::function< double( ) > >& switchingFunctions,
+        const std::vector< PropagationEventDirection >& eventDirections,
+        const std::vector< std::string >& eventNames,
+        const std::vector< boost::shared_ptr< root_finders::RootFinderSettings > >& rootFinderSettings ):
+    switchingFunctions_( switchingFunctions ), eventDirections_( eventDirections ), eventNames_( eventNames ),
+    rootFinderSettings_( rootFinderSettings ), eventLog_( boost::make_shared< PropagationEventLog >( ) )
+{
+    if( ( eventDirections_.size( ) != switchingFunctions_.size( ) ) ||
+            ( eventNames_.size( ) != switchingFunctions_.size( ) ) ||
+            ( rootFinderSettings_.size( ) != switchingFunctions_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when creating propagation event detector, input sizes are inconsistent" );
+    }
+
+    lastSwitchingFunctionValues_.resize( switchingFunctions_.size( ) );
+    lastEventDirections_.resize( switchingFunctions_.size( ) );
+}
+
+//! Function to evaluate all switching functions (using the current environment) at the start of the propagation.
+void PropagationEventDetector::resetSwitchingFunctionValues( )
+{
+    for( unsigned int i = 0; i < switchingFunctions_.size( ); i++ )
+    {
+        lastSwitchingFunctionValues_[ i ] = switchingFunctions_[ i ]( );
+        lastEventDirections_[ i ] = 0;
+    }
+}
+
+//! Function to evaluate all switching functions at the end of an integration step, and find bracketed sign changes
+std::vector< unsigned int > PropagationEventDetector::updateSwitchingFunctionValues( )
+{
+    std::vector< unsigned int > bracketedEventIndices;
+    for( unsigned int i = 0; i < switchingFunctions_.size( ); i++ )
+    {
+        double currentValue = switchingFunctions_[ i ]( );
+
+        // Check for sign change (a zero value at the end of the step is counted as a sign change in this step, a zero
+        // value at the start of the step is not)
+        int eventDirection = 0;
+        if( lastSwitchingFunctionValues_[ i ] < 0.0 && currentValue >= 0.0 )
+        {
+            eventDirection = 1;
+        }
+        else if( lastSwitchingFunctionValues_[ i ] > 0.0 && currentValue <= 0.0 )
+        {
+            eventDirection = -1;
+        }
+
+        // Check if direction of sign change is to be detected
+        if( ( eventDirection == 1 && eventDirections_[ i ] == decreasing_event_direction ) ||
+                ( eventDirection == -1 && eventDirections_[ i ] == increasing_event_direction ) )
+        {
+            eventDirection = 0;
+        }
+
+        if( eventDirection != 0 )
+        {
+            bracketedEventIndices.push_back( i );
+        }
+        lastEventDirections_[ i ] = eventDirection;
+        lastSwitchingFunctionValues_[ i ] = currentValue;
+    }
+    return bracketedEventIndices;
+}
+
+//! Function to compute the switching function of a propagation event defined by a dependent variable
+double computeDependentVariableSwitchingFunction(
+        const boost::function< double( ) > dependentVariableFunction,
+        const double thresholdValue )
+{
+    return dependentVariableFunction( ) - thresholdValue;
+}
+
+//! Function to create an object to detect propagation events from associated settings
+boost::shared_ptr< PropagationEventDetector > createPropagationEventDetector(
+        const std::vector< boost::shared_ptr< PropagationEventSettings > >& eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap )
+{
+    std::vector< boost::function< double( ) > > switchingFunctions;
+    std::vector< PropagationEventDirection > eventDirections;
+    std::vector< std::string > eventNames;
+    std::vector< boost::shared_ptr< root_finders::RootFinderSettings > > rootFinderSettings;
+
+    for( unsigned int i = 0; i < eventSettings.size( ); i++ )
+    {
+        // Get switching function
+        if( eventSettings.at( i )->dependentVariableSettings_ != NULL )
+        {
+            if( getDependentVariableSaveSize( eventSettings.at( i )->dependentVariableSettings_ ) != 1 )
+            {
+                throw std::runtime_error( "Error, cannot make propagation event " + eventSettings.at( i )->eventName_ +
+                                          " from vector dependent variable" );
+            }
+            switchingFunctions.push_back(
+                        boost::bind( &computeDependentVariableSwitchingFunction,
+                                     getDoubleDependentVariableFunction(
+                                         eventSettings.at( i )->dependentVariableSettings_, bodyMap ),
+                                     eventSettings.at( i )->thresholdValue_ ) );
+        }
+        else if( !eventSettings.at( i )->customSwitchingFunction_.empty( ) )
+        {
+            switchingFunctions.push_back( eventSettings.at( i )->customSwitchingFunction_ );
+        }
+        else
+        {
+            throw std::runtime_error( "Error, no switching function defined for propagation event " +
+                                      eventSettings.at( i )->eventName_ );
+        }
+
+        eventDirections.push_back( eventSettings.at( i )->eventDirection_ );
+        eventNames.push_back( eventSettings.at( i )->eventName_ );
+        rootFinderSettings.push_back( eventSettings.at( i )->rootFinderSettings_ );
+    }
+
+    return boost::make_shared< PropagationEventDetector >(
+                switchingFunctions, eventDirections, eventNames, rootFinderSettings );
+}
+
 //! Function to check whether the propagation is to be be stopped
 bool FixedTimePropagationTerminationCondition::checkStopCondition( const double time, const double cpuTime )
 {
@@ -162,7 +341,8 @@ boost::shared_ptr< PropagationTerminationCondition > createPropagationTerminatio
                     dependentVariableFunction, dependentVariableTerminationSettings->limitValue_,
                     dependentVariableTerminationSettings->useAsLowerLimit_,
                     dependentVariableTerminationSettings->terminateExactlyOnFinalCondition_,
-                    dependentVariableTerminationSettings->terminationRootFinderSettings_ );
+                    dependentVariableTerminationSettings->terminationRootFinderSettings_,
+                    dependentVariableTerminationSettings->useDenseOutputToFindFinalCondition_ );
         break;
     }
     case hybrid_stopping_condition:
@@ -174,6 +354,11 @@ boost::shared_ptr< PropagationTerminationCondition > createPropagationTerminatio
         std::vector< boost::shared_ptr< PropagationTerminationCondition > > propagationTerminationConditionList;
         for( unsigned int i = 0; i < hybridTerminationSettings->terminationSettings_.size( ); i++ )
         {
+            if( hybridTerminationSettings->terminationSettings_.at( i )->eventSettings_.size( ) > 0 )
+            {
+                throw std::runtime_error( "Error, propagation events must be defined in top-level termination settings, "
+                                          "not in constituents of hybrid termination settings" );
+            }
             propagationTerminationConditionList.push_back(
                         createPropagationTerminationConditions(
                             hybridTerminationSettings->terminationSettings_.at( i ),
@@ -190,6 +375,14 @@ boost::shared_ptr< PropagationTerminationCondition > createPropagationTerminatio
         throw std::runtime_error( errorMessage );
         break;
     }
+
+    // Create event detector, if any events are to be detected
+    if( terminationSettings->eventSettings_.size( ) > 0 )
+    {
+        propagationTerminationCondition->setEventDetector(
+                    createPropagationEventDetector( terminationSettings->eventSettings_, bodyMap ) );
+    }
+
     return propagationTerminationCondition;
 
 } // namespace propagators
@@ -11,8 +11,13 @@
 #ifndef TUDAT_PROPAGATIONTERMINATIONCONDITIONS_H
 #define TUDAT_PROPAGATIONTERMINATIONCONDITIONS_H
 
+#include <string>
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 
+#include <Eigen/Core>
+
 #include "Tudat/SimulationSetup/PropagationSetup/propagationOutput.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 
@@ -32,6 +37,255 @@ enum PropagationTerminationReason
     nan_or_inf_detected_in_state
 };
 
+//! Class for storing the events detected during a propagation
+/*!
+ *  Class for storing the events detected during a propagation, in order of detection (i.e. chronologically for a
+ *  single propagation). For each event, the index of the event type (in the list of events of the
+ *  PropagationEventDetector), time, direction of sign change of the switching function, and state are stored. The
+ *  states of all events are stored in a single contiguous vector.
+ */
+class PropagationEventLog
+{
+public:
+
+    //! Constructor
+    PropagationEventLog( ): stateSize_( 0 ){ }
+
+    //! Function to add an event to the log.
+    /*!
+     * Function to add an event to the log.
+     * \param eventIndex Index of event type (in the list of events of the PropagationEventDetector)
+     * \param eventTime Time at which the event occurred
+     * \param eventDirection Direction of the sign change of the switching function (1 for increasing, -1 for decreasing)
+     * \param eventState State at the time of the event (all entries, in column-major order for matrix states)
+     * \param isEventTimeConverged Boolean denoting whether the root finder converged on the event time (if false, the
+     * event is logged at the end of the integration step in which it occurred)
+     */
+    void addEvent( const unsigned int eventIndex, const double eventTime, const int eventDirection,
+                   const Eigen::VectorXd& eventState, const bool isEventTimeConverged = true );
+
+    //! Function to remove all events from the log.
+    void clear( );
+
+    //! Function to retrieve the number of logged events.
+    /*!
+     * Function to retrieve the number of logged events.
+     * \return Number of logged events.
+     */
+    unsigned int getNumberOfEvents( )
+    {
+        return eventTimes_.size( );
+    }
+
+    //! Function to retrieve the indices of the event types of the logged events.
+    /*!
+     * Function to retrieve the indices of the event types of the logged events.
+     * \return Indices of the event types of the logged events.
+     */
+    const std::vector< unsigned int >& getEventIndices( )
+    {
+        return eventIndices_;
+    }
+
+    //! Function to retrieve the times of the logged events.
+    /*!
+     * Function to retrieve the times of the logged events.
+     * \return Times of the logged events.
+     */
+    const std::vector< double >& getEventTimes( )
+    {
+        return eventTimes_;
+    }
+
+    //! Function to retrieve the directions of the sign change of the switching functions of the logged events.
+    /*!
+     * Function to retrieve the directions of the sign change of the switching functions of the logged events.
+     * \return Directions of the sign change of the switching functions of the logged events (1 for increasing, -1 for
+     * decreasing).
+     */
+    const std::vector< int >& getEventDirections( )
+    {
+        return eventDirections_;
+    }
+
+    //! Function to retrieve the state of a single logged event.
+    /*!
+     * Function to retrieve the state of a single logged event.
+     * \param eventNumber Number of the event in the log
+     * \return State of the logged event.
+     */
+    Eigen::VectorXd getEventState( const unsigned int eventNumber );
+
+    //! Function to retrieve the times of all logged events of a single type
+    /*!
+     * Function to retrieve the times of all logged events of a single type
+     * \param eventIndex Index of event type (in the list of events of the PropagationEventDetector)
+     * \return Times of all logged events of the requested type.
+     */
+    std::vector< double > getEventTimesOfType( const unsigned int eventIndex );
+
+    //! Function to retrieve the numbers (in the log) of the events for which the root finder did not converge.
+    /*!
+     * Function to retrieve the numbers (in the log) of the events for which the root finder did not converge, which
+     * are logged at the end of the integration step in which they occurred.
+     * \return Numbers (in the log) of the events for which the root finder did not converge.
+     */
+    const std::vector< unsigned int >& getUnconvergedEventNumbers( )
+    {
+        return unconvergedEventNumbers_;
+    }
+
+private:
+
+    //! Indices of the event types of the logged events.
+    std::vector< unsigned int > eventIndices_;
+
+    //! Times of the logged events.
+    std::vector< double > eventTimes_;
+
+    //! Directions of the sign change of the switching functions of the logged events.
+    std::vector< int > eventDirections_;
+
+    //! States of the logged events, concatenated in a single vector
+    std::vector< double > eventStates_;
+
+    //! Numbers (in the log) of the events for which the root finder did not converge.
+    std::vector< unsigned int > unconvergedEventNumbers_;
+
+    //! Size of a single state in the log.
+    unsigned int stateSize_;
+};
+
+//! Class for detecting events, defined by sign changes of switching functions, during a propagation.
+/*!
+ *  Class for detecting events, defined by sign changes of switching functions, during a propagation. The values of the
+ *  switching functions at the end of each integration step are compared to those at the end of the previous step, to
+ *  bracket the sign changes. The root finding on the bracketed interval (done in integrateEquationsFromIntegrator) uses
+ *  the functions of this class to evaluate the switching functions, after which the events are added to the log.
+ *  Note that the switching functions require the environment to be updated to the relevant state.
+ */
+class PropagationEventDetector
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param switchingFunctions List of switching functions, an event occurs when one of these changes sign
+     * \param eventDirections List of directions of the sign changes that are detected (per switching function)
+     * \param eventNames List of names of the events (per switching function)
+     * \param rootFinderSettings Settings to create root finder used to converge on the event time (per switching
+     * function)
+     */
+    PropagationEventDetector(
+            const std::vector< boost::function< double( ) > >& switchingFunctions,
+            const std::vector< PropagationEventDirection >& eventDirections,
+            const std::vector< std::string >& eventNames,
+            const std::vector< boost::shared_ptr< root_finders::RootFinderSettings > >& rootFinderSettings );
+
+    //! Destructor
+    ~PropagationEventDetector( ){ }
+
+    //! Function to retrieve the number of event types that are detected.
+    /*!
+     * Function to retrieve the number of event types that are detected.
+     * \return Number of event types that are detected.
+     */
+    unsigned int getNumberOfEventTypes( )
+    {
+        return switchingFunctions_.size( );
+    }
+
+    //! Function to evaluate a single switching function, using the current environment
+    /*!
+     * Function to evaluate a single switching function, using the current environment
+     * \param eventIndex Index of event type
+     * \return Current value of the switching function
+     */
+    double computeSwitchingFunction( const unsigned int eventIndex )
+    {
+        return switchingFunctions_.at( eventIndex )( );
+    }
+
+    //! Function to evaluate all switching functions (using the current environment) at the start of the propagation.
+    void resetSwitchingFunctionValues( );
+
+    //! Function to evaluate all switching functions at the end of an integration step, and find bracketed sign changes
+    /*!
+     * Function to evaluate all switching functions (using the current environment) at the end of an integration
+     * step, and find the switching functions that changed sign (in the requested direction) since the end of the
+     * previous step.
+     * \return Indices of event types for which a sign change is bracketed by the last integration step.
+     */
+    std::vector< unsigned int > updateSwitchingFunctionValues( );
+
+    //! Function to retrieve the direction of the last sign change of a switching function.
+    /*!
+     * Function to retrieve the direction of the last sign change of a switching function, as bracketed by the last
+     * call to updateSwitchingFunctionValues.
+     * \param eventIndex Index of event type
+     * \return Direction of the last sign change (1 for increasing, -1 for decreasing)
+     */
+    int getLastEventDirection( const unsigned int eventIndex )
+    {
+        return lastEventDirections_.at( eventIndex );
+    }
+
+    //! Function to retrieve the settings to create root finder used to converge on the event time.
+    /*!
+     * Function to retrieve the settings to create root finder used to converge on the event time.
+     * \param eventIndex Index of event type
+     * \return Settings to create root finder used to converge on the event time.
+     */
+    boost::shared_ptr< root_finders::RootFinderSettings > getRootFinderSettings( const unsigned int eventIndex )
+    {
+        return rootFinderSettings_.at( eventIndex );
+    }
+
+    //! Function to retrieve the names of the events.
+    /*!
+     * Function to retrieve the names of the events.
+     * \return Names of the events.
+     */
+    std::vector< std::string > getEventNames( )
+    {
+        return eventNames_;
+    }
+
+    //! Function to retrieve the log of detected events.
+    /*!
+     * Function to retrieve the log of detected events.
+     * \return Log of detected events.
+     */
+    boost::shared_ptr< PropagationEventLog > getEventLog( )
+    {
+        return eventLog_;
+    }
+
+private:
+
+    //! List of switching functions, an event occurs when one of these changes sign
+    std::vector< boost::function< double( ) > > switchingFunctions_;
+
+    //! List of directions of the sign changes that are detected (per switching function)
+    std::vector< PropagationEventDirection > eventDirections_;
+
+    //! List of names of the events (per switching function)
+    std::vector< std::string > eventNames_;
+
+    //! Settings to create root finder used to converge on the event time (per switching function)
+    std::vector< boost::shared_ptr< root_finders::RootFinderSettings > > rootFinderSettings_;
+
+    //! Values of the switching functions at the end of the last integration step.
+    std::vector< double > lastSwitchingFunctionValues_;
+
+    //! Directions of the last sign changes of the switching functions (1 for increasing, -1 for decreasing, 0 if none).
+    std::vector< int > lastEventDirections_;
+
+    //! Log of detected events.
+    boost::shared_ptr< PropagationEventLog > eventLog_;
+};
+
 //! Base class for checking whether the numerical propagation is to be stopped at current time step or not
 /*!
  *  Base class for checking whether the numerical propagation is to be stopped at current time step or not. Derived
@@ -87,6 +341,26 @@ public:
         return terminateExactlyOnFinalCondition_;
     }
 
+    //! Function to set the object used to detect (and log) events during the propagation
+    /*!
+     *  Function to set the object used to detect (and log) events during the propagation
+     *  \param eventDetector Object used to detect (and log) events during the propagation
+     */
+    void setEventDetector( const boost::shared_ptr< PropagationEventDetector > eventDetector )
+    {
+        eventDetector_ = eventDetector;
+    }
+
+    //! Function to retrieve the object used to detect (and log) events during the propagation
+    /*!
+     *  Function to retrieve the object used to detect (and log) events during the propagation
+     *  \return Object used to detect (and log) events during the propagation (NULL if no events are detected).
+     */
+    boost::shared_ptr< PropagationEventDetector > getEventDetector( )
+    {
+        return eventDetector_;
+    }
+
 protected:
 
     //! Type of termination condition
@@ -96,6 +370,9 @@ protected:
     //! on the first step where it is violated.
     bool terminateExactlyOnFinalCondition_;
 
+    //! Object used to detect (and log) events during the propagation (NULL if no events are detected).
+    boost::shared_ptr< PropagationEventDetector > eventDetector_;
+
 };
 
 //! Class for stopping the propagation after a fixed amount of time (i.e. for certain independent variable value)
@@ -198,6 +475,8 @@ public:
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputToFindFinalCondition Boolean denoting whether the root finder used to converge on the exact
+     * final condition is to evaluate the dependent variable on the dense output of the integrator (if available).
      */
     SingleVariableLimitPropagationTerminationCondition(
             const boost::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
@@ -205,12 +484,14 @@ public:
             const double limitingValue,
             const bool useAsLowerBound,
             const bool terminateExactlyOnFinalCondition = false,
-            const boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = NULL ):
+            const boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = NULL,
+            const bool useDenseOutputToFindFinalCondition = false ):
         PropagationTerminationCondition(
             dependent_variable_stopping_condition, terminateExactlyOnFinalCondition ),
         dependentVariableSettings_( dependentVariableSettings ), variableRetrievalFuntion_( variableRetrievalFuntion ),
         limitingValue_( limitingValue ), useAsLowerBound_( useAsLowerBound ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ),
+        useDenseOutputToFindFinalCondition_( useDenseOutputToFindFinalCondition )
     {
         if( ( terminateExactlyOnFinalCondition == false ) && ( terminationRootFinderSettings != NULL ) )
         {
@@ -255,6 +536,17 @@ public:
         return terminationRootFinderSettings_;
     }
 
+    //! Function to retrieve whether the dense output of the integrator is to be used to converge on exact final condition.
+    /*!
+     *  Function to retrieve whether the dense output of the integrator is to be used to converge on exact final condition.
+     *  \return Boolean denoting whether the dense output of the integrator is to be used to converge on exact final
+     *  condition.
+     */
+    bool getUseDenseOutputToFindFinalCondition( )
+    {
+        return useDenseOutputToFindFinalCondition_;
+    }
+
 private:
 
     //! Settings for dependent variable that is to be checked
@@ -272,6 +564,9 @@ private:
 
     //! Settings to create root finder used to converge on exact final condition.
     boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the dense output of the integrator is to be used to converge on exact final condition.
+    bool useDenseOutputToFindFinalCondition_;
 };
 
 //! Class for stopping the propagation when one or all of a given set of stopping conditions is reached.
@@ -349,6 +644,29 @@ private:
     std::vector< bool > isConditionMetWhenStopping_;
 };
 
+//! Function to compute the switching function of a propagation event defined by a dependent variable
+/*!
+ * Function to compute the switching function of a propagation event defined by a dependent variable, as the difference
+ * between the dependent variable and the threshold value.
+ * \param dependentVariableFunction Function returning the dependent variable.
+ * \param thresholdValue Value of the dependent variable at which the event occurs
+ * \return Current value of the switching function
+ */
+double computeDependentVariableSwitchingFunction(
+        const boost::function< double( ) > dependentVariableFunction,
+        const double thresholdValue );
+
+//! Function to create an object to detect propagation events from associated settings
+/*!
+ * Function to create an object to detect propagation events from associated settings
+ * \param eventSettings List of settings for the propagation events
+ * \param bodyMap List of body objects that contains all environment models
+ * \return Object used to detect (and log) the propagation events
+ */
+boost::shared_ptr< PropagationEventDetector > createPropagationEventDetector(
+        const std::vector< boost::shared_ptr< PropagationEventSettings > >& eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap );
+
 //! Function to create propagation termination conditions from associated settings
 /*!
  * Function to create propagation termination conditions from associated settings
@@ -397,6 +715,31 @@ public:
     {
         return terminationOnExactCondition_;
     }
+
+    //! Function to set the numbers (in the event log) of the propagation events that could not be located exactly.
+    /*!
+     * Function to set the numbers (in the event log) of the propagation events for which the root finder did not
+     * converge, and which are therefore logged at the end of the integration step in which they occurred.
+     * \param unconvergedPropagationEventNumbers Numbers (in the event log) of the propagation events that could not be
+     * located exactly.
+     */
+    void setUnconvergedPropagationEventNumbers( const std::vector< unsigned int >& unconvergedPropagationEventNumbers )
+    {
+        unconvergedPropagationEventNumbers_ = unconvergedPropagationEventNumbers;
+    }
+
+    //! Function to retrieve the numbers (in the event log) of the propagation events that could not be located exactly.
+    /*!
+     * Function to retrieve the numbers (in the event log) of the propagation events for which the root finder did not
+     * converge, and which are therefore logged at the end of the integration step in which they occurred.
+     * \return Numbers (in the event log) of the propagation events that could not be located exactly (empty if all
+     * events were located, or if no events are detected).
+     */
+    std::vector< unsigned int > getUnconvergedPropagationEventNumbers( )
+    {
+        return unconvergedPropagationEventNumbers_;
+    }
+
 protected:
 
     //! Reason for termination
@@ -408,6 +751,9 @@ protected:
      *  false if not, -1 if neither is relevant.
      */
     bool terminationOnExactCondition_;
+
+    //! Numbers (in the event log) of the propagation events for which the root finder did not converge.
+    std::vector< unsigned int > unconvergedPropagationEventNumbers_;
 };
 
 //! Class for storing details on the propagation termination when using hybrid termination conditions
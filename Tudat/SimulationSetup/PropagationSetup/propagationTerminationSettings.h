@@ -11,8 +11,11 @@
 #ifndef TUDAT_PROPAGATIONTERMINATIONSETTINGS_H
 #define TUDAT_PROPAGATIONTERMINATIONSETTINGS_H
 
+#include <string>
 #include <vector>
 
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Mathematics/RootFinders/createRootFinder.h"
@@ -34,6 +37,110 @@ enum PropagationTerminationTypes
     hybrid_stopping_condition
 };
 
+//! Enum listing the directions of a sign change of a switching function for which a propagation event is detected.
+enum PropagationEventDirection
+{
+    any_event_direction,
+    increasing_event_direction,
+    decreasing_event_direction
+};
+
+//! Class for defining a propagation event, which is detected and logged during the propagation (without terminating it).
+/*!
+ *  Class for defining a propagation event, which is detected and logged during the propagation (without terminating
+ *  it). An event occurs when a switching function changes sign, for instance the z-component of the position for node
+ *  crossings, the radial velocity for periapsis/apoapsis passages, or the received irradiance minus a threshold value
+ *  for eclipse entry/exit. The switching function is evaluated after the environment has been updated to the current
+ *  state, and is defined either from a (scalar) dependent variable minus a threshold value, or by a custom function.
+ *  The time at which the event occurs is found by a root finder, which evaluates the switching function at
+ *  interpolated states in the integration step in which the sign change occurred.
+ */
+class PropagationEventSettings
+{
+public:
+
+    //! Constructor for an event defined by a dependent variable reaching a threshold value
+    /*!
+     * Constructor for an event defined by a dependent variable reaching a threshold value
+     * \param eventName Name of the event, used to identify it in the event log
+     * \param dependentVariableSettings Settings for (scalar) dependent variable defining the switching function
+     * \param thresholdValue Value of the dependent variable at which the event occurs
+     * \param eventDirection Direction of the sign change of dependent variable minus threshold value that is detected
+     * \param rootFinderSettings Settings to create root finder used to converge on the event time (bisection with
+     * relative tolerance of 1.0E-12 by default)
+     */
+    PropagationEventSettings(
+            const std::string& eventName,
+            const boost::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+            const double thresholdValue = 0.0,
+            const PropagationEventDirection eventDirection = any_event_direction,
+            const boost::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings = NULL ):
+        eventName_( eventName ), dependentVariableSettings_( dependentVariableSettings ),
+        thresholdValue_( thresholdValue ), eventDirection_( eventDirection ),
+        rootFinderSettings_( rootFinderSettings )
+    {
+        setRootFinderSettings( );
+    }
+
+    //! Constructor for an event defined by a custom switching function
+    /*!
+     * Constructor for an event defined by a custom switching function
+     * \param eventName Name of the event, used to identify it in the event log
+     * \param customSwitchingFunction Function returning the switching function, the event occurs when it changes sign
+     * \param eventDirection Direction of the sign change of the switching function that is detected
+     * \param rootFinderSettings Settings to create root finder used to converge on the event time (bisection with
+     * relative tolerance of 1.0E-12 by default)
+     */
+    PropagationEventSettings(
+            const std::string& eventName,
+            const boost::function< double( ) > customSwitchingFunction,
+            const PropagationEventDirection eventDirection = any_event_direction,
+            const boost::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings = NULL ):
+        eventName_( eventName ), thresholdValue_( 0.0 ), customSwitchingFunction_( customSwitchingFunction ),
+        eventDirection_( eventDirection ), rootFinderSettings_( rootFinderSettings )
+    {
+        setRootFinderSettings( );
+    }
+
+    //! Destructor
+    ~PropagationEventSettings( ){ }
+
+    //! Name of the event, used to identify it in the event log
+    std::string eventName_;
+
+    //! Settings for (scalar) dependent variable defining the switching function (NULL if custom function is used)
+    boost::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings_;
+
+    //! Value of the dependent variable at which the event occurs
+    double thresholdValue_;
+
+    //! Function returning the switching function (empty if dependent variable is used)
+    boost::function< double( ) > customSwitchingFunction_;
+
+    //! Direction of the sign change of the switching function that is detected
+    PropagationEventDirection eventDirection_;
+
+    //! Settings to create root finder used to converge on the event time.
+    boost::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings_;
+
+private:
+
+    //! Function to set the default root finder settings (if none are provided), and check the provided settings.
+    void setRootFinderSettings( )
+    {
+        if( rootFinderSettings_ == NULL )
+        {
+            rootFinderSettings_ = boost::make_shared< root_finders::RootFinderSettings >(
+                        root_finders::bisection_root_finder, 1.0E-12, 100 );
+        }
+        else if( root_finders::doesRootFinderRequireDerivatives( rootFinderSettings_ ) )
+        {
+            throw std::runtime_error( "Error when setting propagation event " + eventName_ +
+                                      ", requested root finder requires derivatives; not available for switching function" );
+        }
+    }
+};
+
 
 //! Base class for defining propagation termination settings.
 /*!
@@ -64,6 +171,10 @@ public:
     //! Boolean to denote whether the propagation is to terminate exactly on the final condition, or whether it is to terminate
     //! on the first step where it is violated.
     bool terminateExactlyOnFinalCondition_;
+
+    //! List of events that are to be detected and logged during the propagation (without terminating it).
+    //! Only used for the top-level termination settings (i.e. not for the constituents of hybrid settings).
+    std::vector< boost::shared_ptr< PropagationEventSettings > > eventSettings_;
 };
 
 //! Class for propagation stopping conditions settings: stopping the propagation after a fixed amount of time
@@ -141,18 +252,24 @@ public:
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputToFindFinalCondition Boolean denoting whether the root finder used to converge on the exact
+     * final condition is to evaluate the dependent variable on the dense output of the integrator (if available), instead
+     * of re-integrating the last step for each iteration. This is (much) faster, but the accuracy of the final condition is
+     * then limited by that of the (cubic Hermite) dense output.
      */
     PropagationDependentVariableTerminationSettings(
             const boost::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
             const double limitValue,
             const bool useAsLowerLimit,
             const bool terminateExactlyOnFinalCondition = false,
-            const boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = NULL ):
+            const boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = NULL,
+            const bool useDenseOutputToFindFinalCondition = false ):
         PropagationTerminationSettings(
             dependent_variable_stopping_condition, terminateExactlyOnFinalCondition ),
         dependentVariableSettings_( dependentVariableSettings ),
         limitValue_( limitValue ), useAsLowerLimit_( useAsLowerLimit ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ),
+        useDenseOutputToFindFinalCondition_( useDenseOutputToFindFinalCondition )
     {
         if( terminateExactlyOnFinalCondition_ && ( terminationRootFinderSettings_ == NULL ) )
         {
@@ -175,6 +292,9 @@ public:
 
     //! Settings to create root finder used to converge on exact final condition.
     boost::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the dense output of the integrator is to be used to converge on exact final condition.
+    bool useDenseOutputToFindFinalCondition_;
 };
 
 //! Class for propagation stopping conditions settings: combination of other stopping conditions.
@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryGravityFieldFile.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_binary_gravity_field_file )
+
+//! Test whether coefficients read from a converted binary file are identical to those read from the text file.
+BOOST_AUTO_TEST_CASE( testBinaryGravityFieldFileConversion )
+{
+    const std::string gravityFieldFile = input_output::getGravityModelsPath( ) + "Earth/egm96.txt";
+    const boost::filesystem::path testDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    boost::filesystem::create_directories( testDirectory );
+    const std::string binaryFile = ( testDirectory / "egm96BinaryGravityFieldFileTest.bin" ).string( );
+    BOOST_CHECK_EQUAL( convertGravityFieldFileToBinary( gravityFieldFile, 0, 1, binaryFile ), binaryFile );
+
+    input_output::BinaryGravityFieldFile binaryGravityField( binaryFile );
+    BOOST_CHECK_EQUAL( binaryGravityField.getMaximumDegree( ), 360 );
+    BOOST_CHECK_EQUAL( binaryGravityField.getMaximumOrder( ), 360 );
+    BOOST_CHECK( binaryGravityField.areCoefficientsNormalized( ) );
+    BOOST_CHECK( binaryGravityField.isCreatedFromFile( gravityFieldFile ) );
+
+    // Compare with text file for several truncations, including order larger than degree.
+    const int maximumDegrees[ 4 ] = { 0, 50, 120, 360 };
+    const int maximumOrders[ 4 ] = { 0, 50, 30, 400 };
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > expectedCoefficients;
+        std::pair< double, double > expectedReferenceData = readGravityFieldFile(
+                    gravityFieldFile, maximumDegrees[ i ], maximumOrders[ i ], expectedCoefficients, 0, 1 );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients =
+                binaryGravityField.getCoefficients( maximumDegrees[ i ], maximumOrders[ i ] );
+
+        BOOST_CHECK_EQUAL( binaryGravityField.getGravitationalParameter( ), expectedReferenceData.first );
+        BOOST_CHECK_EQUAL( binaryGravityField.getReferenceRadius( ), expectedReferenceData.second );
+        BOOST_CHECK( coefficients.first == expectedCoefficients.first );
+        BOOST_CHECK( coefficients.second == expectedCoefficients.second );
+    }
+    BOOST_CHECK_THROW( binaryGravityField.getCoefficients( 361, 0 ), std::runtime_error );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+//! Test whether a binary sibling of a gravity field file is used (only) when it is valid.
+BOOST_AUTO_TEST_CASE( testBinaryGravityFieldFileLoading )
+{
+    // Write all files to a unique temporary directory, which is removed at the end of the test.
+    const boost::filesystem::path testDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    boost::filesystem::create_directories( testDirectory );
+    const std::string gravityFieldFile = ( testDirectory / "binaryGravityFieldFileTest.txt" ).string( );
+    const std::string binaryFile = input_output::getBinaryGravityFieldFilePath( gravityFieldFile );
+    {
+        std::ofstream fileStream( gravityFieldFile.c_str( ) );
+        fileStream << "4.0E14, 6.4E6" << std::endl
+                   << "2, 0, -4.8E-4, 0.0" << std::endl
+                   << "2, 2, 2.4E-6, -1.4E-6" << std::endl
+                   << "3, 1, 2.0E-6, 2.5E-7" << std::endl;
+    }
+
+    // Write binary file with different (unnormalized) coefficients, to check from which file the settings are loaded.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 4, 2 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 4, 2 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -1.0E-3;
+    cosineCoefficients( 3, 1 ) = 3.0E-6;
+    sineCoefficients( 3, 1 ) = 4.0E-7;
+    input_output::writeBinaryGravityFieldFile(
+                binaryFile, 3.0E14, 6.0E6, cosineCoefficients, sineCoefficients, false, 0, 1, gravityFieldFile );
+
+    boost::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > gravityFieldSettings =
+            boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 1, 0, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 3.0E14 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getReferenceRadius( ), 6.0E6 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getCosineCoefficients( ).rows( ), 4 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getCosineCoefficients( ).cols( ), 2 );
+    BOOST_CHECK_CLOSE_FRACTION(
+                gravityFieldSettings->getCosineCoefficients( )( 2, 0 ),
+                -1.0E-3 / basic_mathematics::calculateLegendreGeodesyNormalizationFactor( 2, 0 ),
+                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION(
+                gravityFieldSettings->getSineCoefficients( )( 3, 1 ),
+                4.0E-7 / basic_mathematics::calculateLegendreGeodesyNormalizationFactor( 3, 1 ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that text file is used if binary file does not contain requested degree, or has different header indices.
+    gravityFieldSettings = boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 2, 0, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 4.0E14 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getCosineCoefficients( )( 2, 2 ), 2.4E-6 );
+
+    gravityFieldSettings = boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 1, 1, 0 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 6.4E6 );
+
+    // Check that converted binary file gives identical settings as the text file.
+    convertGravityFieldFileToBinary( gravityFieldFile, 0, 1 );
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > expectedCoefficients;
+    readGravityFieldFile( gravityFieldFile, 3, 3, expectedCoefficients, 0, 1 );
+    gravityFieldSettings = boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 3, 0, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 4.0E14 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getReferenceRadius( ), 6.4E6 );
+    BOOST_CHECK( gravityFieldSettings->getCosineCoefficients( ) == expectedCoefficients.first );
+    BOOST_CHECK( gravityFieldSettings->getSineCoefficients( ) == expectedCoefficients.second );
+
+    // Check that outdated binary file is not used.
+    input_output::writeBinaryGravityFieldFile(
+                binaryFile, 3.0E14, 6.0E6, cosineCoefficients, sineCoefficients, true, 0, 1, gravityFieldFile );
+    {
+        std::ofstream fileStream( gravityFieldFile.c_str( ), std::ios::app );
+        fileStream << "3, 3, 1.0E-6, 1.0E-6" << std::endl;
+    }
+    gravityFieldSettings = boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 1, 0, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 4.0E14 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getCosineCoefficients( )( 3, 1 ), 2.0E-6 );
+
+    // Check that invalid binary file is rejected.
+    {
+        std::ofstream fileStream( binaryFile.c_str( ) );
+        fileStream << "Not a binary gravity field file" << std::endl;
+    }
+    BOOST_CHECK_THROW( input_output::BinaryGravityFieldFile binaryGravityField( binaryFile ), std::runtime_error );
+    gravityFieldSettings = boost::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >(
+                gravityFieldFile, "IAU_Earth", 3, 1, 0, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldSettings->getGravitationalParameter( ), 4.0E14 );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
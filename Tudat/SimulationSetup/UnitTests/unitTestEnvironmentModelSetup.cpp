@@ -11,6 +11,7 @@
 #define BOOST_TEST_MAIN
 
 #include <limits>
+#include <thread>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
@@ -22,7 +23,9 @@
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00SurrogateAtmosphere.h"
 #endif
+#include "Tudat/Astrodynamics/Aerodynamics/fusedTabulatedAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -47,6 +50,9 @@
 #include "Tudat/InputOutput/parseSolarActivityData.h"
 #include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/copyBodies.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAtmosphereModel.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createEphemeris.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
@@ -114,6 +120,20 @@ BOOST_AUTO_TEST_CASE( test_atmosphereModelSetup )
     BOOST_CHECK_EQUAL( manualExponentialAtmosphere.getTemperature( 32.0, 0.0, 0.0, 0.0 ),
                        exponentialAtmosphere->getTemperature( 32.0, 0.0, 0.0, 0.0 ) );
 
+    // Create fused tabulated atmosphere using setup function, and compare with tabulated atmosphere.
+    boost::shared_ptr< aerodynamics::AtmosphereModel > fusedTabulatedAtmosphere =
+            createAtmosphereModel( boost::make_shared< FusedTabulatedAtmosphereSettings >(
+                                       input_output::getAtmosphereTablesPath( ) +
+                                       "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat" ), "Earth" );
+    BOOST_CHECK( boost::dynamic_pointer_cast< aerodynamics::FusedTabulatedAtmosphere >( fusedTabulatedAtmosphere ) !=
+                 NULL );
+    BOOST_CHECK_CLOSE_FRACTION( manualTabulatedAtmosphere.getDensity( 32.0, 0.0, 0.0, 0.0 ),
+                                fusedTabulatedAtmosphere->getDensity( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( manualTabulatedAtmosphere.getPressure( 32.0, 0.0, 0.0, 0.0 ),
+                                fusedTabulatedAtmosphere->getPressure( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( manualTabulatedAtmosphere.getTemperature( 32.0, 0.0, 0.0, 0.0 ),
+                                fusedTabulatedAtmosphere->getTemperature( 32.0, 0.0, 0.0, 0.0 ), 1.0E-12 );
+
 #if USE_NRLMSISE00
     boost::shared_ptr< AtmosphereSettings > nrlmsise00AtmosphereSettings;
     for( int atmosphereTest = 0; atmosphereTest < 2; atmosphereTest++ )
@@ -148,6 +168,28 @@ BOOST_AUTO_TEST_CASE( test_atmosphereModelSetup )
         BOOST_CHECK_SMALL( nrlMSISE00Input.f107a - 93.3, 1.0E-14 );
         BOOST_CHECK_SMALL( nrlMSISE00Input.apDaily - 9.0, 1.0E-14 );
     }
+
+    // Create NRLMSISE00 surrogate using setup function, and compare with full model.
+    {
+        const double startTime = ( convertCalendarDateToJulianDay( 2005, 5, 3, 0, 0, 0.0 ) -
+                                   basic_astrodynamics::JULIAN_DAY_ON_J2000 ) * physical_constants::JULIAN_DAY;
+        const double maximumRelativeDensityError = 0.05;
+        boost::shared_ptr< aerodynamics::AtmosphereModel > surrogateAtmosphere =
+                createAtmosphereModel( boost::make_shared< NRLMSISE00SurrogateAtmosphereSettings >(
+                                           aerodynamics::NRLMSISE00SurrogateSettings(
+                                               startTime, startTime + 0.5 * physical_constants::JULIAN_DAY,
+                                               100.0E3, 300.0E3, 10.0E3, 15.0 * mathematical_constants::PI / 180.0,
+                                               2.0, 6.0 * 3600.0, maximumRelativeDensityError, 3, 100 ) ), "Earth" );
+        BOOST_CHECK( boost::dynamic_pointer_cast< aerodynamics::NRLMSISE00SurrogateAtmosphere >(
+                         surrogateAtmosphere ) != NULL );
+
+        boost::shared_ptr< aerodynamics::AtmosphereModel > nrlmsiseAtmosphere =
+                createAtmosphereModel( boost::make_shared< AtmosphereSettings >( nrlmsise00 ), "Earth" );
+        const double time = startTime + 0.3 * physical_constants::JULIAN_DAY;
+        BOOST_CHECK_CLOSE_FRACTION( surrogateAtmosphere->getDensity( 150.0E3, 1.0, 0.1, time ),
+                                    nrlmsiseAtmosphere->getDensity( 150.0E3, 1.0, 0.1, time ),
+                                    2.0 * maximumRelativeDensityError );
+    }
 #endif
 }
 
@@ -1070,6 +1112,246 @@ BOOST_AUTO_TEST_CASE( test_groundStationCreation )
     }
 }
 
+//! Test whether copies of a set of bodies can be evaluated concurrently, reproducing the results of the original.
+BOOST_AUTO_TEST_CASE( test_bodyMapCopyForConcurrentEvaluation )
+{
+    using namespace ephemerides;
+    using namespace gravitation;
+    using namespace aerodynamics;
+    using namespace electro_magnetism;
+    using namespace interpolators;
+
+    // Create Sun and Earth, with Earth on Kepler orbit and with spherical harmonic gravity field, rotation model and
+    // tabulated atmosphere.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Sun" ] = boost::make_shared< Body >( );
+    bodyMap[ "Sun" ]->setEphemeris( boost::make_shared< ConstantEphemeris >(
+                boost::lambda::constant( Eigen::Vector6d::Zero( ) ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Sun" ]->setGravityFieldModel( boost::make_shared< GravityFieldModel >( 1.32712440018E20 ) );
+
+    Eigen::Vector6d earthKeplerElements;
+    earthKeplerElements << 1.496E11, 0.0167, 0.01, 1.8, 2.0, 0.3;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< KeplerEphemeris >(
+                                          earthKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( boost::make_shared< SimpleRotationalEphemeris >(
+                                                    0.2, 1.2, 0.3, 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( unsigned int i = 2; i < 6; i++ )
+    {
+        for( unsigned int j = 0; j <= i; j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-6 / static_cast< double >( i + j );
+            sineCoefficients( i, j ) = ( j > 0 ) ? ( -1.0E-6 / static_cast< double >( 2 * i + j ) ) : 0.0;
+        }
+    }
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< SphericalHarmonicsGravityField >(
+                                                  3.986004418E14, 6378137.0, cosineCoefficients,
+                                                  sineCoefficients, "IAU_Earth" ) );
+    bodyMap[ "Earth" ]->setAtmosphereModel( boost::make_shared< TabulatedAtmosphere >(
+                input_output::getAtmosphereTablesPath( ) + "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat" ) );
+
+    // Create vehicle with tabulated ephemeris and radiation pressure interface.
+    std::map< double, Eigen::Vector6d > vehicleStateMap;
+    Eigen::Vector6d vehicleKeplerElements;
+    vehicleKeplerElements << 7.0E6, 0.01, 1.2, 0.3, 0.4, 0.0;
+    KeplerEphemeris vehicleKeplerEphemeris( vehicleKeplerElements, 0.0, 3.986004418E14, "Earth", "ECLIPJ2000" );
+    for( double time = -600.0; time < 1.0E4; time += 60.0 )
+    {
+        vehicleStateMap[ time ] = vehicleKeplerEphemeris.getCartesianState( time );
+    }
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris(
+                boost::make_shared< TabulatedCartesianEphemeris< > >(
+                    boost::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >( vehicleStateMap, 8 ),
+                    "Earth", "ECLIPJ2000" ) );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 400.0 );
+    bodyMap[ "Vehicle" ]->setRadiationPressureInterface(
+                "Sun", boost::make_shared< RadiationPressureInterface >(
+                    boost::lambda::constant( 3.839E26 ),
+                    boost::bind( &Body::getPosition, bodyMap.at( "Sun" ) ),
+                    boost::bind( &Body::getPosition, bodyMap.at( "Vehicle" ) ), 1.2, 4.0 ) );
+
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create copies of bodies
+    const unsigned int numberOfCopies = 4;
+    std::vector< NamedBodyMap > bodyMapCopies = copyBodyMapForConcurrentEvaluation( bodyMap, numberOfCopies );
+    BOOST_CHECK_EQUAL( bodyMapCopies.size( ), numberOfCopies );
+
+    // Check which models are shared, and which are recreated.
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        BOOST_CHECK_EQUAL( bodyMapCopies.at( i ).size( ), bodyMap.size( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Earth" ) != bodyMap.at( "Earth" ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Sun" )->getEphemeris( ) == bodyMap.at( "Sun" )->getEphemeris( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Earth" )->getEphemeris( ) == bodyMap.at( "Earth" )->getEphemeris( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Earth" )->getGravityFieldModel( ) ==
+                     bodyMap.at( "Earth" )->getGravityFieldModel( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Earth" )->getAtmosphereModel( ) ==
+                     bodyMap.at( "Earth" )->getAtmosphereModel( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Vehicle" )->getEphemeris( ) ==
+                     bodyMap.at( "Vehicle" )->getEphemeris( ) );
+        BOOST_CHECK( bodyMapCopies.at( i ).at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" ) !=
+                     bodyMap.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" ) );
+        BOOST_CHECK_EQUAL( bodyMapCopies.at( i ).at( "Vehicle" )->getBodyMass( ), 400.0 );
+    }
+
+    // Define function evaluating environment at a list of times
+    std::vector< double > evaluationTimes;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        evaluationTimes.push_back( 3600.0 + 53.0 * static_cast< double >( i ) );
+    }
+    auto evaluateEnvironment = [ & ]( const NamedBodyMap& currentBodyMap, std::vector< Eigen::VectorXd >& results )
+    {
+        results.clear( );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            double currentTime = evaluationTimes.at( i );
+            currentBodyMap.at( "Sun" )->setStateFromEphemeris( currentTime );
+            currentBodyMap.at( "Earth" )->setStateFromEphemeris( currentTime );
+            currentBodyMap.at( "Vehicle" )->setStateFromEphemeris( currentTime );
+            currentBodyMap.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( currentTime );
+            currentBodyMap.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" )->updateInterface(
+                        currentTime );
+
+            Eigen::Vector3d bodyFixedPosition = currentBodyMap.at( "Earth" )->getCurrentRotationToLocalFrame( ) *
+                    ( currentBodyMap.at( "Vehicle" )->getPosition( ) - currentBodyMap.at( "Earth" )->getPosition( ) );
+
+            Eigen::VectorXd currentResult = Eigen::VectorXd::Zero( 12 );
+            currentResult.segment( 0, 6 ) = currentBodyMap.at( "Vehicle" )->getState( );
+            currentResult.segment( 6, 3 ) =
+                    currentBodyMap.at( "Earth" )->getGravityFieldModel( )->getGradientOfPotential( bodyFixedPosition );
+            currentResult( 9 ) = currentBodyMap.at( "Earth" )->getAtmosphereModel( )->getDensity(
+                        bodyFixedPosition.norm( ) - 6378137.0, 0.0, 0.0, currentTime );
+            currentResult( 10 ) = currentBodyMap.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" )->
+                    getCurrentRadiationPressure( );
+            currentResult( 11 ) = currentBodyMap.at( "Earth" )->getState( )( 0 );
+            results.push_back( currentResult );
+        }
+    };
+
+    // Evaluate environment sequentially on original bodies, and concurrently on copies
+    std::vector< Eigen::VectorXd > expectedResults;
+    evaluateEnvironment( bodyMap, expectedResults );
+
+    std::vector< std::vector< Eigen::VectorXd > > concurrentResults( numberOfCopies );
+    std::vector< std::thread > threads;
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        threads.push_back( std::thread( evaluateEnvironment, std::cref( bodyMapCopies.at( i ) ),
+                                        std::ref( concurrentResults.at( i ) ) ) );
+    }
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    // Check that results are identical
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        BOOST_CHECK_EQUAL( concurrentResults.at( i ).size( ), expectedResults.size( ) );
+        for( unsigned int j = 0; j < expectedResults.size( ); j++ )
+        {
+            for( unsigned int k = 0; k < 12; k++ )
+            {
+                BOOST_CHECK_EQUAL( concurrentResults.at( i ).at( j )( k ), expectedResults.at( j )( k ) );
+            }
+        }
+    }
+
+#if USE_SOFA
+    // Check copy of GCRS<->ITRS rotation model, which has its own time scale converter and short-period corrections,
+    // and shares the daily IERS corrections and precession-nutation model with the original.
+    bodyMap[ "Earth" ]->setRotationalEphemeris(
+                createRotationModel( boost::make_shared< GcrsToItrsRotationModelSettings >( ), "Earth" ) );
+    bodyMapCopies = copyBodyMapForConcurrentEvaluation( bodyMap, numberOfCopies );
+
+    boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            boost::dynamic_pointer_cast< GcrsToItrsRotationModel >(
+                bodyMap.at( "Earth" )->getRotationalEphemeris( ) )->getAnglesCalculator( );
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        boost::shared_ptr< GcrsToItrsRotationModel > rotationModelCopy =
+                boost::dynamic_pointer_cast< GcrsToItrsRotationModel >(
+                    bodyMapCopies.at( i ).at( "Earth" )->getRotationalEphemeris( ) );
+        BOOST_CHECK( rotationModelCopy != NULL );
+        BOOST_CHECK( rotationModelCopy != bodyMap.at( "Earth" )->getRotationalEphemeris( ) );
+
+        boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculatorCopy =
+                rotationModelCopy->getAnglesCalculator( );
+        BOOST_CHECK( earthOrientationCalculatorCopy->getTerrestrialTimeScaleConverter( ) !=
+                     earthOrientationCalculator->getTerrestrialTimeScaleConverter( ) );
+        BOOST_CHECK( earthOrientationCalculatorCopy->getPolarMotionCalculator( ) !=
+                     earthOrientationCalculator->getPolarMotionCalculator( ) );
+        BOOST_CHECK( earthOrientationCalculatorCopy->getPolarMotionCalculator( )->getDailyIersValueInterpolator( ) ==
+                     earthOrientationCalculator->getPolarMotionCalculator( )->getDailyIersValueInterpolator( ) );
+        BOOST_CHECK( earthOrientationCalculatorCopy->getPrecessionNutationCalculator( ) ==
+                     earthOrientationCalculator->getPrecessionNutationCalculator( ) );
+    }
+
+    // Evaluate rotation sequentially on original bodies, and concurrently on copies
+    auto evaluateEarthRotation = [ & ]( const NamedBodyMap& currentBodyMap, std::vector< Eigen::Matrix3d >& results )
+    {
+        results.clear( );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            currentBodyMap.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris(
+                        1.0E8 + 100.0 * evaluationTimes.at( i ) );
+            results.push_back( currentBodyMap.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( ) );
+        }
+    };
+
+    std::vector< Eigen::Matrix3d > expectedRotations;
+    evaluateEarthRotation( bodyMap, expectedRotations );
+
+    std::vector< std::vector< Eigen::Matrix3d > > concurrentRotations( numberOfCopies );
+    threads.clear( );
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        threads.push_back( std::thread( evaluateEarthRotation, std::cref( bodyMapCopies.at( i ) ),
+                                        std::ref( concurrentRotations.at( i ) ) ) );
+    }
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    for( unsigned int i = 0; i < numberOfCopies; i++ )
+    {
+        BOOST_CHECK_EQUAL( concurrentRotations.at( i ).size( ), expectedRotations.size( ) );
+        for( unsigned int j = 0; j < expectedRotations.size( ); j++ )
+        {
+            BOOST_CHECK( concurrentRotations.at( i ).at( j ) == expectedRotations.at( j ) );
+        }
+    }
+#endif
+
+    // Check that bodies with models that cannot be copied safely are rejected.
+    bodyMap[ "Vehicle" ]->setRadiationPressureInterface(
+                "Sun", boost::make_shared< RadiationPressureInterface >(
+                    boost::lambda::constant( 3.839E26 ),
+                    boost::bind( &Body::getPosition, bodyMap.at( "Sun" ) ),
+                    boost::bind( &Body::getPosition, bodyMap.at( "Vehicle" ) ), 1.2, 4.0,
+                    std::vector< boost::function< Eigen::Vector3d( ) > >(
+                        1, boost::bind( &Body::getPosition, bodyMap.at( "Earth" ) ) ),
+                    std::vector< double >( 1, 6378137.0 ), 6.96E8 ) );
+    bool isExceptionCaught = false;
+    try
+    {
+        copyBodyMapForConcurrentEvaluation( bodyMap );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests